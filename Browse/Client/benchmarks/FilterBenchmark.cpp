@@ -0,0 +1,344 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Replays a labeled gaze trace through every filter type and reports:
+//  lag: time the filtered gaze needs longer than the raw gaze to get within
+//   the fixation radius of the next fixation after saccade onset
+//  jitter: RMS distance of filtered gaze from its mean within fixations,
+//   after the first 150 ms of each fixation
+//  overshoot: how far the filtered gaze goes beyond the next fixation, along
+//   the direction of the saccade
+//  update: cost of one filter update with one new sample
+// A trace has one sample per line: "time_in_ms x y label", with label F for
+// fixation and S for saccade. Without trace, a synthetic one is generated with
+// fixations on random targets, Gaussian noise and minimum jerk saccades.
+//
+// Usage: FilterBenchmark [-file trace.txt] [-write trace.txt] [-rate 60] [-noise 10] [-seconds 120]
+
+#include "src/Input/Filters/FilterFactory.h"
+#include "src/Setup.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+// Time after fixation onset which is not used for jitter
+const double JITTER_SETTLE_TIME = 0.15;
+
+// Time after saccade which is searched for overshoot
+const double OVERSHOOT_TIME = 0.3;
+
+// Options given by command line
+struct Options
+{
+	std::string file = "";
+	std::string write = "";
+	double rate = 60; // samples per second of synthetic trace
+	double noise = 10; // standard deviation of noise of synthetic trace, in pixels
+	double seconds = 120; // duration of synthetic trace
+};
+
+// Labeled sample of trace
+struct TraceSample
+{
+	double time; // seconds
+	double x;
+	double y;
+	bool saccade;
+};
+
+// Continuous run of samples with same label
+struct Segment
+{
+	int begin; // index of first sample
+	int end; // index after last sample
+	bool saccade;
+	double meanX = 0; // mean of raw samples
+	double meanY = 0;
+};
+
+// Metrics of one filter
+struct Metrics
+{
+	std::vector<double> lags; // seconds
+	std::vector<double> overshoots; // pixels
+	double jitterSquareSum = 0;
+	int jitterCount = 0;
+	double updateTime = 0; // seconds per update
+};
+
+// Load trace from file
+std::vector<TraceSample> LoadTrace(const std::string& rFile)
+{
+	std::vector<TraceSample> trace;
+	std::ifstream stream(rFile);
+	std::string line;
+	while (std::getline(stream, line))
+	{
+		if (line.empty() || line[0] == '#') { continue; }
+		std::istringstream lineStream(line);
+		double time = 0;
+		TraceSample sample;
+		std::string label;
+		if (lineStream >> time >> sample.x >> sample.y >> label)
+		{
+			sample.time = time / 1000.0;
+			sample.saccade = label == "S";
+			trace.push_back(sample);
+		}
+	}
+	return trace;
+}
+
+// Generate trace with fixations on random targets, separated by saccades
+std::vector<TraceSample> GenerateTrace(const Options& rOptions)
+{
+	std::vector<TraceSample> trace;
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<double> targetX(100, 1820);
+	std::uniform_real_distribution<double> targetY(100, 980);
+	std::uniform_real_distribution<double> fixationDuration(0.2, 0.6);
+	std::normal_distribution<double> noise(0, rOptions.noise);
+	double fromX = targetX(generator), fromY = targetY(generator);
+	double interval = 1.0 / rOptions.rate;
+	double time = 0;
+	while (time < rOptions.seconds)
+	{
+		// Fixation
+		double fixationEnd = time + fixationDuration(generator);
+		for (; time < fixationEnd; time += interval)
+		{
+			trace.push_back({ time, fromX + noise(generator), fromY + noise(generator), false });
+		}
+
+		// Saccade with duration of main sequence, assuming 40 pixels per degree
+		double toX = targetX(generator), toY = targetY(generator);
+		double amplitude = std::sqrt((toX - fromX) * (toX - fromX) + (toY - fromY) * (toY - fromY));
+		double saccadeStart = time;
+		double saccadeDuration = 0.021 + 0.0022 * amplitude / 40.0;
+		for (; time < saccadeStart + saccadeDuration; time += interval)
+		{
+			double t = (time - saccadeStart) / saccadeDuration;
+			double progress = t * t * t * (10.0 - 15.0 * t + 6.0 * t * t); // minimum jerk
+			trace.push_back({ time,
+				fromX + progress * (toX - fromX) + noise(generator),
+				fromY + progress * (toY - fromY) + noise(generator),
+				true });
+		}
+		fromX = toX;
+		fromY = toY;
+	}
+	return trace;
+}
+
+// Split trace into segments of fixations and saccades
+std::vector<Segment> SplitIntoSegments(const std::vector<TraceSample>& rTrace)
+{
+	std::vector<Segment> segments;
+	for (int i = 0; i < (int)rTrace.size(); i++)
+	{
+		if (segments.empty() || segments.back().saccade != rTrace[i].saccade)
+		{
+			Segment segment;
+			segment.begin = i;
+			segment.saccade = rTrace[i].saccade;
+			segments.push_back(segment);
+		}
+		Segment& rSegment = segments.back();
+		rSegment.end = i + 1;
+		rSegment.meanX += rTrace[i].x;
+		rSegment.meanY += rTrace[i].y;
+	}
+	for (auto& rSegment : segments)
+	{
+		rSegment.meanX /= rSegment.end - rSegment.begin;
+		rSegment.meanY /= rSegment.end - rSegment.begin;
+	}
+	return segments;
+}
+
+// Time after given index when gaze gets within radius of target, interpolated between samples. Negative if never
+double ReachTime(const std::vector<TraceSample>& rTrace, const std::vector<double>& rX, const std::vector<double>& rY,
+	int begin, int end, double targetX, double targetY)
+{
+	const double radius = (double)setup::FILTER_GAZE_FIXATION_PIXEL_RADIUS;
+	double previousDistance = -1;
+	for (int i = begin; i < end; i++)
+	{
+		double distance = std::sqrt((rX[i] - targetX) * (rX[i] - targetX) + (rY[i] - targetY) * (rY[i] - targetY));
+		if (distance <= radius)
+		{
+			if (previousDistance < 0) { return rTrace[i].time; }
+			double t = (previousDistance - radius) / (previousDistance - distance);
+			return rTrace[i - 1].time + t * (rTrace[i].time - rTrace[i - 1].time);
+		}
+		previousDistance = distance;
+	}
+	return -1;
+}
+
+// Compute metrics of gaze after each sample
+void Evaluate(const std::vector<TraceSample>& rTrace, const std::vector<Segment>& rSegments,
+	const std::vector<double>& rRawX, const std::vector<double>& rRawY,
+	const std::vector<double>& rX, const std::vector<double>& rY, Metrics& rMetrics)
+{
+	for (int s = 0; s < (int)rSegments.size(); s++)
+	{
+		const Segment& rSegment = rSegments[s];
+		if (!rSegment.saccade)
+		{
+			// Jitter around mean of filtered gaze in fixation, after filter has settled
+			double settled = rTrace[rSegment.begin].time + JITTER_SETTLE_TIME;
+			double sumX = 0, sumY = 0;
+			int count = 0;
+			for (int i = rSegment.begin; i < rSegment.end; i++)
+			{
+				if (rTrace[i].time < settled) { continue; }
+				sumX += rX[i];
+				sumY += rY[i];
+				count++;
+			}
+			if (count < 3) { continue; }
+			double meanX = sumX / count, meanY = sumY / count;
+			for (int i = rSegment.begin; i < rSegment.end; i++)
+			{
+				if (rTrace[i].time < settled) { continue; }
+				rMetrics.jitterSquareSum += (rX[i] - meanX) * (rX[i] - meanX) + (rY[i] - meanY) * (rY[i] - meanY);
+				rMetrics.jitterCount++;
+			}
+		}
+		else if (s > 0 && s + 1 < (int)rSegments.size())
+		{
+			// Saccade from previous to next fixation
+			const Segment& rFrom = rSegments[s - 1];
+			const Segment& rTo = rSegments[s + 1];
+			double directionX = rTo.meanX - rFrom.meanX, directionY = rTo.meanY - rFrom.meanY;
+			double amplitude = std::sqrt(directionX * directionX + directionY * directionY);
+			if (amplitude <= 2.0 * setup::FILTER_GAZE_FIXATION_PIXEL_RADIUS) { continue; }
+			directionX /= amplitude;
+			directionY /= amplitude;
+
+			// Lag compared to raw gaze
+			double raw = ReachTime(rTrace, rRawX, rRawY, rSegment.begin, rTo.end, rTo.meanX, rTo.meanY);
+			double filtered = ReachTime(rTrace, rX, rY, rSegment.begin, rTo.end, rTo.meanX, rTo.meanY);
+			if (raw >= 0 && filtered >= 0) { rMetrics.lags.push_back(filtered - raw); }
+
+			// Overshoot along direction of saccade
+			double overshoot = 0;
+			double overshootEnd = rTrace[rTo.begin].time + OVERSHOOT_TIME;
+			for (int i = rSegment.begin; i < rTo.end && rTrace[i].time < overshootEnd; i++)
+			{
+				overshoot = std::max(overshoot, (rX[i] - rTo.meanX) * directionX + (rY[i] - rTo.meanY) * directionY);
+			}
+			rMetrics.overshoots.push_back(overshoot);
+		}
+	}
+}
+
+// Print metrics as row of table
+void Print(const std::string& rName, Metrics& rMetrics)
+{
+	std::sort(rMetrics.lags.begin(), rMetrics.lags.end());
+	double lagSum = 0, overshootSum = 0, overshootMax = 0;
+	for (double lag : rMetrics.lags) { lagSum += lag; }
+	for (double overshoot : rMetrics.overshoots) { overshootSum += overshoot; overshootMax = std::max(overshootMax, overshoot); }
+	double lagP90 = rMetrics.lags.empty() ? 0 : rMetrics.lags[std::min(rMetrics.lags.size() - 1, (size_t)(0.9 * rMetrics.lags.size()))];
+	std::cout << std::left << std::setw(18) << rName << std::right << std::fixed << std::setprecision(1)
+		<< std::setw(10) << 1000.0 * lagSum / std::max<size_t>(rMetrics.lags.size(), 1)
+		<< std::setw(10) << 1000.0 * lagP90
+		<< std::setw(12) << std::sqrt(rMetrics.jitterSquareSum / std::max(rMetrics.jitterCount, 1))
+		<< std::setw(12) << overshootSum / std::max<size_t>(rMetrics.overshoots.size(), 1)
+		<< std::setw(12) << overshootMax
+		<< std::setw(12) << std::setprecision(2) << 1e6 * rMetrics.updateTime << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	// Parse command line
+	Options options;
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string argument = argv[i];
+		if (argument == "-file") { options.file = argv[i + 1]; }
+		else if (argument == "-write") { options.write = argv[i + 1]; }
+		else if (argument == "-rate") { options.rate = std::atof(argv[i + 1]); }
+		else if (argument == "-noise") { options.noise = std::atof(argv[i + 1]); }
+		else if (argument == "-seconds") { options.seconds = std::atof(argv[i + 1]); }
+		else { std::cerr << "Unknown argument " << argument << std::endl; return EXIT_FAILURE; }
+	}
+
+	// Load or generate trace
+	std::vector<TraceSample> trace = options.file.empty() ? GenerateTrace(options) : LoadTrace(options.file);
+	if (trace.size() < 2)
+	{
+		std::cerr << "Trace has too few samples" << std::endl;
+		return EXIT_FAILURE;
+	}
+	if (!options.write.empty())
+	{
+		std::ofstream stream(options.write);
+		for (const auto& rSample : trace)
+		{
+			stream << (long long)std::llround(rSample.time * 1000.0) << " " << rSample.x << " " << rSample.y << " " << (rSample.saccade ? "S" : "F") << "\n";
+		}
+	}
+	std::vector<Segment> segments = SplitIntoSegments(trace);
+	float samplerate = (float)((trace.size() - 1) / (trace.back().time - trace.front().time));
+
+	// Raw gaze
+	std::vector<double> rawX, rawY;
+	for (const auto& rSample : trace)
+	{
+		rawX.push_back(rSample.x);
+		rawY.push_back(rSample.y);
+	}
+
+	// Table header
+	std::cout << trace.size() << " samples at " << std::setprecision(1) << std::fixed << samplerate << " Hz, "
+		<< segments.size() << " segments" << std::endl;
+	std::cout << std::left << std::setw(18) << "filter" << std::right
+		<< std::setw(10) << "lag ms" << std::setw(10) << "lag p90"
+		<< std::setw(12) << "jitter px" << std::setw(12) << "overshoot" << std::setw(12) << "max px"
+		<< std::setw(12) << "update us" << std::endl;
+	Metrics rawMetrics;
+	Evaluate(trace, segments, rawX, rawY, rawX, rawY, rawMetrics);
+	Print("raw", rawMetrics);
+
+	// Replay trace through each filter, one sample per update
+	const FilterType types[] = { FilterType::WEIGHTED_AVERAGE, FilterType::ONE_EURO, FilterType::KALMAN, FilterType::FIXATION_AWARE };
+	for (FilterType type : types)
+	{
+		std::shared_ptr<Filter> spFilter = CreateFilter(type);
+		std::vector<double> filteredX, filteredY;
+		auto base = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch());
+		auto start = std::chrono::steady_clock::now();
+		for (const auto& rSample : trace)
+		{
+			SampleQueue spSamples(new std::deque<SampleData>);
+			spSamples->push_back(SampleData(
+				rSample.x,
+				rSample.y,
+				SampleDataCoordinateSystem::SCREEN_PIXELS,
+				base + std::chrono::milliseconds(std::llround(rSample.time * 1000.0)),
+				true));
+			spFilter->Update(spSamples, samplerate);
+			filteredX.push_back(spFilter->GetFilteredGazeX());
+			filteredY.push_back(spFilter->GetFilteredGazeY());
+		}
+		std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+		// Evaluate
+		Metrics metrics;
+		metrics.updateTime = duration.count() / trace.size();
+		Evaluate(trace, segments, rawX, rawY, filteredX, filteredY, metrics);
+		Print(FilterTypeToString(type), metrics);
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,379 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Renders a synthetic link-dense page with the shaders of WebView into a
+// framebuffer, once with highlighted rects drawn one by one (as before they
+// were instanced) and once with a single instanced draw call. The page alone
+// is rendered as reference. Reports per frame:
+//  draw calls: calls of glDraw* for page and highlights
+//  uniform uploads: values handed to the driver, see Shader::Statistics
+//  gpu: GPU time of page and highlights, measured with GL_TIME_ELAPSED.
+//   Software renderers like llvmpipe rasterize at glFinish, outside of query
+//  cpu: wall time of recording and finishing the frame
+// Afterwards, images of both paths are compared pixel by pixel. The benchmark
+// creates a surfaceless OpenGL 3.3 core context through EGL, so it runs
+// headless, e.g. with Mesa's llvmpipe (LIBGL_ALWAYS_SOFTWARE=1). Exit code is
+// non-zero when the images differ.
+//
+// Usage: HighlightBenchmark [-width 1280] [-height 720] [-rects 2000] [-frames 100] [-write prefix]
+
+#include "src/State/Web/Tab/WebViewShaders.h"
+#include "src/Utils/RenderItem.h"
+#include "src/Utils/InstancedRenderItem.h"
+#include "src/Utils/Framebuffer.h"
+#include "src/Utils/Shader.h"
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Options given by command line
+struct Options
+{
+	int width = 1280; // of web view, in pixels
+	int height = 720;
+	int rects = 2000; // count of highlighted links, a third of them below the visible part of the page
+	int frames = 100; // measured frames per path
+	std::string write = ""; // prefix of written images
+};
+
+// Results of one path
+struct Result
+{
+	double drawCalls = 0;
+	double uniformUploads = 0;
+	double gpuTime = 0; // milliseconds
+	double cpuTime = 0; // milliseconds
+	std::vector<unsigned char> pixels;
+};
+
+// Rect in pixels of web view, origin in upper left corner like Rect of CEF
+struct PixelRect
+{
+	float left, top, right, bottom;
+};
+
+// Create surfaceless OpenGL 3.3 core context and make it current
+bool CreateContext()
+{
+	EGLDisplay display = EGL_NO_DISPLAY;
+	auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	if (getPlatformDisplay)
+	{
+		display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+	}
+	if (display == EGL_NO_DISPLAY)
+	{
+		display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	}
+	if (display == EGL_NO_DISPLAY || !eglInitialize(display, NULL, NULL))
+	{
+		std::cerr << "Could not initialize EGL display." << std::endl;
+		return false;
+	}
+	if (!eglBindAPI(EGL_OPENGL_API))
+	{
+		std::cerr << "EGL does not support OpenGL." << std::endl;
+		return false;
+	}
+	const EGLint configAttributes[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+	EGLConfig config;
+	EGLint configCount = 0;
+	if (!eglChooseConfig(display, configAttributes, &config, 1, &configCount) || configCount < 1)
+	{
+		std::cerr << "No EGL config for OpenGL." << std::endl;
+		return false;
+	}
+	const EGLint contextAttributes[] = {
+		EGL_CONTEXT_MAJOR_VERSION, 3,
+		EGL_CONTEXT_MINOR_VERSION, 3,
+		EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+		EGL_NONE };
+	EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+	if (context == EGL_NO_CONTEXT || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+	{
+		std::cerr << "Could not create surfaceless OpenGL 3.3 core context." << std::endl;
+		return false;
+	}
+	return true;
+}
+
+// Page with lines of dark "words" on white background, which highlights tint
+std::vector<unsigned char> CreatePage(int width, int height)
+{
+	std::vector<unsigned char> pixels((size_t)width * (size_t)height * 4, 255);
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			bool ink = (y % 24) > 6 && (y % 24) < 18 && ((x / 7) % 9) != 0 && ((x * 31 + y * 17) % 5) != 0;
+			unsigned char* pPixel = &pixels[((size_t)y * (size_t)width + (size_t)x) * 4];
+			if (ink)
+			{
+				pPixel[0] = (unsigned char)(20 + (x % 40));
+				pPixel[1] = (unsigned char)(20 + (y % 40));
+				pPixel[2] = 60;
+			}
+		}
+	}
+	return pixels;
+}
+
+// Link-sized rects on lines of the page, continuing below the visible part
+std::vector<PixelRect> CreateRects(int count, int width, int height)
+{
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> widthDistribution(30.f, 220.f);
+	std::uniform_real_distribution<float> xDistribution(0.f, 1.f);
+	const int lines = std::max(1, (int)(1.5f * (float)height / 24.f));
+	std::vector<PixelRect> rects;
+	for (int i = 0; i < count; i++)
+	{
+		PixelRect rect;
+		float rectWidth = widthDistribution(generator);
+		rect.left = xDistribution(generator) * ((float)width - rectWidth);
+		rect.right = rect.left + rectWidth;
+		rect.top = (float)((i % lines) * 24 + 4);
+		rect.bottom = rect.top + 16.f;
+		rects.push_back(rect);
+	}
+	return rects;
+}
+
+// Position and texture coordinate of rect, computed like in WebView::Draw
+void PushInstance(const PixelRect& rRect, int width, int height, std::vector<float>& rInstances)
+{
+	rInstances.push_back(((rRect.left / (float)width) * 2.f) - 1.f);
+	rInstances.push_back(((((float)height - rRect.bottom) / (float)height) * 2.f) - 1.f);
+	rInstances.push_back(((rRect.right / (float)width) * 2.f) - 1.f);
+	rInstances.push_back(((((float)height - rRect.top) / (float)height) * 2.f) - 1.f);
+	rInstances.push_back(rRect.left / (float)width);
+	rInstances.push_back(1.f - ((float)height - rRect.bottom) / (float)height);
+	rInstances.push_back(rRect.right / (float)width);
+	rInstances.push_back(1.f - ((float)height - rRect.top) / (float)height);
+}
+
+// How highlights are drawn
+enum class Path
+{
+	NONE, PER_RECT, INSTANCED
+};
+
+// Render page and highlights into framebuffer
+Result Run(const Options& rOptions, Path path, GLuint pageTexture, const std::vector<PixelRect>& rRects)
+{
+	const int width = rOptions.width;
+	const int height = rOptions.height;
+
+	// Render items like those of WebView
+	RenderItem webpageItem(vertexShaderSource, geometryShaderSource, webpageFragmentShaderSource);
+	RenderItem perRectItem(vertexShaderSource, geometryShaderSource, highlightFragmentShaderSource);
+	InstancedRenderItem instancedItem(highlightVertexShaderSource, highlightGeometryShaderSource, highlightFragmentShaderSource, { 4, 4 });
+
+	// Framebuffer of web view
+	Framebuffer framebuffer(width, height);
+	framebuffer.Bind();
+	framebuffer.AddAttachment(Framebuffer::ColorFormat::RGBA);
+	framebuffer.Unbind();
+
+	GLuint query = 0;
+	glGenQueries(1, &query);
+
+	Result result;
+	for (int frame = -1; frame < rOptions.frames; frame++) // first frame warms up
+	{
+		Shader::ResetStatistics();
+		unsigned int drawCalls = 0;
+		auto start = std::chrono::steady_clock::now();
+		glBeginQuery(GL_TIME_ELAPSED, query);
+
+		framebuffer.Bind();
+		glViewport(0, 0, width, height);
+		glBindTexture(GL_TEXTURE_2D, pageTexture);
+
+		// Page
+		webpageItem.Bind();
+		webpageItem.GetShader()->UpdateValue("position", glm::vec4(-1.f, -1.f, 1.f, 1.f));
+		webpageItem.GetShader()->UpdateValue("textureCoordinate", glm::vec4(0.f, 1.f, 1.f, 0.f));
+		webpageItem.GetShader()->UpdateValue("dim", 0.3f);
+		webpageItem.Draw(GL_POINTS);
+		drawCalls++;
+
+		// Highlights
+		if (path == Path::INSTANCED)
+		{
+			// Rects outside of web view are skipped, instances are uploaded once as long as rects stay the same
+			if (frame == -1)
+			{
+				std::vector<float> instances;
+				for (const auto& rRect : rRects)
+				{
+					if (rRect.right < 0.f || rRect.left > (float)width || rRect.bottom < 0.f || rRect.top > (float)height) { continue; }
+					PushInstance(rRect, width, height, instances);
+				}
+				instancedItem.Fill(instances);
+			}
+			instancedItem.Bind();
+			instancedItem.GetShader()->UpdateValue("dim", 0.f);
+			instancedItem.GetShader()->UpdateValue("aspectRatio", (float)width / (float)height);
+			instancedItem.Draw(GL_POINTS);
+			drawCalls++;
+		}
+		else if (path == Path::PER_RECT)
+		{
+			// Every rect is drawn, even when clipped
+			perRectItem.Bind();
+			perRectItem.GetShader()->UpdateValue("dim", 0.f);
+			perRectItem.GetShader()->UpdateValue("aspectRatio", (float)width / (float)height);
+			for (const auto& rRect : rRects)
+			{
+				std::vector<float> instance;
+				PushInstance(rRect, width, height, instance);
+				perRectItem.GetShader()->UpdateValue("position", glm::vec4(instance[0], instance[1], instance[2], instance[3]));
+				perRectItem.GetShader()->UpdateValue("textureCoordinate", glm::vec4(instance[4], instance[5], instance[6], instance[7]));
+				perRectItem.Draw(GL_POINTS);
+				drawCalls++;
+			}
+		}
+
+		glEndQuery(GL_TIME_ELAPSED);
+		framebuffer.Unbind();
+		glFinish();
+		auto end = std::chrono::steady_clock::now();
+
+		// Collect measurements, skipping warm up
+		if (frame >= 0)
+		{
+			GLuint64 nanoseconds = 0;
+			glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+			result.gpuTime += (double)nanoseconds / 1000000.0;
+			result.cpuTime += std::chrono::duration<double, std::milli>(end - start).count();
+			result.drawCalls += drawCalls;
+			result.uniformUploads += Shader::GetStatistics().uploads;
+		}
+	}
+	glDeleteQueries(1, &query);
+
+	// Average over frames
+	const double frames = (double)std::max(1, rOptions.frames);
+	result.drawCalls /= frames;
+	result.uniformUploads /= frames;
+	result.gpuTime /= frames;
+	result.cpuTime /= frames;
+
+	// Read back image
+	result.pixels.resize((size_t)width * (size_t)height * 4);
+	glBindTexture(GL_TEXTURE_2D, framebuffer.GetAttachment(0));
+	glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, result.pixels.data());
+	return result;
+}
+
+// Write image as binary PPM
+void WritePPM(const std::string& rPath, const std::vector<unsigned char>& rPixels, int width, int height)
+{
+	std::ofstream file(rPath, std::ios::binary);
+	file << "P6\n" << width << " " << height << "\n255\n";
+	for (int y = height - 1; y >= 0; y--) // OpenGL rows start at bottom
+	{
+		for (int x = 0; x < width; x++)
+		{
+			file.write((const char*)&rPixels[((size_t)y * (size_t)width + (size_t)x) * 4], 3);
+		}
+	}
+}
+
+void PrintResult(const std::string& rName, const Result& rResult)
+{
+	std::cout << std::left << std::setw(12) << rName << std::right << std::fixed
+		<< std::setw(12) << std::setprecision(1) << rResult.drawCalls
+		<< std::setw(18) << std::setprecision(1) << rResult.uniformUploads
+		<< std::setw(12) << std::setprecision(3) << rResult.gpuTime
+		<< std::setw(12) << std::setprecision(3) << rResult.cpuTime << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	// Parse options
+	Options options;
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string option(argv[i]);
+		std::string value(argv[i + 1]);
+		if (option == "-width") { options.width = std::atoi(value.c_str()); }
+		else if (option == "-height") { options.height = std::atoi(value.c_str()); }
+		else if (option == "-rects") { options.rects = std::atoi(value.c_str()); }
+		else if (option == "-frames") { options.frames = std::atoi(value.c_str()); }
+		else if (option == "-write") { options.write = value; }
+		else
+		{
+			std::cerr << "Unknown option: " << option << std::endl;
+			return 1;
+		}
+	}
+
+	// Context
+	if (!CreateContext()) { return 1; }
+	if (ogl_LoadFunctions() == ogl_LOAD_FAILED)
+	{
+		std::cerr << "Could not load OpenGL functions." << std::endl;
+		return 1;
+	}
+	std::cout << "Renderer: " << (const char*)glGetString(GL_RENDERER) << std::endl;
+
+	// Page texture
+	std::vector<unsigned char> page = CreatePage(options.width, options.height);
+	GLuint pageTexture = 0;
+	glGenTextures(1, &pageTexture);
+	glBindTexture(GL_TEXTURE_2D, pageTexture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, options.width, options.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, page.data());
+
+	// Rects
+	std::vector<PixelRect> rects = CreateRects(options.rects, options.width, options.height);
+	std::cout << "Web view: " << options.width << "x" << options.height << ", rects: " << rects.size() << ", frames: " << options.frames << std::endl;
+
+	// Run both paths
+	Result pageOnly = Run(options, Path::NONE, pageTexture, rects);
+	Result perRect = Run(options, Path::PER_RECT, pageTexture, rects);
+	Result instanced = Run(options, Path::INSTANCED, pageTexture, rects);
+	std::cout << std::left << std::setw(12) << "path" << std::right
+		<< std::setw(12) << "draw calls" << std::setw(18) << "uniform uploads"
+		<< std::setw(12) << "gpu [ms]" << std::setw(12) << "cpu [ms]" << std::endl;
+	PrintResult("page only", pageOnly);
+	PrintResult("per rect", perRect);
+	PrintResult("instanced", instanced);
+
+	// Compare images
+	size_t differingPixels = 0;
+	int maximumDifference = 0;
+	for (size_t i = 0; i < perRect.pixels.size(); i += 4)
+	{
+		int difference = 0;
+		for (size_t c = 0; c < 4; c++)
+		{
+			difference = std::max(difference, std::abs((int)perRect.pixels[i + c] - (int)instanced.pixels[i + c]));
+		}
+		if (difference > 0) { differingPixels++; }
+		maximumDifference = std::max(maximumDifference, difference);
+	}
+	std::cout << "Differing pixels: " << differingPixels << ", maximum channel difference: " << maximumDifference << std::endl;
+
+	// Write images
+	if (!options.write.empty())
+	{
+		WritePPM(options.write + "_per_rect.ppm", perRect.pixels, options.width, options.height);
+		WritePPM(options.write + "_instanced.ppm", instanced.pixels, options.width, options.height);
+	}
+
+	glDeleteTextures(1, &pageTexture);
+	return differingPixels == 0 ? 0 : 2;
+}
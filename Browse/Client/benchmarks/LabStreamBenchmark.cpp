@@ -0,0 +1,150 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Measures LabStreamOutput on local host. Sends gaze-like samples with two
+// channels at given rate and receives them with an inlet in the same process.
+// Reports throughput, cost of sending on the producing thread and latency
+// from timestamp of sample until it is pulled by the inlet.
+//
+// Usage: LabStreamBenchmark [-rate 2000] [-seconds 10] [-latency 5] [-direct]
+//  -latency maximum latency of output in milliseconds
+//  -direct pushes each sample on the producing thread, for comparison
+
+#include "common/LabStream/LabStream.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+// Options given by command line
+struct Options
+{
+	double rate = 2000; // samples per second
+	double seconds = 10;
+	int latency = LAB_STREAM_DEFAULT_MAX_LATENCY.count(); // milliseconds
+	bool direct = false;
+};
+
+// Value at percentile of sorted values
+double Percentile(const std::vector<double>& rSorted, double percentile)
+{
+	if (rSorted.empty()) { return 0; }
+	size_t index = std::min(rSorted.size() - 1, (size_t)(percentile / 100.0 * rSorted.size()));
+	return rSorted[index];
+}
+
+int main(int argc, char** argv)
+{
+	// Parse command line
+	Options options;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+		if (argument == "-direct") { options.direct = true; }
+		else if (i + 1 < argc && argument == "-rate") { options.rate = std::atof(argv[++i]); }
+		else if (i + 1 < argc && argument == "-seconds") { options.seconds = std::atof(argv[++i]); }
+		else if (i + 1 < argc && argument == "-latency") { options.latency = std::atoi(argv[++i]); }
+		else { std::cerr << "Unknown argument " << argument << std::endl; return EXIT_FAILURE; }
+	}
+	const unsigned long long count = (unsigned long long)(options.rate * options.seconds);
+
+	// Stream like the one of eye tracker plugins
+	lsl::stream_info streamInfo(
+		"GazeTheWebBenchmark",
+		"Gaze",
+		2,
+		lsl::IRREGULAR_RATE,
+		lsl::cf_double64,
+		"GazeTheWebBenchmark");
+	std::unique_ptr<LabStreamOutput<double> > upOutput;
+	std::unique_ptr<lsl::stream_outlet> upOutlet;
+	if (options.direct)
+	{
+		upOutlet = std::unique_ptr<lsl::stream_outlet>(new lsl::stream_outlet(streamInfo));
+	}
+	else
+	{
+		upOutput = std::unique_ptr<LabStreamOutput<double> >(
+			new LabStreamOutput<double>(streamInfo, std::chrono::milliseconds(options.latency)));
+	}
+
+	// Connect inlet before sending
+	std::vector<lsl::stream_info> streamInfos = lsl::resolve_stream("name", "GazeTheWebBenchmark", 1, 5.0);
+	if (streamInfos.empty())
+	{
+		std::cerr << "Could not resolve stream" << std::endl;
+		return EXIT_FAILURE;
+	}
+	lsl::stream_inlet inlet(streamInfos[0]);
+	inlet.open_stream(5.0);
+
+	// Receive samples and measure their latency. First channel carries index of sample
+	std::vector<double> latencies;
+	latencies.reserve(count);
+	unsigned long long outOfOrder = 0;
+	std::thread receiverThread([&]()
+	{
+		std::vector<double> buffer(2 * 256);
+		std::vector<double> timestamps(256);
+		double expected = 0;
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(options.seconds + 5.0);
+		while (latencies.size() < count && std::chrono::steady_clock::now() < deadline)
+		{
+			// Wait for first sample, then take the ones which arrived meanwhile
+			timestamps[0] = inlet.pull_sample(&buffer[0], 2, 0.1);
+			if (timestamps[0] == 0.0) { continue; }
+			size_t samples = 1 + inlet.pull_chunk_multiplexed(
+				&buffer[2], &timestamps[1], buffer.size() - 2, timestamps.size() - 1, 0.0) / 2;
+			double now = lsl::local_clock();
+			for (size_t i = 0; i < samples; i++)
+			{
+				latencies.push_back(now - timestamps[i]);
+				if (buffer[2 * i] != expected) { outOfOrder++; }
+				expected = buffer[2 * i] + 1;
+			}
+		}
+	});
+
+	// Send samples at rate and measure cost on sending thread
+	std::vector<double> sendCosts;
+	sendCosts.reserve(count);
+	std::vector<double> sample(2);
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned long long i = 0; i < count; i++)
+	{
+		std::this_thread::sleep_until(start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+			std::chrono::duration<double>(i / options.rate)));
+		sample[0] = (double)i;
+		sample[1] = 0.5;
+		auto sendStart = std::chrono::steady_clock::now();
+		if (options.direct) { upOutlet->push_sample(sample); }
+		else { upOutput->Send(sample); }
+		sendCosts.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - sendStart).count());
+	}
+	std::chrono::duration<double> sendDuration = std::chrono::steady_clock::now() - start;
+	receiverThread.join();
+	std::chrono::duration<double> receiveDuration = std::chrono::steady_clock::now() - start;
+
+	// Report
+	std::sort(sendCosts.begin(), sendCosts.end());
+	std::sort(latencies.begin(), latencies.end());
+	double sendCostSum = 0;
+	for (double cost : sendCosts) { sendCostSum += cost; }
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << (options.direct ? "Direct push_sample" : "LabStreamOutput") << " at " << options.rate << " Hz";
+	if (!options.direct) { std::cout << ", maximum latency " << options.latency << " ms"; }
+	std::cout << std::endl;
+	std::cout << "Samples sent: " << count << " in " << sendDuration.count() << " s" << std::endl;
+	std::cout << "Samples received: " << latencies.size() << " (" << latencies.size() / receiveDuration.count() << " samples/s), out of order: " << outOfOrder;
+	if (!options.direct) { std::cout << ", dropped: " << upOutput->GetDroppedCount(); }
+	std::cout << std::endl;
+	std::cout << "Send cost in us: mean " << 1e6 * sendCostSum / std::max<size_t>(sendCosts.size(), 1)
+		<< ", p99 " << 1e6 * Percentile(sendCosts, 99)
+		<< ", max " << 1e6 * Percentile(sendCosts, 100) << std::endl;
+	std::cout << "Latency in ms: p50 " << 1e3 * Percentile(latencies, 50)
+		<< ", p90 " << 1e3 * Percentile(latencies, 90)
+		<< ", p99 " << 1e3 * Percentile(latencies, 99)
+		<< ", max " << 1e3 * Percentile(latencies, 100) << std::endl;
+	return latencies.size() == count ? EXIT_SUCCESS : EXIT_FAILURE;
+}
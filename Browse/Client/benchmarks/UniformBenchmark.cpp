@@ -0,0 +1,395 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Replays the uniform updates of a drawn frame of Master with one web tab:
+// page, instanced highlights and composition of WebView followed by the
+// periphery blur of the screen filling quad. Counts driver calls for uniforms
+// by wrapping the loaded OpenGL functions:
+//  lookups: glGetUniformLocation
+//  uploads: glUniform*
+//  buffer: glBindBuffer, glBufferSubData and glBindBufferBase of uniform buffer
+// Path "uncached" issues the calls of Shader before locations were cached,
+// one lookup and one upload per update by name, and hands the periphery
+// values to the blur as three uniforms. Path "cached" updates through handles
+// of Shader and fills FrameUniforms once per frame. Scenarios:
+//  gaze: gaze moves every frame, page and zoom stay
+//  zoom: additionally, zoom and its position change every frame
+// The benchmark creates a surfaceless OpenGL 3.3 core context through EGL,
+// so it runs headless, e.g. with Mesa's llvmpipe (LIBGL_ALWAYS_SOFTWARE=1).
+//
+// Usage: UniformBenchmark [-width 1280] [-height 720] [-frames 100]
+
+#include "src/Master/MasterShaders.h"
+#include "src/State/Web/Tab/WebViewShaders.h"
+#include "src/Utils/RenderItem.h"
+#include "src/Utils/InstancedRenderItem.h"
+#include "src/Utils/Framebuffer.h"
+#include "src/Utils/FrameUniforms.h"
+#include "src/Utils/Shader.h"
+#include "submodules/glm/glm/gtc/type_ptr.hpp"
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Options given by command line
+struct Options
+{
+	int width = 1280; // of window, web view covers all but a bar at the top
+	int height = 720;
+	int frames = 100; // measured frames per path and scenario
+};
+
+// Driver calls for uniforms
+struct Counts
+{
+	double lookups = 0;
+	double uploads = 0;
+	double buffer = 0;
+};
+
+// Counts of calls since last reset
+static Counts counts;
+
+// Wrapped OpenGL functions
+static GLint (CODEGEN_FUNCPTR *pGetUniformLocation)(GLuint, const GLchar*) = NULL;
+static void (CODEGEN_FUNCPTR *pUniform1i)(GLint, GLint) = NULL;
+static void (CODEGEN_FUNCPTR *pUniform1f)(GLint, GLfloat) = NULL;
+static void (CODEGEN_FUNCPTR *pUniform2fv)(GLint, GLsizei, const GLfloat*) = NULL;
+static void (CODEGEN_FUNCPTR *pUniform4fv)(GLint, GLsizei, const GLfloat*) = NULL;
+static void (CODEGEN_FUNCPTR *pBindBuffer)(GLenum, GLuint) = NULL;
+static void (CODEGEN_FUNCPTR *pBufferSubData)(GLenum, GLintptr, GLsizeiptr, const GLvoid*) = NULL;
+static void (CODEGEN_FUNCPTR *pBindBufferBase)(GLenum, GLuint, GLuint) = NULL;
+
+static GLint CODEGEN_FUNCPTR CountGetUniformLocation(GLuint program, const GLchar* name) { counts.lookups++; return pGetUniformLocation(program, name); }
+static void CODEGEN_FUNCPTR CountUniform1i(GLint location, GLint value) { counts.uploads++; pUniform1i(location, value); }
+static void CODEGEN_FUNCPTR CountUniform1f(GLint location, GLfloat value) { counts.uploads++; pUniform1f(location, value); }
+static void CODEGEN_FUNCPTR CountUniform2fv(GLint location, GLsizei count, const GLfloat* value) { counts.uploads++; pUniform2fv(location, count, value); }
+static void CODEGEN_FUNCPTR CountUniform4fv(GLint location, GLsizei count, const GLfloat* value) { counts.uploads++; pUniform4fv(location, count, value); }
+static void CODEGEN_FUNCPTR CountBindBuffer(GLenum target, GLuint buffer)
+{
+	if (target == GL_UNIFORM_BUFFER) { counts.buffer++; }
+	pBindBuffer(target, buffer);
+}
+static void CODEGEN_FUNCPTR CountBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid* data)
+{
+	if (target == GL_UNIFORM_BUFFER) { counts.buffer++; }
+	pBufferSubData(target, offset, size, data);
+}
+static void CODEGEN_FUNCPTR CountBindBufferBase(GLenum target, GLuint index, GLuint buffer) { counts.buffer++; pBindBufferBase(target, index, buffer); }
+
+// Replace loaded functions by counting ones
+void WrapFunctions()
+{
+	pGetUniformLocation = _ptrc_glGetUniformLocation; _ptrc_glGetUniformLocation = CountGetUniformLocation;
+	pUniform1i = _ptrc_glUniform1i; _ptrc_glUniform1i = CountUniform1i;
+	pUniform1f = _ptrc_glUniform1f; _ptrc_glUniform1f = CountUniform1f;
+	pUniform2fv = _ptrc_glUniform2fv; _ptrc_glUniform2fv = CountUniform2fv;
+	pUniform4fv = _ptrc_glUniform4fv; _ptrc_glUniform4fv = CountUniform4fv;
+	pBindBuffer = _ptrc_glBindBuffer; _ptrc_glBindBuffer = CountBindBuffer;
+	pBufferSubData = _ptrc_glBufferSubData; _ptrc_glBufferSubData = CountBufferSubData;
+	pBindBufferBase = _ptrc_glBindBufferBase; _ptrc_glBindBufferBase = CountBindBufferBase;
+}
+
+// Create surfaceless OpenGL 3.3 core context and make it current
+bool CreateContext()
+{
+	EGLDisplay display = EGL_NO_DISPLAY;
+	auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	if (getPlatformDisplay)
+	{
+		display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+	}
+	if (display == EGL_NO_DISPLAY)
+	{
+		display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	}
+	if (display == EGL_NO_DISPLAY || !eglInitialize(display, NULL, NULL))
+	{
+		std::cerr << "Could not initialize EGL display." << std::endl;
+		return false;
+	}
+	if (!eglBindAPI(EGL_OPENGL_API))
+	{
+		std::cerr << "EGL does not support OpenGL." << std::endl;
+		return false;
+	}
+	const EGLint configAttributes[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+	EGLConfig config;
+	EGLint configCount = 0;
+	if (!eglChooseConfig(display, configAttributes, &config, 1, &configCount) || configCount < 1)
+	{
+		std::cerr << "No EGL config for OpenGL." << std::endl;
+		return false;
+	}
+	const EGLint contextAttributes[] = {
+		EGL_CONTEXT_MAJOR_VERSION, 3,
+		EGL_CONTEXT_MINOR_VERSION, 3,
+		EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+		EGL_NONE };
+	EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+	if (context == EGL_NO_CONTEXT || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+	{
+		std::cerr << "Could not create surfaceless OpenGL 3.3 core context." << std::endl;
+		return false;
+	}
+	return true;
+}
+
+// How uniforms are updated
+enum class Path
+{
+	UNCACHED, CACHED
+};
+
+// What changes from frame to frame
+enum class Scenario
+{
+	GAZE, ZOOM
+};
+
+// Update of uniform by name as Shader did before caching
+void UpdateUncached(const Shader& rShader, const char* pName, float value)
+{
+	glUniform1f(glGetUniformLocation(rShader.GetProgram(), pName), value);
+}
+
+void UpdateUncached(const Shader& rShader, const char* pName, const glm::vec2& rValue)
+{
+	glUniform2fv(glGetUniformLocation(rShader.GetProgram(), pName), 1, glm::value_ptr(rValue));
+}
+
+void UpdateUncached(const Shader& rShader, const char* pName, const glm::vec4& rValue)
+{
+	glUniform4fv(glGetUniformLocation(rShader.GetProgram(), pName), 1, glm::value_ptr(rValue));
+}
+
+// Draw frames and count driver calls for uniforms per frame
+Counts Run(const Options& rOptions, Path path, Scenario scenario, GLuint pageTexture)
+{
+	const int width = rOptions.width;
+	const int height = rOptions.height;
+	const int webViewY = 0;
+	const int webViewHeight = (height * 9) / 10;
+
+	// Render items like those of WebView and Master
+	RenderItem webpageItem(vertexShaderSource, geometryShaderSource, webpageFragmentShaderSource);
+	InstancedRenderItem highlightItem(highlightVertexShaderSource, highlightGeometryShaderSource, highlightFragmentShaderSource, { 4, 4 });
+	RenderItem compositeItem(vertexShaderSource, geometryShaderSource, compositionFragmentShaderSource);
+	RenderItem screenFillingQuad(screenFillingVertexShaderSource, screenFillingGeometryShaderSource, blurFragmentShaderSource);
+	highlightItem.Fill({ -0.5f, 0.2f, -0.1f, 0.3f, 0.25f, 0.6f, 0.45f, 0.65f });
+
+	// Handles resolved at construction, like WebView does
+	const Shader& rWebpage = *webpageItem.GetShader();
+	const Shader& rHighlight = *highlightItem.GetShader();
+	const Shader& rComposite = *compositeItem.GetShader();
+	const Shader::Handle webpagePosition = rWebpage.GetHandle("position");
+	const Shader::Handle webpageTextureCoordinate = rWebpage.GetHandle("textureCoordinate");
+	const Shader::Handle webpageDim = rWebpage.GetHandle("dim");
+	const Shader::Handle highlightDim = rHighlight.GetHandle("dim");
+	const Shader::Handle highlightAspectRatio = rHighlight.GetHandle("aspectRatio");
+	const Shader::Handle compositePosition = rComposite.GetHandle("position");
+	const Shader::Handle compositeTextureCoordinate = rComposite.GetHandle("textureCoordinate");
+	const Shader::Handle compositeCenterOffset = rComposite.GetHandle("centerOffset");
+	const Shader::Handle compositeZoomPosition = rComposite.GetHandle("zoomPosition");
+	const Shader::Handle compositeZoom = rComposite.GetHandle("zoom");
+
+	// Framebuffers of web view and Master
+	Framebuffer webViewFramebuffer(width, webViewHeight);
+	webViewFramebuffer.Bind();
+	webViewFramebuffer.AddAttachment(Framebuffer::ColorFormat::RGBA);
+	webViewFramebuffer.Unbind();
+	Framebuffer masterFramebuffer(width, height);
+	masterFramebuffer.Bind();
+	masterFramebuffer.AddAttachment(Framebuffer::ColorFormat::RGB);
+	masterFramebuffer.Unbind();
+	Framebuffer windowFramebuffer(width, height); // surfaceless context has no default framebuffer
+	windowFramebuffer.Bind();
+	windowFramebuffer.AddAttachment(Framebuffer::ColorFormat::RGB);
+	windowFramebuffer.Unbind();
+
+	// Frame uniforms are bound in both paths, so the blur never reads an unbound block
+	FrameUniforms frameUniforms;
+	frameUniforms.Update(FrameUniforms::Values());
+
+	Counts result;
+	for (int frame = -1; frame < rOptions.frames; frame++) // first frame warms up
+	{
+		counts = Counts();
+
+		// Values of frame
+		const float t = (float)std::max(frame, 0) / (float)std::max(rOptions.frames, 1);
+		const glm::vec2 gaze((0.2f + 0.6f * t) * (float)width, (0.3f + 0.4f * t) * (float)height); // OpenGL coordinate system
+		const float zoom = scenario == Scenario::ZOOM ? 1.f - 0.5f * t : 1.f;
+		const glm::vec2 zoomPosition = scenario == Scenario::ZOOM ? gaze / glm::vec2(width, height) : glm::vec2(0.5f, 0.5f);
+		const float focusPixelRadius = (float)std::min(width, height) * 0.1f;
+		const float peripheryMultiplier = 0.85f;
+		const glm::vec4 compositePositionValue(
+			-1.f, ((webViewY / (float)height) * 2.f) - 1.f,
+			1.f, (((webViewY + webViewHeight) / (float)height) * 2.f) - 1.f);
+
+		// Frame uniforms, filled by Master before drawing
+		if (path == Path::CACHED)
+		{
+			FrameUniforms::Values values;
+			values.resolution = glm::vec2(width, height);
+			values.gazePixelPosition = gaze;
+			values.focusPixelRadius = focusPixelRadius;
+			values.peripheryMultiplier = peripheryMultiplier;
+			frameUniforms.Update(values);
+		}
+
+		// Page into framebuffer of web view
+		webViewFramebuffer.Bind();
+		glViewport(0, 0, width, webViewHeight);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, pageTexture);
+		webpageItem.Bind();
+		if (path == Path::CACHED)
+		{
+			rWebpage.UpdateValue(webpagePosition, glm::vec4(-1.f, -1.f, 1.f, 1.f));
+			rWebpage.UpdateValue(webpageTextureCoordinate, glm::vec4(0.f, 1.f, 1.f, 0.f));
+			rWebpage.UpdateValue(webpageDim, 0.f);
+		}
+		else
+		{
+			UpdateUncached(rWebpage, "position", glm::vec4(-1.f, -1.f, 1.f, 1.f));
+			UpdateUncached(rWebpage, "textureCoordinate", glm::vec4(0.f, 1.f, 1.f, 0.f));
+			UpdateUncached(rWebpage, "dim", 0.f);
+		}
+		webpageItem.Draw(GL_POINTS);
+
+		// Highlights
+		highlightItem.Bind();
+		if (path == Path::CACHED)
+		{
+			rHighlight.UpdateValue(highlightDim, 0.f);
+			rHighlight.UpdateValue(highlightAspectRatio, (float)width / (float)webViewHeight);
+		}
+		else
+		{
+			UpdateUncached(rHighlight, "dim", 0.f);
+			UpdateUncached(rHighlight, "aspectRatio", (float)width / (float)webViewHeight);
+		}
+		highlightItem.Draw(GL_POINTS);
+		webViewFramebuffer.Unbind();
+
+		// Composition into framebuffer of Master
+		masterFramebuffer.Bind();
+		glViewport(0, 0, width, height);
+		glBindTexture(GL_TEXTURE_2D, webViewFramebuffer.GetAttachment(0));
+		compositeItem.Bind();
+		if (path == Path::CACHED)
+		{
+			rComposite.UpdateValue(compositePosition, compositePositionValue);
+			rComposite.UpdateValue(compositeTextureCoordinate, glm::vec4(0.f, 0.f, 1.f, 1.f));
+			rComposite.UpdateValue(compositeCenterOffset, glm::vec2(0.f, 0.f));
+			rComposite.UpdateValue(compositeZoomPosition, glm::vec2(zoomPosition.x, 1.f - zoomPosition.y));
+			rComposite.UpdateValue(compositeZoom, zoom);
+		}
+		else
+		{
+			UpdateUncached(rComposite, "position", compositePositionValue);
+			UpdateUncached(rComposite, "textureCoordinate", glm::vec4(0.f, 0.f, 1.f, 1.f));
+			UpdateUncached(rComposite, "centerOffset", glm::vec2(0.f, 0.f));
+			UpdateUncached(rComposite, "zoomPosition", glm::vec2(zoomPosition.x, 1.f - zoomPosition.y));
+			UpdateUncached(rComposite, "zoom", zoom);
+		}
+		compositeItem.Draw(GL_POINTS);
+		masterFramebuffer.Unbind();
+
+		// Screen filling quad with periphery blur
+		windowFramebuffer.Bind();
+		glBindTexture(GL_TEXTURE_2D, masterFramebuffer.GetAttachment(0));
+		screenFillingQuad.Bind();
+		if (path == Path::UNCACHED)
+		{
+			UpdateUncached(*screenFillingQuad.GetShader(), "focusPixelPosition", gaze);
+			UpdateUncached(*screenFillingQuad.GetShader(), "focusPixelRadius", focusPixelRadius);
+			UpdateUncached(*screenFillingQuad.GetShader(), "peripheryMultiplier", peripheryMultiplier);
+		}
+		screenFillingQuad.Draw(GL_POINTS);
+		windowFramebuffer.Unbind();
+		glFinish();
+
+		// Collect counts, skipping warm up
+		if (frame >= 0)
+		{
+			result.lookups += counts.lookups;
+			result.uploads += counts.uploads;
+			result.buffer += counts.buffer;
+		}
+	}
+
+	// Average over frames
+	const double frames = (double)std::max(1, rOptions.frames);
+	result.lookups /= frames;
+	result.uploads /= frames;
+	result.buffer /= frames;
+	return result;
+}
+
+void PrintResult(const std::string& rName, const Counts& rCounts)
+{
+	std::cout << std::left << std::setw(18) << rName << std::right << std::fixed << std::setprecision(2)
+		<< std::setw(10) << rCounts.lookups
+		<< std::setw(10) << rCounts.uploads
+		<< std::setw(10) << rCounts.buffer
+		<< std::setw(10) << rCounts.lookups + rCounts.uploads + rCounts.buffer << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	// Parse options
+	Options options;
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string option(argv[i]);
+		std::string value(argv[i + 1]);
+		if (option == "-width") { options.width = std::atoi(value.c_str()); }
+		else if (option == "-height") { options.height = std::atoi(value.c_str()); }
+		else if (option == "-frames") { options.frames = std::atoi(value.c_str()); }
+		else
+		{
+			std::cerr << "Unknown option: " << option << std::endl;
+			return 1;
+		}
+	}
+
+	// Context
+	if (!CreateContext()) { return 1; }
+	if (ogl_LoadFunctions() == ogl_LOAD_FAILED)
+	{
+		std::cerr << "Could not load OpenGL functions." << std::endl;
+		return 1;
+	}
+	WrapFunctions();
+	std::cout << "Renderer: " << (const char*)glGetString(GL_RENDERER) << std::endl;
+	std::cout << "Window: " << options.width << "x" << options.height << ", frames: " << options.frames << std::endl;
+
+	// Page texture, content does not matter for counting
+	std::vector<unsigned char> page((size_t)options.width * (size_t)options.height * 4, 255);
+	GLuint pageTexture = 0;
+	glGenTextures(1, &pageTexture);
+	glBindTexture(GL_TEXTURE_2D, pageTexture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, options.width, options.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, page.data());
+
+	// Run paths for each scenario
+	std::cout << std::left << std::setw(18) << "driver calls" << std::right
+		<< std::setw(10) << "lookups" << std::setw(10) << "uploads"
+		<< std::setw(10) << "buffer" << std::setw(10) << "total" << std::endl;
+	PrintResult("gaze, uncached", Run(options, Path::UNCACHED, Scenario::GAZE, pageTexture));
+	PrintResult("gaze, cached", Run(options, Path::CACHED, Scenario::GAZE, pageTexture));
+	PrintResult("zoom, uncached", Run(options, Path::UNCACHED, Scenario::ZOOM, pageTexture));
+	PrintResult("zoom, cached", Run(options, Path::CACHED, Scenario::ZOOM, pageTexture));
+
+	glDeleteTextures(1, &pageTexture);
+	return glGetError() == GL_NO_ERROR ? 0 : 1;
+}
@@ -4,6 +4,7 @@
 //============================================================================
 
 #include "LabStream.h"
+#include <algorithm>
 #include <iostream>
 #include <chrono>
 
@@ -11,61 +12,72 @@
 // ### LAB STREAM INPUT ###
 // ########################
 
-LabStreamInput::LabStreamInput(std::string streamInputName)
+LabStreamInput::LabStreamInput(std::string streamInputName) : _stop(false)
 {
-    // Setting up receiving
-    std::mutex* pMutex = &_inputMutex; // pointer to mutex because reference of private member is not allowed
-    std::vector<std::string>* pBuffer = &_inputBuffer; // same for buffer itself
-    _upReceiverThread = std::unique_ptr<std::thread>(new std::thread([pMutex, pBuffer, streamInputName]() // pass copies of pointers to members
-    {
-        // Receive data
-        bool connected = false;
-        std::vector<lsl::stream_info> streamInfos;
+	// Setting up receiving
+	std::atomic<bool>* pStop = &_stop; // pointer to stop flag because reference of private member is not allowed
+	std::mutex* pMutex = &_inputMutex; // pointer to mutex for same reason
+	std::vector<std::string>* pBuffer = &_inputBuffer; // same for buffer itself
+	_upReceiverThread = std::unique_ptr<std::thread>(new std::thread([pStop, pMutex, pBuffer, streamInputName]() // pass copies of pointers to members
+	{
+		// Receive data
+		bool connected = false;
+		std::vector<lsl::stream_info> streamInfos;
 		std::unique_ptr<lsl::stream_inlet> upStreamInlet;
-        std::vector<std::string> localBuffer;
-        while(true)
-        {
-            // Build up connection if necessary
-            if(!connected)
-            {
-                streamInfos.clear();
-                while (streamInfos.empty())
-                {
-                    streamInfos = lsl::resolve_stream("name", streamInputName); // search for stream with certain name
-                    std::this_thread::sleep_for(std::chrono::seconds(1)); // do it every second
-                }
+		int channelCount = 1;
+		std::vector<std::string> localBuffer;
+		while (!*pStop)
+		{
+			// Build up connection if necessary
+			if (!connected)
+			{
+				streamInfos = lsl::resolve_stream("name", streamInputName, 1, 1.0); // search for stream with certain name every second
+				if (streamInfos.empty())
+				{
+					continue;
+				}
 
-                // Take first stream you can find
-                upStreamInlet = std::unique_ptr<lsl::stream_inlet>(new lsl::stream_inlet(streamInfos[0]));
-                connected = true;
-            }
+				// Take first stream you can find
+				upStreamInlet = std::unique_ptr<lsl::stream_inlet>(new lsl::stream_inlet(streamInfos[0]));
+				channelCount = std::max(streamInfos[0].channel_count(), 1);
+				localBuffer.resize(PULL_CHUNK_SIZE * channelCount);
+				connected = true;
+			}
 
-            // Listen for input
-            try
-            {
-				upStreamInlet->pull_sample(localBuffer);
-            }
-            catch(lsl::lost_error e)
-            {
-                // Connection lost, do connection again
-                connected = false;
-                continue;
-            }
+			// Listen for input. Wait for first sample, then take all samples which arrived meanwhile at once
+			size_t count = 0;
+			try
+			{
+				if (upStreamInlet->pull_sample(&localBuffer[0], channelCount, 0.5) == 0.0) // timeout, so stop flag is checked
+				{
+					continue;
+				}
+				count = channelCount + upStreamInlet->pull_chunk_multiplexed(
+					&localBuffer[channelCount],
+					NULL, // no timestamps
+					localBuffer.size() - channelCount,
+					0);
+			}
+			catch(lsl::lost_error e)
+			{
+				// Connection lost, do connection again
+				connected = false;
+				continue;
+			}
 
-            // Write it to shared memory
-            pMutex->lock();
-            (*pBuffer).insert(pBuffer->end(), localBuffer.begin(), localBuffer.end()); // append values to shared buffer
-            pMutex->unlock();
-
-            // Clear local buffer
-            localBuffer.clear();
-        }
-    }));
+			// Write it to shared memory
+			pMutex->lock();
+			(*pBuffer).insert(pBuffer->end(), localBuffer.begin(), localBuffer.begin() + count); // append values to shared buffer
+			pMutex->unlock();
+		}
+	}));
 }
 
 LabStreamInput::~LabStreamInput()
 {
-    // Nothing to do
+	// Stop receiving, thread checks flag at least every second
+	_stop = true;
+	_upReceiverThread->join();
 }
 
 std::vector<std::string> LabStreamInput::Poll()
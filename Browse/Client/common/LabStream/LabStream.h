@@ -3,7 +3,10 @@
 // Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
 //============================================================================
 // Handles communication with LabStreamingLayer. Input only supports single
-// strings, output can be customized.
+// strings, output can be customized. Output does not push into LabStreamingLayer
+// on the sending thread. Samples are stamped at sending and put into a lock-free
+// queue, which a thread of the output pushes as chunk at least every given
+// latency, so the per call cost of LabStreamingLayer is paid once per chunk.
 
 #ifndef LABSTREAM_H_
 #define LABSTREAM_H_
@@ -20,11 +23,18 @@
 #pragma warning( pop )
 #endif
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
 #include <thread>
 #include <mutex>
 #include <string>
 #include <vector>
 
+// Default maximum time a sample waits in output before it is pushed
+const std::chrono::milliseconds LAB_STREAM_DEFAULT_MAX_LATENCY(5);
+
 // ########################
 // ### LAB STREAM INPUT ###
 // ########################
@@ -48,12 +58,106 @@ private:
 	LabStreamInput(const LabStreamInput&) {}
 	LabStreamInput& operator = (const LabStreamInput &) { return *this; }
 
+	// Maximum count of samples pulled at once
+	static const int PULL_CHUNK_SIZE = 64;
+
 	// Members
 	std::unique_ptr<std::thread> _upReceiverThread;
+	std::atomic<bool> _stop;
 	std::mutex _inputMutex;
 	std::vector<std::string> _inputBuffer;
 };
 
+// ###############################
+// ### LAB STREAM SAMPLE QUEUE ###
+// ###############################
+
+// Bounded lock-free queue of samples with timestamps. Several threads may push,
+// one thread pops. Slots keep their allocated data, so pushing numeric samples
+// of constant channel count does not allocate after the first round.
+template<typename Type>
+class LabStreamSampleQueue
+{
+public:
+
+	// Constructor, capacity is rounded up to power of two
+	LabStreamSampleQueue(size_t capacity)
+	{
+		size_t size = 2;
+		while (size < capacity) { size *= 2; }
+		_upSlots = std::unique_ptr<Slot[]>(new Slot[size]);
+		_mask = size - 1;
+		for (size_t i = 0; i < size; i++) { _upSlots[i].sequence = i; }
+		_pushPosition = 0;
+		_popPosition = 0;
+	}
+
+	// Push copy of sample, returns false when queue is full
+	bool Push(const std::vector<Type>& rData, double timestamp)
+	{
+		size_t position = _pushPosition.load(std::memory_order_relaxed);
+		Slot* pSlot = NULL;
+		while (true)
+		{
+			pSlot = &_upSlots[position & _mask];
+			size_t sequence = pSlot->sequence.load(std::memory_order_acquire);
+			if (sequence == position)
+			{
+				// Slot is free, try to claim it
+				if (_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) { break; }
+			}
+			else if (sequence < position)
+			{
+				return false; // slot still occupied by previous round, so queue is full
+			}
+			else
+			{
+				position = _pushPosition.load(std::memory_order_relaxed); // other thread was faster
+			}
+		}
+		pSlot->data.assign(rData.begin(), rData.end());
+		pSlot->timestamp = timestamp;
+		pSlot->sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Pop oldest sample and append its data to given vector, returns false when queue is empty
+	bool Pop(std::vector<Type>& rData, double& rTimestamp)
+	{
+		size_t position = _popPosition.load(std::memory_order_relaxed);
+		Slot* pSlot = &_upSlots[position & _mask];
+		if (pSlot->sequence.load(std::memory_order_acquire) != position + 1)
+		{
+			return false; // not yet written
+		}
+		rData.insert(rData.end(), std::make_move_iterator(pSlot->data.begin()), std::make_move_iterator(pSlot->data.end()));
+		rTimestamp = pSlot->timestamp;
+		_popPosition.store(position + 1, std::memory_order_relaxed);
+		pSlot->sequence.store(position + _mask + 1, std::memory_order_release); // free for next round
+		return true;
+	}
+
+private:
+
+	// Slot of queue. Sequence tells whether slot may be written or read in current round
+	struct Slot
+	{
+		std::atomic<size_t> sequence;
+		std::vector<Type> data;
+		double timestamp = 0.0;
+	};
+
+	// Private copy / assignment constructors
+	LabStreamSampleQueue(const LabStreamSampleQueue&) {}
+	LabStreamSampleQueue& operator = (const LabStreamSampleQueue &) { return *this; }
+
+	// Members
+	std::unique_ptr<Slot[]> _upSlots;
+	size_t _mask;
+	std::atomic<size_t> _pushPosition;
+	std::atomic<size_t> _popPosition;
+};
+
 // #########################
 // ### LAB STREAM OUTPUT ###
 // #########################
@@ -63,20 +167,58 @@ class LabStreamOutput
 {
 public:
 
-	// Constructor
-	LabStreamOutput(lsl::stream_info streamInfo)
+	// Constructor. Samples wait at most given latency before they are pushed into LabStreamingLayer
+	LabStreamOutput(lsl::stream_info streamInfo, std::chrono::milliseconds maxLatency = LAB_STREAM_DEFAULT_MAX_LATENCY) :
+		_queue(QUEUE_CAPACITY), _maxLatency(maxLatency), _stop(false), _pendingCount(0), _droppedCount(0)
 	{
 		// Set up stream outlet
 		_upStreamOutlet = std::unique_ptr<lsl::stream_outlet>(new lsl::stream_outlet(streamInfo));
+
+		// Start pushing thread
+		_upPushThread = std::unique_ptr<std::thread>(new std::thread(&LabStreamOutput::Push, this));
 	}
 
-	// Destructor
-	virtual ~LabStreamOutput() {}
+	// Destructor, pushes remaining samples
+	virtual ~LabStreamOutput()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_wakeMutex);
+			_stop = true;
+		}
+		_wakeCondition.notify_one();
+		_upPushThread->join();
+	}
+
+	// Send event. Timestamp in agreement with lsl::local_clock(), if omitted the current time is used
+	void Send(const std::vector<Type>& rData, double timestamp = 0.0)
+	{
+		if (timestamp == 0.0) { timestamp = lsl::local_clock(); }
+
+		// Count before pushing, so pushing thread never counts a sample it has not been told about
+		int pending = _pendingCount++;
+		if (!_queue.Push(rData, timestamp))
+		{
+			_pendingCount--;
+			_droppedCount++;
+			return;
+		}
 
-	// Send event
-	void Send(std::vector<Type> data)
+		// Wake up pushing thread for first sample of chunk. Lock is required so the wake up is not lost
+		if (pending == 0)
+		{
+			std::lock_guard<std::mutex> lock(_wakeMutex);
+			_wakeCondition.notify_one();
+		}
+		else if (pending + 1 == PUSH_CHUNK_SIZE)
+		{
+			_wakeCondition.notify_one(); // lost wake up only costs latency
+		}
+	}
+
+	// Count of samples dropped because queue was full
+	unsigned long long GetDroppedCount() const
 	{
-		_upStreamOutlet->push_sample(data);
+		return _droppedCount;
 	}
 
 private:
@@ -85,8 +227,53 @@ private:
 	LabStreamOutput(const LabStreamOutput&) {}
 	LabStreamOutput& operator = (const LabStreamOutput &) { return *this; }
 
+	// Capacity of queue, in samples
+	static const size_t QUEUE_CAPACITY = 8192;
+
+	// Count of samples which are pushed without waiting for maximum latency
+	static const int PUSH_CHUNK_SIZE = 256;
+
+	// Push queued samples as chunks, executed by thread
+	void Push()
+	{
+		std::vector<Type> chunk;
+		std::vector<double> timestamps;
+		while (true)
+		{
+			// Wait for first sample, then give further samples time to arrive
+			std::unique_lock<std::mutex> lock(_wakeMutex);
+			_wakeCondition.wait(lock, [this]() { return _stop || _pendingCount > 0; });
+			_wakeCondition.wait_for(lock, _maxLatency, [this]() { return _stop || _pendingCount >= PUSH_CHUNK_SIZE; });
+			bool stop = _stop;
+			lock.unlock();
+
+			// Collect samples and push them with their timestamps
+			chunk.clear();
+			timestamps.clear();
+			double timestamp = 0.0;
+			while (_queue.Pop(chunk, timestamp))
+			{
+				timestamps.push_back(timestamp);
+			}
+			_pendingCount -= (int)timestamps.size();
+			if (!timestamps.empty())
+			{
+				_upStreamOutlet->push_chunk_multiplexed(chunk, timestamps);
+			}
+			if (stop) { break; }
+		}
+	}
+
 	// Members
 	std::unique_ptr<lsl::stream_outlet> _upStreamOutlet;
+	LabStreamSampleQueue<Type> _queue;
+	std::chrono::milliseconds _maxLatency;
+	std::unique_ptr<std::thread> _upPushThread;
+	std::mutex _wakeMutex;
+	std::condition_variable _wakeCondition;
+	bool _stop; // guarded by wake mutex
+	std::atomic<int> _pendingCount;
+	std::atomic<unsigned long long> _droppedCount;
 };
 
 #endif // LABSTREAM_H_
\ No newline at end of file
@@ -54,7 +54,7 @@ function SendAttributeChangesToCEF(attrStr, domObj)
     
     var msg = "DOM#upd#"+domObj.getType()+"#"+domObj.getId()+"#"+attrCode+"#"+encodedData+"#";
 
-    ConsolePrint(msg);
+    SendBatchedMessage(msg);
     // console.log("AttrChanges: "+msg);
     return "Success, sent: "+msg;
 }
@@ -22,24 +22,18 @@ function FixedElement(node)
 
     window.domFixedElements.push(this);
     this.id = window.domFixedElements.indexOf(this);
+    window.fixed_elements_by_node.set(node, this);
 
     /* Attributes */
     this.node = node;
     this.rects = [];
-    
-    this.node.setAttribute("fixedId", this.id);
-
-    // Set childFixedId for 1st generation of child nodes, rest will be done by MutationObserver
-    var scoped_id = this.id;
-    ForEveryChild(this.node, (child) => {
-        if(typeof(child.setAttribute) !== "function")
-            return;
-        
-        child.setAttribute("childFixedId", scoped_id);
-    });
+
+    // Nodes in subtree belong to this fixed element from now on
+    InvalidateAncestorCache();
+    ScheduleAncestorUpdate(node);
     
     // Compute fixed subtree's rects and inform CEF
-    this.updateRects();
+    ScheduleRectUpdate(this);
 }
 
 FixedElement.prototype.getId = function(){
@@ -51,9 +45,8 @@ FixedElement.prototype.getRects = function(){
 }
 
 FixedElement.prototype.updateRects = function(){
-    var cs = window.getComputedStyle(this.node, null);
     // Delete fixed element object, if position isn't fixed anymore
-    if(cs.getPropertyValue("position") !== "fixed" || cs.getPropertyValue("display") == "none")
+    if(GetComputedStyleValue(this.node, "position") !== "fixed" || GetComputedStyleValue(this.node, "display") == "none")
     {
         RemoveFixedElement(this.node);
         return true;
@@ -64,7 +57,7 @@ FixedElement.prototype.updateRects = function(){
     // NOTE: Fix for GMail. There exist DIVs without any children, whose rects cover the whole page and they are fixed
     // although this does not seem to influence anything
     if((this.node.tagName === "DIV" && this.node.children.length === 0)
-        || ( window.getComputedStyle(this.node, null).getPropertyValue("display") === "none")) // 9gag inactivity overlay
+        || (GetComputedStyleValue(this.node, "display") === "none")) // 9gag inactivity overlay
     {
         var previous_rects = this.rects;
         this.rects = [[0,0,0,0]];
@@ -91,8 +84,8 @@ FixedElement.prototype.updateRects = function(){
             
 
             if(child.nodeType === 1 && 
-                window.getComputedStyle(child, null).getPropertyValue("opacity") !== "0" &&
-                window.getComputedStyle(child, null).getPropertyValue("visibility") !== "hidden")
+                GetComputedStyleValue(child, "opacity") !== "0" &&
+                GetComputedStyleValue(child, "visibility") !== "hidden")
             {
                 var cr = child.getClientRects();
                 for(var i = 0, n = cr.length; i < n; i++)
@@ -118,13 +111,12 @@ FixedElement.prototype.updateRects = function(){
         (node) => { 
             if (node.nodeType === 1)
             {
-                var cs = window.getComputedStyle(node, null);
                 // Skip children if invisible
-                if(cs.getPropertyValue("opacity") === 0)
+                if(GetComputedStyleValue(node, "opacity") === "0")
                     return true;
                 // ... or overflow element, which would cover children anyway outside of rect
                 var hiding = ["hidden", "scroll", "auto"]
-                if(hiding.indexOf(cs.getPropertyValue("overflow")) !== -1)
+                if(hiding.indexOf(GetComputedStyleValue(node, "overflow")) !== -1)
                 {
                     // ... but keep updating child rects, if registered DOMObject!
                     ForEveryChild(node, (child) => {
@@ -156,7 +148,7 @@ FixedElement.prototype.updateRects = function(){
 
     if(changed)
         // Inform CEF that fixed element has been updated
-        ConsolePrint("#fixElem#add#"+this.id+"#");
+        SendBatchedMessage("#fixElem#add#"+this.id+"#");
 
     return changed;
 }
@@ -167,16 +159,15 @@ function AddFixedElement(node)
     if(typeof(node.hasAttribute) !== "function")
         return false;
 
-    if(node.hasAttribute("childFixedId"))
+    // Subtree of fixed element is covered by it already
+    if(GetFixedElementOf(node.parentNode) !== undefined)
         return false;
 
-    if(node.hasAttribute("fixedId"))
+    var fixedObj = GetFixedElementByNode(node);
+    if(fixedObj !== undefined)
     {
-        var id = node.getAttribute("fixedId")
-        var fixedObj = GetFixedElementById(id);
         // Trigger rect updates of whole subtree, just in case
-        if(fixedObj !== undefined)
-            fixedObj.updateRects();
+        ScheduleRectUpdate(fixedObj);
 
         return false;
     }
@@ -203,27 +194,14 @@ function RemoveFixedElement(node)
     if(id >= 0 && id < window.domFixedElements.length)
     {
         delete window.domFixedElements[id];
-        ConsolePrint("#fixElem#rem#"+id);
+        SendBatchedMessage("#fixElem#rem#"+id);
     }
 
-    node.removeAttribute("fixedId");
+    window.fixed_elements_by_node.delete(node);
 
-    // Set childrens fixedIds to this node's parent fixed id, if any
-    var childFixedId = node.getAttribute("childFixedId");
-    if(childFixedId)
-    {
-        node.childNodes.forEach((child) => {
-            if(typeof(child.setAttribute) === "function")
-                child.setAttribute("childFixedId", childFixedId);
-        });
-    }
-    else
-    {
-        node.childNodes.forEach((child) => {
-            if(typeof(child.removeAttribute) === "function")
-                child.removeAttribute("childFixedId");
-        });
-    }
+    // Nodes in subtree belong to fixed ancestor, if any
+    InvalidateAncestorCache();
+    ScheduleAncestorUpdate(node);
     
     // Just in case
     // UpdateDOMRects("RemoveFixedElement");
@@ -93,21 +93,18 @@ document.addEventListener('transitionend', function(event){
 	if(fixedElem !== undefined)
 	{
 		// If root is fixed element, subtree will be updated by simply calling updateRects
-		fixedElem.updateRects();
+		ScheduleRectUpdate(fixedElem);
 		return;
 	}
 
 	// DOMObjects might not be visible if any parent has opacity == 0, so store information about
 	// possible hidding parents as node attributes, check these in DOMNode.updateRects
 	var hiding_reason = undefined;
-	var cs = window.getComputedStyle(root, null);
-	if(cs.getPropertyValue("opacity") === "0")
+	if(GetComputedStyleValue(root, "opacity") === "0")
 		hiding_reason = "opacity";
 
 	// Update rects of given root node
-	var obj = GetCorrespondingDOMObject(root);
-	if(obj !== undefined)
-		obj.updateRects();
+	ScheduleRectUpdate(GetCorrespondingDOMObject(root));
 
 	// Update rects of whole subtree beneath root node
 	ForEveryChild(root, 
@@ -127,15 +124,9 @@ document.addEventListener('transitionend', function(event){
 
 			var fixedElem = GetFixedElementByNode(child);
 			if(fixedElem === undefined)
-			{
-				var obj = GetCorrespondingDOMObject(child);
-				if (obj !== undefined)
-				{
-					obj.updateRects();
-				}
-			}
+				ScheduleRectUpdate(GetCorrespondingDOMObject(child));
 			else
-				fixedElem.updateRects();
+				ScheduleRectUpdate(fixedElem);
 		},
 		(child) => {
 			// Abort rect update of childs subtree, if child is fixed element
@@ -294,14 +285,8 @@ function AnalyzeNode(node)
 		// 	ForEveryChild(node, AnalyzeNode);
 		// }
 
-		var computedStyle = window.getComputedStyle(node, null);
-		if(!computedStyle)
-		{
-			console.log("AnalyzeNode: computedStyle is null.");
-		}
-
 		// Identify fixed elements on appending them to DOM tree
-		if(computedStyle && computedStyle.getPropertyValue('position') == 'fixed') 
+		if(GetComputedStyleValue(node, "position") == 'fixed') 
 		{
 			// Returns true if new FixedElement was added; false if already linked to FixedElement Object
 			if(AddFixedElement(node))
@@ -459,12 +444,10 @@ function AnalyzeNode(node)
 			CreateDOMLink(node);
 		}
 
-		var rect = node.getBoundingClientRect();
-
 		// Detect scrollable elements inside of webpage
-		if(computedStyle && (node.tagName === "DIV" || node.tagName === "P"))// && rect.width > 0 && rect.height > 0)
+		if(node.tagName === "DIV" || node.tagName === "P")
 		{
-			var overflow = computedStyle.getPropertyValue("overflow");
+			var overflow = GetComputedStyleValue(node, "overflow");
 			var valid_overflow = ["scroll", "auto", "hidden"];
 			if(valid_overflow.indexOf(overflow) !== -1)
 			{
@@ -472,8 +455,8 @@ function AnalyzeNode(node)
 			}
 			else
 			{
-				var overflowX = computedStyle.getPropertyValue("overflow-x");
-				var overflowY = computedStyle.getPropertyValue("overflow-y");
+				var overflowX = GetComputedStyleValue(node, "overflow-x");
+				var overflowY = GetComputedStyleValue(node, "overflow-y");
 				if(valid_overflow.indexOf(overflowX) !== -1 || valid_overflow.indexOf(overflowY) !== -1)
 				//if(overflowX === "auto" || overflowX === "scroll" || overflowY === "auto" || overflowY === "scroll")
 				{
@@ -496,19 +479,7 @@ function AnalyzeNode(node)
 					if(!child.analyzed)
 						AnalyzeNode(child);
 					if(child.nodeType == 1)
-					{
-						var nodeType = child.getAttribute('nodeType');
-						if(nodeType)
-						{
-							var nodeID = child.getAttribute('nodeID');
-							var domObj = GetDOMObject(nodeType, nodeID);
-							if(domObj)
-							{
-								domObj.updateRects();
-							}
-						}
-					}
-				
+						ScheduleRectUpdate(GetCorrespondingDOMObject(child));
 			});
 		}, false);
 
@@ -526,6 +497,9 @@ function MutationObserverInit()
 	window.observer = new MutationObserver(
 		function(mutations) 
 		{
+			mutation_statistics.callbacks++;
+			mutation_statistics.records += mutations.length;
+
 		  	mutations.forEach(
 		  		function(mutation)
 		  		{
@@ -547,66 +521,18 @@ function MutationObserverInit()
 		  				{
 		  					attr = mutation.attributeName;
 
-							// ### FIXED HIERARCHY HANDLING ###
-							// Created FixedElement adds attribute childFixedId with its id as value to all
-							// its direct child nodes. Rest of the tree cascade down by using MutationObserver
-							// as follows:
-							// 1.) Set equivalently valued childFixedId attribute in each direct child node
-							// 2.) Check if corresponding domObj exists and add fixObj with childFixedId as id
-							if(attr === "childfixedid")
-							{
-								var id = node.getAttribute(attr);
-
-								// Set childFixedId for each child of altered node
-
-								node.childNodes.forEach((child) => {
-									// Extend node by given attribute
-									if(typeof(child.setAttribute) === "function")
-									{
-										child.setAttribute("childFixedId", id);
-									}
-								});
-								
-								// Update fixObj in DOMObject
-								var fixObj = GetFixedElementById(id);
-								var domObj = GetCorrespondingDOMObject(node);
-								if(domObj !== undefined)
-								{
-									domObj.setFixObj(fixObj);	// fixObj may be undefined
-									domObj.updateRects();
-								}
-							}
+							// ### FIXED AND OVERFLOW HIERARCHY ###
+							// Membership of nodes in fixed elements and overflow elements is resolved from their ancestors
+							// (see GetFixedElementOf and GetOverflowElementOf) and updated on structural changes in the
+							// childList handling below. No attributes are written into the page for that.
 
 							if(attr === "scrollWidth" || attr === "scrollHeight")
 								console.log("### Detected changes in attr "+attr+" ###");
 
-							// ### OVERFLOW HIERARCHY HANDLING ###
-							// node's overflowid attribute was set (changed): Set childrens' overflowIds when node gets tagged as part of overflow subtree 
-							if(attr == "overflowid")
-							{
-								// console.log(attr, "changed for ", node);
-								var id = node.getAttribute("overflowid");
-								var domObj = SetOverflowObjectViaId(node, id);
-								if(domObj === undefined)
-									var skip_subtree = false;
-								else 
-									var skip_subtree = (domObj.Class === "DOMOverflowElement");
-
-								if(!skip_subtree)
-								{
-									for(var i = 0, n = node.childNodes.length; i < n; i++)
-									{			
-										SetOverflowId(node.childNodes[i], id);
-									}
-								}
-							}
-
-
-							
 							// ### CREATION AND REMOVAL OF FIXED ELEMENTS ###
 		  					if(attr == 'style') // ||  (document.readyState != 'loading' && attr == 'class') )
 		  					{
-								if(window.getComputedStyle(node, null).getPropertyValue('position') === 'fixed')
+								if(GetComputedStyleValue(node, "position") === 'fixed')
 								{
 									if(AddFixedElement(node))
 										// Update every Rect, just in case anything changed due to an additional fixed element
@@ -626,7 +552,7 @@ function MutationObserverInit()
 								if((curr_display_none && !old_display_none) || (!curr_display_none && old_display_none))
 								{
 									console.log("style.display changed: curr="+curr_display_none+", old="+old_display_none);
-									ForEveryChild(node, (c) => { UpdateNodesRect(c); })
+									ForEveryChild(node, (c) => { UpdateNodesRect(c); });
 								}
 
 							}
@@ -648,7 +574,7 @@ function MutationObserverInit()
 							
 								// Node might get fixed or un-fixed if class changes
 								if(typeof(node.getAttribute) === "function" && 
-									window.getComputedStyle(node, null).getPropertyValue("position") === "fixed")
+									GetComputedStyleValue(node, "position") === "fixed")
 								{
 									AddFixedElement(node);
 								}
@@ -656,28 +582,15 @@ function MutationObserverInit()
 
 								// Update (if existant) DOM object's rects if node's class changed
 								// var domObj = GetCorrespondingDOMObject(node);
-								if(domObj !== undefined)
-									domObj.updateRects();
+								ScheduleRectUpdate(domObj);
 
 								// ### FIXED ELEMENT BOUNDING BOX UPDATES ###
 								// Changes in attribute 'class' may indicate that a fixed element's union of bounding rects needs to be updated
-								// Trigger fixed parent update, if it exists. All of its children will be updated
-								var childFixedId = node.getAttribute("childFixedId");
-								if(childFixedId !== null && childFixedId !== null)
-								{
-									var fixObj = GetFixedElementById(childFixedId);
-									if(fixObj !== undefined)
-									{
-										fixObj.updateRects();
-										return;
-									}
-								}
-
-								// Else, if node is fixed, subtree will be updated too
-								var fixObj = GetFixedElementByNode(node);
+								// Trigger update of fixed element the node belongs to, if it exists. All of its children will be updated
+								var fixObj = GetFixedElementOf(node);
 								if(fixObj !== undefined)
 								{
-									fixObj.updateRects();
+									ScheduleRectUpdate(fixObj);
 									return;
 								}
 
@@ -711,6 +624,10 @@ function MutationObserverInit()
 			  			var nodes = mutation.addedNodes;
 						var parent = mutation.target;
 						
+						// Structure changed, cached ancestors of nodes might be outdated
+						if(mutation.addedNodes.length > 0 || mutation.removedNodes.length > 0)
+							InvalidateAncestorCache();
+
 						// Handle every appended child node
 			  			nodes.forEach((node) => {
 							if(node === undefined)
@@ -738,37 +655,10 @@ function MutationObserverInit()
 							// DEBUG
 							// console.log("childList mutation: ", node);							
 							
-							// Set children (and their subtree) to fixed, if parent is also fixed
-							if(parent !== undefined && parent.nodeType === 1 && node.nodeType === 1)
-							{
-								var id = parent.getAttribute("childfixedid");
-								if(id === null || id === undefined)
-									id = parent.getAttribute("fixedid");
+							// Resolve fixed element and overflow element of appended subtree from its new ancestors
+							if(node.nodeType === 1)
+								ScheduleAncestorUpdate(node);
 
-								if(id !== null && id !== undefined)
-								{
-									node.setAttribute("childfixedid", id);
-									var domObj = GetCorrespondingDOMObject(node);
-									if(domObj !== undefined)
-										domObj.setFixObj(GetFixedElementById(id));
-								}
-							}
-
-							// If parent is contained in overflow element, then child will also be
-							if(parent !== undefined && typeof(parent.getAttribute) === "function") 
-							{
-								var parentDomObj = GetCorrespondingDOMObject(parent);
-								
-								// If parent is overflow element, use its id instead
-								if(parentDomObj !== undefined && parentDomObj.Class === "DOMOverflowElement")
-									var overflowId = parentDomObj.getId();
-								else
-									var overflowId = parent.getAttribute("overflowid");
-								
-								SetOverflowId(node, overflowId);
-
-							}
-						
 			  				AnalyzeNode(node);
 						}); // END of forEach
 
@@ -776,15 +666,9 @@ function MutationObserverInit()
 						// TODO: Partial rect update for fixed elements?
 						if(parent.nodeType === 1)
 						{
-							var fixId = parent.getAttribute("childFixedId");
-							if(fixId !== null && fixId !== undefined)
-							{
-								var fixObj = GetFixedElementById(fixId);
-								if(fixObj !== null && fixObj !== undefined)
-								{
-									fixObj.updateRects();
-								}
-							}
+							var fixObj = GetFixedElementOf(parent);
+							if(fixObj !== undefined)
+								ScheduleRectUpdate(fixObj);
 						}
 
 						
@@ -868,6 +752,9 @@ function MutationObserverShutdown()
 
 
 var mutation_observer_working_time = 0;
+
+// Count of MutationObserver callbacks and of mutation records handled in them
+window.mutation_statistics = { callbacks: 0, records: 0 };
 var load_starting_time;
 
 function StartPageLoadingTimer()
@@ -881,6 +768,8 @@ function StopPageLoadingTimer()
 	ConsolePrint("Page load took "+page_load_duration+"ms");
 	ConsolePrint("MutationObserver operations took "+mutation_observer_working_time+"ms, "+
 		(100*mutation_observer_working_time/page_load_duration)+"% of page load.");
+	ConsolePrint("MutationObserver handled "+mutation_statistics.records+" mutations in "+
+		mutation_statistics.callbacks+" callbacks.");
 }
 
 function CreateCustomMutationObserver(node, attrFunc, childFunc)
@@ -32,9 +32,8 @@ function DOMNode(node, id, type, cef_hidden=false)
         return;
     }
 
-    // Store information in node attributes
-    node.setAttribute("nodeObjId", id);
-    node.setAttribute("nodeObjType", type);
+    // Remember object for node
+    window.dom_objects_by_node.set(node, this);
 
     this.node = node;
     this.id = id;
@@ -43,13 +42,13 @@ function DOMNode(node, id, type, cef_hidden=false)
 
     this.rects = []
     this.bitmask = [0];
-    // MutationObserver will handle setting up the following references, if necessary
+    // Resolved from ancestors, updated when tree changes
     this.fixObj = undefined;
     this.overflow = undefined;  // TODO: Rename to overflowObj for consistency?
 
     // Initial setup of fixObj & overflow objects
-    this.fixObj = GetFixedElementById(node.getAttribute("fixedId")) || GetFixedElementById(node.getAttribute("childFixedId"));
-    this.overflow = GetDOMOverflowElement(node.getAttribute("overflowid"));
+    this.fixObj = GetFixedElementOf(node);
+    this.overflow = GetOverflowElementOf(node);
 
 
     this.cppReady = false; // TODO: Queueing calls, when node isn't ready yet?
@@ -114,7 +113,7 @@ DOMNode.prototype.updateRects = function(altNode){
         UpdateRectUpdateTimer(t0);
         return "Error!";
     }
-    if(window.getComputedStyle(this.node, null).getPropertyValue("opacity") === 0)
+    if(GetComputedStyleValue(this.node, "opacity") === "0")
     {
         UpdateRectUpdateTimer(t0);  
         return this.setRectsToZero();
@@ -125,8 +124,7 @@ DOMNode.prototype.updateRects = function(altNode){
         for(var hiding_parent of this.node.hidden_by.keys())
         {
             var hiding_reason = this.node.hidden_by.get(hiding_parent);
-            if (hiding_reason === "opacity" && 
-                window.getComputedStyle(hiding_parent, null).getPropertyValue(hiding_reason) === "0")
+            if (hiding_reason === "opacity" && GetComputedStyleValue(hiding_parent, hiding_reason) === "0")
                 {
                     UpdateRectUpdateTimer(t0);
                     return this.setRectsToZero();
@@ -301,7 +299,7 @@ DOMNode.prototype.setFixObj = function(fixObj){
     {
         this.fixObj = fixObj;
         SendAttributeChangesToCEF("FixedId", this);
-        this.updateRects();
+        ScheduleRectUpdate(this);
     }
     return true;
 }
@@ -318,9 +316,15 @@ DOMNode.prototype.setOverflow = function(obj){
         this.overflow = obj;
         SendAttributeChangesToCEF("OverflowId", this);
         // Automatically trigger rect update
-        this.updateRects();
+        ScheduleRectUpdate(this);
     }
 }
+// Resolve fixed and overflow element from ancestors of node
+DOMNode.prototype.updateAncestors = function(){
+    this.setFixObj(GetFixedElementOf(this.node));
+    this.setOverflow(GetOverflowElementOf(this.node));
+}
+
 DOMNode.prototype.setOverflowViaId = function(id){
     // Reset overflow
     if(id === null || id === -1)
@@ -552,11 +556,7 @@ function DOMOverflowElement(node, cef_hidden=false)
         if(e.target.scrollLeft !== e.target.last_scroll_x || e.target.scrollTop !== e.target.last_scroll_y)
         {
             ForEveryChild(e.target, function(child){
-                var obj = GetCorrespondingDOMObject(child);
-                if(obj !== undefined)
-                {
-                    obj.updateRects();
-                }
+                ScheduleRectUpdate(GetCorrespondingDOMObject(child));
             });
             e.target.last_scroll_x = e.target.scrollLeft;
             e.target.last_scroll_y = e.target.scrollTop;
@@ -564,13 +564,9 @@ function DOMOverflowElement(node, cef_hidden=false)
     };
 
 
-    // Set first generation of childs overflowId, MutationObserver will handle the rest
-    for(var i = 0, n = node.childNodes.length; i < n; i++)
-    {
-        var child = node.childNodes[i];
-
-        SetOverflowId(child, id);
-    }
+    // Nodes in subtree are clipped by this overflow element from now on
+    InvalidateAncestorCache();
+    ScheduleAncestorUpdate(node);
 
 }
 DOMOverflowElement.prototype = Object.create(DOMNode.prototype);
@@ -678,9 +674,9 @@ DOMOverflowElement.prototype.updateOverflowProperties = function()
 
     // Fetch up-to-date properties
     var cs_overflows = [
-        window.getComputedStyle(this.node, null).getPropertyValue("overflow"),
-        window.getComputedStyle(this.node, null).getPropertyValue("overflow-y"),
-        window.getComputedStyle(this.node, null).getPropertyValue("overflow-x")
+        GetComputedStyleValue(this.node, "overflow"),
+        GetComputedStyleValue(this.node, "overflow-y"),
+        GetComputedStyleValue(this.node, "overflow-x")
     ];
 
     // Escape if properties haven't changed
@@ -31,6 +31,176 @@ function SendToMsgRouter(msg)
 
 ConsolePrint("Starting to import helpers.js ...");
 
+/*
+ * Batched DOM access
+ * Reading layout (computed styles, client rects, elementFromPoint) after a write to the DOM forces a synchronous
+ * reflow. Therefore, work triggered by mutations is not executed immediately but queued and flushed at the end of
+ * the current task: first all reads (including rect updates), then all writes. Messages to CEF which are created
+ * while reading are sent after the writes. Computed style values are cached until the batch has been flushed.
+ */
+window.dom_batch = {
+    rect_updates: new Set(),    // objects with updateRects function, multiple requests are merged
+    reads: [],
+    writes: [],
+    messages: [],
+    style_cache: new Map(),     // node -> Map(property -> value)
+    scheduled: false,
+    phase: undefined,           // "read" or "write" while flushing
+    tracing: false,             // set performance marks for each phase, e.g. by benchmark pages
+
+    // Statistics
+    flushes: 0,
+    rect_update_count: 0,
+    read_count: 0,
+    write_count: 0,
+    message_count: 0,
+    style_hits: 0,
+    style_misses: 0,
+    time: 0
+};
+
+// Flush batch at end of current task, before the page is rendered
+function ScheduleDOMBatchFlush()
+{
+    if(window.dom_batch.scheduled)
+        return;
+    window.dom_batch.scheduled = true;
+    Promise.resolve().then(FlushDOMBatch);
+}
+
+// Queue rect update of DOMNode or FixedElement object
+function ScheduleRectUpdate(obj)
+{
+    if(obj === undefined || typeof(obj.updateRects) !== "function")
+        return;
+    window.dom_batch.rect_updates.add(obj);
+    ScheduleDOMBatchFlush();
+}
+
+// Queue function which reads from the DOM but does not write to it
+function ScheduleRead(f)
+{
+    window.dom_batch.reads.push(f);
+    ScheduleDOMBatchFlush();
+}
+
+// Queue function which writes to the DOM, e.g. sets attributes
+function ScheduleWrite(f)
+{
+    window.dom_batch.writes.push(f);
+    ScheduleDOMBatchFlush();
+}
+
+// Send message to CEF, postponed until end of read phase if called while reading
+function SendBatchedMessage(msg)
+{
+    if(window.dom_batch.phase === "read")
+        window.dom_batch.messages.push(msg);
+    else
+        ConsolePrint(msg);
+}
+
+// Get computed style value of node, cached until batch is flushed
+function GetComputedStyleValue(node, property)
+{
+    if(node === null || node === undefined || node.nodeType !== 1)
+        return "";
+
+    var batch = window.dom_batch;
+    var values = batch.style_cache.get(node);
+    if(values === undefined)
+    {
+        values = new Map();
+        batch.style_cache.set(node, values);
+
+        // Cache must not outlive current task
+        ScheduleDOMBatchFlush();
+    }
+    var value = values.get(property);
+    if(value === undefined)
+    {
+        var cs = window.getComputedStyle(node, null);
+        value = (cs && typeof(cs.getPropertyValue) === "function") ? cs.getPropertyValue(property) : "";
+        values.set(property, value);
+        batch.style_misses++;
+    }
+    else
+        batch.style_hits++;
+    return value;
+}
+
+function FlushDOMBatch()
+{
+    var batch = window.dom_batch;
+    if(batch.phase !== undefined) // already flushing, e.g. CefPoll called while flushing
+        return;
+
+    var t_start = performance.now();
+    if(batch.tracing)
+        performance.mark("gtw_batch_start");
+
+    // Writes may cause further reads. Remaining work after some passes is left to the next batch
+    for(var pass = 0; pass < 4 && (batch.rect_updates.size > 0 || batch.reads.length > 0 || batch.writes.length > 0); pass++)
+    {
+        // Read phase
+        batch.phase = "read";
+        var rect_updates = batch.rect_updates;
+        var reads = batch.reads;
+        batch.rect_updates = new Set();
+        batch.reads = [];
+        rect_updates.forEach((obj) => { obj.updateRects(); });
+        reads.forEach((f) => { f(); });
+        batch.rect_update_count += rect_updates.size;
+        batch.read_count += reads.length;
+
+        if(batch.tracing)
+            performance.mark("gtw_batch_read_end");
+
+        // Write phase, invalidates cached styles
+        batch.phase = "write";
+        var writes = batch.writes;
+        batch.writes = [];
+        writes.forEach((f) => { f(); });
+        batch.write_count += writes.length;
+        if(writes.length > 0)
+            batch.style_cache = new Map();
+
+        // Send messages created while reading
+        var messages = batch.messages;
+        batch.messages = [];
+        messages.forEach((msg) => { ConsolePrint(msg); });
+        batch.message_count += messages.length;
+    }
+    batch.phase = undefined;
+    batch.style_cache = new Map();
+
+    // Scheduling is blocked while flushing, so flush again if work is left
+    batch.scheduled = false;
+    if(batch.rect_updates.size > 0 || batch.reads.length > 0 || batch.writes.length > 0)
+        ScheduleDOMBatchFlush();
+
+    if(batch.tracing)
+    {
+        if(pass > 0)
+            performance.measure("gtw_batch_read", "gtw_batch_start", "gtw_batch_read_end");
+        performance.measure("gtw_batch", "gtw_batch_start");
+    }
+    if(pass > 0)
+        batch.flushes++;
+    batch.time += performance.now() - t_start;
+}
+
+function PrintDOMBatchStatistics()
+{
+    var batch = window.dom_batch;
+    var style_reads = batch.style_hits + batch.style_misses;
+    ConsolePrint('### DOM batches: \t'+batch.flushes+' flushes took '+Math.round(batch.time * 1000) / 1000+'ms, '
+        +batch.rect_update_count+' rect updates, '+batch.read_count+' reads, '+batch.write_count+' writes, '
+        +batch.message_count+' messages');
+    ConsolePrint('### Computed styles: \t'+style_reads+' reads, '
+        +(style_reads > 0 ? Math.round(100 * batch.style_hits / style_reads) : 0)+'% from cache');
+}
+
 
 // TODO: Move CEF callable functions to separate js-file
 function CefPoll(num_partitions, update_partition)
@@ -78,15 +248,18 @@ function CefPoll(num_partitions, update_partition)
         list.forEach((o, idx) => { 
             if(!this_partitioned || (idx >= first && idx <= last) )
             {
-                if(typeof(o.updateRects()) === "function")
-                    o.updateRects();
-
-                SendAttributeChangesToCEF("OccBitmask", o);
-                SendAttributeChangesToCEF("Rects", o); // For language list on wikipedia.org main page, for example
+                ScheduleRectUpdate(o);
+                ScheduleRead(() => {
+                    SendAttributeChangesToCEF("OccBitmask", o);
+                    SendAttributeChangesToCEF("Rects", o); // For language list on wikipedia.org main page, for example
+                });
             } 
         });
     });
 
+    // Read layout of all nodes at once instead of node by node between writes
+    FlushDOMBatch();
+
 
     // DISABLED FOR DEBUGGING
     if(!partitioned)
@@ -154,6 +327,26 @@ function CefGetPageResolution()
     window.setInterval(callback, 250);
 })();
 
+/**
+ * Tell CEF whether some media element is playing with sound, so tab is not discarded while in background
+ */
+(function () {
+    var audible = false;
+    var callback = function() {
+        var nowAudible = Array.prototype.some.call(document.querySelectorAll("video, audio"), function(media) {
+            return !media.paused && !media.ended && !media.muted && media.volume > 0;
+        });
+        if(nowAudible !== audible)
+        {
+            audible = nowAudible;
+            ConsolePrint("#audible#"+(audible ? 1 : 0)+"#");
+        }
+    };
+    ["play", "playing", "pause", "ended", "volumechange", "emptied"].forEach(function(type) {
+        document.addEventListener(type, callback, true); // media events do not bubble, so capture them
+    });
+})();
+
 if(DOMRectList.prototype.map === undefined)
 {
     ConsolePrint("JS: Extending JS DOMRectList by own map function.");
@@ -258,13 +451,15 @@ function ForEveryChild(parentNode, applyFunction, abortFunction)
 	}
 }
 
+// FixedElement objects by their node
+window.fixed_elements_by_node = new WeakMap();
+
 function GetFixedElementByNode(node)
 {
-    if(typeof(node.getAttribute) !== "function" || typeof(node.setAttribute) !== "function")
+    if(node === null || node === undefined || typeof(node) !== "object")
         return undefined;
 
-    var fixedId = node.getAttribute("fixedId");
-    return GetFixedElementById(fixedId);
+    return window.fixed_elements_by_node.get(node);
 }
 
 function GetFixedElementById(id)
@@ -293,27 +488,17 @@ function UpdateDOMRects(num_partitions)
 
     
     window.domNodes.forEach(domList => {
-        domList.forEach(obj => {
-            if(typeof(obj.updateRects) === "function")
-                obj.updateRects();
-        });
+        domList.forEach(obj => { ScheduleRectUpdate(obj); });
     });
 
-    window.domFixedElements.forEach(fixObj => {
-        if(typeof(fixObj.updateRects) === "function")
-            fixObj.updateRects();
-    });
+    window.domFixedElements.forEach(fixObj => { ScheduleRectUpdate(fixObj); });
 }
 
+// Schedule rect update of DOM object and fixed element corresponding to node
 function UpdateNodesRect(node)
 {
-    var domObj = GetCorrespondingDOMObject(node);
-    if(domObj !== undefined)
-        domObj.updateRects();
-
-    var fixObj = GetFixedElementByNode(node);
-    if(fixObj !== undefined)
-        fixObj.updateRects();
+    ScheduleRectUpdate(GetCorrespondingDOMObject(node));
+    ScheduleRectUpdate(GetFixedElementByNode(node));
 }
 
 function UpdateChildNodesRects(node)
@@ -376,21 +561,19 @@ function GetDOMOverflowElement(id){ return GetDOMObject(3, id); }
 function GetDOMVideo(id){ return GetDOMObject(4, id); }
 function GetDOMCheckbox(id){ return GetDOMObject(5, id); }
 
+// DOMNode objects by their node, avoids attribute lookups and writes
+window.dom_objects_by_node = new WeakMap();
+
 function GetCorrespondingDOMObject(node, expected_type)
 {
-    if(typeof(node.getAttribute) !== "function")
+    if(node === null || node === undefined || typeof(node) !== "object")
         return undefined;
     
-    var type = node.getAttribute("nodeObjType");
-    if(expected_type !== undefined && type !== expected_type)
-        return undefined;
-
-    var id = node.getAttribute("nodeObjId");
-
-    if(type === null || id === null)
+    var obj = window.dom_objects_by_node.get(node);
+    if(obj === undefined || (expected_type !== undefined && obj.getType() !== expected_type))
         return undefined;
 
-    return GetDOMObject(type, id);
+    return obj;
 }
 function GetCorrespondingDOMOverflow(node){ return GetCorrespondingDOMObject(node, 3); }
 
@@ -590,6 +773,12 @@ function PrintPerformanceInformation()
     ConsolePrint('### Bitmask creation: \t'+Math.round(time_spent_creating_bitmask / 1000)+'s / '+
         Math.round(time_spent_creating_bitmask * 1000) / 1000 +'ms -- '+
             100*Math.round(time_spent_creating_bitmask/window.page_load_time_*1000)/1000 +'% of page load time');
+    if(window.dom_injection_time_ !== undefined)
+        ConsolePrint('### Injection of DOM code: \t'+Math.round(window.dom_injection_time_ * 1000)/1000+'ms');
+    if(window.performance.memory !== undefined)
+        ConsolePrint('### JS heap of main frame: \t'+Math.round(window.performance.memory.usedJSHeapSize / (1024 * 1024))+'MB used, '
+            +Math.round(window.performance.memory.totalJSHeapSize / (1024 * 1024))+'MB total');
+    PrintDOMBatchStatistics();
 }
 
 function SendFaviconURLtoCEF(url)
@@ -646,53 +835,84 @@ function CheckOverflowProperties(node)
     console.log("overflow-y: ", cs.getPropertyValue("overflow-y"));
 }
 
-// ComputedStyle (cs) is optional, because already present in some parts of the code where this function is called
-function SetOverflowId(node, id, cs)
+/*
+ * Membership of nodes in fixed and overflow subtrees
+ * Resolved on demand by walking up the tree until a node with known membership is found. Results are cached for
+ * every visited node. The cache is dropped whenever the tree structure or the set of fixed or overflow elements
+ * changes, afterwards DOM objects in affected subtrees resolve their membership again.
+ */
+window.ancestor_cache = { fixed: new WeakMap(), overflow: new WeakMap() }; // node -> object or null
+
+function InvalidateAncestorCache()
 {
-    // console.log("SetOverflowId called with id ", id, " for ", node);
-    if(node === undefined || typeof(node.setAttribute) !== "function") // Assume, that removeAttribute is also present when setAttribute is
-        return;
+    window.ancestor_cache.fixed = new WeakMap();
+    window.ancestor_cache.overflow = new WeakMap();
+}
 
-    // Remove overflowId
-    if(id === null)
+// Walk up from node until function decides membership or a cached node is found. Caches result for visited nodes
+function ResolveAncestor(cache, node, decide)
+{
+    var visited = [];
+    var result = null;
+    for(var n = node; n !== null && n !== undefined; n = n.parentNode)
     {
-	    // TODO: Search for hierachically higher overflows!
-        node.removeAttribute("overflowid");
-        return;
+        var cached = cache.get(n);
+        if(cached !== undefined)
+        {
+            result = cached;
+            break;
+        }
+        visited.push(n);
+        var decision = decide(n);
+        if(decision !== undefined)
+        {
+            result = decision;
+            break;
+        }
     }
+    for(var i = 0, n = visited.length; i < n; i++)
+        cache.set(visited[i], result);
+    return (result === null) ? undefined : result;
+}
 
-    // Get ComputedStyle, if not already provided in function call
-    if(!cs)
-        cs = window.getComputedStyle(node, null);
-
-    if(typeof(cs.getPropertyValue) !== "function")
-        return;
+// FixedElement of node itself or of its nearest fixed ancestor
+function GetFixedElementOf(node)
+{
+    return ResolveAncestor(window.ancestor_cache.fixed, node, (n) => { return GetFixedElementByNode(n); });
+}
 
-    var css_position = cs.getPropertyValue("position");
-    // Absolutely positioned children don't get clipped on overflow parents
-    if(css_position !== "absolute")
-        node.setAttribute("overflowId", id);
+// DOMOverflowElement which clips node, i.e. its nearest overflow ancestor
+function GetOverflowElementOf(node)
+{
+    return ResolveAncestor(window.ancestor_cache.overflow, node, (n) => {
+        // Absolutely positioned nodes don't get clipped on overflow parents
+        if(n.nodeType === 1 && GetComputedStyleValue(n, "position") === "absolute")
+            return null;
+        return GetCorrespondingDOMObject(n.parentNode, 3);
+    });
 }
 
-// Returns corresponding DOMObject if any exists
-function SetOverflowObjectViaId(node, id)
+// Let DOM objects in subtree of root, including root itself, resolve their fixed and overflow element again
+var ancestor_update_roots = new Set();
+function ScheduleAncestorUpdate(root)
 {
-    if(id === undefined)
-        console.log("SetOverflowObjectViaId: Second argument 'id' is undefined!");
+    if(root === null || root === undefined)
+        return;
 
-    // console.log("SetOverflowObjectViaId called with id ",id, " for ", node);
-    var domObj = GetCorrespondingDOMObject(node);
-    if(domObj !== undefined)
+    if(ancestor_update_roots.size === 0)
     {
-        // DEBUG
-        //if(domObj.getType() === 3)
-        // console.log("Setting overflow to id: ", id, " for ", domObj);
-
-        // id of null or -1 will reset overflow object in domObj
-        domObj.setOverflowViaId(id);
-        return domObj;
+        ScheduleRead(() => {
+            var roots = ancestor_update_roots;
+            ancestor_update_roots = new Set();
+            var update = (node) => {
+                var obj = GetCorrespondingDOMObject(node);
+                if(obj !== undefined)
+                    obj.updateAncestors();
+            };
+            roots.forEach((r) => { update(r); ForEveryChild(r, update); });
+        });
     }
-    return undefined;
+    ancestor_update_roots.add(root);
 }
 
 function IsAncestor(child, ancestor, depth=0)
@@ -707,4 +927,34 @@ function IsAncestor(child, ancestor, depth=0)
         return IsAncestor(child.parentElement, ancestor, depth);
 }
 
+// Resource hints given by link prediction, by rel and href
+window.resource_hints = new Map();
+
+// Add link element with resource hint to head, e.g. rel="preconnect" and href of origin
+function AddResourceHint(rel, href)
+{
+    var key = rel + " " + href;
+    if(window.resource_hints.has(key))
+        return;
+
+    var link = document.createElement("link");
+    link.rel = rel;
+    link.href = href;
+    (document.head || document.documentElement).appendChild(link);
+    window.resource_hints.set(key, link);
+}
+
+// Remove resource hint again, browser may cancel pending requests
+function RemoveResourceHint(rel, href)
+{
+    var key = rel + " " + href;
+    var link = window.resource_hints.get(key);
+    if(link === undefined)
+        return;
+
+    if(link.parentNode)
+        link.parentNode.removeChild(link);
+    window.resource_hints.delete(key);
+}
+
 ConsolePrint("Successfully imported helpers.js!");
\ No newline at end of file
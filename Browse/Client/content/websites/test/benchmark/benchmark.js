@@ -0,0 +1,80 @@
+// Shared code of DOM tracking benchmark pages. Each page builds its content, then applies bursts of mutations and
+// reports the time until the page is stable again, i.e. until no batch of the injected DOM scripts has been flushed
+// for a while. Script time of the injected scripts is reported from their batch statistics. For forced reflows,
+// record a trace with category "blink" in chrome://tracing (or remote debugging) and count "Layout" events with a
+// JavaScript stack. All results are printed to the console and to the result element of the page.
+
+var benchmark_stable_time = 500; // ms without flushes until page is considered stable
+
+function BenchmarkReport(text)
+{
+	console.log("Benchmark: " + text);
+	var result = document.getElementById("result");
+	if(result)
+		result.textContent += text + "\n";
+}
+
+function BenchmarkStatistics()
+{
+	var batch = window.dom_batch;
+	if(batch === undefined)
+		return "injected DOM scripts not found";
+	return batch.flushes + " flushes, " + Math.round(batch.time) + "ms script time, "
+		+ batch.rect_update_count + " rect updates, " + batch.write_count + " writes, "
+		+ batch.style_misses + " computed style reads (" + batch.style_hits + " cached)"
+		+ ((window.mutation_statistics !== undefined) ? (", " + window.mutation_statistics.records + " mutations in "
+		+ window.mutation_statistics.callbacks + " observer callbacks") : "");
+}
+
+// Wait until injected scripts are idle, then call back with elapsed time since start
+function BenchmarkWaitForStable(start, callback)
+{
+	var last_flushes = -1;
+	var last_change = performance.now();
+	var check = function()
+	{
+		var flushes = (window.dom_batch !== undefined) ? window.dom_batch.flushes : 0;
+		var now = performance.now();
+		if(flushes !== last_flushes)
+		{
+			last_flushes = flushes;
+			last_change = now;
+		}
+		if(now - last_change >= benchmark_stable_time)
+			callback(last_change - start);
+		else
+			setTimeout(check, 50);
+	};
+	check();
+}
+
+// Run burst function for given count of rounds and report time to stable page after each round
+function BenchmarkRun(name, rounds, burst)
+{
+	if(window.dom_batch !== undefined)
+		window.dom_batch.tracing = true;
+
+	var round = 0;
+	var next = function()
+	{
+		if(round >= rounds)
+		{
+			BenchmarkReport(name + " done: " + BenchmarkStatistics());
+			return;
+		}
+		performance.mark(name + "_" + round);
+		var start = performance.now();
+		burst(round);
+		BenchmarkWaitForStable(start, function(elapsed) {
+			BenchmarkReport(name + " round " + round + ": stable after " + Math.round(elapsed) + "ms");
+			round++;
+			next();
+		});
+	};
+
+	// Let initial analysis of page settle first
+	BenchmarkWaitForStable(performance.now(), function() {
+		BenchmarkReport(name + " initial: " + BenchmarkStatistics());
+		next();
+	});
+}
@@ -12,20 +12,21 @@ namespace eyetracker_global
 	auto spSampleDataQueue = SampleQueue(new std::deque<SampleData>);
 	std::mutex mutex;
 	
-	// Wrapper for lab stream output
+	// Wrapper for lab stream output. Output only queues the sample, pushing is done by its own thread
 	struct LabStreamOutputWrapper
 	{
 	public:
-		LabStreamOutputWrapper(lsl::stream_info streamInfo, bool stream) : output(streamInfo), stream(stream) {}
+		LabStreamOutputWrapper(lsl::stream_info streamInfo, bool stream) : stream(stream), output(streamInfo), data(2) {}
 		void Continue() { stream = true; }
 		void Pause() { stream = false; }
-		void Update(const std::vector<double>& rData) {
-			if (stream) { output.Send(rData); } // send data if streaming ok
+		void Update(double x, double y) {
+			if (stream) { data[0] = x; data[1] = y; output.Send(data); } // send data if streaming ok, stamped now
 		}
 
 	private:
 		bool stream;
 		LabStreamOutput<double> output;
+		std::vector<double> data; // reused, so no allocation per sample
 	};
 	std::shared_ptr<LabStreamOutputWrapper> spLabStreamOutput = nullptr;
 
@@ -65,7 +66,7 @@ namespace eyetracker_global
 		mutex.lock(); // lock
 
 		// Send to lab streaming layer
-		if (spLabStreamOutput) { spLabStreamOutput->Update({ sample.x, sample.y }); } // handles pause etc. internally
+		if (spLabStreamOutput) { spLabStreamOutput->Update(sample.x, sample.y); } // handles pause etc. internally
 
 		// Push sample to queue
 		if (sample.valid) // only push valid samples to the queue
@@ -7,7 +7,9 @@
 #define EYETRACKER_H_
 
 // Decide about api style by define
-#ifdef DLL_IMPLEMENTATION  
+#ifndef _WIN32
+#define DLL_API __attribute__((visibility("default")))
+#elif defined DLL_IMPLEMENTATION  
 #define DLL_API __declspec(dllexport)   
 #else  
 #define DLL_API __declspec(dllimport)   
@@ -0,0 +1,448 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "OpenGazeClient.h"
+#include <cstring>
+
+#ifdef _WIN32
+#include <ws2tcpip.h>
+#pragma comment(lib, "Ws2_32.lib")
+#else
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+// Flags for sending, broken connection should not raise signal on POSIX
+#if !defined(_WIN32) && defined(MSG_NOSIGNAL)
+static const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+static const int SEND_FLAGS = 0;
+#endif
+
+// ##########################
+// ### SOCKET OF PLATFORM ###
+// ##########################
+
+bool OpenGazeSocketStartup()
+{
+#ifdef _WIN32
+	WSADATA wsaData;
+	return WSAStartup(MAKEWORD(2, 2), &wsaData) == 0;
+#else
+	return true;
+#endif
+}
+
+void OpenGazeSocketCleanup()
+{
+#ifdef _WIN32
+	WSACleanup();
+#endif
+}
+
+void OpenGazeSocketClose(OpenGazeSocket socket)
+{
+#ifdef _WIN32
+	closesocket(socket);
+#else
+	close(socket);
+#endif
+}
+
+// ########################
+// ### OPEN GAZE RECORD ###
+// ########################
+
+// Whitespace between attributes
+static bool IsWhitespace(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Compare characters with zero terminated string
+static bool Equals(const char* pCharacters, size_t length, const char* pString)
+{
+	return std::strlen(pString) == length && std::memcmp(pCharacters, pString, length) == 0;
+}
+
+OpenGazeRecord::OpenGazeRecord(const char* pBegin, const char* pEnd) : _pBegin(pBegin), _pEnd(pEnd), _pTag(pEnd), _tagLength(0)
+{
+	// Find name of tag after opening bracket
+	const char* pCursor = _pBegin;
+	while (pCursor < _pEnd && IsWhitespace(*pCursor)) { pCursor++; }
+	if (pCursor < _pEnd && *pCursor == '<')
+	{
+		_pTag = ++pCursor;
+		while (pCursor < _pEnd && !IsWhitespace(*pCursor) && *pCursor != '/' && *pCursor != '>') { pCursor++; }
+		_tagLength = pCursor - _pTag;
+	}
+}
+
+bool OpenGazeRecord::IsTag(const char* pTag) const
+{
+	return Equals(_pTag, _tagLength, pTag);
+}
+
+bool OpenGazeRecord::NextAttribute(
+	const char*& rpCursor,
+	const char*& rpName,
+	size_t& rNameLength,
+	const char*& rpValue,
+	size_t& rValueLength) const
+{
+	// Start after name of tag
+	const char* pCursor = rpCursor != NULL ? rpCursor : _pTag + _tagLength;
+
+	// Skip whitespace, end of tag has no further attributes
+	while (pCursor < _pEnd && IsWhitespace(*pCursor)) { pCursor++; }
+	if (pCursor >= _pEnd || *pCursor == '/' || *pCursor == '>')
+	{
+		return false;
+	}
+
+	// Name until equality sign
+	rpName = pCursor;
+	while (pCursor < _pEnd && *pCursor != '=' && !IsWhitespace(*pCursor)) { pCursor++; }
+	rNameLength = pCursor - rpName;
+	while (pCursor < _pEnd && IsWhitespace(*pCursor)) { pCursor++; }
+	if (pCursor >= _pEnd || *pCursor != '=')
+	{
+		return false;
+	}
+	pCursor++;
+
+	// Value in quotes
+	while (pCursor < _pEnd && IsWhitespace(*pCursor)) { pCursor++; }
+	if (pCursor >= _pEnd || *pCursor != '"')
+	{
+		return false;
+	}
+	rpValue = ++pCursor;
+	const char* pQuote = static_cast<const char*>(std::memchr(pCursor, '"', _pEnd - pCursor));
+	if (pQuote == NULL)
+	{
+		return false;
+	}
+	rValueLength = pQuote - rpValue;
+	rpCursor = pQuote + 1;
+	return true;
+}
+
+bool OpenGazeRecord::GetNumber(const char* pName, double& rValue) const
+{
+	const char* pCursor = NULL;
+	const char* pAttributeName = NULL;
+	const char* pValue = NULL;
+	size_t nameLength = 0, valueLength = 0;
+	while (NextAttribute(pCursor, pAttributeName, nameLength, pValue, valueLength))
+	{
+		if (Equals(pAttributeName, nameLength, pName))
+		{
+			return ParseNumber(pValue, pValue + valueLength, rValue);
+		}
+	}
+	return false;
+}
+
+bool OpenGazeRecord::ParseBestPointOfGaze(double& rX, double& rY, bool& rValid) const
+{
+	if (!IsTag("REC"))
+	{
+		return false;
+	}
+
+	// Go once over attributes, other values may be enabled in stream
+	bool foundX = false, foundY = false;
+	double valid = 0;
+	const char* pCursor = NULL;
+	const char* pName = NULL;
+	const char* pValue = NULL;
+	size_t nameLength = 0, valueLength = 0;
+	while (NextAttribute(pCursor, pName, nameLength, pValue, valueLength))
+	{
+		if (nameLength != 5 || std::memcmp(pName, "BPOG", 4) != 0)
+		{
+			continue;
+		}
+		switch (pName[4])
+		{
+		case 'X': foundX = ParseNumber(pValue, pValue + valueLength, rX); break;
+		case 'Y': foundY = ParseNumber(pValue, pValue + valueLength, rY); break;
+		case 'V': ParseNumber(pValue, pValue + valueLength, valid); break;
+		}
+	}
+	rValid = foundX && foundY && valid != 0;
+	return foundX && foundY;
+}
+
+bool OpenGazeRecord::ParseScreenSize(int& rX, int& rY, int& rWidth, int& rHeight) const
+{
+	if (!IsTag("ACK"))
+	{
+		return false;
+	}
+
+	// Check identifier of acknowledgement before fetching values
+	const char* pCursor = NULL;
+	const char* pName = NULL;
+	const char* pValue = NULL;
+	size_t nameLength = 0, valueLength = 0;
+	if (!NextAttribute(pCursor, pName, nameLength, pValue, valueLength)
+		|| !Equals(pName, nameLength, "ID")
+		|| !Equals(pValue, valueLength, "SCREEN_SIZE"))
+	{
+		return false;
+	}
+	double x = 0, y = 0, width = 0, height = 0;
+	if (GetNumber("X", x) && GetNumber("Y", y) && GetNumber("WIDTH", width) && GetNumber("HEIGHT", height))
+	{
+		rX = (int)x;
+		rY = (int)y;
+		rWidth = (int)width;
+		rHeight = (int)height;
+		return true;
+	}
+	return false;
+}
+
+bool OpenGazeRecord::ParseNumber(const char* pBegin, const char* pEnd, double& rValue)
+{
+	const char* pCursor = pBegin;
+
+	// Sign
+	bool negative = false;
+	if (pCursor < pEnd && (*pCursor == '-' || *pCursor == '+'))
+	{
+		negative = *pCursor == '-';
+		pCursor++;
+	}
+
+	// Integer and fractional part
+	double value = 0;
+	int digits = 0;
+	while (pCursor < pEnd && *pCursor >= '0' && *pCursor <= '9')
+	{
+		value = value * 10 + (*pCursor++ - '0');
+		digits++;
+	}
+	if (pCursor < pEnd && *pCursor == '.')
+	{
+		pCursor++;
+		double scale = 0.1;
+		while (pCursor < pEnd && *pCursor >= '0' && *pCursor <= '9')
+		{
+			value += (*pCursor++ - '0') * scale;
+			scale *= 0.1;
+			digits++;
+		}
+	}
+	if (digits == 0)
+	{
+		return false;
+	}
+
+	// Exponent
+	if (pCursor < pEnd && (*pCursor == 'e' || *pCursor == 'E'))
+	{
+		pCursor++;
+		bool negativeExponent = false;
+		if (pCursor < pEnd && (*pCursor == '-' || *pCursor == '+'))
+		{
+			negativeExponent = *pCursor == '-';
+			pCursor++;
+		}
+		int exponent = 0;
+		if (pCursor >= pEnd || *pCursor < '0' || *pCursor > '9')
+		{
+			return false;
+		}
+		while (pCursor < pEnd && *pCursor >= '0' && *pCursor <= '9')
+		{
+			exponent = exponent * 10 + (*pCursor++ - '0');
+		}
+		for (int i = 0; i < exponent; i++)
+		{
+			value = negativeExponent ? value / 10 : value * 10;
+		}
+	}
+
+	// Whole value must be number
+	if (pCursor != pEnd)
+	{
+		return false;
+	}
+	rValue = negative ? -value : value;
+	return true;
+}
+
+// ########################
+// ### OPEN GAZE CLIENT ###
+// ########################
+
+OpenGazeClient::OpenGazeClient(RecordCallback callback) : _callback(callback), _connected(false), _recordCount(0)
+{
+	// Nothing to do
+}
+
+OpenGazeClient::~OpenGazeClient()
+{
+	Disconnect();
+}
+
+bool OpenGazeClient::Connect(std::string address, unsigned short port)
+{
+	// Only one connection at once
+	Disconnect();
+	if (!OpenGazeSocketStartup())
+	{
+		return false;
+	}
+
+	// Resolve address of server
+	addrinfo hints;
+	std::memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_INET;
+	hints.ai_socktype = SOCK_STREAM;
+	hints.ai_protocol = IPPROTO_TCP;
+	addrinfo* pAddress = NULL;
+	if (getaddrinfo(address.c_str(), std::to_string(port).c_str(), &hints, &pAddress) != 0)
+	{
+		OpenGazeSocketCleanup();
+		return false;
+	}
+
+	// Connect blocking, receiving thread waits for records then
+	OpenGazeSocket newSocket = socket(pAddress->ai_family, pAddress->ai_socktype, pAddress->ai_protocol);
+	bool connected = newSocket != OPEN_GAZE_INVALID_SOCKET
+		&& connect(newSocket, pAddress->ai_addr, (int)pAddress->ai_addrlen) == 0;
+	freeaddrinfo(pAddress);
+	if (!connected)
+	{
+		if (newSocket != OPEN_GAZE_INVALID_SOCKET)
+		{
+			OpenGazeSocketClose(newSocket);
+		}
+		OpenGazeSocketCleanup();
+		return false;
+	}
+
+	// Commands are small and should not wait to be combined with further ones
+	int noDelay = 1;
+	setsockopt(newSocket, IPPROTO_TCP, TCP_NODELAY, (const char*)&noDelay, sizeof(noDelay));
+
+	// Start receiving
+	_socket = newSocket;
+	_connected = true;
+	_upReceiveThread = std::unique_ptr<std::thread>(new std::thread(&OpenGazeClient::Receive, this));
+	return true;
+}
+
+void OpenGazeClient::Disconnect()
+{
+	if (_socket == OPEN_GAZE_INVALID_SOCKET)
+	{
+		return;
+	}
+
+	// Shutdown wakes up receiving thread
+#ifdef _WIN32
+	shutdown(_socket, SD_BOTH);
+#else
+	shutdown(_socket, SHUT_RDWR);
+#endif
+	if (_upReceiveThread)
+	{
+		_upReceiveThread->join();
+		_upReceiveThread = nullptr;
+	}
+
+	// Close socket
+	OpenGazeSocketClose(_socket);
+	_socket = OPEN_GAZE_INVALID_SOCKET;
+	_connected = false;
+	OpenGazeSocketCleanup();
+}
+
+bool OpenGazeClient::IsConnected() const
+{
+	return _connected;
+}
+
+bool OpenGazeClient::SendCommand(const std::string& rCommand)
+{
+	std::string message = rCommand + "\r\n";
+	std::lock_guard<std::mutex> lock(_sendMutex);
+	size_t sent = 0;
+	while (sent < message.size())
+	{
+		int result = send(_socket, message.c_str() + sent, (int)(message.size() - sent), SEND_FLAGS);
+		if (result <= 0)
+		{
+			return false;
+		}
+		sent += result;
+	}
+	return true;
+}
+
+unsigned long long OpenGazeClient::GetRecordCount() const
+{
+	return _recordCount;
+}
+
+void OpenGazeClient::Receive()
+{
+	// Characters in buffer, which form at most one incomplete record after handing over complete ones
+	size_t filled = 0;
+	while (true)
+	{
+		// Wait for data or shutdown of socket
+		int received = recv(_socket, _receiveBuffer + filled, (int)(RECEIVE_BUFFER_SIZE - filled), 0);
+		if (received < 0)
+		{
+#ifndef _WIN32
+			if (errno == EINTR) { continue; }
+#endif
+			break;
+		}
+		if (received == 0)
+		{
+			break; // closed by server or shutdown
+		}
+
+		// Hand over complete records, incomplete record at front of buffer has no delimiter
+		const char* pRecord = _receiveBuffer;
+		const char* pSearch = _receiveBuffer + filled;
+		const char* pEnd = pSearch + received;
+		const char* pDelimiter = NULL;
+		while ((pDelimiter = static_cast<const char*>(std::memchr(pSearch, '\n', pEnd - pSearch))) != NULL)
+		{
+			const char* pRecordEnd = (pDelimiter > pRecord && pDelimiter[-1] == '\r') ? pDelimiter - 1 : pDelimiter;
+			if (pRecordEnd > pRecord)
+			{
+				_callback(OpenGazeRecord(pRecord, pRecordEnd));
+				_recordCount++;
+			}
+			pRecord = pSearch = pDelimiter + 1;
+		}
+
+		// Move incomplete record to front. Drop it when it fills whole buffer, as it never ends
+		filled = pEnd - pRecord;
+		if (filled == RECEIVE_BUFFER_SIZE)
+		{
+			filled = 0;
+		}
+		else if (filled > 0 && pRecord != _receiveBuffer)
+		{
+			std::memmove(_receiveBuffer, pRecord, filled);
+		}
+	}
+	_connected = false;
+}
@@ -0,0 +1,129 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Portable client for the OpenGaze API, using Winsock or POSIX sockets. A
+// thread receives the records of the server into a fixed buffer, which are
+// separated by "\r\n", and hands them to a callback while they are still in
+// that buffer. Records are tokenized in place, so nothing is allocated per
+// record. Callback is executed by the receiving thread.
+
+#ifndef OPENGAZECLIENT_H_
+#define OPENGAZECLIENT_H_
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Socket handle of platform
+#ifdef _WIN32
+#include <winsock2.h>
+typedef SOCKET OpenGazeSocket;
+static const OpenGazeSocket OPEN_GAZE_INVALID_SOCKET = INVALID_SOCKET;
+#else
+typedef int OpenGazeSocket;
+static const OpenGazeSocket OPEN_GAZE_INVALID_SOCKET = -1;
+#endif
+
+// Initialize and cleanup socket library of platform, both may be called several times
+bool OpenGazeSocketStartup();
+void OpenGazeSocketCleanup();
+void OpenGazeSocketClose(OpenGazeSocket socket);
+
+// Single record like <REC BPOGX="0.5" BPOGY="0.5" BPOGV="1" />. Only valid within callback,
+// as it points into receive buffer of client
+class OpenGazeRecord
+{
+public:
+
+	// Constructor, takes characters between delimiters
+	OpenGazeRecord(const char* pBegin, const char* pEnd);
+
+	// Check name of tag, e.g. "REC" or "ACK"
+	bool IsTag(const char* pTag) const;
+
+	// Get next attribute, starting with first one. Value does not include quotes
+	bool NextAttribute(
+		const char*& rpCursor, // initialize with NULL
+		const char*& rpName,
+		size_t& rNameLength,
+		const char*& rpValue,
+		size_t& rValueLength) const;
+
+	// Fetch value of attribute by name. Returns false if not found or not a number
+	bool GetNumber(const char* pName, double& rValue) const;
+
+	// Parse record with best point of gaze, relative to screen. Returns false for other records
+	bool ParseBestPointOfGaze(double& rX, double& rY, bool& rValid) const;
+
+	// Parse acknowledgement of screen size request. Returns false for other records
+	bool ParseScreenSize(int& rX, int& rY, int& rWidth, int& rHeight) const;
+
+	// Parse decimal number like "-0.125" without locale, returns false if characters are no number
+	static bool ParseNumber(const char* pBegin, const char* pEnd, double& rValue);
+
+	// Characters of record
+	const char* GetBegin() const { return _pBegin; }
+	const char* GetEnd() const { return _pEnd; }
+
+private:
+
+	// Members
+	const char* _pBegin;
+	const char* _pEnd;
+	const char* _pTag; // name of tag after opening bracket
+	size_t _tagLength;
+};
+
+// Client connecting to OpenGaze server
+class OpenGazeClient
+{
+public:
+
+	// Callback for each received record
+	typedef std::function<void(const OpenGazeRecord&)> RecordCallback;
+
+	// Constructor
+	OpenGazeClient(RecordCallback callback);
+
+	// Destructor, disconnects
+	virtual ~OpenGazeClient();
+
+	// Connect to server and start receiving. Returns whether successful
+	bool Connect(std::string address = "127.0.0.1", unsigned short port = 4242);
+
+	// Disconnect from server, waits for receiving thread. Must not be called from callback
+	void Disconnect();
+
+	// Whether connected to server. Connection may be closed from server side
+	bool IsConnected() const;
+
+	// Send command to server, delimiter is appended. May be called from callback. Returns whether successful
+	bool SendCommand(const std::string& rCommand);
+
+	// Count of received records
+	unsigned long long GetRecordCount() const;
+
+private:
+
+	// Size of fixed buffer, must hold at least one complete record
+	static const size_t RECEIVE_BUFFER_SIZE = 64 * 1024;
+
+	// Receive records until socket is closed, executed by thread
+	void Receive();
+
+	// Members
+	RecordCallback _callback;
+	OpenGazeSocket _socket = OPEN_GAZE_INVALID_SOCKET;
+	std::unique_ptr<std::thread> _upReceiveThread;
+	std::mutex _sendMutex;
+	std::atomic<bool> _connected;
+	std::atomic<unsigned long long> _recordCount;
+	char _receiveBuffer[RECEIVE_BUFFER_SIZE];
+};
+
+#endif // OPENGAZECLIENT_H_
@@ -6,115 +6,129 @@
 // This is an implementation
 #define DLL_IMPLEMENTATION
 
-// Defines minimal Windows version for GPClient
-#include <WinSDKVer.h>
-#define _WIN32_WINNT_WIN7 // Windows 7 or higher
-
 #include "plugins/Eyetracker/Interface/Eyetracker.h"
 #include "plugins/Eyetracker/Common/EyetrackerData.h"
-#include "plugins/Eyetracker/OpenGaze/include/GPClient.h"
-#include <algorithm>
-
-// TODO remove
-#include <iostream>
+#include "plugins/Eyetracker/OpenGaze/OpenGazeClient.h"
 
-// GazePoint standard client
-GPClient client;
-int screenX, screenY, screenWidth, screenHeight = 0;
+// Global variables
+static std::unique_ptr<OpenGazeClient> upClient = nullptr;
+static int screenX = 0, screenY = 0, screenWidth = 0, screenHeight = 0; // only accessed by receiving thread
 
-bool Connect()
+// Called by receiving thread of client for each record
+void RecordCallbackFunction(const OpenGazeRecord& rRecord)
 {
-	// Try to connect to the client
-	client.client_connect();
-
-	std::cout << "Connecting" << std::endl;
-
-	// Wait some time
-	Sleep(500);
+	// API data record, push sample directly
+	double x = 0, y = 0;
+	bool valid = false;
+	if (rRecord.ParseBestPointOfGaze(x, y, valid))
+	{
+		// TODO: use timestamp from API, not local one. but in which relation is that timestamp?
+		using namespace std::chrono;
+		eyetracker_global::PushBackSample(
+			SampleData(
+				x * screenWidth + screenX, // x, scale to pixels and offset to handle multi-monitor possibility
+				y * screenHeight + screenY, // y
+				SampleDataCoordinateSystem::SCREEN_PIXELS,
+				duration_cast<milliseconds>(
+					system_clock::now().time_since_epoch() // timestamp
+					),
+				valid
+			)
+		);
+	}
 
-	// Check connection
-	bool connected = client.is_connected();
-	if (connected)
+	// API response to screen size query, then start the data sending
+	else if (rRecord.ParseScreenSize(screenX, screenY, screenWidth, screenHeight))
 	{
-		// Retrieve screen size of screen where eye tracker is attached
-		client.send_cmd("<GET ID=\"SCREEN_SIZE\" />");
+		// Tell server what to stream
+		upClient->SendCommand("<SET ID=\"ENABLE_SEND_POG_BEST\" STATE=\"1\" />");
+		upClient->SendCommand("<SET ID=\"ENABLE_SEND_DATA\" STATE=\"1\" />");
 	}
+}
 
-	// TODO: what happens when connection succeeds after sleep time?
+EyetrackerInfo Connect(EyetrackerGeometry geometry)
+{
+	// Variables
+	EyetrackerInfo info;
 
-	std::cout << "Connection Status: " << connected << std::endl;
+	// Connect to OpenGaze server, previous client must not receive anymore
+	if (upClient) { upClient->Disconnect(); }
+	upClient = std::unique_ptr<OpenGazeClient>(new OpenGazeClient(RecordCallbackFunction));
+	if (upClient->Connect())
+	{
+		// Connection successful
+		info.connected = true;
+
+		// Setup LabStreamingLayer
+		lsl::stream_info streamInfo(
+			"OpenGazeLSL",
+			"Gaze",
+			2, // must match with number of samples in SampleData structure
+			lsl::IRREGULAR_RATE,
+			lsl::cf_double64, // must match with type of samples in SampleData structure
+			"source_id");
+		streamInfo.desc().append_child_value("manufacturer", "Gazepoint");
+		lsl::xml_element channels = streamInfo.desc().append_child("channels");
+		channels.append_child("channel")
+			.append_child_value("label", "gazeX")
+			.append_child_value("unit", "screenPixels");
+		channels.append_child("channel")
+			.append_child_value("label", "gazeY")
+			.append_child_value("unit", "screenPixels");
+		eyetracker_global::SetupLabStream(streamInfo);
+
+		// Retrieve screen size of screen where eye tracker is attached, data sending is started on response
+		upClient->SendCommand("<GET ID=\"SCREEN_SIZE\" />");
+	}
+	else
+	{
+		upClient = nullptr;
+	}
 
-	// Return success or failure
-	return connected;
+	// Return info structure
+	return info;
 }
 
 bool IsTracking()
 {
-	return true;
+	return upClient && upClient->IsConnected();
 }
 
 bool Disconnect()
 {
-	client.client_disconnect();
+	// Just terminate lab stream (not necessary to have done setup)
+	eyetracker_global::TerminateLabStream();
+
+	// Disconnect before destruction, as receiving thread accesses client
+	if (upClient)
+	{
+		upClient->Disconnect();
+		upClient = nullptr;
+	}
 	return true;
 }
 
 void FetchSamples(SampleQueue& rspSamples)
 {
-	// No callback is used by eye tracker, but samples are fetched here
-	float x, y;
-	int valid;
-	std::deque<std::string> messages;
-
-	// Retrieve and process as many messages as available
-	client.get_rx(messages); // latest message
-	for (auto& rMessage : messages) // should start at oldest (FIFO)
-	{
-		// API response to screen size query, extract data then start the data sending
-		if (rMessage.find("<ACK ID=\"SCREEN_SIZE\"") != string::npos)
-		{
-			// Extract data
-			sscanf_s(rMessage.c_str(), "<ACK ID=\"SCREEN_SIZE\" X=\"%i\" Y=\"%i\" WIDTH=\"%i\" HEIGHT=\"%i\" />", &screenX, &screenY, &screenWidth, &screenHeight);
-
-			// Tell server what to stream
-			client.send_cmd("<SET ID=\"ENABLE_SEND_POG_BEST\" STATE=\"1\" />");
-		}
-		// API data record, extract useful info
-		else if (rMessage.find("<REC ") != string::npos)
-		{
-			// Extract data
-			sscanf_s(rMessage.c_str(), "<REC BPOGX=\"%f\" BPOGY=\"%f\" BPOGV=\"%d\"/>",
-				&x, &y, &valid);
-
-			// Only add valid samples
-			if (valid > 0)
-			{
-				// Scale to pixels and offset to handle multi-monitor possibility
-				x = x * screenWidth + screenX;
-				y = y * screenHeight + screenY;
-
-				// TODO: use timestamp from API, not local one. but in which relation is that timestamp?
-				using namespace std::chrono;
-				eyetracker_global::PushBackSample(
-					SampleData(
-						x, // x
-						y, // y
-						SampleDataCoordinateSystem::SCREEN_PIXELS,
-						duration_cast<milliseconds>(
-							system_clock::now().time_since_epoch() // timestamp
-							)
-					)
-				);
-			}
-		}
-	}
-
-	// Finally, fetch collected samples
 	eyetracker_global::FetchSamples(rspSamples);
 }
 
-bool Calibrate()
+CalibrationResult Calibrate(std::shared_ptr<CalibrationInfo>& rspInfo)
+{
+	return CALIBRATION_NOT_SUPPORTED;
+}
+
+TrackboxInfo GetTrackboxInfo()
 {
-	// Not yet implemented
-	return false;
-}
\ No newline at end of file
+	return TrackboxInfo();
+}
+
+void ContinueLabStream()
+{
+	eyetracker_global::ContinueLabStream();
+}
+
+void PauseLabStream()
+{
+	eyetracker_global::PauseLabStream();
+}
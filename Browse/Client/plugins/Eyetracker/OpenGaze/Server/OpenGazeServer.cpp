@@ -0,0 +1,407 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Stand-in for an OpenGaze server, so the plugin can be run and measured
+// without eye tracker. Replays records of a recorded stream (one record per
+// line, only REC records are used) or synthetic gaze moving on a circle, at a
+// configurable rate. Answers screen size request and SET commands.
+//
+// Usage: OpenGazeServer [-port 4242] [-rate 60] [-file stream.txt] [-benchmark 1000000]
+//  -rate 0 streams as fast as the connection allows
+//  -benchmark N connects an OpenGazeClient in the same process, receives N
+//   records and reports throughput and parse cost per record
+
+#include "plugins/Eyetracker/OpenGaze/OpenGazeClient.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#endif
+
+// Screen size reported to client
+const int SCREEN_WIDTH = 1920;
+const int SCREEN_HEIGHT = 1080;
+
+// Size of chunk for sending of several records at once
+const size_t SEND_CHUNK_SIZE = 64 * 1024;
+
+// Options given by command line
+struct Options
+{
+	unsigned short port = 4242;
+	double rate = 60; // records per second, zero for unthrottled
+	std::string file = "";
+	unsigned long long benchmark = 0; // records to receive in benchmark, zero for server only
+};
+
+// Send complete buffer, returns whether successful
+bool SendAll(OpenGazeSocket socket, const char* pData, size_t size)
+{
+	size_t sent = 0;
+	while (sent < size)
+	{
+#if !defined(_WIN32) && defined(MSG_NOSIGNAL)
+		int result = send(socket, pData + sent, (int)(size - sent), MSG_NOSIGNAL);
+#else
+		int result = send(socket, pData + sent, (int)(size - sent), 0);
+#endif
+		if (result <= 0)
+		{
+			return false;
+		}
+		sent += result;
+	}
+	return true;
+}
+
+// Load records to replay. Falls back to synthetic records when no file is given or contains no REC
+std::vector<std::string> LoadRecords(const std::string& rFile)
+{
+	std::vector<std::string> records;
+	if (!rFile.empty())
+	{
+		std::ifstream stream(rFile);
+		if (!stream.is_open())
+		{
+			std::cerr << "Could not open " << rFile << std::endl;
+		}
+		std::string line;
+		while (std::getline(stream, line))
+		{
+			if (!line.empty() && line.back() == '\r') { line.pop_back(); }
+			if (OpenGazeRecord(line.c_str(), line.c_str() + line.size()).IsTag("REC"))
+			{
+				records.push_back(line + "\r\n");
+			}
+		}
+	}
+	if (records.empty())
+	{
+		// Gaze moving on circle around screen center, with a blink from time to time
+		const int count = 600;
+		char buffer[128];
+		for (int i = 0; i < count; i++)
+		{
+			double angle = 2.0 * 3.14159265358979 * i / count;
+			std::snprintf(buffer, sizeof(buffer), "<REC BPOGX=\"%.5f\" BPOGY=\"%.5f\" BPOGV=\"%d\" />\r\n",
+				0.5 + 0.3 * std::cos(angle), 0.5 + 0.3 * std::sin(angle), (i % 100) < 95 ? 1 : 0);
+			records.push_back(buffer);
+		}
+	}
+	return records;
+}
+
+// Serve one connected client until it disconnects
+void Serve(OpenGazeSocket client, const Options& rOptions, const std::vector<std::string>& rRecords)
+{
+	std::atomic<bool> connected(true);
+	std::atomic<bool> sendData(false);
+	std::mutex sendMutex;
+
+	// Receive commands of client in own thread, reusing the record parser of the client
+	std::thread commandThread([&]()
+	{
+		std::vector<char> buffer(SEND_CHUNK_SIZE);
+		size_t filled = 0;
+		while (true)
+		{
+			int received = recv(client, buffer.data() + filled, (int)(buffer.size() - filled), 0);
+			if (received <= 0) { break; }
+			filled += received;
+
+			// Process complete commands
+			size_t begin = 0;
+			for (size_t i = 0; i < filled; i++)
+			{
+				if (buffer[i] != '\n') { continue; }
+				size_t end = (i > begin && buffer[i - 1] == '\r') ? i - 1 : i;
+				OpenGazeRecord command(buffer.data() + begin, buffer.data() + end);
+				begin = i + 1;
+
+				// Collect attributes of command
+				std::string id, state;
+				const char* pCursor = NULL;
+				const char* pName = NULL;
+				const char* pValue = NULL;
+				size_t nameLength = 0, valueLength = 0;
+				while (command.NextAttribute(pCursor, pName, nameLength, pValue, valueLength))
+				{
+					std::string name(pName, nameLength);
+					if (name == "ID") { id.assign(pValue, valueLength); }
+					else if (name == "STATE") { state.assign(pValue, valueLength); }
+				}
+
+				// Answer command
+				std::string answer;
+				if (command.IsTag("GET") && id == "SCREEN_SIZE")
+				{
+					answer = "<ACK ID=\"SCREEN_SIZE\" X=\"0\" Y=\"0\" WIDTH=\"" + std::to_string(SCREEN_WIDTH)
+						+ "\" HEIGHT=\"" + std::to_string(SCREEN_HEIGHT) + "\" />\r\n";
+				}
+				else if (command.IsTag("SET"))
+				{
+					if (id == "ENABLE_SEND_DATA") { sendData = state == "1"; }
+					answer = "<ACK ID=\"" + id + "\" STATE=\"" + state + "\" />\r\n";
+				}
+				else
+				{
+					answer = "<NACK ID=\"" + id + "\" />\r\n";
+				}
+				std::lock_guard<std::mutex> lock(sendMutex);
+				SendAll(client, answer.c_str(), answer.size());
+			}
+
+			// Keep incomplete command
+			filled -= begin;
+			std::memmove(buffer.data(), buffer.data() + begin, filled);
+			if (filled == buffer.size()) { filled = 0; }
+		}
+		connected = false;
+	});
+
+	// Stream records while enabled. Records which are due are sent together in one chunk
+	std::string chunk;
+	chunk.reserve(SEND_CHUNK_SIZE);
+	size_t next = 0; // index of next record to replay
+	unsigned long long sentRecords = 0;
+	auto start = std::chrono::steady_clock::now();
+	while (connected)
+	{
+		if (!sendData)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			start = std::chrono::steady_clock::now();
+			sentRecords = 0;
+			continue;
+		}
+
+		// Decide how many records are due
+		unsigned long long due = 0;
+		if (rOptions.rate > 0)
+		{
+			std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+			unsigned long long target = (unsigned long long)(elapsed.count() * rOptions.rate) + 1;
+			if (target <= sentRecords)
+			{
+				std::this_thread::sleep_until(start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+					std::chrono::duration<double>(sentRecords / rOptions.rate)));
+				continue;
+			}
+			due = target - sentRecords;
+		}
+		else
+		{
+			due = (unsigned long long)-1;
+		}
+
+		// Fill chunk with due records
+		chunk.clear();
+		while (due > 0 && chunk.size() + rRecords[next].size() <= SEND_CHUNK_SIZE)
+		{
+			chunk += rRecords[next];
+			next = (next + 1) % rRecords.size();
+			due--;
+			sentRecords++;
+		}
+		std::lock_guard<std::mutex> lock(sendMutex);
+		if (!SendAll(client, chunk.c_str(), chunk.size()))
+		{
+			break;
+		}
+	}
+
+	// Wait for command thread, which ends as soon as the socket is shut down
+#ifdef _WIN32
+	shutdown(client, SD_BOTH);
+#else
+	shutdown(client, SHUT_RDWR);
+#endif
+	commandThread.join();
+	OpenGazeSocketClose(client);
+}
+
+// Open listening socket on local host
+OpenGazeSocket Listen(unsigned short port)
+{
+	OpenGazeSocket server = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (server == OPEN_GAZE_INVALID_SOCKET)
+	{
+		return OPEN_GAZE_INVALID_SOCKET;
+	}
+	int reuse = 1;
+	setsockopt(server, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse, sizeof(reuse));
+	sockaddr_in address;
+	std::memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = htons(port);
+	if (bind(server, (sockaddr*)&address, sizeof(address)) != 0 || listen(server, 1) != 0)
+	{
+		OpenGazeSocketClose(server);
+		return OPEN_GAZE_INVALID_SOCKET;
+	}
+	return server;
+}
+
+// Receive given count of records with client in same process and measure throughput
+int Benchmark(OpenGazeSocket server, const Options& rOptions, const std::vector<std::string>& rRecords)
+{
+	// Serve exactly one client
+	std::thread serverThread([&]()
+	{
+		OpenGazeSocket client = accept(server, NULL, NULL);
+		if (client != OPEN_GAZE_INVALID_SOCKET)
+		{
+			Serve(client, rOptions, rRecords);
+		}
+	});
+
+	// Client handling records like the plugin does
+	OpenGazeClient* pClient = NULL;
+	std::atomic<unsigned long long> samples(0);
+	std::atomic<bool> done(false);
+	double checksum = 0;
+	std::chrono::steady_clock::time_point first, last;
+	OpenGazeClient client([&](const OpenGazeRecord& rRecord)
+	{
+		double x = 0, y = 0;
+		bool valid = false;
+		int screenX, screenY, screenWidth, screenHeight;
+		if (rRecord.ParseBestPointOfGaze(x, y, valid))
+		{
+			if (done) { return; }
+			unsigned long long count = ++samples;
+			if (count == 1) { first = std::chrono::steady_clock::now(); }
+			checksum += valid ? x + y : 0;
+			if (count == rOptions.benchmark + 1)
+			{
+				last = std::chrono::steady_clock::now();
+				done = true;
+			}
+		}
+		else if (rRecord.ParseScreenSize(screenX, screenY, screenWidth, screenHeight))
+		{
+			pClient->SendCommand("<SET ID=\"ENABLE_SEND_POG_BEST\" STATE=\"1\" />");
+			pClient->SendCommand("<SET ID=\"ENABLE_SEND_DATA\" STATE=\"1\" />");
+		}
+	});
+	pClient = &client;
+	if (!client.Connect("127.0.0.1", rOptions.port))
+	{
+		std::cerr << "Could not connect to server" << std::endl;
+#ifdef _WIN32
+		OpenGazeSocketClose(server); // wakes up accept
+#else
+		shutdown(server, SHUT_RDWR); // wakes up accept
+#endif
+		serverThread.join();
+		return EXIT_FAILURE;
+	}
+	client.SendCommand("<GET ID=\"SCREEN_SIZE\" />");
+	while (!done && client.IsConnected())
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	client.Disconnect();
+	serverThread.join();
+	if (!done)
+	{
+		std::cerr << "Connection closed before all records were received" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// Parse cost without socket, over the records which are replayed
+	const size_t parseRounds = (size_t)(rOptions.benchmark / rRecords.size()) + 1;
+	double parseChecksum = 0;
+	auto parseStart = std::chrono::steady_clock::now();
+	for (size_t round = 0; round < parseRounds; round++)
+	{
+		for (const std::string& rRecord : rRecords)
+		{
+			double x = 0, y = 0;
+			bool valid = false;
+			OpenGazeRecord(rRecord.c_str(), rRecord.c_str() + rRecord.size() - 2).ParseBestPointOfGaze(x, y, valid);
+			parseChecksum += valid ? x + y : 0;
+		}
+	}
+	std::chrono::duration<double> parseDuration = std::chrono::steady_clock::now() - parseStart;
+
+	// Report
+	std::chrono::duration<double> duration = last - first;
+	std::cout << "Records received: " << rOptions.benchmark << std::endl;
+	std::cout << "Throughput: " << (unsigned long long)(rOptions.benchmark / duration.count()) << " records/s" << std::endl;
+	std::cout << "Parse cost: " << (parseDuration.count() * 1e9) / (parseRounds * rRecords.size()) << " ns/record" << std::endl;
+	std::cout << "Checksum: " << checksum << " " << parseChecksum << std::endl;
+	return EXIT_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+	// Parse command line
+	Options options;
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string argument = argv[i];
+		if (argument == "-port") { options.port = (unsigned short)std::atoi(argv[i + 1]); }
+		else if (argument == "-rate") { options.rate = std::atof(argv[i + 1]); }
+		else if (argument == "-file") { options.file = argv[i + 1]; }
+		else if (argument == "-benchmark") { options.benchmark = std::strtoull(argv[i + 1], NULL, 10); }
+		else { std::cerr << "Unknown argument " << argument << std::endl; return EXIT_FAILURE; }
+	}
+
+	// Benchmark measures the client, so stream unthrottled unless rate is given explicitly
+	bool rateGiven = false;
+	for (int i = 1; i < argc; i++) { rateGiven |= std::string(argv[i]) == "-rate"; }
+	if (options.benchmark > 0 && !rateGiven) { options.rate = 0; }
+
+	// Records to replay
+	std::vector<std::string> records = LoadRecords(options.file);
+
+	// Listen for clients
+	if (!OpenGazeSocketStartup())
+	{
+		std::cerr << "Could not start sockets" << std::endl;
+		return EXIT_FAILURE;
+	}
+	OpenGazeSocket server = Listen(options.port);
+	if (server == OPEN_GAZE_INVALID_SOCKET)
+	{
+		std::cerr << "Could not listen on port " << options.port << std::endl;
+		OpenGazeSocketCleanup();
+		return EXIT_FAILURE;
+	}
+
+	// Either measure client or serve clients one after another
+	int result = EXIT_SUCCESS;
+	if (options.benchmark > 0)
+	{
+		result = Benchmark(server, options, records);
+	}
+	else
+	{
+		std::cout << "Replaying " << records.size() << " records at "
+			<< (options.rate > 0 ? std::to_string(options.rate) + " Hz" : std::string("unthrottled rate"))
+			<< " on port " << options.port << std::endl;
+		while (true)
+		{
+			OpenGazeSocket client = accept(server, NULL, NULL);
+			if (client == OPEN_GAZE_INVALID_SOCKET) { break; }
+			std::cout << "Client connected" << std::endl;
+			Serve(client, options, records);
+			std::cout << "Client disconnected" << std::endl;
+		}
+	}
+	OpenGazeSocketClose(server);
+	OpenGazeSocketCleanup();
+	return result;
+}
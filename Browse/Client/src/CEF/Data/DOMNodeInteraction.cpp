@@ -6,21 +6,39 @@
 
 #include "DOMNodeInteraction.h"
 #include "src/CEF/Mediator.h"
+#include "src/Setup.h"
 
 void DOMTextInputInteraction::InputText(std::string text, bool submit)
 {
 	// Focus input node
 	_pTab->ExecuteCorrespondingJavascriptFunction(getBasePtr(), "focusNode");
 
-	// Clear text content and afterwards enter input
-	_pTab->EmulateSelectAll();
-	_pTab->EmulateKeyboardStrokes(text);
-
-	// Emulate Enter key, when submitting
-	if (submit)
+	if (setup::BULK_TEXT_INSERTION)
 	{
-		_pTab->EmulateEnterKey();
+		// Replace text content in one step, emulates Enter key afterwards when submitting. Text of node is set
+		// once result has arrived. Node is gone when tab has cleared its DOM nodes in the meantime
+		std::weak_ptr<DOMBaseInterface> wpNode = getBasePtr();
+		TabDOMNodeInterface* pTab = _pTab;
+		_pTab->InsertText(text, submit, [wpNode, pTab, text]()
+		{
+			if (auto spNode = wpNode.lock())
+			{
+				pTab->ExecuteCorrespondingJavascriptFunction(spNode, "setText", text);
+			}
+		});
 	}
+	else
+	{
+		// Clear text content and afterwards enter input
+		_pTab->EmulateSelectAll();
+		_pTab->EmulateKeyboardStrokes(text);
 
-	_pTab->ExecuteCorrespondingJavascriptFunction(getBasePtr(), "setText", text);
+		// Emulate Enter key, when submitting
+		if (submit)
+		{
+			_pTab->EmulateEnterKey();
+		}
+
+		_pTab->ExecuteCorrespondingJavascriptFunction(getBasePtr(), "setText", text);
+	}
 }
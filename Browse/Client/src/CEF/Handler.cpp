@@ -7,6 +7,7 @@
 #include "src/CEF/Handler.h"
 #include "src/CEF/Mediator.h"
 #include "src/Utils/Logger.h"
+#include "src/Setup.h"
 #include "src/Singletons/JSMailer.h"
 #include "include/base/cef_bind.h"
 #include "include/cef_app.h"
@@ -73,6 +74,9 @@ void Handler::OnBeforeClose(CefRefPtr<CefBrowser> browser)
 
   _msgRouter->OnBeforeClose(browser);
 
+  // Drop pending text insertions of browser
+  _pMediator->RunOnMainThread([=]() { DropTextInsertions(browser); });
+
    //Remove from the list of existing browsers.
   BrowserList::iterator bit = _browserList.begin();
   for (; bit != _browserList.end(); ++bit)
@@ -119,52 +123,58 @@ void Handler::OnLoadError(
 
 void Handler::OnLoadStart(CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, TransitionType transition_type)
 {
-	// Set loading status of each in Tab to loading in order to display loading icon and status
-	_pMediator->SetLoadingStatus(browser, true, frame->IsMain());
-
-    if (frame->IsMain())
-    {
-		_pMediator->ResetFavicon(browser);
-		_pMediator->ClearDOMNodes(browser);
-		//LogDebug("Handler: Started loading frame id = ", frame->GetIdentifier(), " (main = ", frame->IsMain(), "), browserID = ", browser->GetIdentifier());
+	_pMediator->RunOnMainThread([=]()
+	{
+		// Set loading status of each in Tab to loading in order to display loading icon and status
+		_pMediator->SetLoadingStatus(browser, true, frame->IsMain());
 
-        // Set zoom level according to Tab's settings
-        SetZoomLevel(browser, false);
+		if (frame->IsMain())
+		{
+			_pMediator->ResetFavicon(browser);
+			_pMediator->NotifyNavigationCommit(browser, frame->GetURL()); // after reset, as cached favicon is applied
+			DropTextInsertions(browser); // results will never arrive
+			_pMediator->ClearDOMNodes(browser);
+			//LogDebug("Handler: Started loading frame id = ", frame->GetIdentifier(), " (main = ", frame->IsMain(), "), browserID = ", browser->GetIdentifier());
 
-        // Inject Javascript to hide scrollbar
-        frame->ExecuteJavaScript(_js_remove_css_scrollbar, frame->GetURL(), 0);
+			// Set zoom level according to Tab's settings
+			SetZoomLevel(browser, false);
 
-    }
-	else
-	{
-		// EXPERIMENTAL
-		//frame->ExecuteJavaScript(
-		//	"window.addEventListener('message', (event) => {"
-		//	"console.log('Window object',window,'received message from',event.source);"
-		//	"event.source.postMessage('Answering event source...', event);"
-		//	"});", "", 0);
-	}
+			// Inject Javascript to hide scrollbar
+			frame->ExecuteJavaScript(_js_remove_css_scrollbar, frame->GetURL(), 0);
 
+		}
+		else
+		{
+			// EXPERIMENTAL
+			//frame->ExecuteJavaScript(
+			//	"window.addEventListener('message', (event) => {"
+			//	"console.log('Window object',window,'received message from',event.source);"
+			//	"event.source.postMessage('Answering event source...', event);"
+			//	"});", "", 0);
+		}
+	});
 }
 
 void Handler::OnLoadEnd(CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, int httpStatusCode)
 {
-	// Set loading status of each frame in Tab to load finished in order to display loading icon and status
-	_pMediator->SetLoadingStatus(browser, false, frame->IsMain());
-
-    if (frame->IsMain())
-    {
-		// Calculate page loading time via Javascript
-		frame->ExecuteJavaScript(
-			"PrintPerformanceInformation();", "", 0);
+	_pMediator->RunOnMainThread([=]()
+	{
+		// Set loading status of each frame in Tab to load finished in order to display loading icon and status
+		_pMediator->SetLoadingStatus(browser, false, frame->IsMain());
 
-        // Set zoom level according to Tab's settings
-        SetZoomLevel(browser, false);
+		if (frame->IsMain())
+		{
+			// Calculate page loading time via Javascript
+			frame->ExecuteJavaScript(
+				"PrintPerformanceInformation();", "", 0);
 
-		// Inject Javascript to hide scrollbar
-		frame->ExecuteJavaScript(_js_remove_css_scrollbar, frame->GetURL(), 0);
-    }
+			// Set zoom level according to Tab's settings
+			SetZoomLevel(browser, false);
 
+			// Inject Javascript to hide scrollbar
+			frame->ExecuteJavaScript(_js_remove_css_scrollbar, frame->GetURL(), 0);
+		}
+	});
 }
 
 void Handler::OnLoadingStateChange(CefRefPtr<CefBrowser> browser,
@@ -172,22 +182,28 @@ void Handler::OnLoadingStateChange(CefRefPtr<CefBrowser> browser,
     bool canGoBack,
     bool canGoForward)
 {
-	// Fetch main frame's url and set it in Tab, if it changed
-	_pMediator->SetURL(browser);
+	_pMediator->RunOnMainThread([=]()
+	{
+		// Fetch main frame's url and set it in Tab, if it changed
+		_pMediator->SetURL(browser);
 
-    _pMediator->SetCanGoBack(browser, canGoBack);
-    _pMediator->SetCanGoForward(browser, canGoForward);
+		// Tab measures time from start of navigation until first paint
+		_pMediator->NotifyLoadingStateChange(browser, isLoading);
 
-    // Finished loading whole page
-    if (!isLoading)
-    {
-        // Set zoom level again at load end, in case it was written over again
-        SetZoomLevel(browser, false);
+		_pMediator->SetCanGoBack(browser, canGoBack);
+		_pMediator->SetCanGoForward(browser, canGoForward);
+
+		// Finished loading whole page
+		if (!isLoading)
+		{
+			// Set zoom level again at load end, in case it was written over again
+			SetZoomLevel(browser, false);
 
-        // Write page resolution to V8 variables, read them and update Tab
-        UpdatePageResolution(browser);
+			// Write page resolution to V8 variables, read them and update Tab
+			UpdatePageResolution(browser);
 
-    }
+		}
+	});
 }
 
 void Handler::CloseAllBrowsers(bool forceClose)
@@ -229,6 +245,23 @@ bool Handler::OnProcessMessageReceived(
 	CefRefPtr<CefFrame> frame,
     CefProcessId source_process,
     CefRefPtr<CefProcessMessage> msg)
+{
+	// Message router stays on CEF UI thread, its handlers hand their work over to main thread
+	if (_msgRouter->OnProcessMessageReceived(browser, frame, source_process, msg))
+	{
+		return true;
+	}
+
+	// Other messages are handled on main thread
+	if (!setup::CEF_MULTI_THREADED_MESSAGE_LOOP)
+	{
+		return HandleProcessMessage(browser, msg);
+	}
+	_pMediator->RunOnMainThread([=]() { HandleProcessMessage(browser, msg); });
+	return true;
+}
+
+bool Handler::HandleProcessMessage(CefRefPtr<CefBrowser> browser, CefRefPtr<CefProcessMessage> msg)
 {
     const std::string& msgName = msg->GetName().ToString();
 
@@ -345,7 +378,7 @@ bool Handler::OnProcessMessageReceived(
 		}
 	}
 
-    return _msgRouter->OnProcessMessageReceived(browser, frame, source_process, msg);
+    return false;
 }
 
 bool Handler::OnJSDialog(
@@ -366,9 +399,6 @@ bool Handler::OnJSDialog(
 	//return true;
 	*/
 
-	// Remember that callback
-	_jsDialogCallbacks[browser->GetIdentifier()] = callback;
-
 	// Decide type of dialog
 	JavaScriptDialogType type = JavaScriptDialogType::ALERT;
 	if (dialog_type == JSDialogType::JSDIALOGTYPE_CONFIRM)
@@ -380,8 +410,13 @@ bool Handler::OnJSDialog(
 		type = JavaScriptDialogType::PROMPT;
 	}
 
-	// Tell Tab about it so it can react and execute callback later
-	_pMediator->RequestJSDialog(browser, type, message_text);
+	// Remember that callback and tell Tab about it so it can react and execute callback later
+	const std::string message = message_text.ToString();
+	_pMediator->RunOnMainThread([=]()
+	{
+		_jsDialogCallbacks[browser->GetIdentifier()] = callback;
+		_pMediator->RequestJSDialog(browser, type, message);
+	});
 
 	// Dialog handled!
 	return true;
@@ -393,11 +428,13 @@ bool Handler::OnBeforeUnloadDialog(
 	bool is_reload,
 	CefRefPtr<CefJSDialogCallback> callback)
 {
-	// Remember that callback
-	_jsDialogCallbacks[browser->GetIdentifier()] = callback;
-
-	// Tell Tab about it so it can react and execute callback later
-	_pMediator->RequestJSDialog(browser, JavaScriptDialogType::LEAVE_PAGE, message_text);
+	// Remember that callback and tell Tab about it so it can react and execute callback later
+	const std::string message = message_text.ToString();
+	_pMediator->RunOnMainThread([=]()
+	{
+		_jsDialogCallbacks[browser->GetIdentifier()] = callback;
+		_pMediator->RequestJSDialog(browser, JavaScriptDialogType::LEAVE_PAGE, message);
+	});
 
 	// Dialog handled!
 	return true;
@@ -405,7 +442,13 @@ bool Handler::OnBeforeUnloadDialog(
 
 void Handler::ResizeBrowsers()
 {
-    CEF_REQUIRE_UI_THREAD();
+    if (!CefCurrentlyOn(TID_UI))
+    {
+        // Execute on the UI thread (CEF runs with multi-threaded message loop)
+        CefPostTask(TID_UI,
+            base::Bind(&Handler::ResizeBrowsers, this));
+        return;
+    }
 
     BrowserList::iterator bit = _browserList.begin();
     for (; bit != _browserList.end(); ++bit)
@@ -499,6 +542,25 @@ void Handler::ResetMainFramesScrolling(CefRefPtr<CefBrowser> browser)
     browser->GetMainFrame()->ExecuteJavaScript(resetScrolling, browser->GetMainFrame()->GetURL(), 0);
 }
 
+void Handler::SetMainFramesScrolling(CefRefPtr<CefBrowser> browser, double x, double y)
+{
+    const std::string setScrolling = "window.scrollTo(" + std::to_string(x) + ", " + std::to_string(y) + ");";
+    browser->GetMainFrame()->ExecuteJavaScript(setScrolling, browser->GetMainFrame()->GetURL(), 0);
+}
+
+void Handler::SetResourceHint(CefRefPtr<CefBrowser> browser, std::string rel, std::string URL, bool add)
+{
+    // URL is put into JavaScript string
+    std::string escapedURL;
+    for (const char c : URL)
+    {
+        if (c == '\\' || c == '"') { escapedURL += '\\'; }
+        if (c != '\n' && c != '\r') { escapedURL += c; }
+    }
+    const std::string setHint = std::string(add ? "AddResourceHint" : "RemoveResourceHint") + "(\"" + rel + "\", \"" + escapedURL + "\");";
+    browser->GetMainFrame()->ExecuteJavaScript(setHint, browser->GetMainFrame()->GetURL(), 0);
+}
+
 void Handler::SetZoomLevel(CefRefPtr<CefBrowser> browser, bool definitelyChanged)
 {
 
@@ -544,14 +606,18 @@ void Handler::IPCLogRenderer(CefRefPtr<CefBrowser> browser, CefRefPtr<CefProcess
 void Handler::OnFaviconURLChange(CefRefPtr<CefBrowser> browser,
     const std::vector<CefString>& icon_urls)
 {
-	for (auto url : icon_urls)
-		StartFaviconImageDownload(browser, url);
+	_pMediator->RunOnMainThread([=]()
+	{
+		for (auto url : icon_urls)
+			StartFaviconImageDownload(browser, url);
+	});
 }
 
 void Handler::OnTitleChange(CefRefPtr<CefBrowser> browser,
 	const CefString& title)
 {
-	_pMediator->OnTabTitleChange(browser, title.ToString());
+	const std::string titleString = title.ToString();
+	_pMediator->RunOnMainThread([=]() { _pMediator->OnTabTitleChange(browser, titleString); });
 }
 
 bool Handler::OnBeforePopup(CefRefPtr<CefBrowser> browser,
@@ -569,12 +635,34 @@ bool Handler::OnBeforePopup(CefRefPtr<CefBrowser> browser,
 {
 	LogInfo("Handler: Suppressed popup from opening a new window");
 	
-	_pMediator->OpenPopupTab(browser, target_url);
+	const std::string url = target_url.ToString();
+	_pMediator->RunOnMainThread([=]() { _pMediator->OpenPopupTab(browser, url); });
 	return true;
 }
 
+void Handler::RegisterJavascriptCallback(std::string prefix, std::function<void(std::string)> callbackFunction)
+{
+	if (!CefCurrentlyOn(TID_UI))
+	{
+		// Message router must be accessed on the UI thread (CEF runs with multi-threaded message loop)
+		CefPostTask(TID_UI,
+			base::Bind(&Handler::RegisterJavascriptCallback, this, prefix, callbackFunction));
+		return;
+	}
+
+	_msgRouter->RegisterJavascriptCallback(prefix, callbackFunction);
+}
+
 void Handler::SendToJSLoggingMediator(std::string message)
 {
+	if (!CefCurrentlyOn(TID_UI))
+	{
+		// Execute on the UI thread (CEF runs with multi-threaded message loop)
+		CefPostTask(TID_UI,
+			base::Bind(&Handler::SendToJSLoggingMediator, this, message));
+		return;
+	}
+
 	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("SendToLoggingMediator");
 	msg->GetArgumentList()->SetString(0, message);
 
@@ -586,9 +674,14 @@ void Handler::SendToJSLoggingMediator(std::string message)
 	
 }
 
-bool Handler::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img)
+bool Handler::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img, CefString img_url)
 {
-	return _pMediator->ForwardFaviconBytes(browser, img);
+	if (!setup::CEF_MULTI_THREADED_MESSAGE_LOOP)
+	{
+		return _pMediator->ForwardFaviconBytes(browser, img, img_url);
+	}
+	_pMediator->RunOnMainThread([=]() { _pMediator->ForwardFaviconBytes(browser, img, img_url); });
+	return true;
 }
 
 bool Handler::StartFaviconImageDownload(CefRefPtr<CefBrowser> browser, CefString img_url)
@@ -664,6 +757,69 @@ void Handler::EmulateSelectAll(CefRefPtr<CefBrowser> browser)
 	EmulateKeyboardKey(browser, 'A', 'A', EVENTFLAG_CONTROL_DOWN, false);
 }
 
+void Handler::InsertText(CefRefPtr<CefBrowser> browser, std::string input, bool submit, std::function<void()> finished)
+{
+	// Remember insertion until JavaScript reports back
+	const int insertionId = _nextTextInsertionId++;
+	TextInsertion& rInsertion = _textInsertions[insertionId];
+	rInsertion.browserId = browser->GetIdentifier();
+	rInsertion.input = input;
+	rInsertion.submit = submit;
+	rInsertion.finished = finished;
+	rInsertion.start = std::chrono::steady_clock::now();
+
+	// Execute in frame which has the focus, like key events would be delivered
+	CefRefPtr<CefFrame> frame = browser->GetFocusedFrame();
+	if (!frame) { frame = browser->GetMainFrame(); }
+	frame->ExecuteJavaScript(jsInsertText(insertionId, input, true), frame->GetURL(), 0);
+}
+
+void Handler::FinishTextInsertion(CefRefPtr<CefBrowser> browser, int insertionId, bool inserted, double rendererTime)
+{
+	auto iter = _textInsertions.find(insertionId);
+	if (iter == _textInsertions.end() || iter->second.browserId != browser->GetIdentifier())
+	{
+		return;
+	}
+	const TextInsertion insertion = iter->second;
+	_textInsertions.erase(iter);
+
+	// Element rejected editing command, emulate typing instead
+	if (!inserted)
+	{
+		EmulateSelectAll(browser);
+		EmulateKeyboardStrokes(browser, insertion.input);
+	}
+
+	// Submit after text has arrived
+	if (insertion.submit)
+	{
+		EmulateEnterKey(browser);
+	}
+
+	// Let caller react on text being in place
+	if (insertion.finished)
+	{
+		insertion.finished();
+	}
+
+	if (setup::LOG_TEXT_INSERTION)
+	{
+		const double duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - insertion.start).count();
+		LogInfo("Handler: Text of ", insertion.input.length(), " bytes ", (inserted ? "inserted with one command" : "rejected, emulating keyboard strokes"),
+			" after ", duration, "ms (", rendererTime, "ms in renderer)");
+	}
+}
+
+void Handler::DropTextInsertions(CefRefPtr<CefBrowser> browser)
+{
+	for (auto iter = _textInsertions.begin(); iter != _textInsertions.end();)
+	{
+		if (iter->second.browserId == browser->GetIdentifier()) { iter = _textInsertions.erase(iter); }
+		else { ++iter; }
+	}
+}
+
 void Handler::EmulateEnterKey(CefRefPtr<CefBrowser> browser)
 {
 	EmulateKeyboardKey(browser, 13, 13, 0);
@@ -15,6 +15,9 @@
 #include "src/CEF/RequestHandler.h"
 #include <list>
 #include <set>
+#include <map>
+#include <chrono>
+#include <functional>
 
 // Forward declaration
 class Mediator;
@@ -135,8 +138,23 @@ public:
 	void EmulateKeyboardStrokes(CefRefPtr<CefBrowser> browser, std::string input);
 	void EmulateEnterKey(CefRefPtr<CefBrowser> browser);
 	void EmulateSelectAll(CefRefPtr<CefBrowser> browser);
+
+	// Replace content of focused element by text with a single editing command in the focused frame. Falls back to
+	// select all and keyboard strokes if element rejects the command. Enter is emulated afterwards when submitting.
+	// Finished is called after that, not when browser navigates or closes before result arrives
+	void InsertText(CefRefPtr<CefBrowser> browser, std::string input, bool submit, std::function<void()> finished);
+
+	// Called by message router when JavaScript has tried to insert text. Time is spent in renderer, in milliseconds
+	void FinishTextInsertion(CefRefPtr<CefBrowser> browser, int insertionId, bool inserted, double rendererTime);
+
+	// Drop pending text insertions of browser, their results are ignored
+	void DropTextInsertions(CefRefPtr<CefBrowser> browser);
     
     void ResetMainFramesScrolling(CefRefPtr<CefBrowser> browser);
+    void SetMainFramesScrolling(CefRefPtr<CefBrowser> browser, double x, double y);
+
+    // Add or remove resource hint like preconnect or prefetch in main frame
+    void SetResourceHint(CefRefPtr<CefBrowser> browser, std::string rel, std::string URL, bool add);
 
     // Bool value indicates need to reload DOM node data, true when called from outside of Tab due to changes
     void SetZoomLevel(CefRefPtr<CefBrowser> browser, bool definitelyChanged = true);
@@ -153,10 +171,7 @@ public:
 	void OnTitleChange(CefRefPtr<CefBrowser> browser,
 		const CefString& title) OVERRIDE;
 
-	void RegisterJavascriptCallback(std::string prefix, std::function<void(std::string)> callbackFunction)
-	{
-		_msgRouter->RegisterJavascriptCallback(prefix, callbackFunction);
-	}
+	void RegisterJavascriptCallback(std::string prefix, std::function<void(std::string)> callbackFunction);
 
 	// Send log data to LoggingMediator instance in each browser context
 	void SendToJSLoggingMediator(std::string message);
@@ -164,7 +179,7 @@ public:
 	// Check if favicon was already loaded, if not download it
 	bool StartFaviconImageDownload(CefRefPtr<CefBrowser> browser, CefString img_url);
 	// HandlerImageDownload interface methods
-	bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img);
+	bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img, CefString img_url);
 
 	// Decide whether to block ads
 	void BlockAds(bool blockAds) { _requestHandler->BlockAds(blockAds); }
@@ -173,6 +188,9 @@ private:
 
     /* METHODS */
 
+	// Handle message from renderer process which is not meant for message router. Called on main thread
+	bool HandleProcessMessage(CefRefPtr<CefBrowser> browser, CefRefPtr<CefProcessMessage> msg);
+
     // Log messages from renderer process on receiving logging relevant IPC messages
     void IPCLogRenderer(CefRefPtr<CefBrowser> browser, CefRefPtr<CefProcessMessage> msg);
 
@@ -202,9 +220,25 @@ private:
 	// Set for parsing strings (as char by accessing it with []) to numbers
 	std::set<char> digits = { '0', '1', '2', '3', '4', '5', '6' ,'7', '8', '9' };
 
-	// Map of browser identifier to JavaScript dialog callbacks that can be answered (may be never answered or to late TODO: problem?)
+	// Map of browser identifier to JavaScript dialog callbacks that can be answered. Only accessed on main thread (may be never answered or to late TODO: problem?)
 	std::map<int, CefRefPtr<CefJSDialogCallback> > _jsDialogCallbacks;
 
+	// Text insertion waiting for result from JavaScript
+	struct TextInsertion
+	{
+		int browserId;
+		std::string input;
+		bool submit;
+		std::function<void()> finished;
+		std::chrono::steady_clock::time_point start;
+	};
+
+	// Map of insertion identifier to text insertion. Entries of browsers which navigate or close are dropped
+	std::map<int, TextInsertion> _textInsertions;
+
+	// Identifier of next text insertion
+	int _nextTextInsertionId = 0;
+
     // Include CEF'S default reference counting implementation
     IMPLEMENT_REFCOUNTING(Handler);
 };
@@ -12,7 +12,7 @@ void PendingImageDownload::OnDownloadImageFinished(const CefString& image_url,
 	CefRefPtr<CefImage> image)
 {
 	//LogDebug("PendingImageDownload: Finished image download for url:\n", image_url.ToString());
-	_handler->ForwardFaviconBytes(_corresponding_browser, image);
+	_handler->ForwardFaviconBytes(_corresponding_browser, image, image_url);
 	_handler->FinishImageDownload(this);
 }
 
@@ -20,13 +20,17 @@ void PendingImageDownload::OnDownloadImageFinished(const CefString& image_url,
 void HandlerImageInterface::StartImageDownload(CefRefPtr<CefBrowser> browser, CefString img_url)
 {
 	CefRefPtr<PendingImageDownload> download(new PendingImageDownload(this, browser));
-	_downloads.push_back(download);
+	{
+		std::lock_guard<std::mutex> lock(_downloadsMutex);
+		_downloads.push_back(download);
+	}
 	//LogDebug("HandlerImageInterface: Starting new image download for url:\n", img_url.ToString());
 	browser->GetHost()->DownloadImage(img_url, true, 0, false, download);
 }
 
 void HandlerImageInterface::FinishImageDownload(CefRefPtr<PendingImageDownload> download)
 {
+	std::lock_guard<std::mutex> lock(_downloadsMutex);
 	const auto& iter = std::find(_downloads.begin(), _downloads.end(), download);
 	// Remove download from vector by using its iterator in _downloads
 	if (iter != _downloads.end())
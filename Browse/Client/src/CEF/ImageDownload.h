@@ -10,6 +10,7 @@
 
 #include "include/cef_browser.h"
 #include <algorithm>
+#include <mutex>
 
 class HandlerImageInterface;	// Forward declaration
 
@@ -35,7 +36,7 @@ private:
 class HandlerImageInterface
 {
 public:
-	virtual bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img) = 0;
+	virtual bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img, CefString img_url) = 0;
 
 	void StartImageDownload(CefRefPtr<CefBrowser> browser, CefString img_url);
 	void FinishImageDownload(CefRefPtr<PendingImageDownload> download);
@@ -43,6 +44,7 @@ public:
 
 private:
 	std::vector< CefRefPtr<PendingImageDownload> > _downloads;
+	std::mutex _downloadsMutex; // downloads finish on CEF UI thread, which might not be the main thread
 };
 
 
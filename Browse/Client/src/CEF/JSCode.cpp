@@ -61,6 +61,56 @@ std::string jsInputTextData(int inputID, std::string text, bool submit)
 	return code;
 }
 
+std::string jsInsertText(int insertionId, std::string text, bool replace)
+{
+	// Put text into JavaScript string. Line and paragraph separator (UTF-8 encoded U+2028 and U+2029)
+	// end a string literal like line feed does in older JavaScript engines
+	std::string escaped;
+	for (size_t i = 0; i < text.length(); i++)
+	{
+		const char c = text[i];
+		if (c == '\xE2' && i + 2 < text.length() && text[i + 1] == '\x80' && (text[i + 2] == '\xA8' || text[i + 2] == '\xA9'))
+		{
+			escaped += (text[i + 2] == '\xA8') ? "\\u2028" : "\\u2029";
+			i += 2;
+			continue;
+		}
+		switch (c)
+		{
+		case '\\': escaped += "\\\\"; break;
+		case '\'': escaped += "\\'"; break;
+		case '\n': escaped += "\\n"; break;
+		case '\r': escaped += "\\r"; break;
+		default: escaped += c;
+		}
+	}
+
+	// Insert text into focused element with a single editing command, which fires one input event. Command fails
+	// for elements which are not editable. Form fields may accept the command but keep their value, e.g. when a
+	// script of the page cancels the input. Result is reported back with the time spent in the renderer
+	std::string code = "(function(){\
+		var start = performance.now();\
+		var text = '" + escaped + "';\
+		var element = document.activeElement;\
+		var inserted = false;\
+		try {\
+			" + (replace ? "document.execCommand('selectAll', false, null);" : "") + "\
+			inserted = document.execCommand('insertText', false, text);\
+		} catch(e) {}\
+		if(inserted && element && typeof(element.value) === 'string')\
+		{\
+			var expected = text.replace(/\\r\\n?/g, '\\n');\
+			if(element.tagName === 'INPUT')\
+				expected = expected.replace(/\\n/g, '');\
+			inserted = (element.value.indexOf(expected) !== -1);\
+		}\
+		if(typeof(window.cefQuery) === 'function')\
+			window.cefQuery({ request: '#insertText#" + std::to_string(insertionId) + "#' + (inserted ? 1 : 0) + '#' + (performance.now() - start) + '#',\
+				persistent: false, onSuccess: function(response) {}, onFailure: function(error_code, error_message) {} });\
+	})();";
+	return code;
+}
+
 std::string jsFavIconUpdate(std::string oldUrl)
 {
 	std::string code = "for (i = 0; i < links.length; i++)\
@@ -39,5 +39,6 @@ enum JSFile
 std::string GetJSCode(JSFile file);
 std::string jsInputTextData(int inputID, std::string text, bool submit = false);
 std::string jsFavIconUpdate(std::string oldUrl);
+std::string jsInsertText(int insertionId, std::string text, bool replace);
 
 #endif // CEF_JSCODE_H_
@@ -77,4 +77,18 @@ void MainCefApp::OnContextInitialized()
 
 	// Create handler for dev tools
 	_devToolsHandler = new DevToolsHandler();
+
+	// Tell waiting main thread about initialization
+	_contextInitializedPromise.set_value();
+}
+
+void MainCefApp::OnScheduleMessagePumpWork(int64 delay_ms)
+{
+	// Called on any thread, pump is performed by Master's loop
+	_messagePump.ScheduleWork(delay_ms);
+}
+
+void MainCefApp::WaitForContextInitialization()
+{
+	_contextInitializedFuture.wait();
 }
\ No newline at end of file
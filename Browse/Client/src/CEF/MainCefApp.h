@@ -10,6 +10,7 @@
 
 #include "include/cef_app.h"
 #include "src/CEF/Mediator.h"
+#include <future>
 
 class MainCefApp :	public CefApp,
 					public CefBrowserProcessHandler,
@@ -23,9 +24,17 @@ public:
     // CefBrowserProcessHandler methods
     virtual CefRefPtr<CefBrowserProcessHandler> GetBrowserProcessHandler() OVERRIDE { return this; }
     virtual void OnContextInitialized() OVERRIDE;
+    virtual void OnScheduleMessagePumpWork(int64 delay_ms) OVERRIDE;
+
+	// Block until CEF context is initialized. Only necessary with multi-threaded message loop
+	void WaitForContextInitialization();
 
 private:
 
+	// Promise fulfilled when CEF context is initialized
+	std::promise<void> _contextInitializedPromise;
+	std::shared_future<void> _contextInitializedFuture = _contextInitializedPromise.get_future().share();
+
     // Include CEF'S default reference counting implementation
     IMPLEMENT_REFCOUNTING(MainCefApp);
 };
@@ -13,8 +13,33 @@
 #include "src/CEF/Data/DOMNode.h"
 #include "src/Utils/Logger.h"
 #include "src/Global.h"
+#include "src/Utils/Texture.h"
+#include "src/Singletons/ScreenshotHandler.h"
 #include "include/cef_app.h"
+#include "include/cef_task.h"
 #include "include/wrapper/cef_helpers.h"
+#include <future>
+#include <limits>
+
+// Task executing a function on a CEF thread
+class FunctionTask : public CefTask
+{
+public:
+
+	// Constructor
+	FunctionTask(std::function<void()> function) : _function(function) {}
+
+	// Execute function
+	virtual void Execute() OVERRIDE { _function(); }
+
+private:
+
+	// Function to execute
+	std::function<void()> _function;
+
+	// Include CEF'S default reference counting implementation
+	IMPLEMENT_REFCOUNTING(FunctionTask);
+};
 
 
 void Mediator::SetMaster(MasterNotificationInterface* pMaster)
@@ -24,8 +49,6 @@ void Mediator::SetMaster(MasterNotificationInterface* pMaster)
 
 void Mediator::RegisterTab(TabCEFInterface* pTab, std::string URL, CefRefPtr<CefRequestContext> request_context)
 {
-    CEF_REQUIRE_UI_THREAD();
-
     /*Following information might be changed and used in the future
     http://magpcss.org/ceforum/apidocs3/projects/%28default%29/_cef_browser_settings_t.html
         - webgl: enable WebGL
@@ -43,6 +66,12 @@ void Mediator::RegisterTab(TabCEFInterface* pTab, std::string URL, CefRefPtr<Cef
 	
     }
 
+	// Start at maximum frame rate, Tab lowers it depending on activity
+	if (setup::WEB_VIEW_FRAME_RATE_CONTROL)
+	{
+		browser_settings.windowless_frame_rate = setup::WEB_VIEW_MAX_FRAME_RATE;
+	}
+
 	browser_settings.application_cache = STATE_ENABLED; // Goal: Accepting & saving cookies enabled
 
     // TODO: Delay Renderer OR save Tab & Texture as default if key(browser) not in map, reset after map insertion
@@ -56,26 +85,60 @@ void Mediator::RegisterTab(TabCEFInterface* pTab, std::string URL, CefRefPtr<Cef
     LogDebug("Mediator: Creating new CefBrowser at Tab registration.");
     // Create new CefBrowser with given information
 	auto dict = CefDictionaryValue::Create();
-    CefRefPtr<CefBrowser> browser = CefBrowserHost::CreateBrowserSync(
-        window_info, _handler.get(), URL, browser_settings, dict, request_context);
+	CefRefPtr<CefBrowser> browser;
+	if (CefCurrentlyOn(TID_UI))
+	{
+		browser = CefBrowserHost::CreateBrowserSync(
+			window_info, _handler.get(), URL, browser_settings, dict, request_context);
+	}
+	else
+	{
+		// CEF runs its UI thread on its own (multi-threaded message loop), so create browser there and wait for it.
+		// Meanwhile, GetViewRect is answered with resolution of pending Tab
+		{
+			int width = 0, height = 0;
+			pTab->GetWebRenderResolution(width, height);
+			std::lock_guard<std::mutex> lock(_resolutionsMutex);
+			_pendingResolution = std::make_pair(width, height);
+		}
+		std::promise<void> promise; auto future = promise.get_future();
+		CefPostTask(TID_UI, new FunctionTask([&]()
+		{
+			browser = CefBrowserHost::CreateBrowserSync(
+				window_info, _handler.get(), URL, browser_settings, dict, request_context);
+			promise.set_value();
+		}));
+		future.wait();
+	}
 	LogDebug("Mediator::RegisterTab: request_context == nullptr? ", request_context == nullptr);
 
     // Fill maps with correlating Tab and CefBrowsre
     _browsers.emplace(pTab, browser);
     _tabs.emplace(browser->GetIdentifier(), pTab);
     _pendingTab = NULL;
+	if (setup::CEF_MULTI_THREADED_MESSAGE_LOOP)
+	{
+		std::lock_guard<std::mutex> lock(_resolutionsMutex);
+		_resolutions[browser->GetIdentifier()] = _pendingResolution;
+	}
 }
 
 void Mediator::UnregisterTab(TabCEFInterface* pTab)
 {
     if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
     {
-        // Close corresponding CefBrowser in Handler
+        // Close corresponding CefBrowser in Handler. Pending text insertions must not call back into Tab
         _handler->CloseBrowser(browser);
+        _handler->DropTextInsertions(browser);
 
         // Delete corresponding key-value-pair
         BrowserID browserID = browser->GetIdentifier();
         LogDebug("Mediator: Unregistering Tab corresponding to browserID = ", browserID);
+        _paintHandoffQueue.Remove(browserID);
+		{
+			std::lock_guard<std::mutex> lock(_resolutionsMutex);
+			_resolutions.erase(browserID);
+		}
         _tabs.erase(browserID);
         _browsers.erase(pTab);
     }
@@ -132,7 +195,133 @@ void Mediator::ReplyJSDialog(TabCEFInterface* pTab, bool clicked_ok, std::string
 
 void Mediator::DoMessageLoopWork()
 {
-    CefDoMessageLoopWork();
+	if (!setup::CEF_MULTI_THREADED_MESSAGE_LOOP)
+	{
+		// Perform CEF work that is due. Paints are directly uploaded within the work
+		_messagePump.Update();
+	}
+	else
+	{
+		// CEF works on a thread of its own, execute callbacks that have been handed over. Tasks queued
+		// by these callbacks wait for next call
+		std::vector<std::function<void()> > tasks;
+		{
+			std::lock_guard<std::mutex> lock(_tasksMutex);
+			std::swap(tasks, _tasks);
+		}
+		for (const auto& rTask : tasks)
+		{
+			rTask();
+		}
+
+		// Upload paints that have been handed over
+		_paintHandoffQueue.Flush([this](int browserId, const std::vector<unsigned char>& rPixels, int width, int height, float dirtyShare)
+		{
+			auto iter = _tabs.find(browserId);
+			if (iter == _tabs.end()) { return; }
+			if (auto spTexture = iter->second->GetWebViewTexture().lock())
+			{
+				if (setup::KEYSTROKE_BMP_CREATION)
+				{
+					ScreenshotHandler::instance().SetBuffer(rPixels.data(), width, height, 4);
+				}
+				spTexture->Fill(width, height, GL_BGRA, rPixels.data());
+			}
+			iter->second->NotifyPaint(dirtyShare);
+			_paintDamage = true;
+		});
+	}
+}
+
+void Mediator::QueuePaint(CefRefPtr<CefBrowser> browser, const void* pBuffer, int width, int height, float dirtyShare)
+{
+	_paintHandoffQueue.Push(browser->GetIdentifier(), pBuffer, width, height, dirtyShare);
+	WakeUp();
+}
+
+void Mediator::RunOnMainThread(std::function<void()> task)
+{
+	if (!setup::CEF_MULTI_THREADED_MESSAGE_LOOP)
+	{
+		// CEF callbacks are already executed on main thread
+		task();
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_tasksMutex);
+		_tasks.push_back(task);
+	}
+	WakeUp();
+}
+
+void Mediator::WakeUp()
+{
+	// Main loop might wait for events
+	std::lock_guard<std::mutex> lock(_wakeUpMutex);
+	if (_wakeUp) { _wakeUp(); }
+}
+
+void Mediator::NotifyPaint(CefRefPtr<CefBrowser> browser, float dirtyShare)
+{
+	_paintDamage = true;
+	if (TabCEFInterface* pTab = GetTab(browser))
+	{
+		pTab->NotifyPaint(dirtyShare);
+	}
+}
+
+void Mediator::NotifyLoadingStateChange(CefRefPtr<CefBrowser> browser, bool isLoading)
+{
+	if (TabCEFInterface* pTab = GetTab(browser))
+	{
+		pTab->NotifyLoadingStateChange(isLoading);
+	}
+}
+
+void Mediator::NotifyNavigationCommit(CefRefPtr<CefBrowser> browser, std::string URL)
+{
+	if (TabCEFInterface* pTab = GetTab(browser))
+	{
+		pTab->NotifyNavigationCommit(URL);
+	}
+}
+
+void Mediator::SetWakeUpFunction(std::function<void()> function)
+{
+	_messagePump.SetWakeUpFunction(function);
+	std::lock_guard<std::mutex> lock(_wakeUpMutex);
+	_wakeUp = function;
+}
+
+double Mediator::GetTimeUntilWork() const
+{
+	if (setup::CEF_MULTI_THREADED_MESSAGE_LOOP)
+	{
+		// CEF works on its own and wakes up main loop when handing over callbacks or paints
+		return std::numeric_limits<double>::max();
+	}
+	if (!setup::CEF_EXTERNAL_MESSAGE_PUMP)
+	{
+		// CEF has to be pumped every frame
+		return 0.0;
+	}
+	return _messagePump.GetTimeUntilWork();
+}
+
+bool Mediator::TakePaintDamage()
+{
+	bool damage = _paintDamage;
+	_paintDamage = false;
+	return damage;
+}
+
+void Mediator::SetFrameRate(TabCEFInterface* pTab, int frameRate)
+{
+	if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
+	{
+		browser->GetHost()->SetWindowlessFrameRate(frameRate);
+	}
 }
 
 void Mediator::EmulateMouseCursor(TabCEFInterface* pTab, double x, double y, bool leftButtonPressed)
@@ -413,6 +602,21 @@ bool Mediator::EmulateSelectAll(TabCEFInterface* pTab)
 	return false;
 }
 
+bool Mediator::InsertText(TabCEFInterface* pTab, std::string input, bool submit, std::function<void()> finished)
+{
+	if (const auto& browser = GetBrowser(pTab))
+	{
+		_handler->InsertText(browser, input, submit, finished);
+		return true;
+	}
+	return false;
+}
+
+void Mediator::FinishTextInsertion(CefRefPtr<CefBrowser> browser, int insertionId, bool inserted, double rendererTime)
+{
+	_handler->FinishTextInsertion(browser, insertionId, inserted, rendererTime);
+}
+
 void Mediator::ResetScrolling(TabCEFInterface * pTab)
 {
     if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
@@ -421,6 +625,22 @@ void Mediator::ResetScrolling(TabCEFInterface * pTab)
     }
 }
 
+void Mediator::SetScrolling(TabCEFInterface * pTab, double x, double y)
+{
+    if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
+    {
+        _handler->SetMainFramesScrolling(browser, x, y);
+    }
+}
+
+void Mediator::SetResourceHint(TabCEFInterface* pTab, std::string rel, std::string URL, bool add)
+{
+    if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
+    {
+        _handler->SetResourceHint(browser, rel, URL, add);
+    }
+}
+
 void Mediator::SetURL(CefRefPtr<CefBrowser> browser)
 {
     if (TabCEFInterface* pTab = GetTab(browser))
@@ -445,7 +665,7 @@ void Mediator::SetCanGoForward(CefRefPtr<CefBrowser> browser, bool canGoForward)
     }
 }
 
-bool Mediator::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img)
+bool Mediator::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img, CefString img_url)
 {
 	if (const auto pTab = GetTab(browser))
 	{
@@ -478,7 +698,7 @@ bool Mediator::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefI
 		upData->resize(byte_size / sizeof(unsigned char));
 		binary_value->GetData(static_cast<void*>(upData->data()), byte_size, 0);
 
-		pTab->ReceiveFaviconBytes(std::move(upData), width, height);
+		pTab->ReceiveFaviconBytes(std::move(upData), width, height, img_url.ToString());
 		return true;
 	}
 	LogInfo("Mediator: Forwarding favicon bytes to Tab failed. It might not exist anymore.");
@@ -504,6 +724,14 @@ bool Mediator::SetMetaKeywords(CefRefPtr<CefBrowser> browser, std::string conten
 	return false;
 }
 
+void Mediator::SetAudible(CefRefPtr<CefBrowser> browser, bool audible)
+{
+	if (auto pTab = GetTab(browser))
+	{
+		pTab->SetAudible(audible);
+	}
+}
+
 void Mediator::SetZoomLevel(TabCEFInterface * pTab)
 {
     if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
@@ -780,6 +1008,17 @@ void Mediator::OnScrollOffsetChanged(CefRefPtr<CefBrowser> browser, double x, do
 
 void Mediator::GetResolution(CefRefPtr<CefBrowser> browser, int& width, int& height) const
 {
+	if (setup::CEF_MULTI_THREADED_MESSAGE_LOOP)
+	{
+		// Called on CEF UI thread, which must not access Tabs
+		std::lock_guard<std::mutex> lock(_resolutionsMutex);
+		auto iter = _resolutions.find(browser->GetIdentifier());
+		const std::pair<int, int>& rResolution = iter != _resolutions.end() ? iter->second : _pendingResolution;
+		width = rResolution.first;
+		height = rResolution.second;
+		return;
+	}
+
     if (TabCEFInterface* pTab = GetTab(browser))
     {
         pTab->GetWebRenderResolution(width, height);
@@ -799,5 +1038,16 @@ void Mediator::GetResolution(CefRefPtr<CefBrowser> browser, int& width, int& hei
 
 void Mediator::ResizeTabs()
 {
+	if (setup::CEF_MULTI_THREADED_MESSAGE_LOOP)
+	{
+		// Remember resolutions before CEF UI thread asks for them
+		std::lock_guard<std::mutex> lock(_resolutionsMutex);
+		for (const auto& rPair : _tabs)
+		{
+			int width = 0, height = 0;
+			rPair.second->GetWebRenderResolution(width, height);
+			_resolutions[rPair.first] = std::make_pair(width, height);
+		}
+	}
     _handler->ResizeBrowsers();
 }
@@ -12,11 +12,15 @@
 #include "src/CEF/Handler.h"
 #include "src/CEF/DevToolsHandler.h"
 #include "src/CEF/JavaScriptDialogType.h"
+#include "src/CEF/MessagePump.h"
+#include "src/CEF/PaintHandoffQueue.h"
 #include <set>
 #include <map>
 #include <memory>
 #include <queue>
 #include <functional>
+#include <mutex>
+#include <vector>
 #include "include\cef_base.h"
 
 /**
@@ -69,9 +73,40 @@ public:
     // Called by Master when window resize happens
     void ResizeTabs();
 
-    // Call from Master to do message loop work
+    // Call from Master to do message loop work. Performs scheduled CEF work or, when CEF runs on a thread
+    // of its own, executes handed over callbacks and uploads handed over paints
     void DoMessageLoopWork();
 
+	// Execute task on main thread. Executed immediately unless CEF runs with multi-threaded message loop,
+	// then it is queued for next DoMessageLoopWork. Thread-safe
+	void RunOnMainThread(std::function<void()> task);
+
+	// Set function which wakes up the main loop when CEF has something to do. Must be thread-safe
+	void SetWakeUpFunction(std::function<void()> function);
+
+	// Get time the main loop may wait before DoMessageLoopWork must be called again, in seconds
+	double GetTimeUntilWork() const;
+
+	// Whether some Tab has been painted since last call
+	bool TakePaintDamage();
+
+	// Renderer::OnPaint calls this method when CEF runs on a thread of its own
+	void QueuePaint(CefRefPtr<CefBrowser> browser, const void* pBuffer, int width, int height, float dirtyShare);
+
+	// Tell Tab which share of its web view has been repainted
+	void NotifyPaint(CefRefPtr<CefBrowser> browser, float dirtyShare);
+
+	// Tell Tab about change of loading state and commit of navigation in main frame
+	void NotifyLoadingStateChange(CefRefPtr<CefBrowser> browser, bool isLoading);
+	void NotifyNavigationCommit(CefRefPtr<CefBrowser> browser, std::string URL);
+
+	// Set windowless frame rate of Tab's browser
+	void SetFrameRate(TabCEFInterface* pTab, int frameRate);
+
+	// Frame pacing statistics of the message pump
+	MessagePump::FramePacing GetFramePacing() const { return _messagePump.GetFramePacing(); }
+	void ResetFramePacing() { _messagePump.ResetFramePacing(); }
+
     // Emulation of left mouse button press and release in specific Tab
     void EmulateMouseCursor(TabCEFInterface* pTab, double x, double y, bool leftButtonPressed); // leftButtonPressed seems necessary
 																								// between mouse button down and up during text selection
@@ -88,7 +123,18 @@ public:
 	bool EmulateEnterKey(TabCEFInterface* pTab);
 	bool EmulateSelectAll(TabCEFInterface* pTab);
 
+	// Replace content of focused element in Tab by text with a single editing command, falls back to keyboard strokes.
+	// Finished is called once the result is known
+	bool InsertText(TabCEFInterface* pTab, std::string input, bool submit, std::function<void()> finished);
+
+	// Called by message router with result of text insertion. Time spent in renderer is in milliseconds
+	void FinishTextInsertion(CefRefPtr<CefBrowser> browser, int insertionId, bool inserted, double rendererTime);
+
     void ResetScrolling(TabCEFInterface* pTab);
+    void SetScrolling(TabCEFInterface* pTab, double x, double y);
+
+    // Add or remove resource hint in main frame of Tab, rel is e.g. "preconnect" or "prefetch"
+    void SetResourceHint(TabCEFInterface* pTab, std::string rel, std::string URL, bool add);
 
     // Sets Tab's URL attribute, called by Handler when main frame starts loading a page
     void SetURL(CefRefPtr<CefBrowser> browser);
@@ -106,15 +152,18 @@ public:
 	void ResetFavicon(CefRefPtr<CefBrowser> browser);
 
 	// Get byte code from CefImage and send it to corresponding Tab
-	bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img);
+	bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img, CefString img_url);
 
-	// Check if favicon was already loaded before new image is also loaded
+	// Check if favicon was already loaded or is cached before new image is also loaded
 	bool IsFaviconAlreadyAvailable(CefRefPtr<CefBrowser> browser, CefString img_url);
 
 
 
 	bool SetMetaKeywords(CefRefPtr<CefBrowser> browser, std::string content);
 
+	// Tell Tab whether some media element of its page is playing with sound
+	void SetAudible(CefRefPtr<CefBrowser> browser, bool audible);
+
     // External zoom level request
     void SetZoomLevel(TabCEFInterface* pTab);
     // Called by Handler OnLoadStart
@@ -217,6 +266,31 @@ protected:
 	// Simple internal clipboard
 	std::string _clipboard = "";
 
+	// Pump of CEF message loop, scheduled by CEF through OnScheduleMessagePumpWork
+	MessagePump _messagePump;
+
+	// Paints handed over from CEF UI thread (only used with multi-threaded message loop)
+	PaintHandoffQueue _paintHandoffQueue;
+
+	// Callbacks handed over from CEF UI thread (only used with multi-threaded message loop)
+	std::vector<std::function<void()> > _tasks;
+	std::mutex _tasksMutex;
+
+	// Function to wake up main loop when paint or callback has been handed over
+	std::function<void()> _wakeUp;
+	std::mutex _wakeUpMutex;
+
+	// Resolutions of Tabs for GetViewRect on CEF UI thread (only used with multi-threaded message loop)
+	std::map<BrowserID, std::pair<int, int> > _resolutions;
+	std::pair<int, int> _pendingResolution;
+	mutable std::mutex _resolutionsMutex;
+
+	// Wake up main loop
+	void WakeUp();
+
+	// Whether some Tab has been painted since last check of damage
+	bool _paintDamage = false;
+
     // Use these methods for less coding overhead by checking if key exists in map
     TabCEFInterface* GetTab(CefRefPtr<CefBrowser> browser) const;
     CefRefPtr<CefBrowser> GetBrowser(TabCEFInterface* pTab) const;
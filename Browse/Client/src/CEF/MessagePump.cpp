@@ -0,0 +1,107 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "MessagePump.h"
+#include "src/Setup.h"
+#include "include/cef_app.h"
+#include <algorithm>
+
+MessagePump::MessagePump()
+{
+	// Do work in first frame
+	_nextWork = Clock::now();
+	_lastUpdate = Clock::now();
+}
+
+void MessagePump::ScheduleWork(int64 delayMs)
+{
+	// CEF replaces previously scheduled work with the new request. Delay is clamped
+	// so CEF is pumped at least with the maximum delay (as recommended by CEF)
+	delayMs = std::max((int64)0, std::min(delayMs, (int64)setup::CEF_MESSAGE_PUMP_MAX_DELAY));
+	std::lock_guard<std::mutex> lock(_mutex);
+	_nextWork = Clock::now() + std::chrono::milliseconds(delayMs);
+	if (_wakeUp) { _wakeUp(); }
+}
+
+void MessagePump::SetWakeUpFunction(std::function<void()> function)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_wakeUp = function;
+}
+
+double MessagePump::GetTimeUntilWork() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return std::max(0.0, std::chrono::duration<double>(_nextWork - Clock::now()).count());
+}
+
+void MessagePump::Update()
+{
+	// Measure frame time as duration between updates
+	const auto now = Clock::now();
+	const double frameTime = std::chrono::duration<double>(now - _lastUpdate).count();
+	_lastUpdate = now;
+
+	// Do work as long as CEF wants it and the budget of the frame is not exceeded
+	double frameWorkTime = 0.0;
+	bool busy = false;
+	if (setup::CEF_EXTERNAL_MESSAGE_PUMP)
+	{
+		while (true)
+		{
+			// Check whether work is due
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (Clock::now() < _nextWork)
+				{
+					break;
+				}
+
+				// Without further scheduling by CEF, pump again after maximum delay
+				_nextWork = Clock::now() + std::chrono::milliseconds(setup::CEF_MESSAGE_PUMP_MAX_DELAY);
+			}
+
+			// Do work (CEF may schedule further work meanwhile)
+			frameWorkTime += DoWork();
+
+			// Leave remaining work for next frame when budget is exceeded
+			if (frameWorkTime >= setup::CEF_MESSAGE_PUMP_FRAME_BUDGET)
+			{
+				busy = true;
+				break;
+			}
+		}
+	}
+	else
+	{
+		// Pump once per frame without any scheduling
+		frameWorkTime = DoWork();
+	}
+
+	// Update statistics
+	_framePacing.frameCount++;
+	_framePacing.frameTime += frameTime;
+	_framePacing.workTime += frameWorkTime;
+	_framePacing.maxWorkTime = std::max(_framePacing.maxWorkTime, frameWorkTime);
+	if (busy) { _framePacing.busyFrameCount++; }
+}
+
+MessagePump::FramePacing MessagePump::GetFramePacing() const
+{
+	return _framePacing;
+}
+
+void MessagePump::ResetFramePacing()
+{
+	_framePacing = FramePacing();
+}
+
+double MessagePump::DoWork()
+{
+	const auto start = Clock::now();
+	CefDoMessageLoopWork();
+	_framePacing.workCount++;
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
@@ -0,0 +1,80 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Drives the CEF message loop when CEF runs with an external message pump.
+// CEF tells via OnScheduleMessagePumpWork when it wants to do work next and
+// the master loop asks the pump once per frame to perform due work. Keeps
+// statistics about how much of each frame is consumed by CEF.
+
+#ifndef CEF_MESSAGEPUMP_H_
+#define CEF_MESSAGEPUMP_H_
+
+#include "include/cef_base.h"
+#include <chrono>
+#include <mutex>
+#include <functional>
+
+class MessagePump
+{
+public:
+
+	// Frame pacing statistics, accumulated since last reset
+	struct FramePacing
+	{
+		unsigned int frameCount = 0; // frames in which pump has been updated
+		unsigned int workCount = 0; // calls of CefDoMessageLoopWork
+		unsigned int busyFrameCount = 0; // frames in which the work budget has been exceeded
+		double frameTime = 0.0; // accumulated frame time, in seconds
+		double workTime = 0.0; // accumulated time spent in CEF, in seconds
+		double maxWorkTime = 0.0; // maximum time spent in CEF within a single frame, in seconds
+
+		// Share of frame time consumed by CEF
+		double GetWorkShare() const { return frameTime > 0.0 ? workTime / frameTime : 0.0; }
+	};
+
+	// Constructor
+	MessagePump();
+
+	// Called by CEF on any thread when it wants work to be done after given delay
+	void ScheduleWork(int64 delayMs);
+
+	// Called once per frame by the main loop. Performs CEF work that is due
+	void Update();
+
+	// Set function called whenever CEF schedules work, so a waiting main loop wakes up. Must be thread-safe
+	void SetWakeUpFunction(std::function<void()> function);
+
+	// Get time until CEF wants to do work, in seconds. Zero when work is due
+	double GetTimeUntilWork() const;
+
+	// Get frame pacing statistics
+	FramePacing GetFramePacing() const;
+
+	// Reset frame pacing statistics
+	void ResetFramePacing();
+
+private:
+
+	typedef std::chrono::steady_clock Clock;
+
+	// Perform a single unit of CEF work and return spent time in seconds
+	double DoWork();
+
+	// Mutex for members written by CEF threads
+	mutable std::mutex _mutex;
+
+	// Function to wake up main loop
+	std::function<void()> _wakeUp;
+
+	// Point in time at which CEF wants to do work next
+	Clock::time_point _nextWork;
+
+	// Time of last update, used to measure frame time
+	Clock::time_point _lastUpdate;
+
+	// Statistics
+	FramePacing _framePacing;
+};
+
+#endif // CEF_MESSAGEPUMP_H_
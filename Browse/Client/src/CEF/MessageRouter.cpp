@@ -6,6 +6,7 @@
 #include "MessageRouter.h"
 #include "src/CEF/Mediator.h"
 #include "src/Utils/Logger.h"
+#include "src/Setup.h"
 #include "src/CEF/Data/DOMNode.h"
 #include "src/CEF/Data/DOMExtraction.h"
 #include <cstdlib>
@@ -34,7 +35,26 @@ bool DefaultMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 	bool persistent,
 	CefRefPtr<Callback> callback)
 {
-	const std::string& requestStr = request.ToString();
+	const std::string requestStr = request.ToString();
+	if (!setup::CEF_MULTI_THREADED_MESSAGE_LOOP)
+	{
+		return HandleQuery(browser, requestStr, callback);
+	}
+
+	// Mediator and Tabs belong to main thread
+	_pMediator->RunOnMainThread([=]()
+	{
+		if (!HandleQuery(browser, requestStr, callback))
+		{
+			// Too late to pass query to further handlers
+			callback->Failure(0, "unhandled query");
+		}
+	});
+	return true;
+}
+
+bool DefaultMsgHandler::HandleQuery(CefRefPtr<CefBrowser> browser, const std::string& requestStr, CefRefPtr<Callback> callback)
+{
 	std::vector<std::string> split_request = SplitBySeparator(requestStr, '#');
 
 	if (split_request.size() == 3 && split_request[0].compare("resolution") == 0)
@@ -82,6 +102,13 @@ bool DefaultMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 		return false;
 	}
 
+	// Receive whether some media element is playing with sound
+	if (split_request.size() == 2 && split_request[0].compare("audible") == 0)
+	{
+		_pMediator->SetAudible(browser, split_request[1] == "1");
+		return true;
+	}
+
 
 	// ###############
 	// ### Favicon ###
@@ -112,6 +139,30 @@ bool DefaultMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 		return true;
 	}
 
+	// ######################
+	// ### Text Insertion ###
+	// ######################
+
+	// Result of text insertion, called by JavaScript of Handler::InsertText
+	if (requestStr.compare(0, 12, "#insertText#") == 0)
+	{
+		auto split = SplitBySeparator(requestStr, '#');
+		if (split.size() >= 4)
+		{
+			try
+			{
+				_pMediator->FinishTextInsertion(browser, std::stoi(split[1]), split[2] == "1", std::stod(split[3]));
+			}
+			catch (const std::exception& e)
+			{
+				LogInfo("MsgRouter: Received wrongly typed text insertion result!");
+				LogInfo("Caught exception: ", e.what());
+			}
+		}
+		callback->Success("success");
+		return true;
+	}
+
 	// ######################
 	// ### Text Selection ###
 	// ######################
@@ -399,17 +450,22 @@ bool CallbackMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 		// Remove prefix
 		std::string message = requestString.substr(_prefix.size());
 
-		try
+		// Call callback on main thread
+		std::function<void(std::string)> callbackFunction = _callbackFunction;
+		_pMediator->RunOnMainThread([=]()
 		{
-			// Call callback
-			_callbackFunction(message);
-			callback->Success("success"); // tell JavaScript about success
-		}
-		catch (const std::exception& e)
-		{
-			LogInfo("CallbackMsgHandler: Exception occured!\n", e.what());
-			callback->Failure(0, e.what());
-		}
+			try
+			{
+				// Call callback
+				callbackFunction(message);
+				callback->Success("success"); // tell JavaScript about success
+			}
+			catch (const std::exception& e)
+			{
+				LogInfo("CallbackMsgHandler: Exception occured!\n", e.what());
+				callback->Failure(0, e.what());
+			}
+		});
 		return true;
 	}
 
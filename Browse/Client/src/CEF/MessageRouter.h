@@ -34,6 +34,9 @@ public:
 
 private:
 
+	// Handle query on main thread. Returns whether query has been handled
+	bool HandleQuery(CefRefPtr<CefBrowser> browser, const std::string& requestStr, CefRefPtr<Callback> callback);
+
 	// Pointer to mediator (TODO: some extra interface?)
 	Mediator* _pMediator;
 };
@@ -44,8 +47,9 @@ class CallbackMsgHandler : public CefMessageRouterBrowserSide::Handler
 public:
 
 	// Constructor
-	CallbackMsgHandler(std::string prefix, std::function<void(std::string)> callbackFunction)
+	CallbackMsgHandler(Mediator* pMediator, std::string prefix, std::function<void(std::string)> callbackFunction)
 	{
+		_pMediator = pMediator;
 		_prefix = prefix;
 		_callbackFunction = callbackFunction;
 	}
@@ -61,6 +65,7 @@ public:
 private:
 
 	// Members
+	Mediator* _pMediator;
 	std::string _prefix;
 	std::function<void(std::string)> _callbackFunction;
 };
@@ -73,10 +78,10 @@ public:
 	// Constructor
 	MessageRouter(Mediator* pMediator);
 
-	// Add new handler to process this callback
+	// Add new handler to process this callback. Must be called on CEF UI thread
 	void RegisterJavascriptCallback(std::string prefix, std::function<void(std::string)> callbackFunction)
 	{
-		CefMessageRouterBrowserSide::Handler* callbackHandler = new CallbackMsgHandler(prefix, callbackFunction);
+		CefMessageRouterBrowserSide::Handler* callbackHandler = new CallbackMsgHandler(_pMediator, prefix, callbackFunction);
 		_router->AddHandler(callbackHandler, false);
 	}
 
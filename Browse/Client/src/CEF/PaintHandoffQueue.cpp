@@ -0,0 +1,60 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "PaintHandoffQueue.h"
+#include <cstring>
+
+void PaintHandoffQueue::Push(int browserId, const void* pBuffer, int width, int height, float dirtyShare)
+{
+	const size_t byteCount = (size_t)width * (size_t)height * 4; // BGRA
+	std::lock_guard<std::mutex> lock(_mutex);
+	Paint& rPaint = _pushed[browserId];
+	if (rPaint.pending) { _droppedCount++; }
+	else { rPaint.dirtyShare = 0.f; }
+	rPaint.pixels.resize(byteCount); // keeps capacity of previously swapped buffer
+	std::memcpy(rPaint.pixels.data(), pBuffer, byteCount);
+	rPaint.width = width;
+	rPaint.height = height;
+	rPaint.dirtyShare += dirtyShare;
+	rPaint.pending = true;
+}
+
+void PaintHandoffQueue::Flush(PaintFunction function)
+{
+	// Take over pending paints while holding the lock
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		for (auto& rPair : _pushed)
+		{
+			if (rPair.second.pending)
+			{
+				Paint& rTaken = _taken[rPair.first];
+				std::swap(rTaken.pixels, rPair.second.pixels);
+				rTaken.width = rPair.second.width;
+				rTaken.height = rPair.second.height;
+				rTaken.dirtyShare = rPair.second.dirtyShare;
+				rTaken.pending = true;
+				rPair.second.pending = false;
+			}
+		}
+	}
+
+	// Process paints without blocking the CEF UI thread
+	for (auto& rPair : _taken)
+	{
+		if (rPair.second.pending)
+		{
+			function(rPair.first, rPair.second.pixels, rPair.second.width, rPair.second.height, rPair.second.dirtyShare);
+			rPair.second.pending = false;
+		}
+	}
+}
+
+void PaintHandoffQueue::Remove(int browserId)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_pushed.erase(browserId);
+	_taken.erase(browserId);
+}
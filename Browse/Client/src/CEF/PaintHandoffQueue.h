@@ -0,0 +1,63 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Hands over paints of CEF from the CEF UI thread to the main thread, which
+// owns the OpenGL context. Only the latest paint per browser is kept. Pixel
+// buffers are swapped instead of copied at handover and reused afterwards.
+
+#ifndef CEF_PAINTHANDOFFQUEUE_H_
+#define CEF_PAINTHANDOFFQUEUE_H_
+
+#include <vector>
+#include <map>
+#include <mutex>
+#include <functional>
+#include <atomic>
+
+class PaintHandoffQueue
+{
+public:
+
+	// Function called for each paint at flushing
+	typedef std::function<void(int browserId, const std::vector<unsigned char>& rPixels, int width, int height, float dirtyShare)> PaintFunction;
+
+	// Copy BGRA pixels of a paint into the queue. Replaces pending paint of same browser, whose repainted share of
+	// the view is accumulated. Called on CEF UI thread
+	void Push(int browserId, const void* pBuffer, int width, int height, float dirtyShare);
+
+	// Call function for every pending paint. Called on main thread
+	void Flush(PaintFunction function);
+
+	// Remove paints of browser. Called on main thread
+	void Remove(int browserId);
+
+	// Get count of paints that have been replaced before being flushed. Thread-safe
+	unsigned int GetDroppedCount() const { return _droppedCount.load(); }
+
+private:
+
+	// Paint of a browser
+	struct Paint
+	{
+		std::vector<unsigned char> pixels;
+		int width = 0;
+		int height = 0;
+		float dirtyShare = 0.f;
+		bool pending = false;
+	};
+
+	// Paints pushed by CEF UI thread
+	std::map<int, Paint> _pushed;
+
+	// Paints taken over by main thread
+	std::map<int, Paint> _taken;
+
+	// Mutex guarding pushed paints
+	std::mutex _mutex;
+
+	// Count of dropped paints, written by CEF UI thread
+	std::atomic<unsigned int> _droppedCount{ 0 };
+};
+
+#endif // CEF_PAINTHANDOFFQUEUE_H_
@@ -20,6 +20,35 @@ RenderProcessHandler::RenderProcessHandler()
 	_msgRouter = CefMessageRouterRendererSide::Create(config);
 }
 
+std::string RenderProcessHandler::BundleDOMCode() const
+{
+	std::stringstream bundle;
+	bundle << "window.starting_time_ = window.performance.now();\n";
+
+	// Scripts in order of their dependencies
+	for (const auto& dom_code : _js_dom_code)
+	{
+		bundle << "\n// " << dom_code.second << "\n" << dom_code.first << "\n;\n";
+	}
+
+	// Register DOM attributes known to C++
+	bool valid = true;
+	int attrId = 0;
+	while (valid)
+	{
+		const std::string& attrStr = DOMAttrToString((DOMAttribute) attrId);
+		valid = (attrStr.size() >= 3);	// There won't exist any attribute name with less than 4 characters
+		if (valid)
+			bundle << "AddDOMAttribute('" << attrStr << "', " << attrId << ");\n";
+		attrId++;
+	}
+
+	// Start observing and remember time spent for injection
+	bundle << "MutationObserverInit();\n";
+	bundle << "window.dom_injection_time_ = window.performance.now() - window.starting_time_;\n";
+	return bundle.str();
+}
+
 CefRefPtr<CefV8Value> RenderProcessHandler::CefValueToCefV8Value(CefRefPtr<CefValue> val)
 {
 	switch (val->GetType()) {
@@ -362,8 +391,6 @@ void RenderProcessHandler::OnContextCreated(
 	/*	frame->ExecuteJavaScript("window.addEventListener('message', (event) => {"
 			"if(window.debug) console.log('Window object',window,'received message ', event);}, false);", "", 0);*/
 
-		frame->ExecuteJavaScript("window.starting_time_ = window.performance.now();", "", 0);
-
 		// Clear previous DOM nodes in current Tab
 		CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("OnContextCreated");
 		browser->GetMainFrame()->SendProcessMessage(PID_BROWSER, msg);
@@ -385,38 +412,14 @@ void RenderProcessHandler::OnContextCreated(
             globalObj->SetValue("favIconHeight", CefV8Value::CreateInt(-1), V8_PROPERTY_ATTRIBUTE_NONE);
             globalObj->SetValue("favIconWidth", CefV8Value::CreateInt(-1), V8_PROPERTY_ATTRIBUTE_NONE);
 
-			// Inject Javascript code which extends the current page's context by our methods
-			// and automatically creates a MutationObserver instance
-			for (const auto& dom_code : _js_dom_code)
-			{
-				frame->ExecuteJavaScript(dom_code.first, dom_code.second, 0);
-			}
-
-
-			const auto& add_attribute = context->GetGlobal()->GetValue("AddDOMAttribute");
-			if (add_attribute->IsFunction())
-			{
-				bool valid = true;
-				int attrId = 0;
-				while (valid)
-				{
-					const std::string& attrStr = DOMAttrToString((DOMAttribute) attrId);
-					valid = (attrStr.size() >= 3);	// There won't exist any attribute name with less than 4 characters
-					if (valid)
-						add_attribute->ExecuteFunction(
-							context->GetGlobal(),
-							{ CefV8Value::CreateString(attrStr), CefV8Value::CreateInt(attrId) }
-					);
-					attrId++;
-				}
-			}
-			else
+			// Inject Javascript code which extends the current page's context by our methods, registers the
+			// DOM attributes and automatically creates a MutationObserver instance. Subframes get no DOM code
+			frame->ExecuteJavaScript(_js_dom_bundle, _js_dom_bundle_url, 0);
+			if (!context->GetGlobal()->GetValue("AddDOMAttribute")->IsFunction())
 			{
 				IPCLog(browser, "Renderer: ERROR: Could not find JS function 'AddDOMAttribute'!");
 			}
 
-			frame->ExecuteJavaScript("MutationObserverInit();", "", 0);
-
 
 			//IPCLog(browser, "LOADING FIXED ELEMENT JS FILE OVER AND OVER AGAIN");
 			//_js_dom_fixed_elements = GetJSCode(DOM_FIXED_ELEMENTS);
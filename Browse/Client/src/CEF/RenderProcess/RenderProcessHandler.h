@@ -53,6 +53,9 @@ private:
     void IPCLog(CefRefPtr<CefBrowser> browser, std::string text, bool debugLog = false);
     void IPCLogDebug(CefRefPtr<CefBrowser> browser, std::string text) { IPCLog(browser, text, true); }
 
+	// Concatenate DOM scripts, registration of DOM attributes and start of MutationObserver into a single script
+	std::string BundleDOMCode() const;
+
     // Message router instance
 	CefRefPtr<CefMessageRouterRendererSide> _msgRouter;
 
@@ -76,6 +79,11 @@ private:
 
 	};
 
+	// Bundle of DOM code which is injected into main frames. Identical source and URL let V8 reuse compiled code
+	// from its compilation cache on later navigations within the same render process
+	const std::string _js_dom_bundle = BundleDOMCode();
+	const std::string _js_dom_bundle_url = "gazetheweb_dom.js";
+
     // Include CEF'S default reference counting implementation
     IMPLEMENT_REFCOUNTING(RenderProcessHandler);
 };
@@ -39,6 +39,25 @@ void Renderer::OnPaint(
     int width,
     int height)
 {
+	// Share of view which has been repainted
+	float dirtyShare = 0.f;
+	if (width > 0 && height > 0)
+	{
+		double dirtyArea = 0.0;
+		for (const auto& rRect : dirtyRects)
+		{
+			dirtyArea += (double)rRect.width * (double)rRect.height;
+		}
+		dirtyShare = (float)(dirtyArea / ((double)width * (double)height));
+	}
+
+	// CEF UI thread has no OpenGL context with multi-threaded message loop, so hand over the paint to main thread
+	if (setup::CEF_MULTI_THREADED_MESSAGE_LOOP)
+	{
+		_mediator->QueuePaint(browser, buffer, width, height, dirtyShare);
+		return;
+	}
+
     // Look up corresponding texture
     if (auto spTexture = _mediator->GetTexture(browser).lock())
     {
@@ -61,6 +80,8 @@ void Renderer::OnPaint(
 		//	spTexture->drawRectangle(rect.width, rect.height, rect.x, rect.y);
 		//}
 
+		// Tell Tab about activity of page
+		_mediator->NotifyPaint(browser, dirtyShare);
     }
     else
     {
@@ -71,5 +92,5 @@ void Renderer::OnPaint(
 void Renderer::OnScrollOffsetChanged(CefRefPtr<CefBrowser> browser, double x, double y)
 {
     // Call Mediator to set offset in corresponding Tab
-    _mediator->OnScrollOffsetChanged(browser, x, y);
+    _mediator->RunOnMainThread([=]() { _mediator->OnScrollOffsetChanged(browser, x, y); });
 }
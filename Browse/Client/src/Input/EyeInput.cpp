@@ -6,16 +6,12 @@
 #include "EyeInput.h"
 #include "src/Utils/Logger.h"
 #include "src/Setup.h"
-#include "src/Input/Filters/WeightedAverageFilter.h"
+#include "src/Input/Filters/FilterFactory.h"
 #include <cmath>
 #include <functional>
 
-EyeInput::EyeInput(MasterThreadsafeInterface* _pMasterThreadsafeInterface, EyetrackerGeometry geometry) :
-	_spFilter(std::shared_ptr<Filter>(
-		new WeightedAverageFilter(
-			setup::FILTER_KERNEL,
-			setup::FILTER_WINDOW_TIME,
-			setup::FILTER_USE_OUTLIER_REMOVAL)))
+EyeInput::EyeInput(MasterThreadsafeInterface* _pMasterThreadsafeInterface, EyetrackerGeometry geometry, FilterType filterType) :
+	_spFilter(CreateFilter(filterType)), _filterType(filterType)
 {
 	// Create thread for connection to eye tracker
 	_upConnectionThread = std::unique_ptr<std::thread>(new std::thread([this, _pMasterThreadsafeInterface, geometry]()
@@ -458,6 +454,19 @@ void EyeInput::PauseLabStream()
 #endif // _WIN32
 }
 
+void EyeInput::SetFilter(FilterType filterType)
+{
+	// Settings are applied several times, so only replace filter when type differs
+	if (filterType == _filterType) { return; }
+
+	// Replace filter but keep received samples, so there is no gap in gaze data
+	std::shared_ptr<Filter> spFilter = CreateFilter(filterType);
+	spFilter->TakeOverSamples(*_spFilter.get());
+	_spFilter = spFilter;
+	_filterType = filterType;
+	LogInfo("EyeInput: Gaze filter changed to " + FilterTypeToString(filterType) + ".");
+}
+
 std::weak_ptr<CustomTransformationInterface> EyeInput::GetCustomTransformationInterface()
 {
 	return _spFilter;
@@ -13,6 +13,7 @@
 #include "src/Master/MasterThreadsafeInterface.h"
 #include "src/Input/EyeTrackerStatus.h"
 #include "src/Input/Filters/Filter.h"
+#include "src/Input/Filters/FilterType.h"
 #include "src/Input/Input.h"
 #include "plugins/Eyetracker/Interface/EyetrackerSample.h"
 #include "plugins/Eyetracker/Interface/EyetrackerInfo.h"
@@ -37,7 +38,7 @@ class EyeInput
 public:
 
     // Constructor, starts thread to establish eye tracker connection. Callback called from a different thread!
-    EyeInput(MasterThreadsafeInterface* _pMasterThreadsafeInterface, EyetrackerGeometry geometry);
+    EyeInput(MasterThreadsafeInterface* _pMasterThreadsafeInterface, EyetrackerGeometry geometry, FilterType filterType);
 
     // Destructor
     virtual ~EyeInput();
@@ -70,6 +71,9 @@ public:
 	// Pause lab streaming layer streaming of eye gaze data
 	void PauseLabStream();
 
+	// Exchange filter of gaze data. Custom transformations registered at previous filter are taken over
+	void SetFilter(FilterType filterType);
+
 	// Get pointer to interface for custom transformation of samples before filtering
 	std::weak_ptr<CustomTransformationInterface> GetCustomTransformationInterface();
 
@@ -124,6 +128,7 @@ private:
 
 	// Filter of gaze data
 	std::shared_ptr<Filter> _spFilter;
+	FilterType _filterType;
 };
 
 #endif // EYEINPUT_H_
\ No newline at end of file
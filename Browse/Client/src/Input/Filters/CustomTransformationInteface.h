@@ -9,6 +9,7 @@
 #define CUSTOMTRANSFORMATIONINTERFACE_H_
 
 #include <functional>
+#include <string>
 
 // Typedef for custom transformation
 typedef std::function<void(double&, double&)> FilterTransformation;
@@ -144,6 +144,71 @@ bool Filter::IsTimestampSetOnce() const
 	return _timestampSetOnce;
 }
 
+void Filter::TakeOverSamples(const Filter& rOther)
+{
+	_timestamp = rOther._timestamp;
+	_timestampSetOnce = rOther._timestampSetOnce;
+	_spSamples = SampleQueue(new std::deque<SampleData>(*rOther._spSamples.get())); // deep copy of sample data
+	_gazeX = rOther._gazeX;
+	_gazeY = rOther._gazeY;
+	_fixationDuration = rOther._fixationDuration;
+
+	// Users of custom transformations continue with this filter
+	_customTransformations = rOther._customTransformations;
+	for (auto& rCustomTransformation : _customTransformations)
+	{
+		auto& rTrans = rCustomTransformation.second;
+		rTrans.queue = SampleQueue(new std::deque<SampleData>(*rTrans.queue.get())); // deep copy of sample data
+	}
+}
+
+int Filter::FindWindowStart(const SampleQueue& rSamples, float windowTime)
+{
+	const int size = (int)rSamples->size();
+	if (size == 0) { return -1; }
+	const auto windowBegin = rSamples->back().timestamp - std::chrono::milliseconds((long long)(windowTime * 1000.f));
+	int index = size - 1;
+	while (index > 0 && rSamples->at(index - 1).timestamp >= windowBegin)
+	{
+		--index;
+	}
+	return index;
+}
+
+int Filter::FindFixationStart(const SampleQueue& rSamples, int windowStartIndex)
+{
+	const int size = (int)rSamples->size();
+	if (size == 0) { return -1; }
+	int index = size - 1;
+	while (index > windowStartIndex)
+	{
+		const auto& rGaze = rSamples->at(index - 1);
+		const auto& rNewerGaze = rSamples->at(index);
+		if (glm::distance(
+			glm::vec2(rNewerGaze.x, rNewerGaze.y),
+			glm::vec2(rGaze.x, rGaze.y))
+			> setup::FILTER_GAZE_FIXATION_PIXEL_RADIUS)
+		{
+			break; // older sample does not belong to fixation
+		}
+		--index;
+	}
+	return index;
+}
+
+float Filter::CalculateFixationDuration(const SampleQueue& rSamples, int fixationStartIndex)
+{
+	if (fixationStartIndex < 0) { return 0.f; }
+	return (float)((double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch() - rSamples->at(fixationStartIndex).timestamp).count() / 1000.0);
+}
+
+double Filter::CalculateInterval(const SampleData& rPrevious, const SampleData& rCurrent, float samplerate)
+{
+	double interval = (double)(rCurrent.timestamp - rPrevious.timestamp).count() / 1000.0;
+	double minimum = samplerate > 0 ? 1.0 / samplerate : 0.001;
+	return glm::max(interval, minimum);
+}
+
 bool Filter::RegisterCustomTransformation(std::string name, FilterTransformation transformation)
 {
 	// Check whether custom transformation already exists
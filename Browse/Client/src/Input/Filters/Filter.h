@@ -39,6 +39,9 @@ public:
 	// Getter which returns whether timestamp was actively set at least once (aka at least one sample received)
 	bool IsTimestampSetOnce() const;
 
+	// Take over received samples and custom transformations of other filter, e.g. when filter is exchanged
+	void TakeOverSamples(const Filter& rOther);
+
 	// #######################################
 	// ### CUSTOM TRANSFORMATION INTERFACE ###
 	// #######################################
@@ -60,6 +63,21 @@ public:
 
 	// #######################################
 
+protected:
+
+	// Index of oldest sample which is not older than given time, relative to latest sample. Returns -1 for empty queue
+	static int FindWindowStart(const SampleQueue& rSamples, float windowTime);
+
+	// Index of oldest sample in window which still belongs to fixation of latest sample. Consecutive samples of fixation
+	// are not farther away than fixation radius. Returns -1 for empty queue
+	static int FindFixationStart(const SampleQueue& rSamples, int windowStartIndex);
+
+	// Fixation duration in seconds, from receiving of sample at given index until now
+	static float CalculateFixationDuration(const SampleQueue& rSamples, int fixationStartIndex);
+
+	// Time between two samples in seconds. Falls back to interval of samplerate, as timestamps have millisecond resolution
+	static double CalculateInterval(const SampleData& rPrevious, const SampleData& rCurrent, float samplerate);
+
 private:
 
 	// Actual implementation of filtering
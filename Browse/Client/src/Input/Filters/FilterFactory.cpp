@@ -0,0 +1,65 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "FilterFactory.h"
+#include "src/Input/Filters/WeightedAverageFilter.h"
+#include "src/Input/Filters/OneEuroFilter.h"
+#include "src/Input/Filters/KalmanFilter.h"
+#include "src/Input/Filters/FixationAwareFilter.h"
+#include "src/Setup.h"
+
+std::shared_ptr<Filter> CreateFilter(FilterType type)
+{
+	switch (type)
+	{
+	case FilterType::ONE_EURO:
+		return std::shared_ptr<Filter>(
+			new OneEuroFilter(
+				setup::FILTER_ONE_EURO_MIN_CUTOFF,
+				setup::FILTER_ONE_EURO_BETA,
+				setup::FILTER_ONE_EURO_DERIVATIVE_CUTOFF,
+				setup::FILTER_WINDOW_TIME));
+	case FilterType::KALMAN:
+		return std::shared_ptr<Filter>(
+			new KalmanFilter(
+				setup::FILTER_KALMAN_PROCESS_NOISE,
+				setup::FILTER_KALMAN_MEASUREMENT_NOISE,
+				setup::FILTER_KALMAN_SACCADE_THRESHOLD,
+				setup::FILTER_WINDOW_TIME));
+	case FilterType::FIXATION_AWARE:
+		return std::shared_ptr<Filter>(
+			new FixationAwareFilter(
+				setup::FILTER_WINDOW_TIME));
+	default:
+		return std::shared_ptr<Filter>(
+			new WeightedAverageFilter(
+				setup::FILTER_KERNEL,
+				setup::FILTER_WINDOW_TIME,
+				setup::FILTER_USE_OUTLIER_REMOVAL));
+	}
+}
+
+std::string FilterTypeToString(FilterType type)
+{
+	switch (type)
+	{
+	case FilterType::ONE_EURO:
+		return "ONE_EURO";
+	case FilterType::KALMAN:
+		return "KALMAN";
+	case FilterType::FIXATION_AWARE:
+		return "FIXATION_AWARE";
+	default:
+		return "WEIGHTED_AVERAGE";
+	}
+}
+
+FilterType StringToFilterType(std::string name)
+{
+	if (name == "ONE_EURO") { return FilterType::ONE_EURO; }
+	else if (name == "KALMAN") { return FilterType::KALMAN; }
+	else if (name == "FIXATION_AWARE") { return FilterType::FIXATION_AWARE; }
+	else { return FilterType::WEIGHTED_AVERAGE; } // "WEIGHTED_AVERAGE" as fallback if string is different
+}
@@ -0,0 +1,24 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Creates eye gaze filters with parameters of setup.
+
+#ifndef FILTERFACTORY_H_
+#define FILTERFACTORY_H_
+
+#include "src/Input/Filters/Filter.h"
+#include "src/Input/Filters/FilterType.h"
+#include <memory>
+#include <string>
+
+// Create filter of given type
+std::shared_ptr<Filter> CreateFilter(FilterType type);
+
+// Name of filter type as used in settings file
+std::string FilterTypeToString(FilterType type);
+
+// Filter type by name in settings file, weighted average as fallback
+FilterType StringToFilterType(std::string name);
+
+#endif // FILTERFACTORY_H_
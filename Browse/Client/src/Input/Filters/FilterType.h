@@ -0,0 +1,18 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Filter type enumeration.
+
+#ifndef FILTERTYPE_H_
+#define FILTERTYPE_H_
+
+enum class FilterType
+{
+	WEIGHTED_AVERAGE, // average over time window, weighted by filter kernel
+	ONE_EURO, // low pass filter with cutoff frequency adapted to speed of gaze
+	KALMAN, // constant velocity Kalman filter
+	FIXATION_AWARE // average of current fixation, restarts at saccade onset
+};
+
+#endif // FILTERTYPE_H_
\ No newline at end of file
@@ -0,0 +1,70 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "FixationAwareFilter.h"
+#include "src/Setup.h"
+#include "src/Utils/glmWrapper.h"
+
+FixationAwareFilter::FixationAwareFilter(float windowTime) : _windowTime(windowTime) {}
+
+void FixationAwareFilter::ApplyFilter(const SampleQueue& rSamples, double& rGazeX, double& rGazeY, float& rFixationDuration, float) const
+{
+	// Nothing to filter
+	int startIndex = FindWindowStart(rSamples, _windowTime);
+	if (startIndex < 0)
+	{
+		rFixationDuration = 0;
+		return;
+	}
+
+	// Start fixation with oldest sample of window
+	const int size = (int)rSamples->size();
+	const double radius = (double)setup::FILTER_GAZE_FIXATION_PIXEL_RADIUS;
+	int fixationStartIndex = startIndex;
+	double sumX = rSamples->at(startIndex).x;
+	double sumY = rSamples->at(startIndex).y;
+	int count = 1;
+
+	// Go forward in time and restart fixation at saccade onset
+	for (int i = startIndex + 1; i < size; ++i)
+	{
+		const auto& rGaze = rSamples->at(i);
+		glm::dvec2 centroid(sumX / count, sumY / count);
+		glm::dvec2 gaze(rGaze.x, rGaze.y);
+		if (glm::distance(centroid, gaze) > radius)
+		{
+			if (i + 1 < size)
+			{
+				// Skip outlier, unless next sample confirms that gaze left fixation
+				const auto& rNextGaze = rSamples->at(i + 1);
+				glm::dvec2 middle = (gaze + glm::dvec2(rNextGaze.x, rNextGaze.y)) / 2.0;
+				if (glm::distance(centroid, middle) <= radius)
+				{
+					continue;
+				}
+			}
+			else if (glm::distance(centroid, gaze) <= 2.0 * radius)
+			{
+				continue; // latest sample is only taken without confirmation when it is far away
+			}
+
+			// Saccade onset, so start new fixation
+			fixationStartIndex = i;
+			sumX = 0;
+			sumY = 0;
+			count = 0;
+		}
+
+		// Add sample to fixation
+		sumX += rGaze.x;
+		sumY += rGaze.y;
+		++count;
+	}
+
+	// Update members
+	rGazeX = sumX / count;
+	rGazeY = sumY / count;
+	rFixationDuration = CalculateFixationDuration(rSamples, fixationStartIndex);
+}
@@ -0,0 +1,35 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Averages the samples of the current fixation. In contrast to the weighted
+// average filter, samples are compared with the centroid of the fixation and
+// not with each other. A sample outside of the fixation radius starts a new
+// fixation when the following sample confirms that the gaze has left, else it
+// is dropped as outlier. The latest sample starts a new fixation without
+// confirmation when it is twice the radius away, so saccades are followed
+// without delay.
+
+#ifndef FIXATIONAWAREFILTER_H_
+#define FIXATIONAWAREFILTER_H_
+
+#include "src/Input/Filters/Filter.h"
+
+class FixationAwareFilter : public Filter
+{
+public:
+
+	// Constructor
+	FixationAwareFilter(
+		float windowTime); // time of window from which samples are taken for filtering
+
+private:
+
+	// Actual implementation of filtering
+	void ApplyFilter(const SampleQueue& rSamples, double& rGazeX, double& rGazeY, float& rFixationDuration, float samplerate) const override;
+
+	// Members
+	float _windowTime;
+};
+
+#endif // FIXATIONAWAREFILTER_H_
@@ -0,0 +1,123 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "KalmanFilter.h"
+
+// Initial uncertainty of velocity, in pixels per second
+const double KALMAN_INITIAL_VELOCITY_DEVIATION = 100.0;
+
+KalmanFilter::KalmanFilter(float processNoise, float measurementNoise, float saccadeThreshold, float historyTime) :
+	_processNoise(processNoise), _measurementNoise(measurementNoise), _saccadeThreshold(saccadeThreshold), _historyTime(historyTime) {}
+
+void KalmanFilter::ApplyFilter(const SampleQueue& rSamples, double& rGazeX, double& rGazeY, float& rFixationDuration, float samplerate) const
+{
+	// Nothing to filter
+	int startIndex = FindWindowStart(rSamples, _historyTime);
+	if (startIndex < 0)
+	{
+		rFixationDuration = 0;
+		return;
+	}
+
+	// Forget states of queues which do not exist anymore, e.g. of unregistered custom transformations
+	for (auto iter = _states.begin(); iter != _states.end();)
+	{
+		if (iter->first.expired()) { iter = _states.erase(iter); }
+		else { ++iter; }
+	}
+
+	// Continue after last filtered sample, if it is still in queue
+	const int size = (int)rSamples->size();
+	auto stateIter = _states.find(rSamples);
+	int index = -1;
+	if (stateIter != _states.end())
+	{
+		const QueueState& rState = stateIter->second;
+		for (int i = size - 1; i >= 0; --i)
+		{
+			const auto& rGaze = rSamples->at(i);
+			if (rGaze.timestamp == rState.timestamp && rGaze.x == rState.lastX && rGaze.y == rState.lastY)
+			{
+				index = i;
+				break;
+			}
+		}
+	}
+
+	// Otherwise, initialize state with oldest sample of window
+	if (index < 0)
+	{
+		QueueState state;
+		const auto& rGaze = rSamples->at(startIndex);
+		Reset(state.x, rGaze.x);
+		Reset(state.y, rGaze.y);
+		_states[rSamples] = state; // replaces outdated state of queue
+		stateIter = _states.find(rSamples);
+		index = startIndex;
+	}
+
+	// Filter new samples forward in time
+	QueueState& rState = stateIter->second;
+	const double threshold = (double)_saccadeThreshold;
+	for (int i = index + 1; i < size; ++i)
+	{
+		const auto& rGaze = rSamples->at(i);
+		double deltaX = rGaze.x - rState.x.position;
+		double deltaY = rGaze.y - rState.y.position;
+		if (deltaX * deltaX + deltaY * deltaY > threshold * threshold)
+		{
+			// Saccade onset, start over at sample
+			Reset(rState.x, rGaze.x);
+			Reset(rState.y, rGaze.y);
+		}
+		else
+		{
+			double interval = CalculateInterval(rSamples->at(i - 1), rGaze, samplerate);
+			Step(rState.x, rGaze.x, interval);
+			Step(rState.y, rGaze.y, interval);
+		}
+	}
+
+	// Remember last filtered sample
+	const auto& rLast = rSamples->back();
+	rState.timestamp = rLast.timestamp;
+	rState.lastX = rLast.x;
+	rState.lastY = rLast.y;
+
+	// Update members
+	rGazeX = rState.x.position;
+	rGazeY = rState.y.position;
+	rFixationDuration = CalculateFixationDuration(rSamples, FindFixationStart(rSamples, startIndex));
+}
+
+void KalmanFilter::Reset(AxisState& rState, double measurement) const
+{
+	rState.position = measurement;
+	rState.velocity = 0;
+	rState.p00 = (double)_measurementNoise * _measurementNoise;
+	rState.p01 = 0;
+	rState.p11 = KALMAN_INITIAL_VELOCITY_DEVIATION * KALMAN_INITIAL_VELOCITY_DEVIATION;
+}
+
+void KalmanFilter::Step(AxisState& rState, double measurement, double interval) const
+{
+	// Predict with constant velocity, P = F * P * F^T + Q
+	double t = interval;
+	rState.position += rState.velocity * t;
+	double p00 = rState.p00 + 2.0 * t * rState.p01 + t * t * rState.p11 + _processNoise * t * t * t / 3.0;
+	double p01 = rState.p01 + t * rState.p11 + _processNoise * t * t / 2.0;
+	double p11 = rState.p11 + _processNoise * t;
+
+	// Correct with measured position
+	double innovation = measurement - rState.position;
+	double innovationCovariance = p00 + (double)_measurementNoise * _measurementNoise;
+	double gainPosition = p00 / innovationCovariance;
+	double gainVelocity = p01 / innovationCovariance;
+	rState.position += gainPosition * innovation;
+	rState.velocity += gainVelocity * innovation;
+	rState.p00 = (1.0 - gainPosition) * p00;
+	rState.p01 = (1.0 - gainPosition) * p01;
+	rState.p11 = p11 - gainVelocity * p01;
+}
@@ -0,0 +1,69 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Kalman filter with constant velocity model, separately for each axis.
+// Acceleration is modelled as white noise. Process noise is low, so the
+// filter smoothes strongly within fixations. Instead of following saccades
+// by its dynamics, which makes it lag and overshoot, the filter is reset to
+// the sample when it is farther away from the estimate than the saccade
+// threshold. State is kept per sample queue across updates, as custom
+// transformations are filtered with their own queues.
+
+#ifndef KALMANFILTER_H_
+#define KALMANFILTER_H_
+
+#include "src/Input/Filters/Filter.h"
+#include <map>
+
+class KalmanFilter : public Filter
+{
+public:
+
+	// Constructor
+	KalmanFilter(
+		float processNoise, // spectral density of acceleration noise, in pixels squared per second cubed
+		float measurementNoise, // standard deviation of samples around true gaze, in pixels
+		float saccadeThreshold, // distance of sample from estimate which resets filter, in pixels
+		float historyTime); // time of window from which samples are taken when there is no state, yet
+
+private:
+
+	// Actual implementation of filtering
+	void ApplyFilter(const SampleQueue& rSamples, double& rGazeX, double& rGazeY, float& rFixationDuration, float samplerate) const override;
+
+	// State of one axis with covariance
+	struct AxisState
+	{
+		double position = 0;
+		double velocity = 0;
+		double p00 = 0, p01 = 0, p11 = 0; // symmetric covariance
+	};
+
+	// State of filter for one sample queue
+	struct QueueState
+	{
+		AxisState x;
+		AxisState y;
+		std::chrono::milliseconds timestamp; // of last filtered sample
+		double lastX = 0; // of last filtered sample
+		double lastY = 0;
+	};
+
+	// Reset axis to measurement, without velocity
+	void Reset(AxisState& rState, double measurement) const;
+
+	// Predict state over interval and correct it with measurement
+	void Step(AxisState& rState, double measurement, double interval) const;
+
+	// Members
+	float _processNoise;
+	float _measurementNoise;
+	float _saccadeThreshold;
+	float _historyTime;
+
+	// State per sample queue. Filtering does not change filtered gaze of filter, so state is mutable
+	mutable std::map<std::weak_ptr<std::deque<SampleData> >, QueueState, std::owner_less<std::weak_ptr<std::deque<SampleData> > > > _states;
+};
+
+#endif // KALMANFILTER_H_
@@ -0,0 +1,58 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "OneEuroFilter.h"
+#include "src/Utils/glmWrapper.h"
+#include "submodules/glm/glm/gtc/constants.hpp"
+
+OneEuroFilter::OneEuroFilter(float minCutoff, float beta, float derivativeCutoff, float historyTime) :
+	_minCutoff(minCutoff), _beta(beta), _derivativeCutoff(derivativeCutoff), _historyTime(historyTime) {}
+
+void OneEuroFilter::ApplyFilter(const SampleQueue& rSamples, double& rGazeX, double& rGazeY, float& rFixationDuration, float samplerate) const
+{
+	// Nothing to filter
+	int startIndex = FindWindowStart(rSamples, _historyTime);
+	if (startIndex < 0)
+	{
+		rFixationDuration = 0;
+		return;
+	}
+
+	// Start at oldest sample of window without speed
+	const int size = (int)rSamples->size();
+	double gazeX = rSamples->at(startIndex).x;
+	double gazeY = rSamples->at(startIndex).y;
+	double speedX = 0;
+	double speedY = 0;
+
+	// Filter forward in time
+	for (int i = startIndex + 1; i < size; ++i)
+	{
+		const auto& rGaze = rSamples->at(i);
+		double interval = CalculateInterval(rSamples->at(i - 1), rGaze, samplerate);
+
+		// Smooth speed, from difference to filtered gaze
+		double derivativeAlpha = CalculateAlpha(_derivativeCutoff, interval);
+		speedX += derivativeAlpha * (((rGaze.x - gazeX) / interval) - speedX);
+		speedY += derivativeAlpha * (((rGaze.y - gazeY) / interval) - speedY);
+
+		// Smooth gaze with cutoff adapted to speed
+		double cutoff = _minCutoff + _beta * glm::sqrt(speedX * speedX + speedY * speedY);
+		double alpha = CalculateAlpha(cutoff, interval);
+		gazeX += alpha * (rGaze.x - gazeX);
+		gazeY += alpha * (rGaze.y - gazeY);
+	}
+
+	// Update members
+	rGazeX = gazeX;
+	rGazeY = gazeY;
+	rFixationDuration = CalculateFixationDuration(rSamples, FindFixationStart(rSamples, startIndex));
+}
+
+double OneEuroFilter::CalculateAlpha(double cutoff, double interval)
+{
+	double tau = 1.0 / (2.0 * glm::pi<double>() * cutoff);
+	return 1.0 / (1.0 + tau / interval);
+}
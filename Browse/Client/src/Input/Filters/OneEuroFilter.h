@@ -0,0 +1,42 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// 1€ filter (Casiez et al., CHI 2012). Exponential smoothing whose cutoff
+// frequency grows with the speed of the gaze, so fixations are smoothed
+// strongly while saccades pass with little lag. Speed is taken from both axes
+// together. Filter state is not kept between updates but recomputed over the
+// samples of the history window, which is long compared to the time constant.
+
+#ifndef ONEEUROFILTER_H_
+#define ONEEUROFILTER_H_
+
+#include "src/Input/Filters/Filter.h"
+
+class OneEuroFilter : public Filter
+{
+public:
+
+	// Constructor
+	OneEuroFilter(
+		float minCutoff, // cutoff frequency at rest, in Hz
+		float beta, // increase of cutoff frequency per pixel per second of speed
+		float derivativeCutoff, // cutoff frequency for speed estimation, in Hz
+		float historyTime); // time of window from which samples are taken for filtering
+
+private:
+
+	// Actual implementation of filtering
+	void ApplyFilter(const SampleQueue& rSamples, double& rGazeX, double& rGazeY, float& rFixationDuration, float samplerate) const override;
+
+	// Smoothing factor for exponential smoothing
+	static double CalculateAlpha(double cutoff, double interval);
+
+	// Members
+	float _minCutoff;
+	float _beta;
+	float _derivativeCutoff;
+	float _historyTime;
+};
+
+#endif // ONEEUROFILTER_H_
@@ -4,6 +4,7 @@
 //============================================================================
 
 #include "Master.h"
+#include "src/Master/MasterShaders.h"
 #include "src/Utils/Helper.h"
 #include "src/Utils/Logger.h"
 #include "src/Arguments.h"
@@ -29,84 +30,6 @@
 // Namespace for text-csv
 namespace csv = ::text::csv;
 
-// Shaders for screen filling rendering
-const std::string vertexShaderSource =
-"#version 330 core\n"
-"void main() {\n"
-"}\n";
-
-const std::string geometryShaderSource =
-"#version 330 core\n"
-"layout(points) in;\n"
-"layout(triangle_strip, max_vertices = 4) out;\n"
-"out vec2 uv;\n"
-"void main() {\n"
-"    gl_Position = vec4(1.0, 1.0, 0.0, 1.0);\n"
-"    uv = vec2(1.0, 1.0);\n"
-"    EmitVertex();\n"
-"    gl_Position = vec4(-1.0, 1.0, 0.0, 1.0);\n"
-"    uv = vec2(0.0, 1.0);\n"
-"    EmitVertex();\n"
-"    gl_Position = vec4(1.0, -1.0, 0.0, 1.0);\n"
-"    uv = vec2(1.0, 0.0);\n"
-"    EmitVertex();\n"
-"    gl_Position = vec4(-1.0, -1.0, 0.0, 1.0);\n"
-"    uv = vec2(0.0, 0.0);\n"
-"    EmitVertex();\n"
-"    EndPrimitive();\n"
-"}\n";
-
-const std::string blurFragmentShaderSource =
-"#version 330 core\n"
-"const float offset = 1.9;\n" // TODO: maybe use resolution here
-"in vec2 uv;\n"
-"out vec4 fragColor;\n"
-"uniform sampler2D tex;\n"
-"uniform vec2 focusPixelPosition;\n"
-"uniform float focusPixelRadius;\n"
-"uniform float peripheryMultiplier;\n"
-"void main() {\n"
-// Preparation
-"   vec4 color = texture(tex, uv);\n"
-"   float mask = min(distance(focusPixelPosition, gl_FragCoord.xy) / focusPixelRadius, 1.0);\n"
-"   vec2 texSize = textureSize(tex, 0);\n"
-"   vec4 blur = vec4(0,0,0,0);\n"
-// x and y not zero
-"   for(int x = 1; x <= 2; x++) {\n"
-"       for(int y = 1; y <= 2; y++) {\n"
-"           blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(x, y))) / texSize);\n"
-"           blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(-x, y))) / texSize);\n"
-"           blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(x, -y))) / texSize);\n"
-"           blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(-x, -y))) / texSize);\n"
-"       }\n"
-"   }\n"
-// x is zero
-"   for(int y = 1; y <= 2; y++) {\n"
-"       blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(0, y))) / texSize);\n"
-"       blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(0, -y))) / texSize);\n"
-"   }\n"
-// y is zero
-"   for(int x = 1; x <= 2; x++) {\n"
-"       blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(x, 0))) / texSize);\n"
-"       blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(-x, 0))) / texSize);\n"
-"   }\n"
-// Both is zero
-"   blur += color;\n"
-// Do composition
-"   blur /= 25;\n"
-"   color = mix(color, peripheryMultiplier * blur, mask);\n"
-"   fragColor = vec4(color.rgb, 1.0);\n"
-"}\n";
-
-const std::string simpleFragmentShaderSource =
-"#version 330 core\n"
-"in vec2 uv;\n"
-"out vec4 fragColor;\n"
-"uniform sampler2D tex;\n"
-"void main() {\n"
-"   fragColor = texture(tex, uv);\n"
-"}\n";
-
 Master::Master(Mediator* pCefMediator, std::string userDirectory, bool useVoice)
 {
 	// Save members
@@ -447,7 +370,7 @@ Master::Master(Mediator* pCefMediator, std::string userDirectory, bool useVoice)
 	_cursorFrameIndex = eyegui::addFloatingFrameWithBrick(_pCursorLayout, "bricks/Cursor.beyegui", 0, 0, 0, 0, true, false); // will be moved and sized in loop
 
 																															 // ### EYE INPUT ###
-	_upEyeInput = std::unique_ptr<EyeInput>(new EyeInput(this, _upSettings->GetEyetrackerGeometry()));
+	_upEyeInput = std::unique_ptr<EyeInput>(new EyeInput(this, _upSettings->GetEyetrackerGeometry(), _upSettings->GetGazeFilter()));
 
 	// ### VOICE INPUT ###
 
@@ -465,10 +388,11 @@ Master::Master(Mediator* pCefMediator, std::string userDirectory, bool useVoice)
 	_upFramebuffer->Bind();
 	_upFramebuffer->AddAttachment(Framebuffer::ColorFormat::RGB);
 	_upFramebuffer->Unbind();
+	_upFrameUniforms = std::unique_ptr<FrameUniforms>(new FrameUniforms());
 	_upScreenFillingQuad = std::unique_ptr<RenderItem>(
 		new RenderItem(
-			vertexShaderSource,
-			geometryShaderSource,
+			screenFillingVertexShaderSource,
+			screenFillingGeometryShaderSource,
 			setup::BLUR_PERIPHERY ? blurFragmentShaderSource : simpleFragmentShaderSource));
 
 	// ### FIREBASE MAILER ###
@@ -569,12 +493,18 @@ Master::Master(Mediator* pCefMediator, std::string userDirectory, bool useVoice)
 
 #endif
 
+	// Wake up main loop when CEF has something to do
+	_pCefMediator->SetWakeUpFunction([]() { glfwPostEmptyEvent(); });
+
 	// Time
 	_lastTime = glfwGetTime();
 }
 
 Master::~Master()
 {
+	// CEF must not wake up a terminated GLFW
+	_pCefMediator->SetWakeUpFunction(nullptr);
+
 	// Manual destruction of Web. Otherwise there are errors in CEF at shutdown (TODO: understand why)
 	_upWeb.reset();
 
@@ -714,6 +644,7 @@ eyegui::Layout* Master::AddLayout(std::string filepath, int layer, bool visible)
 {
 	// Add layout
 	eyegui::Layout* pLayout = eyegui::addLayout(_pGUI, filepath, layer, visible);
+	RequestRedraw();
 	return pLayout;
 }
 
@@ -721,6 +652,7 @@ void Master::RemoveLayout(eyegui::Layout* pLayout)
 {
 	// Remove layout
 	eyegui::removeLayout(_pGUI, pLayout);
+	RequestRedraw();
 }
 
 std::u16string Master::FetchLocalization(std::string key) const
@@ -728,6 +660,15 @@ std::u16string Master::FetchLocalization(std::string key) const
 	return eyegui::fetchLocalization(_pGUI, key);
 }
 
+void Master::SetVisibilityOfLayout(eyegui::Layout* pLayout, bool visible, bool reset, bool fade)
+{
+	if (reset || eyegui::isLayoutVisible(pLayout) != visible)
+	{
+		RequestRedraw();
+	}
+	eyegui::setVisibilityOfLayout(pLayout, visible, reset, fade);
+}
+
 void Master::SetStyleTreePropertyValue(std::string styleClass, eyegui::property::Duration type, std::string value)
 {
 	eyegui::setStyleTreePropertyValue(_pGUI, styleClass, type, value);
@@ -807,6 +748,7 @@ void Master::Loop()
 
 		// Execute thread jobs
 		_threadJobsMutex.lock(); // lock jobs
+		if (!_threadJobs.empty()) { RequestRedraw(); }
 		for (auto& rJob : _threadJobs)
 		{
 			rJob->Execute();
@@ -817,7 +759,8 @@ void Master::Loop()
 								   // Update lab streaming layer mailer to get incoming messages
 		LabStreamMailer::instance().Update();
 
-		// Notification handling
+		// Notification handling (displayed notifications are animated)
+		if (_notificationTime > 0 || !_notificationStack.empty()) { RequestRedraw(); }
 		if (_notificationTime <= 0 // time for the current notification is over
 			|| (_notificationOverridable && !_notificationStack.empty())) // go to next notification if current is overridable and stack not empty
 		{
@@ -857,6 +800,7 @@ void Master::Loop()
 
 				// Make floating frame visible
 				eyegui::setVisibilityOFloatingFrame(_pSuperNotificationLayout, _notificationFrameIndex, true, false, true);
+				_notificationVisible = true;
 
 				// Reset time
 				_notificationTime = NOTIFICATION_DISPLAY_DURATION;
@@ -867,10 +811,12 @@ void Master::Loop()
 					eyegui::playSound(_pGUI, notification.sound);
 				}
 			}
-			else
+			else if (_notificationVisible)
 			{
 				// Hide notification display
 				eyegui::setVisibilityOFloatingFrame(_pSuperNotificationLayout, _notificationFrameIndex, false, false, true);
+				_notificationVisible = false;
+				RequestRedraw(); // fading out
 			}
 		}
 		else
@@ -996,7 +942,7 @@ void Master::Loop()
 		}
 
 		// Update cursor with original mouse input
-		eyegui::setVisibilityOfLayout(_pCursorLayout, spInput->gazeEmulated, false, true);
+		SetVisibilityOfLayout(_pCursorLayout, spInput->gazeEmulated, false, true);
 		float halfRelativeMouseCursorSize = MOUSE_CURSOR_RELATIVE_SIZE / 2.f;
 		eyegui::setPositionOfFloatingFrame(
 			_pCursorLayout,
@@ -1010,7 +956,9 @@ void Master::Loop()
 			MOUSE_CURSOR_RELATIVE_SIZE);
 
 		// Pause visualization
+		float pausedDimming = _pausedDimming.getValue();
 		_pausedDimming.update(tpf, !_paused);
+		if (_pausedDimming.getValue() != pausedDimming) { RequestRedraw(); } // dimming is fading
 		eyegui::setStyleTreePropertyValue(
 			_pSuperGUI,
 			"pause_background",
@@ -1036,16 +984,39 @@ void Master::Loop()
 		eyeGUIInput.gazeUsed = spInput->gazeUponGUI;
 
 		// Update super GUI, including pause button
+		bool gazeConsumed = eyeGUIInput.gazeUsed; // gaze that is consumed before is not used by any element
 		eyeGUIInput = eyegui::updateGUI(_pSuperGUI, tpf, eyeGUIInput); // update super GUI with pause button
+		bool gazeUsedByElement = !gazeConsumed && eyeGUIInput.gazeUsed;
 		if (_paused)
 		{
 			// Do not pipe input to standard GUI if paused
 			eyeGUIInput.gazeUsed = true; // TODO: null pointer would be nicer
 		}
+		gazeConsumed = eyeGUIInput.gazeUsed;
 		eyeGUIInput = eyegui::updateGUI(_pGUI, tpf, eyeGUIInput); // update GUI
+		gazeUsedByElement = gazeUsedByElement || (!gazeConsumed && eyeGUIInput.gazeUsed);
+
+																  // Do message loop work of CEF that has been scheduled by CEF
+		_pCefMediator->DoMessageLoopWork();
 
-																  // Do message loop of CEF
-		_pCefMediator->DoMessageLoopWork(); // TODO: Breaks randomly after sometime in debug mode?
+		// Log share of frame time consumed by CEF
+		if (setup::LOG_FRAME_PACING)
+		{
+			_framePacingLogTime += tpf;
+			if (_framePacingLogTime >= setup::FRAME_PACING_LOG_INTERVAL)
+			{
+				auto framePacing = _pCefMediator->GetFramePacing();
+				LogInfo("Master: CEF frame pacing: ",
+					framePacing.frameCount, " frames, ",
+					framePacing.workCount, " pumps, ",
+					framePacing.busyFrameCount, " frames over budget, ",
+					"average work ", (framePacing.frameCount > 0 ? 1000.0 * framePacing.workTime / framePacing.frameCount : 0.0), "ms, ",
+					"maximum work ", 1000.0 * framePacing.maxWorkTime, "ms, ",
+					"share of frame ", 100.0 * framePacing.GetWorkShare(), "%");
+				_pCefMediator->ResetFramePacing();
+				_framePacingLogTime = 0.f;
+			}
+		}
 
 											// Update our input structure
 		spInput->gazeUponGUI = eyeGUIInput.gazeUsed;
@@ -1054,30 +1025,70 @@ void Master::Loop()
 		// eyeGUI returns drift corrected gaze (if DriftMap is activated).
 		// However, this is not used here. Instead, we ask for drift correction where required.
 
-		// Bind framebuffer
-		_upFramebuffer->Bind();
-
-		// Clearing of buffers
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-		// Disable depth test for drawing
-		glDisable(GL_DEPTH_TEST);
-
-
-		// Update current state and draw it (one should use here pointer instead of switch case)
+		// Update current state (one should use here pointer instead of switch case)
 		StateType nextState = StateType::WEB;
+		StateType updatedState = _currentState;
 		switch (_currentState)
 		{
 		case StateType::WEB:
 			nextState = _upWeb->Update(tpf, spInput, spVoiceInput, _keyboardActive);
-			_upWeb->Draw();
 			break;
 		case StateType::SETTINGS:
 			nextState = _upSettings->Update(tpf, spInput, spVoiceInput, _keyboardActive);
-			_upSettings->Draw();
 			break;
 		}
 
+		// Decide whether frame has to be drawn. Changes of input, paints of CEF and animations mark it dirty.
+		// Fading of layouts, notifications and dimming request redraws where they are triggered. eyeGUI does not tell
+		// whether its elements are still animating, so gaze used by an element counts as damage and animations
+		// following the interaction are drawn within the settle time of RequestRedraw
+		bool gazeMoved = glm::distance(glm::vec2(spInput->gazeX, spInput->gazeY), _lastDrawnGaze) >= setup::REDRAW_GAZE_DISTANCE;
+		bool mouseMoved = currentMouseX != _lastDrawnMouseX || currentMouseY != _lastDrawnMouseY;
+		if (gazeMoved || mouseMoved
+			|| _pCefMediator->TakePaintDamage()
+			|| gazeUsedByElement // interaction with eyeGUI element
+			|| spVoiceInput->command != VoiceCommand::NO_ACTION
+			|| eyegui::isLayoutVisible(_pSuperCalibrationLayout) // trackbox visualization
+			|| _currentState != nextState
+			|| _demoModeReset)
+		{
+			RequestRedraw();
+		}
+		bool draw = !setup::DAMAGE_TRACKED_RENDERING || _redrawTime > 0.f;
+		_redrawTime -= tpf;
+
+		// Draw state into framebuffer
+		if (draw)
+		{
+			// Values of this frame, read by periphery blur
+			FrameUniforms::Values frameValues;
+			frameValues.resolution = glm::vec2(_width, _height);
+			frameValues.focusPixelRadius = (float)glm::min(_width, _height) * BLUR_FOCUS_RELATIVE_RADIUS;
+			frameValues.gazePixelPosition = glm::vec2(spInput->gazeX, _height - spInput->gazeY); // OpenGL coordinate system
+			frameValues.peripheryMultiplier = BLUR_PERIPHERY_MULTIPLIER;
+			_upFrameUniforms->Update(frameValues);
+
+			// Bind framebuffer
+			_upFramebuffer->Bind();
+
+			// Clearing of buffers
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+			// Disable depth test for drawing
+			glDisable(GL_DEPTH_TEST);
+
+			// Draw state that has been updated
+			switch (updatedState)
+			{
+			case StateType::WEB:
+				_upWeb->Draw();
+				break;
+			case StateType::SETTINGS:
+				_upSettings->Draw();
+				break;
+			}
+		}
+
 		// Check next state
 		if (_currentState != nextState)
 		{
@@ -1129,6 +1140,29 @@ void Master::Loop()
 			_demoModeReset = false;
 		}
 
+		// Reset reminder BEFORE POLLING
+		_leftMouseButtonPressed = false;
+		_enterKeyPressed = false;
+
+		// Nothing has changed, so keep last frame on screen and wait for events instead
+		if (!draw)
+		{
+			// Wake up for next eye tracker sample or when CEF wants to work. CEF and input events wake up earlier
+			double waitTime = spInput->gazeEmulated ? setup::IDLE_WAIT_MAX_TIME : setup::IDLE_WAIT_FRAME_TIME;
+			waitTime = std::min(waitTime, _pCefMediator->GetTimeUntilWork());
+			_skippedFrameCount++;
+			LogIdleRendering(tpf);
+			glfwWaitEventsTimeout(waitTime);
+			continue;
+		}
+		_drawnFrameCount++;
+		_shaderUniformsFrameCount++;
+		LogIdleRendering(tpf);
+		LogShaderUniforms(tpf);
+		_lastDrawnGaze = glm::vec2(spInput->gazeX, spInput->gazeY);
+		_lastDrawnMouseX = currentMouseX;
+		_lastDrawnMouseY = currentMouseY;
+
 		// Enable depth test again
 		glEnable(GL_DEPTH_TEST);
 
@@ -1146,29 +1180,54 @@ void Master::Loop()
 		glActiveTexture(GL_TEXTURE0);
 		glBindTexture(GL_TEXTURE_2D, _upFramebuffer->GetAttachment(0));
 
-		// Render screen filling quad
+		// Render screen filling quad, periphery values are part of frame uniforms
 		_upScreenFillingQuad->Bind();
-
-		// Fill uniforms when necessary
-		if (setup::BLUR_PERIPHERY)
-		{
-			_upScreenFillingQuad->GetShader()->UpdateValue("focusPixelPosition", glm::vec2(spInput->gazeX, _height - spInput->gazeY)); // OpenGL coordinate system
-			_upScreenFillingQuad->GetShader()->UpdateValue("focusPixelRadius", (float)glm::min(_width, _height) * BLUR_FOCUS_RELATIVE_RADIUS);
-			_upScreenFillingQuad->GetShader()->UpdateValue("peripheryMultiplier", BLUR_PERIPHERY_MULTIPLIER);
-		}
-
 		_upScreenFillingQuad->Draw(GL_POINTS);
 
-		// Reset reminder BEFORE POLLING
-		_leftMouseButtonPressed = false;
-		_enterKeyPressed = false;
-
 		// Swap front and back buffers and poll events
 		glfwSwapBuffers(_pWindow);
 		glfwPollEvents();
 	}
 }
 
+void Master::LogIdleRendering(float tpf)
+{
+	if (!setup::LOG_IDLE_RENDERING) { return; }
+	_idleRenderingLogTime += tpf;
+	if (_idleRenderingLogTime >= setup::IDLE_RENDERING_LOG_INTERVAL)
+	{
+		unsigned int frameCount = _drawnFrameCount + _skippedFrameCount;
+		LogInfo("Master: Idle rendering: ",
+			_drawnFrameCount, " frames drawn, ",
+			_skippedFrameCount, " frames skipped (",
+			(frameCount > 0 ? (100 * _skippedFrameCount) / frameCount : 0), "%)");
+		_drawnFrameCount = 0;
+		_skippedFrameCount = 0;
+		_idleRenderingLogTime = 0.f;
+	}
+}
+
+void Master::LogShaderUniforms(float tpf)
+{
+	if (!setup::LOG_SHADER_UNIFORMS) { return; }
+	_shaderUniformsLogTime += tpf;
+	if (_shaderUniformsLogTime >= setup::SHADER_UNIFORMS_LOG_INTERVAL)
+	{
+		// Before caching, each update by name cost a location lookup and each update an upload.
+		// Frame uniforms add four calls per drawn frame for their buffer (see UniformBenchmark)
+		Shader::Statistics statistics = Shader::GetStatistics();
+		float frames = (float)glm::max(_shaderUniformsFrameCount, 1u);
+		LogInfo("Master: Shader uniforms per drawn frame: ",
+			statistics.uploads / frames, " uploads plus frame uniform buffer, ",
+			(statistics.lookups + statistics.uploads + statistics.skipped) / frames, " without caching (",
+			statistics.skipped / frames, " unchanged values skipped, ",
+			statistics.lookups / frames, " updates by name)");
+		Shader::ResetStatistics();
+		_shaderUniformsFrameCount = 0;
+		_shaderUniformsLogTime = 0.f;
+	}
+}
+
 void Master::UpdateAsyncJobs(bool wait)
 {
 	// Check asynchronous jobs
@@ -1202,7 +1261,7 @@ void Master::UpdateAsyncJobs(bool wait)
 void Master::ShowSuperCalibrationLayout()
 {
 	// Display layout to recalibrate
-	eyegui::setVisibilityOfLayout(_pSuperCalibrationLayout, true, true, true);
+	SetVisibilityOfLayout(_pSuperCalibrationLayout, true, true, true);
 
 	// Notify user via sound
 	eyegui::playSound(_pGUI, "sounds/GameAudio/FlourishSpacey-1.ogg");
@@ -1395,6 +1454,7 @@ void Master::OpenFileNameWindow()
 
 void Master::GLFWKeyCallback(int key, int scancode, int action, int mods)
 {
+	RequestRedraw();
 	if (action == GLFW_PRESS)
 	{
 		switch (key)
@@ -1452,6 +1512,7 @@ void Master::GLFWKeyCallback(int key, int scancode, int action, int mods)
 
 void Master::GLFWMouseButtonCallback(int button, int action, int mods)
 {
+	RequestRedraw();
 	if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS)
 	{
 		_leftMouseButtonPressed = true;
@@ -1465,6 +1526,8 @@ void Master::GLFWCursorPosCallback(double xpos, double ypos)
 
 void Master::GLFWResizeCallback(int width, int height)
 {
+	RequestRedraw();
+
 	// Save it
 	_width = width;
 	_height = height;
@@ -1510,7 +1573,7 @@ void Master::MasterButtonListener::down(eyegui::Layout* pLayout, std::string id)
 		if (id == "continue")
 		{
 			// Hide layout
-			eyegui::setVisibilityOfLayout(_pMaster->_pSuperCalibrationLayout, false, false, true);
+			_pMaster->SetVisibilityOfLayout(_pMaster->_pSuperCalibrationLayout, false, false, true);
 		}
 		else if (id == "recalibration")
 		{
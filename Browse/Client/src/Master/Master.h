@@ -23,6 +23,7 @@
 #include "src/Utils/LerpValue.h"
 #include "src/Utils/Framebuffer.h"
 #include "src/Utils/RenderItem.h"
+#include "src/Utils/FrameUniforms.h"
 #include "src/Input/Filters/CustomTransformationInteface.h"
 #include "externals/OGL/gl_core_3_3.h"
 #include "submodules/eyeGUI/include/eyeGUI.h"
@@ -120,6 +121,12 @@ public:
 	void SetStyleTreePropertyValue(std::string styleClass, eyegui::property::Duration type, std::string value);
 	void SetStyleTreePropertyValue(std::string styleClass, eyegui::property::Color type, std::string value);
 
+	// Set visibility of layout. Requests redraw when visibility changes or layout is reset, so fading is drawn
+	void SetVisibilityOfLayout(eyegui::Layout* pLayout, bool visible, bool reset, bool fade);
+
+	// Request redraw of upcoming frames, e.g. for animations that are not driven by input
+	void RequestRedraw() { _redrawTime = setup::REDRAW_SETTLE_TIME; }
+
 	// Play some sound
 	void PlaySound(std::string filepath)
 	{
@@ -163,6 +170,9 @@ public:
 	// Decide whether to block ads
 	void BlockAds(bool blockAds) { _pCefMediator->BlockAds(blockAds); }
 
+	// Set filter of gaze data. Eye input is created after settings, which provide initial filter
+	void SetGazeFilter(FilterType filterType) { if (_upEyeInput) { _upEyeInput->SetFilter(filterType); } }
+
 	// ### STORING OF SETTINGS ###
 
 	// Store homepage URL in settings
@@ -280,6 +290,12 @@ private:
 	// Update async jobs
 	void UpdateAsyncJobs(bool wait); // wait indicates that it should block the thread until all async jobs are finished
 
+	// Log share of frames skipped by damage tracking
+	void LogIdleRendering(float tpf);
+
+	// Log driver calls for shader uniforms per drawn frame
+	void LogShaderUniforms(float tpf);
+
 									 // Show super calibration layout
 	void ShowSuperCalibrationLayout();
 
@@ -368,6 +384,9 @@ private:
 	// Render item to render screenfilling quad
 	std::unique_ptr<RenderItem> _upScreenFillingQuad;
 
+	// Uniform buffer with values shared by shaders, filled once per frame
+	std::unique_ptr<FrameUniforms> _upFrameUniforms;
+
 	// Directory for bookmarks etc
 	std::string _userDirectory;
 
@@ -383,6 +402,9 @@ private:
 	// Whether current notification is overridable or not
 	bool _notificationOverridable = false;
 
+	// Whether notification is displayed
+	bool _notificationVisible = false;
+
 	// LabStreamMailer callback to print incoming messages to log
 	std::shared_ptr<LabStreamCallback> _spLabStreamCallback;
 
@@ -423,6 +445,24 @@ private:
 	// Bool to indicate demo mode reset which is handled in the update loop
 	bool _demoModeReset = false;
 
+	// Time since frame pacing of CEF has been logged
+	float _framePacingLogTime = 0.f;
+
+	// Damage tracking. Frames are drawn as long as time is left
+	float _redrawTime = setup::REDRAW_SETTLE_TIME;
+	glm::vec2 _lastDrawnGaze = glm::vec2(-1, -1);
+	double _lastDrawnMouseX = -1;
+	double _lastDrawnMouseY = -1;
+
+	// Statistics of damage tracking
+	unsigned int _drawnFrameCount = 0;
+	unsigned int _skippedFrameCount = 0;
+	float _idleRenderingLogTime = 0.f;
+
+	// Statistics of shader uniforms
+	unsigned int _shaderUniformsFrameCount = 0;
+	float _shaderUniformsLogTime = 0.f;
+
 	// File Name Dialog runs in this Thread
 	std::unique_ptr<std::thread> _tEdit = nullptr;
 	// Invokes File Name Dialog
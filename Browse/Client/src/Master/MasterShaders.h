@@ -0,0 +1,88 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Shader sources of the screen filling quad of Master. Kept apart so the
+// uniform benchmark renders with the very same shaders.
+
+#ifndef MASTERSHADERS_H_
+#define MASTERSHADERS_H_
+
+#include "src/Utils/FrameUniforms.h"
+#include <string>
+
+const std::string screenFillingVertexShaderSource =
+"#version 330 core\n"
+"void main() {\n"
+"}\n";
+
+const std::string screenFillingGeometryShaderSource =
+"#version 330 core\n"
+"layout(points) in;\n"
+"layout(triangle_strip, max_vertices = 4) out;\n"
+"out vec2 uv;\n"
+"void main() {\n"
+"    gl_Position = vec4(1.0, 1.0, 0.0, 1.0);\n"
+"    uv = vec2(1.0, 1.0);\n"
+"    EmitVertex();\n"
+"    gl_Position = vec4(-1.0, 1.0, 0.0, 1.0);\n"
+"    uv = vec2(0.0, 1.0);\n"
+"    EmitVertex();\n"
+"    gl_Position = vec4(1.0, -1.0, 0.0, 1.0);\n"
+"    uv = vec2(1.0, 0.0);\n"
+"    EmitVertex();\n"
+"    gl_Position = vec4(-1.0, -1.0, 0.0, 1.0);\n"
+"    uv = vec2(0.0, 0.0);\n"
+"    EmitVertex();\n"
+"    EndPrimitive();\n"
+"}\n";
+
+const std::string blurFragmentShaderSource =
+"#version 330 core\n"
+"const float offset = 1.9;\n"
+"in vec2 uv;\n"
+"out vec4 fragColor;\n"
+"uniform sampler2D tex;\n"
++ FRAME_UNIFORM_BLOCK_SOURCE + // resolution, gaze position, focus radius and periphery multiplier
+"void main() {\n"
+// Preparation
+"   vec4 color = texture(tex, uv);\n"
+"   float mask = min(distance(gazePixelPosition, gl_FragCoord.xy) / focusPixelRadius, 1.0);\n"
+"   vec4 blur = vec4(0,0,0,0);\n"
+// x and y not zero
+"   for(int x = 1; x <= 2; x++) {\n"
+"       for(int y = 1; y <= 2; y++) {\n"
+"           blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(x, y))) / resolution);\n"
+"           blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(-x, y))) / resolution);\n"
+"           blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(x, -y))) / resolution);\n"
+"           blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(-x, -y))) / resolution);\n"
+"       }\n"
+"   }\n"
+// x is zero
+"   for(int y = 1; y <= 2; y++) {\n"
+"       blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(0, y))) / resolution);\n"
+"       blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(0, -y))) / resolution);\n"
+"   }\n"
+// y is zero
+"   for(int x = 1; x <= 2; x++) {\n"
+"       blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(x, 0))) / resolution);\n"
+"       blur += texture(tex, (gl_FragCoord.xy + (offset * vec2(-x, 0))) / resolution);\n"
+"   }\n"
+// Both is zero
+"   blur += color;\n"
+// Do composition
+"   blur /= 25;\n"
+"   color = mix(color, peripheryMultiplier * blur, mask);\n"
+"   fragColor = vec4(color.rgb, 1.0);\n"
+"}\n";
+
+const std::string simpleFragmentShaderSource =
+"#version 330 core\n"
+"in vec2 uv;\n"
+"out vec4 fragColor;\n"
+"uniform sampler2D tex;\n"
+"void main() {\n"
+"   fragColor = texture(tex, uv);\n"
+"}\n";
+
+#endif // MASTERSHADERS_H_
@@ -9,6 +9,7 @@
 #define SETUP_H_
 
 #include "src/Input/Filters/FilterKernel.h"
+#include "src/Input/Filters/FilterType.h"
 #include <string>
 #include <chrono>
 
@@ -58,6 +59,13 @@ namespace setup
 	static const FilterKernel FILTER_KERNEL = FilterKernel::GAUSSIAN;
 	static const float	FILTER_WINDOW_TIME = 1.f; // in seconds, limits the fixation duration in the input structure !!!
 	static const bool	FILTER_USE_OUTLIER_REMOVAL = true;
+	static const FilterType FILTER_TYPE = FilterType::WEIGHTED_AVERAGE; // used until user selects filter in settings
+	static const float	FILTER_ONE_EURO_MIN_CUTOFF = 1.f; // in Hz
+	static const float	FILTER_ONE_EURO_BETA = 0.01f; // cutoff increase per pixel per second of gaze speed
+	static const float	FILTER_ONE_EURO_DERIVATIVE_CUTOFF = 1.f; // in Hz
+	static const float	FILTER_KALMAN_PROCESS_NOISE = 1000.f; // acceleration noise, in pixels squared per second cubed
+	static const float	FILTER_KALMAN_MEASUREMENT_NOISE = 15.f; // noise of samples, in pixels
+	static const float	FILTER_KALMAN_SACCADE_THRESHOLD = 60.f; // distance of sample from estimate which resets filter, in pixels
 
 	// Distortion
 	static const bool	EYEINPUT_DISTORT_GAZE = false && !(DEPLOYMENT || DEMO_MODE);
@@ -69,6 +77,7 @@ namespace setup
 	static const std::string	LAB_STREAM_OUTPUT_NAME = "GazeTheWebOutput";
 	static const std::string	LAB_STREAM_OUTPUT_SOURCE_ID = CLIENT_VERSION; // use client version as source id
 	static const std::string	LAB_STREAM_INPUT_NAME = "GazeTheWebInput"; // may be set to same value as LAB_STREAM_OUTPUT_NAME to receive own events for debugging purposes
+	static const std::chrono::milliseconds LAB_STREAM_OUTPUT_MAX_LATENCY = std::chrono::milliseconds(5); // maximum time a marker waits before it is pushed as part of a chunk
 	static const bool			LOG_INTERACTIONS = false; // on eyeGUI level, deprecated
 	static const bool			TAB_TRIGGER_SHOW_BADGE = false;
 	static const std::string	DASHBOARD_URL = "gtw.mamem.eu/home"; // without slash at the end
@@ -94,6 +103,79 @@ namespace setup
 	static const bool	PERIODICAL_VOICE_RESTART = false; // allow the voice recognition to restart before 60 seconds are expired (after 50 seconds)
 	static const bool	KEYSTROKE_BMP_CREATION = true; // Creation of bmp files using the "s" key
 	static const int	BMP_GAZE_RADIUS = 200; // Radius around the gaze in which you want to take a partial screenshot
+
+	// CEF message loop
+	static const bool	CEF_EXTERNAL_MESSAGE_PUMP = true; // CEF schedules its work via OnScheduleMessagePumpWork instead of being pumped once per frame
+#ifdef _WIN32
+	static const bool	CEF_MULTI_THREADED_MESSAGE_LOOP = false; // CEF runs on a thread of its own, its callbacks and paints are handed over to the main loop
+#else
+	static const bool	CEF_MULTI_THREADED_MESSAGE_LOOP = false; // only supported by CEF on Windows
+#endif
+	static const int	CEF_MESSAGE_PUMP_MAX_DELAY = 1000 / 30; // maximum delay between two pumps of CEF, in milliseconds
+	static const double	CEF_MESSAGE_PUMP_FRAME_BUDGET = 0.008; // time CEF may consume per frame before remaining work is postponed, in seconds
+	static const bool	LOG_FRAME_PACING = false | DEBUG_MODE; // log share of frame time consumed by CEF
+	static const float	FRAME_PACING_LOG_INTERVAL = 10.f; // in seconds
+
+	// Tab discarding
+	static const bool	TAB_DISCARDING = true; // discard least recently used background tabs to a lightweight record and restore them on activation
+	static const unsigned int	TAB_TEXTURE_MEMORY_BUDGET = 512; // web view texture memory of all live tabs, in megabytes
+	static const unsigned int	TAB_MAX_LIVE_COUNT = 8; // maximal count of tabs with live browser, including current tab
+	static const float	TAB_DISCARD_IDLE_TIME = 60.f * 15.f; // background tabs inactive for that time are discarded regardless of budget, in seconds. Zero disables it
+	static const float	TAB_DISCARD_CHECK_INTERVAL = 1.f; // in seconds
+	static const bool	LOG_TAB_DISCARDING = false | DEBUG_MODE; // log discards and restores of tabs
+
+	// Windowless frame rate of web views
+	static const bool	WEB_VIEW_FRAME_RATE_CONTROL = true; // adapt frame rate of CEF rendering to activity in web view
+	static const int	WEB_VIEW_MAX_FRAME_RATE = 60; // while video is visible, page animates or auto scrolling is active (CEF does not render faster)
+	static const int	WEB_VIEW_INPUT_FRAME_RATE = 30; // while text is input or page changes partially
+	static const int	WEB_VIEW_READING_FRAME_RATE = 15; // while gaze is upon web view
+	static const int	WEB_VIEW_IDLE_FRAME_RATE = 5; // otherwise
+	static const float	WEB_VIEW_DIRTY_SHARE_HIGH = 0.25f; // average share of web view repainted per frame to use maximum frame rate
+	static const float	WEB_VIEW_DIRTY_SHARE_LOW = 0.02f; // average share of web view repainted per frame to use input frame rate
+	static const float	WEB_VIEW_DIRTY_MEASURE_TIME = 0.5f; // duration over which repainted share is averaged, in seconds
+	static const float	WEB_VIEW_FRAME_RATE_DECREASE_DELAY = 2.f; // time a lower frame rate must be sufficient before it is applied, in seconds
+	static const bool	LOG_WEB_VIEW_FRAME_RATE = false | DEBUG_MODE; // log time spent at each frame rate
+	static const float	WEB_VIEW_FRAME_RATE_LOG_INTERVAL = 30.f; // in seconds
+
+	// Idle rendering
+	static const bool	DAMAGE_TRACKED_RENDERING = true; // skip redraw of frames without any change and wait for events instead
+	static const float	REDRAW_SETTLE_TIME = 1.5f; // frames keep being drawn after last change so that eyeGUI animations can finish, in seconds. Covers animations of eyeGUI elements after interaction, since eyeGUI does not report them
+	static const float	REDRAW_GAZE_DISTANCE = 1.f; // movement of gaze which marks frame as dirty, in pixels
+	static const double	IDLE_WAIT_FRAME_TIME = 1.0 / 60.0; // maximum wait for events while eye tracker delivers samples, keeps input sampling within one frame, in seconds
+	static const double	IDLE_WAIT_MAX_TIME = 0.25; // maximum wait for events while gaze is emulated by mouse, in seconds
+	static const bool	LOG_IDLE_RENDERING = false | DEBUG_MODE; // log share of skipped frames
+	static const float	IDLE_RENDERING_LOG_INTERVAL = 60.f; // in seconds
+
+	// Link prediction
+	static const bool	LINK_PREDICTION = true; // give resource hints for links the user dwells upon
+	static const float	LINK_PREDICTION_RADIUS = 48.f; // gaze within that distance to a link adds to its score, in CEF pixels
+	static const unsigned int	LINK_PREDICTION_CANDIDATES = 2; // count of highest scored links which may receive hints
+	static const float	LINK_PREDICTION_MAX_SCORE = 2.f; // upper bound of dwell score, in seconds
+	static const float	LINK_PREDICTION_DECAY = 1.f; // decay of score while gaze is not near link, in seconds per second
+	static const float	LINK_PRECONNECT_DWELL = 0.2f; // score at which host of link is resolved and connected, in seconds
+	static const bool	LINK_PREFETCH = false; // speculatively fetch target of link, costs bandwidth of user and host
+	static const float	LINK_PREFETCH_DWELL = 0.6f; // score at which target of link is prefetched, in seconds
+	static const unsigned int	LINK_HINTS_PER_HOST = 4; // maximum count of hints per host within rate window
+	static const float	LINK_HINT_RATE_WINDOW = 10.f; // in seconds
+	static const bool	LOG_LINK_PREDICTION = false | DEBUG_MODE; // log hints and time from navigation start to first paint
+
+	// Favicon cache
+	static const bool	FAVICON_CACHE = true; // keep decoded favicons and accent colors in memory and on disk
+	static const unsigned int	FAVICON_CACHE_MAX_ENTRIES = 256; // icons kept, least recently used are evicted
+	static const int	FAVICON_CACHE_MAX_SIZE = 64; // larger icons are downscaled before caching, in pixels
+	static const int	FAVICON_CACHE_MIN_SIZE = 16; // smallest of the halved sizes kept per icon, in pixels
+	static const bool	LOG_FAVICON_CACHE = false | DEBUG_MODE; // log hits and misses
+
+	// Text insertion
+	static const bool	BULK_TEXT_INSERTION = true; // insert text into fields with one editing command instead of a key event per character
+	static const bool	LOG_TEXT_INSERTION = false | DEBUG_MODE; // log duration of text insertions
+
+	// Web view drawing
+	static const bool	WEB_VIEW_COMPOSITION_CACHE = true; // keep web page with highlighted rects in framebuffer while neither changes
+	static const bool	LOG_WEB_VIEW_DRAWING = false | DEBUG_MODE; // log draw calls, cache hits and GPU time of web views
+	static const unsigned int	WEB_VIEW_DRAWING_LOG_FRAMES = 600; // frames of a web view between two logs
+	static const bool	LOG_SHADER_UNIFORMS = false | DEBUG_MODE; // log driver calls for shader uniforms per frame
+	static const float	SHADER_UNIFORMS_LOG_INTERVAL = 30.f; // in seconds
 }
 
 #endif // SETUP_H_
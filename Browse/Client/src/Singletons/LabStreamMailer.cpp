@@ -16,7 +16,8 @@ LabStreamMailer::LabStreamMailer() :
 				1, // channel count
 				lsl::IRREGULAR_RATE, // rate
 				lsl::cf_string, // channel format
-				setup::LAB_STREAM_OUTPUT_SOURCE_ID)))) // source id
+				setup::LAB_STREAM_OUTPUT_SOURCE_ID), // source id
+			setup::LAB_STREAM_OUTPUT_MAX_LATENCY))) // maximum latency
 	
 {
 	// Nothing to do	
@@ -7,6 +7,7 @@
 #include "src/Master/Master.h"
 #include "src/Global.h"
 #include "src/Utils/Logger.h"
+#include "src/Input/Filters/FilterFactory.h"
 #include "submodules/eyeGUI/externals/TinyXML2/tinyxml2.h"
 
 // Include singleton for mailing to JavaScript
@@ -29,6 +30,7 @@ Settings::Settings(Master* pMaster) : State(pMaster)
 	// Create layouts
 	_pSettingsLayout = _pMaster->AddLayout("layouts/Settings.xeyegui", EYEGUI_SETTINGS_LAYER, false);
 	_pGeneralLayout = _pMaster->AddLayout("layouts/SettingsGeneral.xeyegui", EYEGUI_SETTINGS_LAYER, false);
+	_pInputLayout = _pMaster->AddLayout("layouts/SettingsInput.xeyegui", EYEGUI_SETTINGS_LAYER, false);
 	_pAdBlockingLayout = _pMaster->AddLayout("layouts/SettingsAdBlocking.xeyegui", EYEGUI_SETTINGS_LAYER, false);
 	_pInfoLayout = _pMaster->AddLayout("layouts/SettingsInfo.xeyegui", EYEGUI_SETTINGS_LAYER, false);
 
@@ -36,24 +38,28 @@ Settings::Settings(Master* pMaster) : State(pMaster)
     if(_globalSetup.showDescriptions) { eyegui::buttonDown(_pGeneralLayout, "toggle_descriptions", true); }
     if(_globalSetup.showGazeVisualization) { eyegui::buttonDown(_pGeneralLayout, "toggle_gaze_visualization", true); }
 	if(_globalSetup.adBlocking) { eyegui::buttonDown(_pAdBlockingLayout, "toggle_ad_blocking", true); };
+	eyegui::buttonDown(_pInputLayout, GetGazeFilterButtonId(_globalSetup.gazeFilter), true);
 
 	// Button listener
 	_spSettingsButtonListener = std::shared_ptr<SettingsButtonListener>(new SettingsButtonListener(this));
 	eyegui::registerButtonListener(_pSettingsLayout, "close", _spSettingsButtonListener);
 	eyegui::registerButtonListener(_pSettingsLayout, "general", _spSettingsButtonListener);
+	eyegui::registerButtonListener(_pSettingsLayout, "input", _spSettingsButtonListener);
 	eyegui::registerButtonListener(_pSettingsLayout, "ad_blocking", _spSettingsButtonListener);
 	eyegui::registerButtonListener(_pSettingsLayout, "info", _spSettingsButtonListener);
 	eyegui::registerButtonListener(_pSettingsLayout, "shutdown", _spSettingsButtonListener);
 	eyegui::registerButtonListener(_pGeneralLayout, "toggle_descriptions", _spSettingsButtonListener);
 	eyegui::registerButtonListener(_pGeneralLayout, "toggle_gaze_visualization", _spSettingsButtonListener);
 	eyegui::registerButtonListener(_pGeneralLayout, "back", _spSettingsButtonListener);
+	eyegui::registerButtonListener(_pInputLayout, "filter_weighted_average", _spSettingsButtonListener);
+	eyegui::registerButtonListener(_pInputLayout, "filter_one_euro", _spSettingsButtonListener);
+	eyegui::registerButtonListener(_pInputLayout, "filter_kalman", _spSettingsButtonListener);
+	eyegui::registerButtonListener(_pInputLayout, "filter_fixation_aware", _spSettingsButtonListener);
+	eyegui::registerButtonListener(_pInputLayout, "back", _spSettingsButtonListener);
 	eyegui::registerButtonListener(_pAdBlockingLayout, "toggle_ad_blocking", _spSettingsButtonListener);
 	eyegui::registerButtonListener(_pAdBlockingLayout, "back", _spSettingsButtonListener);
 	eyegui::registerButtonListener(_pInfoLayout, "back", _spSettingsButtonListener);
 
-	// Deactivate buttons which are not used, yet
-	eyegui::setElementActivity(_pSettingsLayout, "input", false, false);
-
 	// Deactivate shutdown button when in demo mode
 	if (setup::DEMO_MODE)
 	{
@@ -89,7 +95,7 @@ void Settings::Activate()
 	State::Activate();
 
 	// Make layout visible
-	eyegui::setVisibilityOfLayout(_pSettingsLayout, true, true, true);
+	_pMaster->SetVisibilityOfLayout(_pSettingsLayout, true, true, true);
 
 	// Reset stuff
 	_goToWeb = false;
@@ -101,7 +107,7 @@ void Settings::Deactivate()
 	State::Deactivate();
 
 	// Make all layouts invisible
-	eyegui::setVisibilityOfLayout(_pSettingsLayout, false, false, true);
+	_pMaster->SetVisibilityOfLayout(_pSettingsLayout, false, false, true);
 }
 
 // Save settings to hard disk. Returns whether successful
@@ -154,6 +160,11 @@ bool Settings::SaveSettings() const
 	pKeyboardLayout->SetAttribute("layout", layout.c_str());
 	pGlobal->InsertAfterChild(pAdBlocking, pKeyboardLayout);
 
+	// Gaze filter
+	tinyxml2::XMLElement* pGazeFilter = doc.NewElement("gazefilter");
+	pGazeFilter->SetAttribute("type", FilterTypeToString(_globalSetup.gazeFilter).c_str());
+	pGlobal->InsertAfterChild(pKeyboardLayout, pGazeFilter);
+
 	// Firebase email and password
 	tinyxml2::XMLElement* pFirebase = doc.NewElement("firebase");
 	pFirebase->SetAttribute("email", _globalSetup.firebaseEmail.c_str());
@@ -192,6 +203,7 @@ void Settings::ApplySettings(bool save)
 	_pMaster->SetGazeVisualization(_globalSetup.showGazeVisualization);
 	_pMaster->SetKeyboardLayout(_globalSetup.keyboardLayout);
 	_pMaster->BlockAds(_globalSetup.adBlocking);
+	_pMaster->SetGazeFilter(_globalSetup.gazeFilter);
 
 	// Save it
 	if (save)
@@ -262,6 +274,17 @@ bool Settings::LoadSettings()
 		}
 	}
 
+	// Gaze filter
+	tinyxml2::XMLElement* pGazeFilter = pGlobal->FirstChildElement("gazefilter");
+	if (pGazeFilter != NULL)
+	{
+		const char * pType = pGazeFilter->Attribute("type");
+		if (pType != NULL)
+		{
+			_globalSetup.gazeFilter = StringToFilterType(std::string(pType));
+		}
+	}
+
 	// Firebase email and password
 	tinyxml2::XMLElement* pFirebase = pGlobal->FirstChildElement("firebase");
 	if (pFirebase != NULL)
@@ -301,6 +324,21 @@ bool Settings::LoadSettings()
 	return true;
 }
 
+std::string Settings::GetGazeFilterButtonId(FilterType filterType)
+{
+	switch (filterType)
+	{
+	case FilterType::ONE_EURO:
+		return "filter_one_euro";
+	case FilterType::KALMAN:
+		return "filter_kalman";
+	case FilterType::FIXATION_AWARE:
+		return "filter_fixation_aware";
+	default:
+		return "filter_weighted_average";
+	}
+}
+
 void Settings::SettingsButtonListener::down(eyegui::Layout* pLayout, std::string id)
 {
 	if (pLayout == _pSettings->_pSettingsLayout)
@@ -313,16 +351,20 @@ void Settings::SettingsButtonListener::down(eyegui::Layout* pLayout, std::string
 		}
 		else if (id == "general")
 		{
-			eyegui::setVisibilityOfLayout(_pSettings->_pGeneralLayout, true, true, true);
+			_pSettings->_pMaster->SetVisibilityOfLayout(_pSettings->_pGeneralLayout, true, true, true);
 			JSMailer::instance().Send("general");
 		}
+		else if (id == "input")
+		{
+			_pSettings->_pMaster->SetVisibilityOfLayout(_pSettings->_pInputLayout, true, true, true);
+		}
 		else if (id == "ad_blocking")
 		{
-			eyegui::setVisibilityOfLayout(_pSettings->_pAdBlockingLayout, true, true, true);
+			_pSettings->_pMaster->SetVisibilityOfLayout(_pSettings->_pAdBlockingLayout, true, true, true);
 		}
 		else if (id == "info")
 		{
-			eyegui::setVisibilityOfLayout(_pSettings->_pInfoLayout, true, true, true);
+			_pSettings->_pMaster->SetVisibilityOfLayout(_pSettings->_pInfoLayout, true, true, true);
 		}
 		else if (id == "shutdown")
 		{
@@ -338,7 +380,7 @@ void Settings::SettingsButtonListener::down(eyegui::Layout* pLayout, std::string
 			// as buttons are virtually pressed by constructor, which is stored until first update of eyeGUI.
 			// This would cause the description setting to be overriden at first eyeGUI update.)
 			_pSettings->ApplySettings(true);
-			eyegui::setVisibilityOfLayout(_pSettings->_pGeneralLayout, false, false, true);
+			_pSettings->_pMaster->SetVisibilityOfLayout(_pSettings->_pGeneralLayout, false, false, true);
 		}
 		else if (id == "toggle_descriptions")
 		{
@@ -362,13 +404,45 @@ void Settings::SettingsButtonListener::down(eyegui::Layout* pLayout, std::string
 			}
 		}
 	}
+	else if (pLayout == _pSettings->_pInputLayout)
+	{
+		// ### Input layout ###
+		if (id == "back")
+		{
+			_pSettings->ApplySettings(true);
+			_pSettings->_pMaster->SetVisibilityOfLayout(_pSettings->_pInputLayout, false, false, true);
+		}
+		else
+		{
+			// Switch buttons of filters behave like radio buttons
+			FilterType previousFilterType = _pSettings->_globalSetup.gazeFilter;
+			for (FilterType filterType : { FilterType::WEIGHTED_AVERAGE, FilterType::ONE_EURO, FilterType::KALMAN, FilterType::FIXATION_AWARE })
+			{
+				std::string buttonId = GetGazeFilterButtonId(filterType);
+				if (id == buttonId)
+				{
+					_pSettings->_globalSetup.gazeFilter = filterType;
+				}
+				else
+				{
+					eyegui::buttonUp(_pSettings->_pInputLayout, buttonId, true);
+				}
+			}
+
+			// Do notification if layout visible to user and filter has changed
+			if (eyegui::isLayoutVisible(_pSettings->_pInputLayout) && previousFilterType != _pSettings->_globalSetup.gazeFilter)
+			{
+				_pSettings->_pMaster->PushNotificationByKey("notification:settings:gaze_filter_changed", MasterNotificationInterface::Type::NEUTRAL, true);
+			}
+		}
+	}
 	else if (pLayout == _pSettings->_pAdBlockingLayout)
 	{
 		// ### Ad blocking layout ###
 		if (id == "back")
 		{
 			_pSettings->ApplySettings(true);
-			eyegui::setVisibilityOfLayout(_pSettings->_pAdBlockingLayout, false, false, true);
+			_pSettings->_pMaster->SetVisibilityOfLayout(_pSettings->_pAdBlockingLayout, false, false, true);
 		}
 		else if (id == "toggle_ad_blocking")
 		{
@@ -386,7 +460,7 @@ void Settings::SettingsButtonListener::down(eyegui::Layout* pLayout, std::string
 		// ### Information layout ###
 		if (id == "back")
 		{
-			eyegui::setVisibilityOfLayout(_pSettings->_pInfoLayout, false, false, true);
+			_pSettings->_pMaster->SetVisibilityOfLayout(_pSettings->_pInfoLayout, false, false, true);
 		}
 	}
 }
@@ -418,6 +492,15 @@ void Settings::SettingsButtonListener::up(eyegui::Layout* pLayout, std::string i
 			}
         }
     }
+	else if (pLayout == _pSettings->_pInputLayout)
+	{
+		// ### Input layout ###
+		if (id == GetGazeFilterButtonId(_pSettings->_globalSetup.gazeFilter))
+		{
+			// Filter in use cannot be switched off, only replaced by other one
+			eyegui::buttonDown(_pSettings->_pInputLayout, id, true);
+		}
+	}
 	else if (pLayout == _pSettings->_pAdBlockingLayout)
 	{
 		// ### Ad blocking layout ###
@@ -8,6 +8,7 @@
 #define SETTINGS_H_
 
 #include "src/State/State.h"
+#include "src/Setup.h"
 #include "plugins/Eyetracker/Interface/EyetrackerGeometry.h"
 
 class Settings : public State
@@ -49,6 +50,9 @@ public:
 	// Get eyetracker geometry
 	EyetrackerGeometry GetEyetrackerGeometry() const { return _globalSetup.eyetrackerGeometry; }
 
+	// Get filter of gaze data
+	FilterType GetGazeFilter() const { return _globalSetup.gazeFilter; }
+
 	// Store homepage URL
 	void StoreHomepage(std::string URL) { _webSetup.homepage = URL; ApplySettings(true); }
 
@@ -66,6 +70,9 @@ private:
 	// Load settings from hard disk. Returns whether successful
 	bool LoadSettings();
 
+	// Id of switch button in input layout for filter of gaze data
+	static std::string GetGazeFilterButtonId(FilterType filterType);
+
     // Give listener full access
     friend class SettingsButtonListener;
 
@@ -100,6 +107,7 @@ private:
 		std::string firebaseEmail = "";
 		std::string firebasePassword = "";
 		EyetrackerGeometry eyetrackerGeometry;
+		FilterType gazeFilter = setup::FILTER_TYPE;
     };
 
 	// Setup of web settings
@@ -113,6 +121,7 @@ private:
     // Layouts
     eyegui::Layout* _pSettingsLayout;
     eyegui::Layout* _pGeneralLayout;
+	eyegui::Layout* _pInputLayout;
 	eyegui::Layout* _pAdBlockingLayout;
     eyegui::Layout* _pInfoLayout;
 
@@ -0,0 +1,377 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "FaviconManager.h"
+#include "src/Global.h"
+#include "src/Setup.h"
+#include "src/Utils/Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+	// Header of favicons file
+	const char FILE_MAGIC[4] = { 'G', 'T', 'W', 'F' };
+	const uint32_t FILE_VERSION = 1;
+
+	// Limits when reading, protect against corrupted files
+	const uint32_t MAX_STRING_LENGTH = 8192;
+	const uint32_t MAX_IMAGE_COUNT = 8;
+	const int32_t MAX_IMAGE_SIZE = 1024;
+
+	void WriteUInt(std::ofstream& rStream, uint32_t value)
+	{
+		rStream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+
+	void WriteString(std::ofstream& rStream, const std::string& rString)
+	{
+		WriteUInt(rStream, (uint32_t)rString.size());
+		rStream.write(rString.data(), rString.size());
+	}
+
+	bool ReadUInt(std::ifstream& rStream, uint32_t& rValue)
+	{
+		return (bool)rStream.read(reinterpret_cast<char*>(&rValue), sizeof(rValue));
+	}
+
+	bool ReadString(std::ifstream& rStream, std::string& rString)
+	{
+		uint32_t length = 0;
+		if (!ReadUInt(rStream, length) || length > MAX_STRING_LENGTH) { return false; }
+		rString.resize(length);
+		return length == 0 || (bool)rStream.read(&rString[0], length);
+	}
+
+	// Downscale RGBA image by averaging boxes of source pixels
+	FaviconManager::Image Downscale(const unsigned char* pPixels, int width, int height, int targetWidth, int targetHeight)
+	{
+		FaviconManager::Image image;
+		image.width = targetWidth;
+		image.height = targetHeight;
+		image.pixels.resize((size_t)targetWidth * (size_t)targetHeight * 4);
+		for (int y = 0; y < targetHeight; y++)
+		{
+			const int y0 = (y * height) / targetHeight;
+			const int y1 = std::max(y0 + 1, ((y + 1) * height) / targetHeight);
+			for (int x = 0; x < targetWidth; x++)
+			{
+				const int x0 = (x * width) / targetWidth;
+				const int x1 = std::max(x0 + 1, ((x + 1) * width) / targetWidth);
+				unsigned int sum[4] = { 0, 0, 0, 0 };
+				for (int sy = y0; sy < y1; sy++)
+				{
+					const unsigned char* pRow = pPixels + ((size_t)sy * (size_t)width + (size_t)x0) * 4;
+					for (int sx = x0; sx < x1; sx++, pRow += 4)
+					{
+						for (int c = 0; c < 4; c++) { sum[c] += pRow[c]; }
+					}
+				}
+				const unsigned int count = (unsigned int)((y1 - y0) * (x1 - x0));
+				unsigned char* pTarget = image.pixels.data() + ((size_t)y * (size_t)targetWidth + (size_t)x) * 4;
+				for (int c = 0; c < 4; c++) { pTarget[c] = (unsigned char)(sum[c] / count); }
+			}
+		}
+		return image;
+	}
+}
+
+const FaviconManager::Image& FaviconManager::Favicon::GetImage(int size) const
+{
+	// Images are sorted descending in size, so go from smallest to largest
+	for (auto iter = images.rbegin(); iter != images.rend(); ++iter)
+	{
+		if (iter->width >= size) { return *iter; }
+	}
+	return images.front();
+}
+
+FaviconManager::FaviconManager(std::string userDirectory)
+{
+	// Fill members
+	_fullpathFavicons = userDirectory + FAVICONS_FILE;
+
+	// Load existing favicons
+	if (!LoadFavicons()) { LogInfo("FaviconManager: No favicons file found or parsing error"); }
+}
+
+FaviconManager::~FaviconManager()
+{
+	LogInfo("FaviconManager: Hit rate at navigation start ", (int)(_statistics.GetHostHitRate() * 100.f), "% (",
+		_statistics.hostHits, " of ", _statistics.hostHits + _statistics.hostMisses, "), hit rate of icon URLs ",
+		(int)(_statistics.GetIconHitRate() * 100.f), "% (", _statistics.iconHits, " of ", _statistics.iconHits + _statistics.iconMisses, ")");
+
+	// Save favicons
+	if (!SaveFavicons()) { LogInfo("FaviconManager: Failed to save favicons file"); }
+}
+
+std::shared_ptr<const FaviconManager::Favicon> FaviconManager::FindByHost(std::string pageURL)
+{
+	const std::string host = ExtractHost(pageURL);
+	if (host.empty()) { return nullptr; }
+
+	auto hostIter = _hosts.find(host);
+	if (hostIter != _hosts.end())
+	{
+		auto iconIter = _icons.find(hostIter->second);
+		if (iconIter != _icons.end())
+		{
+			Touch(iconIter->second);
+			_statistics.hostHits++;
+			if (setup::LOG_FAVICON_CACHE) { LogInfo("FaviconManager: Found icon of host ", host); }
+			return iconIter->second.spFavicon;
+		}
+
+		// Icon has been evicted
+		_hosts.erase(hostIter);
+	}
+	_statistics.hostMisses++;
+	return nullptr;
+}
+
+std::shared_ptr<const FaviconManager::Favicon> FaviconManager::FindByIconURL(std::string iconURL, std::string pageURL)
+{
+	auto iter = _icons.find(iconURL);
+	if (iter == _icons.end())
+	{
+		_statistics.iconMisses++;
+		return nullptr;
+	}
+
+	Touch(iter->second);
+	MapHost(pageURL, iconURL);
+	_statistics.iconHits++;
+	if (setup::LOG_FAVICON_CACHE) { LogInfo("FaviconManager: Found icon ", iconURL); }
+	return iter->second.spFavicon;
+}
+
+std::shared_ptr<const FaviconManager::Favicon> FaviconManager::Store(
+	std::string iconURL,
+	std::string pageURL,
+	const unsigned char* pPixels,
+	int width,
+	int height,
+	glm::vec4 accentColor)
+{
+	auto spFavicon = std::make_shared<Favicon>();
+	spFavicon->accentColor = accentColor;
+
+	// Keep icon at limited size and at halved sizes down to minimum
+	int targetWidth = std::min(width, setup::FAVICON_CACHE_MAX_SIZE);
+	do
+	{
+		const int targetHeight = std::max(1, (height * targetWidth) / width);
+		if (targetWidth == width && targetHeight == height)
+		{
+			Image image;
+			image.width = width;
+			image.height = height;
+			image.pixels.assign(pPixels, pPixels + ((size_t)width * (size_t)height * 4));
+			spFavicon->images.push_back(std::move(image));
+		}
+		else
+		{
+			spFavicon->images.push_back(Downscale(pPixels, width, height, targetWidth, targetHeight));
+		}
+		targetWidth /= 2;
+	} while (targetWidth >= setup::FAVICON_CACHE_MIN_SIZE);
+
+	Insert(iconURL, spFavicon);
+	MapHost(pageURL, iconURL);
+	if (setup::LOG_FAVICON_CACHE) { LogInfo("FaviconManager: Stored icon ", iconURL, " with ", spFavicon->images.size(), " sizes"); }
+	return spFavicon;
+}
+
+void FaviconManager::ClearFaviconsAndDeleteFile()
+{
+	_icons.clear();
+	_usage.clear();
+	_hosts.clear();
+	std::remove(_fullpathFavicons.c_str());
+}
+
+std::string FaviconManager::ExtractHost(const std::string& rURL)
+{
+	const size_t schemeEnd = rURL.find("://");
+	if (schemeEnd == std::string::npos) { return ""; } // e.g. about:blank
+	const size_t hostStart = schemeEnd + 3;
+	const size_t hostEnd = std::min(rURL.find_first_of("/?#", hostStart), rURL.size());
+	std::string host = rURL.substr(hostStart, hostEnd - hostStart);
+	std::transform(host.begin(), host.end(), host.begin(), ::tolower);
+	return host;
+}
+
+void FaviconManager::Touch(Entry& rEntry)
+{
+	_usage.splice(_usage.begin(), _usage, rEntry.usage);
+}
+
+void FaviconManager::Insert(std::string iconURL, std::shared_ptr<const Favicon> spFavicon)
+{
+	auto iter = _icons.find(iconURL);
+	if (iter != _icons.end())
+	{
+		iter->second.spFavicon = spFavicon;
+		Touch(iter->second);
+		return;
+	}
+
+	_usage.push_front(iconURL);
+	Entry entry;
+	entry.spFavicon = spFavicon;
+	entry.usage = _usage.begin();
+	_icons.emplace(iconURL, entry);
+
+	// Evict least recently used icons. Hosts referring to them are removed on lookup
+	while (_usage.size() > setup::FAVICON_CACHE_MAX_ENTRIES)
+	{
+		_icons.erase(_usage.back());
+		_usage.pop_back();
+	}
+}
+
+void FaviconManager::MapHost(const std::string& rPageURL, const std::string& rIconURL)
+{
+	const std::string host = ExtractHost(rPageURL);
+	if (host.empty()) { return; }
+
+	// Prefer icon of higher resolution when page announces multiple icons
+	auto hostIter = _hosts.find(host);
+	if (hostIter != _hosts.end() && hostIter->second != rIconURL)
+	{
+		auto previous = _icons.find(hostIter->second);
+		auto current = _icons.find(rIconURL);
+		if (previous != _icons.end() && current != _icons.end()
+			&& previous->second.spFavicon->GetImage(INT32_MAX).width > current->second.spFavicon->GetImage(INT32_MAX).width)
+		{
+			return;
+		}
+	}
+	_hosts[host] = rIconURL;
+}
+
+bool FaviconManager::SaveFavicons() const
+{
+	// Do not save favicons to file in demo mode
+	if (setup::DEMO_MODE)
+	{
+		return true;
+	}
+
+	std::ofstream stream(_fullpathFavicons, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!stream) { return false; }
+
+	// Header
+	stream.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+	WriteUInt(stream, FILE_VERSION);
+
+	// Icons, most recently used first
+	WriteUInt(stream, (uint32_t)_usage.size());
+	for (const auto& rIconURL : _usage)
+	{
+		const Favicon& rFavicon = *_icons.at(rIconURL).spFavicon;
+		WriteString(stream, rIconURL);
+		stream.write(reinterpret_cast<const char*>(&rFavicon.accentColor[0]), sizeof(float) * 4);
+		WriteUInt(stream, (uint32_t)rFavicon.images.size());
+		for (const auto& rImage : rFavicon.images)
+		{
+			WriteUInt(stream, (uint32_t)rImage.width);
+			WriteUInt(stream, (uint32_t)rImage.height);
+			stream.write(reinterpret_cast<const char*>(rImage.pixels.data()), rImage.pixels.size());
+		}
+	}
+
+	// Hosts which refer to kept icons
+	uint32_t hostCount = 0;
+	for (const auto& rPair : _hosts) { if (_icons.find(rPair.second) != _icons.end()) { hostCount++; } }
+	WriteUInt(stream, hostCount);
+	for (const auto& rPair : _hosts)
+	{
+		if (_icons.find(rPair.second) == _icons.end()) { continue; }
+		WriteString(stream, rPair.first);
+		WriteString(stream, rPair.second);
+	}
+
+	return (bool)stream;
+}
+
+bool FaviconManager::LoadFavicons()
+{
+	std::ifstream stream(_fullpathFavicons, std::ios::in | std::ios::binary);
+	if (!stream) { return false; }
+
+	// Header
+	char magic[sizeof(FILE_MAGIC)];
+	uint32_t version = 0;
+	if (!stream.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), FILE_MAGIC)
+		|| !ReadUInt(stream, version) || version != FILE_VERSION)
+	{
+		return false;
+	}
+
+	// Icons, most recently used first
+	uint32_t iconCount = 0;
+	if (!ReadUInt(stream, iconCount)) { return false; }
+	for (uint32_t i = 0; i < iconCount; i++)
+	{
+		std::string iconURL;
+		auto spFavicon = std::make_shared<Favicon>();
+		uint32_t imageCount = 0;
+		if (!ReadString(stream, iconURL)
+			|| !stream.read(reinterpret_cast<char*>(&spFavicon->accentColor[0]), sizeof(float) * 4)
+			|| !ReadUInt(stream, imageCount) || imageCount == 0 || imageCount > MAX_IMAGE_COUNT)
+		{
+			ClearFaviconsAndDeleteFile();
+			return false;
+		}
+		for (uint32_t j = 0; j < imageCount; j++)
+		{
+			Image image;
+			uint32_t width = 0, height = 0;
+			if (!ReadUInt(stream, width) || !ReadUInt(stream, height)
+				|| width == 0 || height == 0 || (int32_t)width > MAX_IMAGE_SIZE || (int32_t)height > MAX_IMAGE_SIZE)
+			{
+				ClearFaviconsAndDeleteFile();
+				return false;
+			}
+			image.width = (int)width;
+			image.height = (int)height;
+			image.pixels.resize((size_t)width * (size_t)height * 4);
+			if (!stream.read(reinterpret_cast<char*>(image.pixels.data()), image.pixels.size()))
+			{
+				ClearFaviconsAndDeleteFile();
+				return false;
+			}
+			spFavicon->images.push_back(std::move(image));
+		}
+
+		// Keep order of usage by appending
+		if (_icons.find(iconURL) == _icons.end() && _usage.size() < setup::FAVICON_CACHE_MAX_ENTRIES)
+		{
+			_usage.push_back(iconURL);
+			Entry entry;
+			entry.spFavicon = spFavicon;
+			entry.usage = std::prev(_usage.end());
+			_icons.emplace(iconURL, entry);
+		}
+	}
+
+	// Hosts
+	uint32_t hostCount = 0;
+	if (!ReadUInt(stream, hostCount)) { return false; }
+	for (uint32_t i = 0; i < hostCount; i++)
+	{
+		std::string host, iconURL;
+		if (!ReadString(stream, host) || !ReadString(stream, iconURL)) { return false; }
+		if (_icons.find(iconURL) != _icons.end()) { _hosts[host] = iconURL; }
+	}
+
+	LogInfo("FaviconManager: Loaded ", _icons.size(), " favicons of ", _hosts.size(), " hosts");
+	return true;
+}
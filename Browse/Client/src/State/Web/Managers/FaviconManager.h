@@ -0,0 +1,127 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Manager of favicons. Keeps decoded RGBA pixels at a few sizes together with
+// the accent color computed from the icon, keyed by icon URL. Hosts of pages
+// are mapped to the icon they used last, so a tab can show icon and accent
+// color at navigation start, before the page announces any icon. Least
+// recently used icons are evicted. Icons are stored in a binary file next to
+// the history file when the manager is destructed.
+
+#ifndef FAVICONMANAGER_H_
+#define FAVICONMANAGER_H_
+
+#include "src/Utils/glmWrapper.h"
+#include <string>
+#include <vector>
+#include <list>
+#include <map>
+#include <memory>
+
+class FaviconManager
+{
+public:
+
+	// Decoded image in RGBA
+	struct Image
+	{
+		int width = 0;
+		int height = 0;
+		std::vector<unsigned char> pixels;
+	};
+
+	// Cached favicon
+	struct Favicon
+	{
+		std::vector<Image> images; // descending in size
+		glm::vec4 accentColor;
+
+		// Get smallest image with at least given size, or largest image if none is that large
+		const Image& GetImage(int size = 0) const;
+	};
+
+	// Statistics about lookups
+	struct Statistics
+	{
+		unsigned int hostHits = 0; // icon found at navigation start
+		unsigned int hostMisses = 0;
+		unsigned int iconHits = 0; // download of icon saved
+		unsigned int iconMisses = 0;
+
+		// Share of hits among lookups
+		float GetHostHitRate() const { return (hostHits + hostMisses) > 0 ? (float)hostHits / (float)(hostHits + hostMisses) : 0.f; }
+		float GetIconHitRate() const { return (iconHits + iconMisses) > 0 ? (float)iconHits / (float)(iconHits + iconMisses) : 0.f; }
+	};
+
+	// Constructor
+	FaviconManager(std::string userDirectory);
+
+	// Destructor, saves favicons to hard disk
+	virtual ~FaviconManager();
+
+	// Find favicon last used by host of page. Returns nullptr if not found
+	std::shared_ptr<const Favicon> FindByHost(std::string pageURL);
+
+	// Find favicon by its URL and remember it for host of page. Returns nullptr if not found
+	std::shared_ptr<const Favicon> FindByIconURL(std::string iconURL, std::string pageURL);
+
+	// Store decoded favicon for host of page. Pixels are RGBA. Returns cached favicon
+	std::shared_ptr<const Favicon> Store(
+		std::string iconURL,
+		std::string pageURL,
+		const unsigned char* pPixels,
+		int width,
+		int height,
+		glm::vec4 accentColor);
+
+	// Clear favicons and delete file
+	void ClearFaviconsAndDeleteFile();
+
+	// Get statistics
+	Statistics GetStatistics() const { return _statistics; }
+
+	// Extract host of URL, lower case. Empty if URL has no host, like about:blank or local files
+	static std::string ExtractHost(const std::string& rURL);
+
+private:
+
+	// Entry in map of icons
+	struct Entry
+	{
+		std::shared_ptr<const Favicon> spFavicon;
+		std::list<std::string>::iterator usage; // position in list of recently used icons
+	};
+
+	// Mark icon as most recently used
+	void Touch(Entry& rEntry);
+
+	// Insert favicon as most recently used and evict least recently used icons above limit
+	void Insert(std::string iconURL, std::shared_ptr<const Favicon> spFavicon);
+
+	// Remember icon for host of page
+	void MapHost(const std::string& rPageURL, const std::string& rIconURL);
+
+	// Save favicons to hard disk. Returns whether successful
+	bool SaveFavicons() const;
+
+	// Load favicons from hard disk. Returns whether successful
+	bool LoadFavicons();
+
+	// Icons by URL
+	std::map<std::string, Entry> _icons;
+
+	// Icon URLs, most recently used first
+	std::list<std::string> _usage;
+
+	// Icon URL by host of page. Might refer to evicted icons, which are removed on lookup
+	std::map<std::string, std::string> _hosts;
+
+	// Fullpath to favicons file
+	std::string _fullpathFavicons;
+
+	// Statistics
+	Statistics _statistics;
+};
+
+#endif // FAVICONMANAGER_H_
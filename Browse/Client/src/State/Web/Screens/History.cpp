@@ -38,7 +38,7 @@ void History::Activate(int tabId)
 	if (!_active)
 	{
 		// Make layout visible
-		eyegui::setVisibilityOfLayout(_pLayout, true, true, true);
+		_pMaster->SetVisibilityOfLayout(_pLayout, true, true, true);
 
 		// Reset collected URL
 		_collectedURL = u"";
@@ -120,7 +120,7 @@ void History::Deactivate()
 	if (_active)
 	{
 		// Make layouts invisible
-		eyegui::setVisibilityOfLayout(_pLayout, false, false, true);
+		_pMaster->SetVisibilityOfLayout(_pLayout, false, false, true);
 
 		// Remember it
 		_active = false;
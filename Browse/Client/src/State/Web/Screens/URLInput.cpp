@@ -61,10 +61,10 @@ void URLInput::Activate(int tabId)
     if (!_active)
     {
         // Make layout visible
-        eyegui::setVisibilityOfLayout(_pLayout, true, true, true);
+        _pMaster->SetVisibilityOfLayout(_pLayout, true, true, true);
 
 		// Make bookmarks layout invisble
-		eyegui::setVisibilityOfLayout(_pBookmarksLayout, false, false, false);
+		_pMaster->SetVisibilityOfLayout(_pBookmarksLayout, false, false, false);
 
 		// Set keymap
 		eyegui::setKeymapOfKeyboard(_pLayout, "keyboard", 0);
@@ -101,8 +101,8 @@ void URLInput::Deactivate()
     if (_active)
     {
         // Make layouts invisible
-        eyegui::setVisibilityOfLayout(_pLayout, false, false, true);
-		eyegui::setVisibilityOfLayout(_pBookmarksLayout, false, false, true);
+        _pMaster->SetVisibilityOfLayout(_pLayout, false, false, true);
+		_pMaster->SetVisibilityOfLayout(_pBookmarksLayout, false, false, true);
 
         // Remember it
         _active = false;
@@ -178,7 +178,7 @@ void URLInput::ShowBookmarks()
 	}
 
 	// Make layout visible
-	eyegui::setVisibilityOfLayout(_pBookmarksLayout, true, true, true);
+	_pMaster->SetVisibilityOfLayout(_pBookmarksLayout, true, true, true);
 }
 
 void URLInput::URLKeyboardListener::keyPressed(eyegui::Layout* pLayout, std::string id, std::u16string value)
@@ -310,7 +310,7 @@ void URLInput::URLButtonListener::down(eyegui::Layout* pLayout, std::string id)
 		// Bookmarks layout
 		if (id == "back")
 		{
-			eyegui::setVisibilityOfLayout(_pURLInput->_pBookmarksLayout, false, false, true);
+			_pURLInput->_pMaster->SetVisibilityOfLayout(_pURLInput->_pBookmarksLayout, false, false, true);
 			LabStreamMailer::instance().Send("Hide bookmarks");
 		}
 		else
@@ -335,7 +335,7 @@ void URLInput::URLButtonListener::down(eyegui::Layout* pLayout, std::string id)
 					LabStreamMailer::instance().Send("Remove bookmark: " + URL);
 
 					// Reset screen and notify user
-					eyegui::setVisibilityOfLayout(_pURLInput->_pBookmarksLayout, false, false, true);
+					_pURLInput->_pMaster->SetVisibilityOfLayout(_pURLInput->_pBookmarksLayout, false, false, true);
 					_pURLInput->_pMaster->PushNotificationByKey("notification:bookmark_removed", MasterNotificationInterface::Type::SUCCESS, false);
 				}
 				else if (id.substr(0, pos) == "select") // "select"
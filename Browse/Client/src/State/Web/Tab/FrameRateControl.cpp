@@ -0,0 +1,92 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "FrameRateControl.h"
+#include "src/Setup.h"
+#include <algorithm>
+
+FrameRateControl::FrameRateControl()
+{
+	_frameRate = setup::WEB_VIEW_MAX_FRAME_RATE;
+}
+
+void FrameRateControl::AddPaint(float dirtyShare)
+{
+	_dirtyShareSum += std::min(dirtyShare, 1.f);
+}
+
+bool FrameRateControl::Update(float tpf, const Signals& rSignals)
+{
+	// Statistics
+	_timePerFrameRate[_frameRate] += tpf;
+
+	// Measure repainted share per possible frame, which does not depend on current frame rate
+	_measureTime += tpf;
+	if (_measureTime >= setup::WEB_VIEW_DIRTY_MEASURE_TIME)
+	{
+		_dirtyShare = _dirtyShareSum / (_measureTime * (float)_frameRate);
+		_dirtyShareSum = 0.f;
+		_measureTime = 0.f;
+	}
+
+	// Raise immediately but lower only after lower frame rate has been sufficient for a while
+	int frameRate = DecideFrameRate(rSignals);
+	if (frameRate >= _frameRate)
+	{
+		_lowerTime = 0.f;
+		if (frameRate == _frameRate) { return false; }
+	}
+	else
+	{
+		_lowerTime += tpf;
+		if (_lowerTime < setup::WEB_VIEW_FRAME_RATE_DECREASE_DELAY) { return false; }
+		_lowerTime = 0.f;
+	}
+
+	// Measurement is not comparable after change of frame rate
+	_frameRate = frameRate;
+	_dirtyShareSum = 0.f;
+	_measureTime = 0.f;
+	return true;
+}
+
+void FrameRateControl::Reset()
+{
+	_frameRate = setup::WEB_VIEW_MAX_FRAME_RATE;
+	_lowerTime = 0.f;
+	_dirtyShareSum = 0.f;
+	_measureTime = 0.f;
+	_dirtyShare = 0.f;
+}
+
+float FrameRateControl::GetSavedShare() const
+{
+	float time = 0.f;
+	float frames = 0.f;
+	for (const auto& rPair : _timePerFrameRate)
+	{
+		time += rPair.second;
+		frames += rPair.second * (float)rPair.first;
+	}
+	if (time <= 0.f) { return 0.f; }
+	return 1.f - (frames / (time * (float)setup::WEB_VIEW_MAX_FRAME_RATE));
+}
+
+int FrameRateControl::DecideFrameRate(const Signals& rSignals) const
+{
+	if (rSignals.video || rSignals.autoScrolling || _dirtyShare >= setup::WEB_VIEW_DIRTY_SHARE_HIGH)
+	{
+		return setup::WEB_VIEW_MAX_FRAME_RATE;
+	}
+	if (rSignals.textInput || _dirtyShare >= setup::WEB_VIEW_DIRTY_SHARE_LOW)
+	{
+		return setup::WEB_VIEW_INPUT_FRAME_RATE;
+	}
+	if (rSignals.gazeInWebView)
+	{
+		return setup::WEB_VIEW_READING_FRAME_RATE;
+	}
+	return setup::WEB_VIEW_IDLE_FRAME_RATE;
+}
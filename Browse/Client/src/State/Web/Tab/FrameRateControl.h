@@ -0,0 +1,72 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Decides on the windowless frame rate of the browser of a tab. Activity of
+// the page (repainted area, videos, scrolling, text input) and whether the
+// user looks at the web view raise the rate immediately. Lower rates are only
+// applied after they have been sufficient for a while (hysteresis). Keeps
+// statistics about the time spent at each rate.
+
+#ifndef FRAMERATECONTROL_H_
+#define FRAMERATECONTROL_H_
+
+#include <map>
+
+class FrameRateControl
+{
+public:
+
+	// Signals of tab used to decide on frame rate
+	struct Signals
+	{
+		bool video = false; // video is visible in web view
+		bool autoScrolling = false; // automatic scrolling is active
+		bool textInput = false; // text is being input
+		bool gazeInWebView = false; // gaze is upon web view
+	};
+
+	// Constructor
+	FrameRateControl();
+
+	// Add share of web view which has been repainted. Called for every paint of CEF
+	void AddPaint(float dirtyShare);
+
+	// Update decision. Returns whether frame rate has changed
+	bool Update(float tpf, const Signals& rSignals);
+
+	// Go back to maximum frame rate, e.g. at activation of tab. Statistics are kept
+	void Reset();
+
+	// Get frame rate which should be used by browser
+	int GetFrameRate() const { return _frameRate; }
+
+	// Get time spent at each frame rate in seconds
+	const std::map<int, float>& GetTimePerFrameRate() const { return _timePerFrameRate; }
+
+	// Get estimated share of frames which have not been rendered compared to maximum frame rate
+	float GetSavedShare() const;
+
+private:
+
+	// Decide on frame rate for current signals
+	int DecideFrameRate(const Signals& rSignals) const;
+
+	// Current frame rate
+	int _frameRate;
+
+	// Time lower frame rate has been sufficient, in seconds
+	float _lowerTime = 0.f;
+
+	// Repainted share of web view summed up within measurement
+	float _dirtyShareSum = 0.f;
+	float _measureTime = 0.f;
+
+	// Average share of web view repainted per frame, measured at last completed measurement
+	float _dirtyShare = 0.f;
+
+	// Statistics
+	std::map<int, float> _timePerFrameRate;
+};
+
+#endif // FRAMERATECONTROL_H_
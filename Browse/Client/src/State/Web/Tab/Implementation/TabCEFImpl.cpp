@@ -13,6 +13,7 @@
 #include "src/Singletons/FirebaseMailer.h"
 #include "src/CEF/Mediator.h"
 #include <algorithm>
+#include <functional>
 
 #define SendRenderMessage [this](CefRefPtr<CefProcessMessage> msg) { return _pCefMediator->SendProcessMessageToRenderer(msg, this); }
 
@@ -45,98 +46,21 @@ void Tab::SetURL(std::string URL)
 	}
 }
 
-void Tab::ReceiveFaviconBytes(std::unique_ptr< std::vector<unsigned char> > upData, int width, int height)
+void Tab::ReceiveFaviconBytes(std::unique_ptr< std::vector<unsigned char> > upData, int width, int height, std::string img_url)
 {
-	// Go over colors and get most colorful as accent (should be always RGBA)
+	// Should be always RGBA
 	int size; // width * height * 4
 	if (upData != NULL && ((size = (int)upData->size()) >= 4) && width > 0 && height == width) // only accept square icons
 	{
-		if (size <= _current_favicon_bytes)
-			return;
-
 		LogInfo("Tab: Current favicon resolution -- ", width, " x ", height);
-		_current_favicon_bytes = size;
-
-		// Load icon into eyeGUI
-		eyegui::fetchImage(_pPanelLayout, GetFaviconIdentifier(), width, height, eyegui::ColorFormat::RGBA, upData->data(), true);
-		_faviconLoaded = true;
-
-		// Prepare loop
-		int steps = (width * height) / TAB_ACCENT_COLOR_SAMPLING_POINTS;
-		steps = glm::max(1, steps);
-		int maxIndex = 0;
-		int maxSaturation = 0;
-		bool foundColor = false;
-		for (int i = 0; i < size; i += steps * 4)
-		{
-			// Discard pixels that are transparent
-			if (upData->at(i + 3) < 200)
-			{
-				continue;
-			}
-			else
-			{
-				foundColor = true;
-			}
-
-			// Extract colors
-			float r = upData->at(i);
-			float g = upData->at(i + 1);
-			float b = upData->at(i + 2);
-			// float a = upData->at(i + 3); // not used
-
-			// Calculate saturation like in HSV color space
-			float max = glm::max(r, glm::max(g, b));
-			float saturation = 0;
-			if (max != 0)
-			{
-				float delta = max - glm::min(r, glm::min(g, b));
-				saturation = delta / max;
-				// saturation *= a; // Are values already premultiplied?
-			}
 
-			// Is it maximum?
-			if (maxSaturation < saturation)
-			{
-				maxSaturation = saturation;
-				maxIndex = i;
-			}
-		}
-
-		if (foundColor)
+		// Analyze icon once, cache keeps it for later visits. Store it in any case, so host is mapped to its current icon
+		glm::vec4 accentColor = ComputeFaviconAccentColor(upData->data(), width, height);
+		if (setup::FAVICON_CACHE)
 		{
-			// Extract accent color
-			_targetColorAccent = glm::vec4(
-				((float)upData->at(maxIndex) / 255.f),
-				((float)upData->at(maxIndex + 1) / 255.f),
-				((float)upData->at(maxIndex + 2) / 255.f),
-				1.f);
-
-			// Check, whether new target color is too much white
-			float sum = _targetColorAccent.r + _targetColorAccent.g + _targetColorAccent.b; // maximal 3
-			float whiteBorder = 2.0;
-			if (sum >= whiteBorder)
-			{
-				// Too bright, darken it
-				float multiplier = (1.f - ((sum - whiteBorder)/3.f));
-				_targetColorAccent.r *= multiplier;
-				_targetColorAccent.g *= multiplier;
-				_targetColorAccent.b *= multiplier;
-			}
-			else if (sum <= 0.3f)
-			{
-				// Too dark, use default instead
-				_targetColorAccent = TAB_DEFAULT_COLOR_ACCENT;
-			}
+			_pWeb->GetFaviconManager()->Store(img_url, _url, upData->data(), width, height, accentColor);
 		}
-		else
-		{
-			_targetColorAccent = TAB_DEFAULT_COLOR_ACCENT;
-		}
-
-        // Start color accent interpolation
-        _colorInterpolation = 0;
-
+		ApplyFavicon(upData->data(), width, height, accentColor);
 	}
     // else: do nothing
 }
@@ -154,8 +78,114 @@ bool Tab::IsFaviconAlreadyAvailable(std::string img_url)
 	if (std::find(_loaded_favicon_urls.begin(), _loaded_favicon_urls.end(), img_url) == _loaded_favicon_urls.end())
 	{
 		_loaded_favicon_urls.push_back(img_url);
-		return false;
+
+		// No download necessary if icon is cached
+		return setup::FAVICON_CACHE && ApplyCachedFavicon(_pWeb->GetFaviconManager()->FindByIconURL(img_url, _url));
+	}
+	return true;
+}
+
+glm::vec4 Tab::ComputeFaviconAccentColor(const unsigned char* pData, int width, int height)
+{
+	// Prepare loop
+	const int size = width * height * 4;
+	int steps = (width * height) / TAB_ACCENT_COLOR_SAMPLING_POINTS;
+	steps = glm::max(1, steps);
+	int maxIndex = 0;
+	int maxSaturation = 0;
+	bool foundColor = false;
+	for (int i = 0; i < size; i += steps * 4)
+	{
+		// Discard pixels that are transparent
+		if (pData[i + 3] < 200)
+		{
+			continue;
+		}
+		else
+		{
+			foundColor = true;
+		}
+
+		// Extract colors
+		float r = pData[i];
+		float g = pData[i + 1];
+		float b = pData[i + 2];
+		// float a = pData[i + 3]; // not used
+
+		// Calculate saturation like in HSV color space
+		float max = glm::max(r, glm::max(g, b));
+		float saturation = 0;
+		if (max != 0)
+		{
+			float delta = max - glm::min(r, glm::min(g, b));
+			saturation = delta / max;
+			// saturation *= a; // Are values already premultiplied?
+		}
+
+		// Is it maximum?
+		if (maxSaturation < saturation)
+		{
+			maxSaturation = saturation;
+			maxIndex = i;
+		}
+	}
+
+	if (!foundColor)
+	{
+		return TAB_DEFAULT_COLOR_ACCENT;
+	}
+
+	// Extract accent color
+	glm::vec4 accentColor = glm::vec4(
+		((float)pData[maxIndex] / 255.f),
+		((float)pData[maxIndex + 1] / 255.f),
+		((float)pData[maxIndex + 2] / 255.f),
+		1.f);
+
+	// Check, whether new target color is too much white
+	float sum = accentColor.r + accentColor.g + accentColor.b; // maximal 3
+	float whiteBorder = 2.0;
+	if (sum >= whiteBorder)
+	{
+		// Too bright, darken it
+		float multiplier = (1.f - ((sum - whiteBorder)/3.f));
+		accentColor.r *= multiplier;
+		accentColor.g *= multiplier;
+		accentColor.b *= multiplier;
+	}
+	else if (sum <= 0.3f)
+	{
+		// Too dark, use default instead
+		accentColor = TAB_DEFAULT_COLOR_ACCENT;
 	}
+	return accentColor;
+}
+
+bool Tab::ApplyFavicon(const unsigned char* pData, int width, int height, glm::vec4 accentColor, bool speculative)
+{
+	// Speculative icon is only shown until page delivers any icon, so it does not count as current resolution
+	const int size = width * height * 4;
+	if (speculative ? _current_favicon_bytes > 0 : size <= _current_favicon_bytes)
+		return false;
+	_current_favicon_bytes = speculative ? 0 : size;
+
+	// Load icon into eyeGUI
+	eyegui::fetchImage(_pPanelLayout, GetFaviconIdentifier(), width, height, eyegui::ColorFormat::RGBA, pData, true);
+	_faviconLoaded = true;
+
+	// Start color accent interpolation
+	_targetColorAccent = accentColor;
+	_colorInterpolation = 0;
+	return true;
+}
+
+bool Tab::ApplyCachedFavicon(std::shared_ptr<const FaviconManager::Favicon> spFavicon, bool speculative)
+{
+	if (!spFavicon)
+		return false;
+
+	const FaviconManager::Image& rImage = spFavicon->GetImage(setup::FAVICON_CACHE_MAX_SIZE);
+	ApplyFavicon(rImage.pixels.data(), rImage.width, rImage.height, spFavicon->accentColor, speculative);
 	return true;
 }
 
@@ -380,6 +410,72 @@ void Tab::RemoveFixedElement(int id)
 	//}
 }
 
+void Tab::NotifyPaint(float dirtyShare)
+{
+	_frameRateControl.AddPaint(dirtyShare);
+
+	// First paint of new page
+	if (_navigationState == NavigationState::COMMITTED)
+	{
+		_navigationState = NavigationState::NONE;
+		const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _navigationStartTime).count();
+		const LinkPredictor::Hint hint = _upLinkPredictor->RecordNavigation(_navigationURL, milliseconds);
+		if (setup::LOG_LINK_PREDICTION)
+		{
+			const auto& rTimes = _upLinkPredictor->GetNavigationTimes();
+			const std::function<std::string(LinkPredictor::Hint)> average = [&](LinkPredictor::Hint averagedHint)
+			{
+				auto iter = rTimes.find(averagedHint);
+				if (iter == rTimes.end()) { return std::string("-"); }
+				return std::to_string((int)iter->second.GetAverage()) + "ms (" + std::to_string(iter->second.count) + ")";
+			};
+			const std::string hintName = (hint == LinkPredictor::Hint::PREFETCH) ? "prefetch" : ((hint == LinkPredictor::Hint::PRECONNECT) ? "preconnect" : "none");
+			LogInfo("Tab: Navigation start to first paint: ", (int)milliseconds, "ms, hint: ", hintName,
+				", averages without hint: ", average(LinkPredictor::Hint::NONE),
+				", preconnect: ", average(LinkPredictor::Hint::PRECONNECT),
+				", prefetch: ", average(LinkPredictor::Hint::PREFETCH),
+				", hints given: ", _upLinkPredictor->GetHintCount(),
+				", rate limited: ", _upLinkPredictor->GetLimitedHintCount());
+		}
+	}
+}
+
+void Tab::NotifyLoadingStateChange(bool isLoading)
+{
+	// Loading state is reported again during navigation whenever history changes
+	if (isLoading && _navigationState == NavigationState::NONE)
+	{
+		_navigationState = NavigationState::STARTED;
+		_navigationStartTime = std::chrono::steady_clock::now();
+
+		// Hints belong to the page which is left
+		_upLinkPredictor->Reset();
+	}
+	else if (!isLoading)
+	{
+		// Navigation aborted or nothing painted until load end
+		_navigationState = NavigationState::NONE;
+	}
+}
+
+void Tab::NotifyNavigationCommit(std::string URL)
+{
+	// Media of previous page is gone, new page reports its own
+	_audible = false;
+
+	// Show icon and accent color of host right away, if cached
+	if (setup::FAVICON_CACHE)
+	{
+		ApplyCachedFavicon(_pWeb->GetFaviconManager()->FindByHost(URL), true);
+	}
+
+	if (_navigationState == NavigationState::STARTED)
+	{
+		_navigationState = NavigationState::COMMITTED;
+		_navigationURL = URL;
+	}
+}
+
 void Tab::SetTitle(std::string title)
 {
 	_title = title;
@@ -410,6 +506,13 @@ void Tab::SetLoadingStatus(bool isLoading, bool isMainFrame)
     }
     else
     {
+        // Scroll restored tab back to recorded offset
+        if (_restoreScrolling)
+        {
+            _pCefMediator->SetScrolling(this, _restoreScrollingOffsetX, _restoreScrollingOffsetY);
+            _restoreScrolling = false;
+        }
+
         // Main frame is done with loading
         if (_faviconLoaded)
         {
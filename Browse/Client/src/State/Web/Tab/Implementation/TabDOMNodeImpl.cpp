@@ -29,6 +29,11 @@ bool Tab::EmulateEnterKey()
 	return _pCefMediator->EmulateEnterKey(this);
 }
 
+bool Tab::InsertText(std::string text, bool submit, std::function<void()> finished)
+{
+	return _pCefMediator->InsertText(this, text, submit, finished);
+}
+
 CefRefPtr<CefProcessMessage> TabDOMNodeInterface::SetupExecuteFunctionMessage(
 	std::shared_ptr<DOMBaseInterface> spNode, std::string func_name, CefRefPtr<CefListValue> param)
 {
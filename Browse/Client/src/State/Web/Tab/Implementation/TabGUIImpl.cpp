@@ -86,7 +86,7 @@ void Tab::TabButtonListener::down(eyegui::Layout* pLayout, std::string id)
 			if (iter != _pTab->_VideoMap.end()) // search for DOMVideo corresponding to videoModeId
 			{
 				iter->second->SetPlaying(true);
-				eyegui::setVisibilityOfLayout(_pTab->_pVideoModePauseOverlayLayout, false, false, true); // hide pause overlay
+				_pTab->_pMaster->SetVisibilityOfLayout(_pTab->_pVideoModePauseOverlayLayout, false, false, true); // hide pause overlay
 			}
 		}
 		else if (id == "pause")
@@ -95,7 +95,7 @@ void Tab::TabButtonListener::down(eyegui::Layout* pLayout, std::string id)
 			if (iter != _pTab->_VideoMap.end()) // search for DOMVideo corresponding to videoModeId
 			{
 				iter->second->SetPlaying(false);
-				eyegui::setVisibilityOfLayout(_pTab->_pVideoModePauseOverlayLayout, true, true, true); // show pause overlay
+				_pTab->_pMaster->SetVisibilityOfLayout(_pTab->_pVideoModePauseOverlayLayout, true, true, true); // show pause overlay
 			}
 		}
 		else if (id == "volume_up")
@@ -9,6 +9,7 @@
 #include "src/Setup.h"
 #include "src/Utils/Helper.h"
 #include "src/Utils/Logger.h"
+#include "src/Utils/Texture.h"
 #include "src/State/Web/Tab/SocialRecord.h"
 #include <algorithm>
 #include "src/Singletons/ScreenshotHandler.h"
@@ -26,6 +27,7 @@ Tab::Tab(
 	_pMaster = pMaster;
 	_pCefMediator = pCefMediator;
 	_pWeb = pWeb;
+	_requestContext = request_context;
 	// URL etc. is set by meditator
 
 	// Create layouts for Tab (overlay at first, because behind other layouts)
@@ -108,6 +110,11 @@ Tab::Tab(
 	auto webViewInGUI = eyegui::getAbsolutePositionAndSizeOfElement(_pPanelLayout, "web_view");
     _upWebView = std::unique_ptr<WebView>(new WebView(webViewInGUI.x, webViewInGUI.y, webViewInGUI.width, webViewInGUI.height));
 
+	// Create link prediction which gives resource hints to browser
+	_upLinkPredictor = std::unique_ptr<LinkPredictor>(new LinkPredictor(
+		[this](LinkPredictor::Hint hint, const std::string& rURL) { SetResourceHint(hint, rURL, true); },
+		[this](LinkPredictor::Hint hint, const std::string& rURL) { SetResourceHint(hint, rURL, false); }));
+
 	// Register itself and painted texture in mediator to receive DOMNodes
 	_pCefMediator->RegisterTab(this, url, request_context);
 
@@ -474,6 +481,25 @@ void Tab::Update(float tpf, const std::shared_ptr<const Input> spInput, std::sha
 		_upWebView->GetResolutionY()
 		);
 
+	// Adapt frame rate of browser
+	if (setup::WEB_VIEW_FRAME_RATE_CONTROL)
+	{
+		UpdateFrameRate(tpf, spTabInput);
+	}
+
+	// Predict followed link from dwell of fixations upon links
+	if (setup::LINK_PREDICTION)
+	{
+		_upLinkPredictor->Update(
+			tpf,
+			spTabInput->CEFPixelGazeX,
+			spTabInput->CEFPixelGazeY,
+			_scrollingOffsetX,
+			_scrollingOffsetY,
+			!_pipelineActive && spTabInput->insideWebView && !spTabInput->gazeUponGUI && spTabInput->fixationDuration > 0.f,
+			_TextLinkMap);
+	}
+
 	// Update highlight rectangle of webview
 	// TODO: alternative: give webview shared pointer to DOM nodes
 	std::vector<Rect> rects;
@@ -515,6 +541,7 @@ void Tab::Update(float tpf, const std::shared_ptr<const Input> spInput, std::sha
     else if (_iconState == IconState::LOADING)
 	{
 		// Update frame of loading icon
+		_pMaster->RequestRedraw();
 		_timeUntilNextLoadingIconFrame -= tpf;
 		while (_timeUntilNextLoadingIconFrame < 0)
 		{
@@ -632,10 +659,18 @@ void Tab::Update(float tpf, const std::shared_ptr<const Input> spInput, std::sha
 		eyegui::setProgress(_pScrollingOverlayLayout, "scroll_down_progress", progressDown);
 
 		// Set visibility of scroll elements
-		eyegui::setVisibilityOFloatingFrame(_pScrollingOverlayLayout, _scrollUpProgressFrameIndex, !_autoScrolling && canScrollUp, false, true);
-		eyegui::setVisibilityOFloatingFrame(_pScrollingOverlayLayout, _scrollDownProgressFrameIndex, !_autoScrolling && canScrollDown, false, true);
-		eyegui::setVisibilityOFloatingFrame(_pScrollingOverlayLayout, _scrollUpSensorFrameIndex, !_autoScrolling && canScrollUp, false, true);
-		eyegui::setVisibilityOFloatingFrame(_pScrollingOverlayLayout, _scrollDownSensorFrameIndex, !_autoScrolling && canScrollDown, false, true);
+		bool scrollUpVisible = !_autoScrolling && canScrollUp;
+		bool scrollDownVisible = !_autoScrolling && canScrollDown;
+		if (scrollUpVisible != _scrollUpVisible || scrollDownVisible != _scrollDownVisible)
+		{
+			_pMaster->RequestRedraw(); // fading
+			_scrollUpVisible = scrollUpVisible;
+			_scrollDownVisible = scrollDownVisible;
+		}
+		eyegui::setVisibilityOFloatingFrame(_pScrollingOverlayLayout, _scrollUpProgressFrameIndex, scrollUpVisible, false, true);
+		eyegui::setVisibilityOFloatingFrame(_pScrollingOverlayLayout, _scrollDownProgressFrameIndex, scrollDownVisible, false, true);
+		eyegui::setVisibilityOFloatingFrame(_pScrollingOverlayLayout, _scrollUpSensorFrameIndex, scrollUpVisible, false, true);
+		eyegui::setVisibilityOFloatingFrame(_pScrollingOverlayLayout, _scrollDownSensorFrameIndex, scrollDownVisible, false, true);
 
 		// Set activity of scroll to top button
 		eyegui::setElementActivity(_pPanelLayout, "scroll_to_top", canScrollUp, true);
@@ -830,10 +865,10 @@ void Tab::Draw() const
 void Tab::Activate()
 {
 	// Show layouts
-	eyegui::setVisibilityOfLayout(_pOverlayLayout, true, true, false);
-	eyegui::setVisibilityOfLayout(_pScrollingOverlayLayout, true, true, false);
-	eyegui::setVisibilityOfLayout(_pPanelLayout, true, true, false);
-    eyegui::setVisibilityOfLayout(_pDebugLayout, setup::DEBUG_MODE, true, false);
+	_pMaster->SetVisibilityOfLayout(_pOverlayLayout, true, true, false);
+	_pMaster->SetVisibilityOfLayout(_pScrollingOverlayLayout, true, true, false);
+	_pMaster->SetVisibilityOfLayout(_pPanelLayout, true, true, false);
+    _pMaster->SetVisibilityOfLayout(_pDebugLayout, setup::DEBUG_MODE, true, false);
 
 	// Setup switches
 	if (_autoScrolling) { eyegui::buttonDown(_pPanelLayout, "auto_scrolling", true); }
@@ -845,21 +880,31 @@ void Tab::Activate()
 
 	// Remember being active
 	_active = true;
+	_lastActiveTime = std::chrono::steady_clock::now();
+
+	// Start at full frame rate, content may have changed meanwhile
+	if (setup::WEB_VIEW_FRAME_RATE_CONTROL)
+	{
+		_frameRateControl.Reset();
+		_pCefMediator->SetFrameRate(this, _frameRateControl.GetFrameRate());
+	}
 }
 
 void Tab::Deactivate()
 {
 	// Hide layouts
-	eyegui::setVisibilityOfLayout(_pOverlayLayout, false, true, false);
-	eyegui::setVisibilityOfLayout(_pScrollingOverlayLayout, false, true, false);
-	eyegui::setVisibilityOfLayout(_pPanelLayout, false, true, false);
-    eyegui::setVisibilityOfLayout(_pDebugLayout, false, true, false);
+	_pMaster->SetVisibilityOfLayout(_pOverlayLayout, false, true, false);
+	_pMaster->SetVisibilityOfLayout(_pScrollingOverlayLayout, false, true, false);
+	_pMaster->SetVisibilityOfLayout(_pPanelLayout, false, true, false);
+    _pMaster->SetVisibilityOfLayout(_pDebugLayout, false, true, false);
 
 	// TODO: THIS SHOULD NOT BE NECESSARY SINCE _pScrollingOverlayLayout IS HIDDEN! WHY?
 	eyegui::setVisibilityOFloatingFrame(_pScrollingOverlayLayout, _scrollUpProgressFrameIndex, false, false, true);
 	eyegui::setVisibilityOFloatingFrame(_pScrollingOverlayLayout, _scrollDownProgressFrameIndex, false, false, true);
 	eyegui::setVisibilityOFloatingFrame(_pScrollingOverlayLayout, _scrollUpSensorFrameIndex, false, false, true);
 	eyegui::setVisibilityOFloatingFrame(_pScrollingOverlayLayout, _scrollDownSensorFrameIndex, false, false, true);
+	_scrollUpVisible = false;
+	_scrollDownVisible = false;
 
 	// Abort pipeline, which also hides GUI for manual abortion
 	AbortAndClearPipelines();
@@ -869,10 +914,101 @@ void Tab::Deactivate()
 
 	// Remember being not active
 	_active = false;
+	_lastActiveTime = std::chrono::steady_clock::now();
+}
+
+void Tab::Discard()
+{
+	if (_discarded || _active) { return; }
+
+	// Record preview of rendering before texture is released
+	auto spTexture = _upWebView->GetTexture().lock();
+	if (!spTexture || !spTexture->GetPixelsFromMipMap(
+		WEB_TAB_OVERVIEW_MINI_PREVIEW_MIP_MAP_LEVEL,
+		_discardedPreviewWidth,
+		_discardedPreviewHeight,
+		_discardedPreview))
+	{
+		_discardedPreview.clear();
+	}
+
+	// Scrolling offset is overwritten while page loads at restoring, so remember it separately
+	if (!_restoreScrolling)
+	{
+		_restoreScrolling = true;
+		_restoreScrollingOffsetX = _scrollingOffsetX;
+		_restoreScrollingOffsetY = _scrollingOffsetY;
+	}
+
+	// History of browser cannot be handed to the one created at restoring
+	_discardedHistory = _canGoBack || _canGoForward;
+
+	// Close browser and free what belongs to the page
+	AbortAndClearPipelines();
+	ClearDOMNodes();
+	_pCefMediator->UnregisterTab(this);
+	_loadingFrames.clear();
+	_upWebView->ReleaseTexture();
+	_upLinkPredictor->Reset();
+	_navigationState = NavigationState::NONE;
+
+	_discarded = true;
+	_audible = false;
+}
+
+void Tab::Restore()
+{
+	if (!_discarded) { return; }
+	_discarded = false;
+
+	// Create browser at recorded URL within original request context. Scrolling is restored when loading has finished
+	_pCefMediator->RegisterTab(this, _url, _requestContext);
+
+	// Recorded preview is not needed anymore
+	_discardedPreview.clear();
+	_discardedPreview.shrink_to_fit();
+
+	// Tell user that back and forward navigation starts anew
+	if (_discardedHistory)
+	{
+		_pMaster->PushNotificationByKey("notification:tab_history_cleared", MasterNotificationInterface::Type::NEUTRAL, false);
+		_discardedHistory = false;
+	}
+}
+
+float Tab::GetTimeSinceActive() const
+{
+	if (_active) { return 0.f; }
+	return std::chrono::duration<float>(std::chrono::steady_clock::now() - _lastActiveTime).count();
+}
+
+bool Tab::GetPreview(int mipMapLevel, int& rWidth, int& rHeight, std::vector<unsigned char>& rData)
+{
+	if (_discarded)
+	{
+		// Only preview in level recorded at discarding available
+		if (_discardedPreview.empty()) { return false; }
+		rWidth = _discardedPreviewWidth;
+		rHeight = _discardedPreviewHeight;
+		rData = _discardedPreview;
+		return true;
+	}
+	if (auto spTexture = _upWebView->GetTexture().lock())
+	{
+		return spTexture->GetPixelsFromMipMap(mipMapLevel, rWidth, rHeight, rData);
+	}
+	return false;
 }
 
 void Tab::OpenURL(std::string URL)
 {
+	// Discarded tab loads URL when restored
+	if (_discarded)
+	{
+		_url = URL;
+		_restoreScrolling = false;
+	}
+
 	// Tell CEF to load a new URL (sets later URL and title here)
 	_pCefMediator->LoadURLInTab(this, URL);
 
@@ -1017,7 +1153,7 @@ void Tab::SetPipelineActivity(bool active)
 		ExitVideoMode();
 
 		_pipelineActive = true;
-		eyegui::setVisibilityOfLayout(_pPipelineAbortLayout, true, true, true);
+		_pMaster->SetVisibilityOfLayout(_pPipelineAbortLayout, true, true, true);
 
 		// Deactivate all triggers
 		for (auto pTrigger : _triggers)
@@ -1026,12 +1162,12 @@ void Tab::SetPipelineActivity(bool active)
 		}
 
 		// Deactivate scrolling overlay
-		eyegui::setVisibilityOfLayout(_pScrollingOverlayLayout, false, false, true);
+		_pMaster->SetVisibilityOfLayout(_pScrollingOverlayLayout, false, false, true);
 	}
 	else
 	{
 		_pipelineActive = false;
-		eyegui::setVisibilityOfLayout(_pPipelineAbortLayout, false, false, true);
+		_pMaster->SetVisibilityOfLayout(_pPipelineAbortLayout, false, false, true);
 
 		// Activate all triggers
 		for (auto pTrigger : _triggers)
@@ -1040,7 +1176,7 @@ void Tab::SetPipelineActivity(bool active)
 		}
 
 		// Activate scrolling overlay
-		eyegui::setVisibilityOfLayout(_pScrollingOverlayLayout, true, true, true);
+		_pMaster->SetVisibilityOfLayout(_pScrollingOverlayLayout, true, true, true);
 	}
 }
 
@@ -1061,10 +1197,10 @@ void Tab::EnterVideoMode(int id)
 			_videoModeId = id;
 
 			// Set visibility of layout
-			eyegui::setVisibilityOfLayout(_pVideoModeLayout, true, true, true);
+			_pMaster->SetVisibilityOfLayout(_pVideoModeLayout, true, true, true);
 
 			// Set visibility of pause overlay layout (just blend out, do not ask for current state)
-			eyegui::setVisibilityOfLayout(_pVideoModePauseOverlayLayout, false, false, false);
+			_pMaster->SetVisibilityOfLayout(_pVideoModePauseOverlayLayout, false, false, false);
 
 			// Deactivate all triggers
 			for (auto pTrigger : _triggers)
@@ -1073,7 +1209,7 @@ void Tab::EnterVideoMode(int id)
 			}
 
 			// Deactivate scrolling overlay
-			eyegui::setVisibilityOfLayout(_pScrollingOverlayLayout, false, false, true);
+			_pMaster->SetVisibilityOfLayout(_pScrollingOverlayLayout, false, false, true);
 		}
 	}
 }
@@ -1096,10 +1232,10 @@ void Tab::ExitVideoMode(bool immediately)
 		_videoModeId = -1; // indicating that video mode is off
 
 		// Set visibility of layout
-		eyegui::setVisibilityOfLayout(_pVideoModeLayout, false, false, !immediately);
+		_pMaster->SetVisibilityOfLayout(_pVideoModeLayout, false, false, !immediately);
 
 		// Set visibility of pause overlay layout (just blend out, do not ask for current state)
-		eyegui::setVisibilityOfLayout(_pVideoModePauseOverlayLayout, false, false, !immediately);
+		_pMaster->SetVisibilityOfLayout(_pVideoModePauseOverlayLayout, false, false, !immediately);
 
 		// Activate all triggers
 		for (auto pTrigger : _triggers)
@@ -1108,7 +1244,7 @@ void Tab::ExitVideoMode(bool immediately)
 		}
 
 		// Activate scrolling overlay
-		eyegui::setVisibilityOfLayout(_pScrollingOverlayLayout, true, true, !immediately);
+		_pMaster->SetVisibilityOfLayout(_pScrollingOverlayLayout, true, true, !immediately);
 	}
 }
 
@@ -1180,6 +1316,7 @@ void Tab::UpdateAccentColor(float tpf)
 	glm::vec4 colorAccent = _currentColorAccent;
 	if (_colorInterpolation < 1.f)
 	{
+		_pMaster->RequestRedraw();
 		_colorInterpolation += tpf; // interpolate
 		_colorInterpolation = glm::min(_colorInterpolation, 1.f); // clamp
 		colorAccent = ((1.f - _colorInterpolation) * _currentColorAccent) + (_colorInterpolation * _targetColorAccent); // calculation of current color
@@ -1268,6 +1405,75 @@ void Tab::UpdateAccentColor(float tpf)
 	);
 }
 
+void Tab::UpdateFrameRate(float tpf, const std::shared_ptr<const TabInput> spTabInput)
+{
+	// Collect signals
+	FrameRateControl::Signals signals;
+	signals.video = IsVideoInWebView();
+	signals.autoScrolling = _autoScrolling;
+	signals.textInput = _keyboardActive;
+	signals.gazeInWebView = spTabInput->insideWebView && !spTabInput->gazeUponGUI;
+
+	// Tell browser about new frame rate
+	if (_frameRateControl.Update(tpf, signals))
+	{
+		_pCefMediator->SetFrameRate(this, _frameRateControl.GetFrameRate());
+	}
+
+	// Report time spent at each frame rate
+	if (setup::LOG_WEB_VIEW_FRAME_RATE)
+	{
+		_frameRateLogTime += tpf;
+		if (_frameRateLogTime >= setup::WEB_VIEW_FRAME_RATE_LOG_INTERVAL)
+		{
+			_frameRateLogTime = 0.f;
+			std::string times;
+			for (const auto& rPair : _frameRateControl.GetTimePerFrameRate())
+			{
+				times += " " + std::to_string(rPair.first) + "fps: " + std::to_string((int)rPair.second) + "s";
+			}
+			LogInfo("Tab: Time per frame rate of web view:", times, ", frames saved: ", (int)(100.f * _frameRateControl.GetSavedShare()), "%");
+		}
+	}
+}
+
+void Tab::SetResourceHint(LinkPredictor::Hint hint, const std::string& rURL, bool add)
+{
+	switch (hint)
+	{
+	case LinkPredictor::Hint::PRECONNECT:
+		// Resolution of host as fallback where preconnect is not supported
+		_pCefMediator->SetResourceHint(this, "dns-prefetch", rURL, add);
+		_pCefMediator->SetResourceHint(this, "preconnect", rURL, add);
+		break;
+	case LinkPredictor::Hint::PREFETCH:
+		_pCefMediator->SetResourceHint(this, "prefetch", rURL, add);
+		break;
+	default:
+		break;
+	}
+}
+
+bool Tab::IsVideoInWebView() const
+{
+	if (_videoModeId >= 0) { return true; }
+	const float resolutionY = (float)_upWebView->GetResolutionY();
+	for (const auto& rPair : _VideoMap)
+	{
+		for (Rect rect : rPair.second->GetRects())
+		{
+			if (rect.IsZero()) { continue; }
+			if (!rPair.second->IsFixed())
+			{
+				rect.top -= _scrollingOffsetY;
+				rect.bottom -= _scrollingOffsetY;
+			}
+			if (rect.bottom > 0.f && rect.top < resolutionY) { return true; }
+		}
+	}
+	return false;
+}
+
 void Tab::PushBackClickVisualization(double x, double y)
 {
 	// Structure for click visulization
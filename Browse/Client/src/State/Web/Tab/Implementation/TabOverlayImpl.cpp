@@ -66,6 +66,7 @@ void Tab::SetVisibilityOfFloatingFrameInOverlay(int index, bool visible)
 {
 	// Reset when becoming visible
 	eyegui::setVisibilityOFloatingFrame(_pOverlayLayout, index, visible, visible, true);
+	_pMaster->RequestRedraw(); // fading
 }
 
 void Tab::RemoveFloatingFrameFromOverlay(int index)
@@ -43,13 +43,20 @@ public:
     virtual void SetCanGoBack(bool canGoBack) = 0;
     virtual void SetCanGoForward(bool canGoForward) = 0;
 
-    // Receive favicon bytes as char vector ordered in RGBA
-    virtual void ReceiveFaviconBytes(std::unique_ptr< std::vector<unsigned char> > upData, int width, int height) = 0;
+    // Receive favicon bytes as char vector ordered in RGBA, downloaded from given URL
+    virtual void ReceiveFaviconBytes(std::unique_ptr< std::vector<unsigned char> > upData, int width, int height, std::string img_url) = 0;
     virtual void ResetFaviconBytes() = 0;
 
     // Get weak pointer to texture of web view
     virtual std::weak_ptr<Texture> GetWebViewTexture() = 0;
 
+    // Receive share of web view which has been repainted
+    virtual void NotifyPaint(float dirtyShare) = 0;
+
+    // Receive change of loading state and commit of navigation in main frame
+    virtual void NotifyLoadingStateChange(bool isLoading) = 0;
+    virtual void NotifyNavigationCommit(std::string URL) = 0;
+
 	// Add, remove and update Tab's current DOMNodes
     virtual void AddDOMTextInput(int id) = 0;
 	virtual void AddDOMLink(int id) = 0;
@@ -75,6 +82,9 @@ public:
 
 	virtual void SetMetaKeywords(std::string content) = 0;
 
+	// Receive whether some media element of page is playing with sound
+	virtual void SetAudible(bool audible) = 0;
+
     // Receive callbacks from CefMediator upon scrolling offset changes
     virtual void SetScrollingOffset(double x, double y) = 0;
 
@@ -100,7 +110,7 @@ public:
 	// Tell about JavaScript dialog
 	virtual void RequestJSDialog(JavaScriptDialogType type, std::string message) = 0;
 
-	// Mediator checks first if favicon image has to be loaded
+	// Mediator checks first if favicon image has to be loaded. Cached favicon is applied instead of download
 	virtual bool IsFaviconAlreadyAvailable(std::string img_url) = 0;
 
 	int _current_favicon_bytes = 0;
@@ -12,6 +12,7 @@
 #include "src/State/Web/Tab/Interface/TabActionInterface.h"
 #include "include/cef_browser.h" // TODO: very bad to have this included here.
 #include <memory>
+#include <functional>
 
 class DOMBaseInterface;	// forward declaration
 
@@ -36,6 +37,7 @@ public:
 	virtual bool EmulateKeyboardStrokes(std::string textt) = 0;
 	virtual bool EmulateSelectAll() = 0;
 	virtual bool EmulateEnterKey() = 0;
+	virtual bool InsertText(std::string text, bool submit, std::function<void()> finished) = 0;
 
 private:
 
@@ -0,0 +1,250 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "LinkPredictor.h"
+#include "src/Setup.h"
+#include "src/Utils/Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+LinkPredictor::LinkPredictor(HintFunction addHint, HintFunction removeHint)
+{
+	_addHint = addHint;
+	_removeHint = removeHint;
+}
+
+void LinkPredictor::Update(
+	float tpf,
+	float gazeX,
+	float gazeY,
+	double scrollingOffsetX,
+	double scrollingOffsetY,
+	bool fixating,
+	const std::map<int, std::shared_ptr<DOMLink> >& rLinks)
+{
+	_time += tpf;
+
+	// Proximity of gaze to candidates in this frame. Multiple links may share the same target
+	for (auto& rPair : _candidates) { rPair.second.weight = 0.f; }
+	if (fixating)
+	{
+		for (const auto& rIdLinkPair : rLinks)
+		{
+			if (!rIdLinkPair.second || rIdLinkPair.second->IsOccluded()) { continue; }
+			const float weight = ComputeWeight(*rIdLinkPair.second, gazeX, gazeY, scrollingOffsetX, scrollingOffsetY);
+			if (weight <= 0.f) { continue; }
+
+			// Only targets reachable via HTTP(S) are candidates
+			const std::string URL = rIdLinkPair.second->GetUrl();
+			auto iter = _candidates.find(URL);
+			if (iter == _candidates.end())
+			{
+				std::string origin = ExtractOrigin(URL);
+				if (origin.empty()) { continue; }
+				iter = _candidates.emplace(URL, Candidate()).first;
+				iter->second.origin = origin;
+			}
+			iter->second.weight = std::max(iter->second.weight, weight);
+		}
+	}
+
+	// Accumulate dwell and let it decay when gaze has moved away. Withdraw hints of vanished candidates
+	for (auto iter = _candidates.begin(); iter != _candidates.end();)
+	{
+		Candidate& rCandidate = iter->second;
+		if (rCandidate.weight > 0.f)
+		{
+			rCandidate.score = std::min(rCandidate.score + (tpf * rCandidate.weight), setup::LINK_PREDICTION_MAX_SCORE);
+		}
+		else
+		{
+			rCandidate.score -= tpf * setup::LINK_PREDICTION_DECAY;
+		}
+
+		if (rCandidate.score <= 0.f)
+		{
+			WithdrawHints(iter->first, rCandidate);
+			iter = _candidates.erase(iter);
+		}
+		else
+		{
+			++iter;
+		}
+	}
+
+	// Rank candidates by score
+	_ranking.clear();
+	for (auto& rPair : _candidates) { _ranking.push_back(std::make_pair(&rPair.first, &rPair.second)); }
+	const size_t count = std::min((size_t)setup::LINK_PREDICTION_CANDIDATES, _ranking.size());
+	std::partial_sort(_ranking.begin(), _ranking.begin() + count, _ranking.end(),
+		[](const std::pair<const std::string*, Candidate*>& a, const std::pair<const std::string*, Candidate*>& b)
+		{
+			return a.second->score > b.second->score;
+		});
+
+	// Give hints to highest ranked candidates. Hints of others are kept until their score has vanished
+	for (size_t i = 0; i < count; i++)
+	{
+		const std::string& rURL = *_ranking.at(i).first;
+		Candidate& rCandidate = *_ranking.at(i).second;
+		if (!rCandidate.preconnected && rCandidate.score >= setup::LINK_PRECONNECT_DWELL)
+		{
+			GiveHint(Hint::PRECONNECT, rURL, rCandidate);
+		}
+		if (setup::LINK_PREFETCH && !rCandidate.prefetched && rCandidate.score >= setup::LINK_PREFETCH_DWELL)
+		{
+			GiveHint(Hint::PREFETCH, rURL, rCandidate);
+		}
+	}
+}
+
+void LinkPredictor::Reset()
+{
+	_candidates.clear();
+	_ranking.clear();
+	_preconnectedOrigins.clear();
+	_previousHintedOrigins.swap(_hintedOrigins);
+	_previousHintedURLs.swap(_hintedURLs);
+	_hintedOrigins.clear();
+	_hintedURLs.clear();
+
+	// Rate limit is kept across pages but hosts without recent hints are forgotten
+	for (auto iter = _hintTimes.begin(); iter != _hintTimes.end();)
+	{
+		if (iter->second.empty() || iter->second.back() <= _time - setup::LINK_HINT_RATE_WINDOW)
+		{
+			iter = _hintTimes.erase(iter);
+		}
+		else
+		{
+			++iter;
+		}
+	}
+}
+
+LinkPredictor::Hint LinkPredictor::RecordNavigation(const std::string& rURL, double milliseconds)
+{
+	Hint hint = Hint::NONE;
+	if (_previousHintedURLs.find(rURL) != _previousHintedURLs.end())
+	{
+		hint = Hint::PREFETCH;
+	}
+	else if (_previousHintedOrigins.find(ExtractOrigin(rURL)) != _previousHintedOrigins.end())
+	{
+		hint = Hint::PRECONNECT;
+	}
+
+	NavigationTimes& rTimes = _navigationTimes[hint];
+	rTimes.count++;
+	rTimes.sum += milliseconds;
+	return hint;
+}
+
+std::string LinkPredictor::ExtractOrigin(const std::string& rURL)
+{
+	const size_t schemeEnd = rURL.find("://");
+	if (schemeEnd == std::string::npos) { return ""; }
+	std::string scheme = rURL.substr(0, schemeEnd);
+	std::transform(scheme.begin(), scheme.end(), scheme.begin(), ::tolower);
+	if (scheme != "http" && scheme != "https") { return ""; }
+	const size_t hostEnd = rURL.find_first_of("/?#", schemeEnd + 3);
+	if (hostEnd == schemeEnd + 3) { return ""; } // no host
+	return rURL.substr(0, hostEnd);
+}
+
+float LinkPredictor::ComputeWeight(const DOMLink& rLink, float gazeX, float gazeY, double scrollingOffsetX, double scrollingOffsetY) const
+{
+	// Rects of fixed links are in view space
+	if (!rLink.IsFixed())
+	{
+		gazeX += (float)scrollingOffsetX;
+		gazeY += (float)scrollingOffsetY;
+	}
+
+	// Distance to closest rect of link
+	float minDistance = setup::LINK_PREDICTION_RADIUS;
+	for (const auto& rRect : rLink.GetRects())
+	{
+		if (rRect.IsZero()) { continue; }
+		const float dx = std::max(std::max(rRect.left - gazeX, gazeX - rRect.right), 0.f);
+		const float dy = std::max(std::max(rRect.top - gazeY, gazeY - rRect.bottom), 0.f);
+		minDistance = std::min(minDistance, std::sqrt((dx * dx) + (dy * dy)));
+	}
+	return 1.f - (minDistance / setup::LINK_PREDICTION_RADIUS);
+}
+
+bool LinkPredictor::GiveHint(Hint hint, const std::string& rURL, Candidate& rCandidate)
+{
+	// Origin already preconnected for another target
+	if (hint == Hint::PRECONNECT)
+	{
+		auto iter = _preconnectedOrigins.find(rCandidate.origin);
+		if (iter != _preconnectedOrigins.end())
+		{
+			iter->second++;
+			rCandidate.preconnected = true;
+			return true;
+		}
+	}
+
+	// Refused before and window of host has no room yet
+	if (_time < rCandidate.retryTime) { return false; }
+
+	// Rate limit per host
+	std::deque<float>& rTimes = _hintTimes[rCandidate.origin];
+	while (!rTimes.empty() && rTimes.front() <= _time - setup::LINK_HINT_RATE_WINDOW) { rTimes.pop_front(); }
+	if (rTimes.size() >= setup::LINK_HINTS_PER_HOST)
+	{
+		// Count refusal once per candidate and hint, retry when oldest hint of host leaves window
+		bool& rLimited = (hint == Hint::PRECONNECT) ? rCandidate.preconnectLimited : rCandidate.prefetchLimited;
+		if (!rLimited)
+		{
+			rLimited = true;
+			_limitedHintCount++;
+		}
+		rCandidate.retryTime = (rTimes.empty() ? _time : rTimes.front()) + setup::LINK_HINT_RATE_WINDOW;
+		return false;
+	}
+	rTimes.push_back(_time);
+	_hintCount++;
+
+	// Give hint
+	if (hint == Hint::PRECONNECT)
+	{
+		_preconnectedOrigins[rCandidate.origin] = 1;
+		_hintedOrigins.insert(rCandidate.origin);
+		rCandidate.preconnected = true;
+		_addHint(Hint::PRECONNECT, rCandidate.origin);
+		if (setup::LOG_LINK_PREDICTION) { LogInfo("LinkPredictor: Preconnect to ", rCandidate.origin); }
+	}
+	else
+	{
+		_hintedURLs.insert(rURL);
+		rCandidate.prefetched = true;
+		_addHint(Hint::PREFETCH, rURL);
+		if (setup::LOG_LINK_PREDICTION) { LogInfo("LinkPredictor: Prefetch of ", rURL); }
+	}
+	return true;
+}
+
+void LinkPredictor::WithdrawHints(const std::string& rURL, Candidate& rCandidate)
+{
+	if (rCandidate.prefetched)
+	{
+		_removeHint(Hint::PREFETCH, rURL);
+		rCandidate.prefetched = false;
+	}
+	if (rCandidate.preconnected)
+	{
+		auto iter = _preconnectedOrigins.find(rCandidate.origin);
+		if (iter != _preconnectedOrigins.end() && --(iter->second) <= 0)
+		{
+			_preconnectedOrigins.erase(iter);
+			_removeHint(Hint::PRECONNECT, rCandidate.origin);
+		}
+		rCandidate.preconnected = false;
+	}
+}
@@ -0,0 +1,133 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Predicts which link the user is going to follow from the dwell of fixations
+// upon and near links. Candidates with enough score get resource hints, so
+// the browser resolves and connects to their host (and optionally prefetches
+// the target) before the link is actually selected. Scores decay when gaze
+// moves away and hints are withdrawn once a score has vanished. Hints per host
+// are rate limited. Keeps statistics about the time from navigation start to
+// first paint, split by the hint the target received before navigation.
+
+#ifndef LINKPREDICTOR_H_
+#define LINKPREDICTOR_H_
+
+#include "src/CEF/Data/DOMNode.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <set>
+
+class LinkPredictor
+{
+public:
+
+	// Resource hints, ordered by strength
+	enum class Hint { NONE, PRECONNECT, PREFETCH };
+
+	// Function to add or remove a hint. URL is origin for preconnect and full URL for prefetch
+	typedef std::function<void(Hint hint, const std::string& rURL)> HintFunction;
+
+	// Navigation times accumulated for one kind of hint
+	struct NavigationTimes
+	{
+		unsigned int count = 0;
+		double sum = 0.0; // in milliseconds
+
+		// Average time from navigation start to first paint in milliseconds
+		double GetAverage() const { return count > 0 ? sum / (double)count : 0.0; }
+	};
+
+	// Constructor
+	LinkPredictor(HintFunction addHint, HintFunction removeHint);
+
+	// Update scores and hints. Gaze is in CEF pixel space of the web view, rects of links are in page space.
+	// Fixating tells whether gaze currently rests within the web view
+	void Update(
+		float tpf,
+		float gazeX,
+		float gazeY,
+		double scrollingOffsetX,
+		double scrollingOffsetY,
+		bool fixating,
+		const std::map<int, std::shared_ptr<DOMLink> >& rLinks);
+
+	// Forget scores and hints, e.g. when navigation starts. Hints are not removed as they vanish with the page.
+	// Hinted targets are remembered for classification of the following navigation
+	void Reset();
+
+	// Record time from navigation start to first paint for URL. Returns hint the URL received before navigation
+	Hint RecordNavigation(const std::string& rURL, double milliseconds);
+
+	// Get navigation times per hint
+	const std::map<Hint, NavigationTimes>& GetNavigationTimes() const { return _navigationTimes; }
+
+	// Get count of given hints
+	unsigned int GetHintCount() const { return _hintCount; }
+
+	// Get count of hints suppressed by rate limit, each refused hint of a candidate is counted once
+	unsigned int GetLimitedHintCount() const { return _limitedHintCount; }
+
+	// Extract origin (scheme, host and port) of URL. Empty for other schemes than HTTP and HTTPS
+	static std::string ExtractOrigin(const std::string& rURL);
+
+private:
+
+	// Candidate link target
+	struct Candidate
+	{
+		std::string origin;
+		float score = 0.f; // accumulated dwell in seconds
+		float weight = 0.f; // proximity of gaze in current frame, [0..1]
+		bool preconnected = false;
+		bool prefetched = false;
+		bool preconnectLimited = false; // refused by rate limit and already counted
+		bool prefetchLimited = false;
+		float retryTime = 0.f; // when rate window of origin has room again after refusal
+	};
+
+	// Proximity of gaze to link, one when gaze is upon link and zero outside of prediction radius
+	float ComputeWeight(const DOMLink& rLink, float gazeX, float gazeY, double scrollingOffsetX, double scrollingOffsetY) const;
+
+	// Give hint to candidate if rate limit of host allows it. Refused candidate is not retried before window has room
+	bool GiveHint(Hint hint, const std::string& rURL, Candidate& rCandidate);
+
+	// Withdraw hints of candidate
+	void WithdrawHints(const std::string& rURL, Candidate& rCandidate);
+
+	// Functions to add and remove hints
+	HintFunction _addHint;
+	HintFunction _removeHint;
+
+	// Candidates by target URL
+	std::map<std::string, Candidate> _candidates;
+
+	// Candidates ranked by score, reused every update
+	std::vector<std::pair<const std::string*, Candidate*> > _ranking;
+
+	// Count of candidates per preconnected origin, as multiple targets share an origin
+	std::map<std::string, int> _preconnectedOrigins;
+
+	// Targets hinted since last reset and before it
+	std::set<std::string> _hintedOrigins;
+	std::set<std::string> _hintedURLs;
+	std::set<std::string> _previousHintedOrigins;
+	std::set<std::string> _previousHintedURLs;
+
+	// Points in time of hints given per origin, for rate limit
+	std::map<std::string, std::deque<float> > _hintTimes;
+
+	// Time since construction in seconds
+	float _time = 0.f;
+
+	// Statistics
+	std::map<Hint, NavigationTimes> _navigationTimes;
+	unsigned int _hintCount = 0;
+	unsigned int _limitedHintCount = 0;
+};
+
+#endif // LINKPREDICTOR_H_
@@ -55,6 +55,9 @@ FutureCoordinateAction::FutureCoordinateAction(TabInteractionInterface* pTab, bo
 
 bool FutureCoordinateAction::Update(float tpf, const std::shared_ptr<const TabInput> spInput, std::shared_ptr<VoiceAction> spVoiceInput)
 {
+	// Gaze filter may have been exchanged
+	FetchTransformationInterface();
+
 	// ###################
 	// ### DEFINITIONS ###
 	// ###################
@@ -400,13 +403,14 @@ void FutureCoordinateAction::Draw() const
 void FutureCoordinateAction::Activate()
 {
 	// TODO: could go wrong, as taken from weak pointer
-	_spTrans = _pTab->GetCustomTransformationInterface().lock();
+	FetchTransformationInterface();
 	_spTrans->RegisterCustomTransformation(TRANS_NAME, [](double& x, double& y) {}); // tell transformation to not transform anything, done in update
 }
 
 void FutureCoordinateAction::Deactivate()
 {
 	// Unregister transformation
+	FetchTransformationInterface();
 	_spTrans->UnregisterCustomTransformation(TRANS_NAME);
 
 	// Reset web view (necessary because of dimming)
@@ -416,5 +420,15 @@ void FutureCoordinateAction::Deactivate()
 
 void FutureCoordinateAction::Abort()
 {
+	FetchTransformationInterface();
 	_spTrans->UnregisterCustomTransformation(TRANS_NAME);
 }
+
+void FutureCoordinateAction::FetchTransformationInterface()
+{
+	// Filter which is exchanged takes over custom transformation, so continue with current one
+	if (auto spTrans = _pTab->GetCustomTransformationInterface().lock())
+	{
+		_spTrans = spTrans;
+	}
+}
@@ -39,6 +39,9 @@ public:
 
 protected:
 
+	// Fetch custom transformation interface of current gaze filter
+	void FetchTransformationInterface();
+
 	// Sample data
 	struct SampleData
 	{
@@ -26,6 +26,8 @@
 #include "src/State/Web/WebTabInterface.h"
 #include "src/CEF/Data/DOMNode.h"
 #include "src/State/Web/Tab/WebView.h"
+#include "src/State/Web/Tab/FrameRateControl.h"
+#include "src/State/Web/Tab/LinkPredictor.h"
 #include "src/State/Web/Tab/Pipelines/Pipeline.h"
 #include "src/State/Web/Tab/Triggers/TextInputTrigger.h"
 #include "src/State/Web/Tab/Triggers/SelectFieldTrigger.h"
@@ -43,6 +45,7 @@
 #include <map>
 #include <set>
 #include <future>
+#include <chrono>
 
 
 // Forward declaration
@@ -158,6 +161,31 @@ public:
 	// Getter for URL
 	std::string GetURL() const { return _url; }
 
+	// Discard browser and release texture of inactive tab. Only a lightweight record of URL,
+	// scrolling, favicon and preview is kept. Back and forward history of the browser is lost
+	void Discard();
+
+	// Recreate browser of discarded tab at recorded URL and scrolling. Tells user when history was lost
+	void Restore();
+
+	// Whether tab is discarded
+	bool IsDiscarded() const { return _discarded; }
+
+	// Whether some video is within web view or video mode is active
+	bool IsVideoInWebView() const;
+
+	// Whether some media element of page is playing with sound
+	bool IsAudible() const { return _audible; }
+
+	// Get time since tab has been active, in seconds
+	float GetTimeSinceActive() const;
+
+	// Get memory used by texture of web view in bytes
+	size_t GetTextureMemoryUsage() const { return _upWebView->GetTextureMemoryUsage(); }
+
+	// Get preview of rendering from mip map level. Falls back to preview recorded at discarding. Returns whether successful
+	bool GetPreview(int mipMapLevel, int& rWidth, int& rHeight, std::vector<unsigned char>& rData);
+
 	// Getter for title
 	std::string GetTitle() const { return _title; }
 
@@ -391,6 +419,10 @@ public:
 	virtual bool EmulateSelectAll();
 	virtual bool EmulateEnterKey();
 
+	// Replace content of focused field by text in one step, Enter is emulated afterwards when submitting.
+	// Finished is called once the result of the insertion is known
+	virtual bool InsertText(std::string text, bool submit, std::function<void()> finished);
+
     // #########################
     // ### TAB CEF INTERFACE ###
     // #########################
@@ -413,13 +445,20 @@ public:
     virtual void SetCanGoBack(bool canGoBack) { _canGoBack = canGoBack;	}
     virtual void SetCanGoForward(bool canGoForward) { _canGoForward = canGoForward; }
 
-    // Receive favicon bytes as char vector ordered in RGBA. Accepts also NULL for upData!
-    virtual void ReceiveFaviconBytes(std::unique_ptr< std::vector<unsigned char> > upData, int width, int height);
+    // Receive favicon bytes as char vector ordered in RGBA, downloaded from given URL. Accepts also NULL for upData!
+    virtual void ReceiveFaviconBytes(std::unique_ptr< std::vector<unsigned char> > upData, int width, int height, std::string img_url);
     virtual void ResetFaviconBytes(); // TODO
 
     // Get weak pointer to texture of web view
     virtual std::weak_ptr<Texture> GetWebViewTexture() { return _upWebView->GetTexture(); }
 
+    // Receive share of web view which has been repainted
+    virtual void NotifyPaint(float dirtyShare);
+
+    // Receive change of loading state and commit of navigation in main frame
+    virtual void NotifyLoadingStateChange(bool isLoading);
+    virtual void NotifyNavigationCommit(std::string URL);
+
     // Add, remove and update Tab's current DOMNodes
 	virtual void AddDOMTextInput(int id);
 	virtual void AddDOMLink(int id);
@@ -460,6 +499,9 @@ public:
 
 	virtual void SetMetaKeywords(std::string content);
 
+	// Receive whether some media element of page is playing with sound
+	virtual void SetAudible(bool audible) { _audible = audible; }
+
     // Add new Tab after that one
 	virtual void AddTabAfter(std::string URL, CefRefPtr<CefRequestContext> request_context) { _pWeb->PushAddTabAfterJob(this, URL, request_context); }
 
@@ -624,6 +666,12 @@ private:
     // Method to update and pipe accent color to eyeGUI
     void UpdateAccentColor(float tpf);
 
+	// Adapt frame rate of browser to activity in web view
+	void UpdateFrameRate(float tpf, const std::shared_ptr<const TabInput> spTabInput);
+
+	// Add or remove resource hint given by link prediction
+	void SetResourceHint(LinkPredictor::Hint hint, const std::string& rURL, bool add);
+
     // Pushes back click visualization which fades out. X and y are in pixels
     void PushBackClickVisualization(double x, double y);
 
@@ -637,6 +685,20 @@ private:
 	// Used by TabDOMInterface in order to be able to execute node functions in Javascript
 	bool SendProcessMessageToRenderer(CefRefPtr<CefProcessMessage> msg);
 
+	// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+	// >>> Implemented in TabCEFImpl.cpp >>>
+	// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+
+	// Compute accent color from most saturated pixel of favicon in RGBA
+	static glm::vec4 ComputeFaviconAccentColor(const unsigned char* pData, int width, int height);
+
+	// Load favicon into eyeGUI and start interpolation to its accent color. Returns false if current favicon has higher resolution.
+	// Speculative favicon, e.g. cached one of host, is replaced by any favicon of the page
+	bool ApplyFavicon(const unsigned char* pData, int width, int height, glm::vec4 accentColor, bool speculative = false);
+
+	// Apply cached favicon. Returns whether favicon has been available
+	bool ApplyCachedFavicon(std::shared_ptr<const FaviconManager::Favicon> spFavicon, bool speculative = false);
+
 	// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 	// >>> Implemented in TabDebuggingImpl.cpp >>>
 	// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
@@ -702,6 +764,37 @@ private:
 	// Bool to indicate whether tab is active
 	bool _active = false;
 
+	// Time when tab has been active for the last time
+	std::chrono::steady_clock::time_point _lastActiveTime = std::chrono::steady_clock::now();
+
+	// Record of discarded tab. URL, title, favicon and scrolling offset are kept in their members
+	bool _discarded = false;
+	std::vector<unsigned char> _discardedPreview;
+	int _discardedPreviewWidth = 0;
+	int _discardedPreviewHeight = 0;
+	bool _discardedHistory = false; // whether browser could go back or forward when discarded
+
+	// Request context of browser, used again when discarded tab is restored
+	CefRefPtr<CefRequestContext> _requestContext = nullptr;
+
+	// Control of browser's frame rate
+	FrameRateControl _frameRateControl;
+	float _frameRateLogTime = 0.f;
+
+	// Prediction of followed links
+	std::unique_ptr<LinkPredictor> _upLinkPredictor;
+
+	// Measurement of time from start of navigation until first paint after commit
+	enum class NavigationState { NONE, STARTED, COMMITTED };
+	NavigationState _navigationState = NavigationState::NONE;
+	std::chrono::steady_clock::time_point _navigationStartTime;
+	std::string _navigationURL;
+
+	// Scrolling offset to restore after page of restored tab has been loaded
+	bool _restoreScrolling = false;
+	double _restoreScrollingOffsetX = 0;
+	double _restoreScrollingOffsetY = 0;
+
     // Bool to indicate whether some pipeline is active
     bool _pipelineActive = false;
 
@@ -731,6 +824,8 @@ private:
     unsigned int _scrollDownProgressFrameIndex = 0;
     unsigned int _scrollUpSensorFrameIndex = 0;
     unsigned int _scrollDownSensorFrameIndex = 0;
+	bool _scrollUpVisible = false;
+	bool _scrollDownVisible = false;
 
     // Ids of elements in overlay (added / removed by triggers or actions)
     std::map<std::string, std::function<void(void)> > _overlayButtonDownCallbacks;
@@ -769,6 +864,9 @@ private:
 	// Current site's meta keywords
 	std::string _metaKeywords;
 
+	// Whether some media element of page is playing with sound, reported by JavaScript
+	bool _audible = false;
+
 	// Used for current loading status
 	std::set<int64> _loadingFrames;
 
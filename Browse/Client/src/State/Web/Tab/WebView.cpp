@@ -4,99 +4,12 @@
 //============================================================================
 
 #include "WebView.h"
+#include "src/State/Web/Tab/WebViewShaders.h"
 #include "src/Utils/Texture.h"
 #include "src/Setup.h"
+#include "src/Utils/Logger.h"
 #include "submodules/glm/glm/gtc/matrix_transform.hpp"
 
-// Shaders
-const std::string vertexShaderSource =
-"#version 330 core\n"
-"void main() {\n"
-"}\n";
-
-const std::string geometryShaderSource =
-"#version 330 core\n"
-"layout(points) in;\n"
-"layout(triangle_strip, max_vertices = 4) out;\n"
-"out vec2 uv;\n"
-"out vec2 pos;\n" // relative position within quad in OpenGL space
-"out vec2 size;\n" // size of quad (relative values)
-"uniform vec4 position;\n" // minX, minY, maxX, maxY. OpenGL coordinate system!
-"uniform vec4 textureCoordinate;\n" // minU, minV, maxU, maxV. OpenGL coordinate system!
-"void main() {\n"
-"    size = vec2(position.z - position.x, position.w - position.y);\n" // relative size of quad
-"    gl_Position = vec4(position.zw, 0.0, 1.0);\n" // upper right corner
-"    uv = vec2(textureCoordinate.zw);\n"
-"    pos = vec2(1,1);\n"
-"    EmitVertex();\n"
-"    gl_Position = vec4(position.xw, 0.0, 1.0);\n" // upper left corner
-"    uv = vec2(textureCoordinate.xw);\n"
-"    pos = vec2(0,1);\n"
-"    EmitVertex();\n"
-"    gl_Position = vec4(position.zy, 0.0, 1.0);\n" // lower right corner
-"    uv = vec2(textureCoordinate.zy);\n"
-"    pos = vec2(1,0);\n"
-"    EmitVertex();\n"
-"    gl_Position = vec4(position.xy, 0.0, 1.0);\n" // lower left corner
-"    uv = vec2(textureCoordinate.xy);\n"
-"    pos = vec2(0,0);\n"
-"    EmitVertex();\n"
-"    EndPrimitive();\n"
-"}\n";
-
-const std::string webpageFragmentShaderSource =
-"#version 330 core\n"
-"in vec2 uv;\n"
-"out vec4 fragColor;\n"
-"uniform sampler2D tex;\n"
-"uniform float dim;\n"
-"void main() {\n"
-"	vec4 color = texture(tex, uv);\n"
-"   color.rgb = (color.a * color.rgb) + (1.0 - color.a);" // white background
-"   fragColor = vec4(color.rgb * (1.0 - dim), 1.0);\n"
-"}\n";
-
-const std::string highlightFragmentShaderSource =
-"#version 330 core\n"
-"in vec2 uv;\n"
-"in vec2 pos;\n"
-"in vec2 size;\n"
-"out vec4 fragColor;\n"
-"uniform sampler2D tex;\n"
-"uniform float dim;\n"
-"uniform float aspectRatio;\n"
-"void main() {\n"
-"	vec4 color = texture(tex, uv);\n"
-"   color.rgb = (color.a * color.rgb) + (1.0 - color.a);" // white background
-"	vec2 circle = vec2(0.015, 0.015);\n" // inner circle to display
-"	circle.y *= aspectRatio;\n" // aspect ratio correction
-"   circle /= size;\n" // realtive size of circle within mesh
-"	vec2 halfCircle = circle/2;\n" // half circle necessary
-"	float inside = min(length(abs(pos - 0.5) / halfCircle),1);\n" // calculate whether pos inside circle to display
-"   inside = inside * inside;\n" // make circle stronger
-"   inside = inside * inside;\n" // make circle stronger, again
-"   inside = inside * inside;\n" // make circle stronger, again
-"   vec3 mixture = mix(vec3(1, 0, 0), color.rgb * (1.0 - dim), min(inside + 0.4, 1));\n" // mix overlay circle and normal color
-"   fragColor = vec4(mixture, 1.0);\n"
-"}\n";
-
-const std::string compositionFragmentShaderSource =
-"#version 330 core\n"
-"in vec2 uv;\n"
-"out vec4 fragColor;\n"
-"uniform sampler2D tex;\n"
-"uniform vec2 centerOffset;\n"
-"uniform vec2 zoomPosition;\n"
-"uniform float zoom;\n"
-"void main() {\n"
-"   vec2 coords = uv;\n"
-"   coords += centerOffset;" // move towards center
-"   coords -= zoomPosition;" // move zoom position to origin
-"   coords *= zoom;" // scale coords
-"   coords += zoomPosition;" // move it back
-"   fragColor = texture(tex, coords);\n"
-"}\n";
-
 WebView::WebView(int x, int y, int width, int height)
 {
 	// Set members
@@ -110,19 +23,42 @@ WebView::WebView(int x, int y, int width, int height)
 
     // Render items
 	_upWebpageRenderItem = std::unique_ptr<RenderItem>(new RenderItem(vertexShaderSource, geometryShaderSource, webpageFragmentShaderSource));
-    _upHighlightRenderItem = std::unique_ptr<RenderItem>(new RenderItem(vertexShaderSource, geometryShaderSource, highlightFragmentShaderSource));
+    _upHighlightRenderItem = std::unique_ptr<InstancedRenderItem>(new InstancedRenderItem(highlightVertexShaderSource, highlightGeometryShaderSource, highlightFragmentShaderSource, { 4, 4 }));
     _upCompositeRenderItem = std::unique_ptr<RenderItem>(new RenderItem(vertexShaderSource, geometryShaderSource, compositionFragmentShaderSource));
 
+	// Handles of uniforms
+	_webpageUniforms.position = _upWebpageRenderItem->GetShader()->GetHandle("position");
+	_webpageUniforms.textureCoordinate = _upWebpageRenderItem->GetShader()->GetHandle("textureCoordinate");
+	_webpageUniforms.dim = _upWebpageRenderItem->GetShader()->GetHandle("dim");
+	_highlightUniforms.dim = _upHighlightRenderItem->GetShader()->GetHandle("dim");
+	_highlightUniforms.aspectRatio = _upHighlightRenderItem->GetShader()->GetHandle("aspectRatio");
+	_compositeUniforms.position = _upCompositeRenderItem->GetShader()->GetHandle("position");
+	_compositeUniforms.textureCoordinate = _upCompositeRenderItem->GetShader()->GetHandle("textureCoordinate");
+	_compositeUniforms.centerOffset = _upCompositeRenderItem->GetShader()->GetHandle("centerOffset");
+	_compositeUniforms.zoomPosition = _upCompositeRenderItem->GetShader()->GetHandle("zoomPosition");
+	_compositeUniforms.zoom = _upCompositeRenderItem->GetShader()->GetHandle("zoom");
+
     // Framebuffer
     _upFramebuffer = std::unique_ptr<Framebuffer>(new Framebuffer(_width, _height));
     _upFramebuffer->Bind();
     _upFramebuffer->AddAttachment(Framebuffer::ColorFormat::RGB, true);
     _upFramebuffer->Unbind();
+
+	// Query for GPU time
+	if (setup::LOG_WEB_VIEW_DRAWING)
+	{
+		glGenQueries(1, &_timeQuery);
+	}
 }
 
 WebView::~WebView()
 {
-    // Nothing to do
+	// Log statistics of drawing
+	if (setup::LOG_WEB_VIEW_DRAWING)
+	{
+		LogDrawStatistics();
+		glDeleteQueries(1, &_timeQuery);
+	}
 }
 
 void WebView::Update(
@@ -137,6 +73,7 @@ void WebView::Update(
         _upFramebuffer->Bind();
         _upFramebuffer->Resize(width, height);
         _upFramebuffer->Unbind();
+		_framebufferValid = false;
     }
 
     // Set members
@@ -153,46 +90,40 @@ void WebView::Draw(
 	double scrollingOffsetX,
 	double scrollingOffsetY) const
 {
-    // ### FILL FRAMEBUFFER ###
-
-    // Just render to framebuffer
-    _upFramebuffer->Bind();
-
-    // Rescue current viewport and set own which fits rendered webpage
-    GLint viewport[4];
-    glGetIntegerv(GL_VIEWPORT, viewport);
-    glViewport(0, 0, _width, _height);
-
-    // Bind render item for web page
-	_upWebpageRenderItem->Bind();
-
-    // Bind texture with rendered web page
-    _spTexture->Bind();
-
-    // Fill uniforms
-	_upWebpageRenderItem->GetShader()->UpdateValue("position", glm::vec4(-1.f, -1.f, 1.f, 1.f)); // normalized device coordinates
-	_upWebpageRenderItem->GetShader()->UpdateValue("textureCoordinate", glm::vec4(0.f, 1.f, 1.f, 0.f)); // using texture coordinates to flip image in v direction
-	_upWebpageRenderItem->GetShader()->UpdateValue("dim", parameters.dim);
-
-    // Draw webpage completely into framebuffer
-	_upWebpageRenderItem->Draw(GL_POINTS);
-
-    // Render highlighting
-    if(parameters.dim > 0.f)
-    {
-		// Bind render item for highlighting
-		_upHighlightRenderItem->Bind();
-
-        // TODO: use value from highlight or so
-        // For now: just reset dimming to zero for the rect rendering
-		_upHighlightRenderItem->GetShader()->UpdateValue("dim", 0.f);
-
-		// Aspect ratio of web view
-		_upHighlightRenderItem->GetShader()->UpdateValue("aspectRatio", (float)_width / (float)_height);
-
-        // Go over rects and render them
-        for(Rect rect : _rects)
-        {
+	// Collect GPU time of previous frame and measure this one
+	bool measure = false;
+	if (setup::LOG_WEB_VIEW_DRAWING)
+	{
+		if (_timeQueryPending)
+		{
+			GLuint available = 0;
+			glGetQueryObjectuiv(_timeQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+			if (available)
+			{
+				GLuint64 nanoseconds = 0;
+				glGetQueryObjectui64v(_timeQuery, GL_QUERY_RESULT, &nanoseconds);
+				_drawStatistics.gpuTime += (double)nanoseconds / 1000000.0;
+				_drawStatistics.measuredFrames++;
+				_timeQueryPending = false;
+			}
+		}
+		if (!_timeQueryPending)
+		{
+			glBeginQuery(GL_TIME_ELAPSED, _timeQuery);
+			measure = true;
+		}
+	}
+	unsigned int drawCalls = 0;
+
+	// ### COLLECT HIGHLIGHTS ###
+
+	// Position and texture coordinate of each highlighted rect, like uniforms of the webpage render item
+	std::vector<float> instances;
+	if (parameters.dim > 0.f)
+	{
+		instances.reserve(_rects.size() * 8);
+		for (Rect rect : _rects)
+		{
 			// Move rect by scrolling
 			rect.left -= scrollingOffsetX;
 			rect.right -= scrollingOffsetX;
@@ -205,34 +136,96 @@ void WebView::Draw(
 			rect.bottom = (rect.bottom / (float)GetResolutionY()) * (float)_height;
 			rect.top = (rect.top / (float)GetResolutionY()) * (float)_height;
 
-            // Setup position
-			_upHighlightRenderItem->GetShader()->UpdateValue(
-                "position",
-                glm::vec4(
-                    (((float)rect.left / (float)_width) * 2.f) - 1.f,
-                    ((((float)(_height - rect.bottom)) / (float)_height) * 2.f) - 1.f,
-                    (((float)(rect.right) / (float)_width) * 2.f) - 1.f,
-                    ((((float)(_height - rect.top)) / (float)_height) * 2.f) - 1.f)); // normalized device coordinates
-
-            // Setup texture coordinate
-			_upHighlightRenderItem->GetShader()->UpdateValue(
-                "textureCoordinate",
-                glm::vec4(
-                    (float)rect.left / (float)_width,
-                    1.f - (float)(_height - rect.bottom) / (float)_height,
-                    (float)rect.right / (float)_width,
-                    1.f - (float)(_height - rect.top) / (float)_height)); // using texture coordinates to flip image in v direction
-
-            // Draw the quad
+			// Skip rects outside of web view, they would be clipped anyway
+			if (rect.right < 0.f || rect.left > (float)_width || rect.bottom < 0.f || rect.top > (float)_height) { continue; }
+
+			// Position in normalized device coordinates
+			instances.push_back((((float)rect.left / (float)_width) * 2.f) - 1.f);
+			instances.push_back(((((float)(_height - rect.bottom)) / (float)_height) * 2.f) - 1.f);
+			instances.push_back((((float)(rect.right) / (float)_width) * 2.f) - 1.f);
+			instances.push_back(((((float)(_height - rect.top)) / (float)_height) * 2.f) - 1.f);
+
+			// Texture coordinate, flipping image in v direction
+			instances.push_back((float)rect.left / (float)_width);
+			instances.push_back(1.f - (float)(_height - rect.bottom) / (float)_height);
+			instances.push_back((float)rect.right / (float)_width);
+			instances.push_back(1.f - (float)(_height - rect.top) / (float)_height);
+		}
+	}
+
+	// Decide whether content of framebuffer is still valid. Zooming only affects composition
+	bool fill =
+		!setup::WEB_VIEW_COMPOSITION_CACHE
+		|| !_framebufferValid
+		|| _filledTexture != _spTexture.get()
+		|| _filledTextureRevision != _spTexture->GetRevision()
+		|| _filledDim != parameters.dim
+		|| _instances != instances;
+
+    // ### FILL FRAMEBUFFER ###
+
+	if (fill)
+	{
+		// Just render to framebuffer
+		_upFramebuffer->Bind();
+
+		// Rescue current viewport and set own which fits rendered webpage
+		GLint viewport[4];
+		glGetIntegerv(GL_VIEWPORT, viewport);
+		glViewport(0, 0, _width, _height);
+
+		// Bind render item for web page
+		_upWebpageRenderItem->Bind();
+
+		// Bind texture with rendered web page
+		_spTexture->Bind();
+
+		// Fill uniforms
+		_upWebpageRenderItem->GetShader()->UpdateValue(_webpageUniforms.position, glm::vec4(-1.f, -1.f, 1.f, 1.f)); // normalized device coordinates
+		_upWebpageRenderItem->GetShader()->UpdateValue(_webpageUniforms.textureCoordinate, glm::vec4(0.f, 1.f, 1.f, 0.f)); // using texture coordinates to flip image in v direction
+		_upWebpageRenderItem->GetShader()->UpdateValue(_webpageUniforms.dim, parameters.dim);
+
+		// Draw webpage completely into framebuffer
+		_upWebpageRenderItem->Draw(GL_POINTS);
+		drawCalls++;
+
+		// Render highlighting, all rects at once
+		if (!instances.empty())
+		{
+			// Upload rects only when they changed
+			if (_instances != instances)
+			{
+				_upHighlightRenderItem->Fill(instances);
+			}
+
+			// Bind render item for highlighting
+			_upHighlightRenderItem->Bind();
+
+			// TODO: use value from highlight or so
+			// For now: just reset dimming to zero for the rect rendering
+			_upHighlightRenderItem->GetShader()->UpdateValue(_highlightUniforms.dim, 0.f);
+
+			// Aspect ratio of web view
+			_upHighlightRenderItem->GetShader()->UpdateValue(_highlightUniforms.aspectRatio, (float)_width / (float)_height);
+
+			// Draw the quads
 			_upHighlightRenderItem->Draw(GL_POINTS);
-        }
-    }
+			drawCalls++;
+		}
 
-    // Restore old viewport
-    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+		// Restore old viewport
+		glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
 
-    // Unbind framebuffer
-    _upFramebuffer->Unbind();
+		// Unbind framebuffer
+		_upFramebuffer->Unbind();
+
+		// Remember what framebuffer contains
+		_framebufferValid = true;
+		_filledTexture = _spTexture.get();
+		_filledTextureRevision = _spTexture->GetRevision();
+		_filledDim = parameters.dim;
+		_instances.swap(instances);
+	}
 
     // ### COMPOSITING INCLUSIVE ZOOMING ###
 
@@ -245,18 +238,37 @@ void WebView::Draw(
 
     // Fill uniforms (TODO: here, coordinate sytem is not completely correctly translated. Would be only a problem at vertical transformation)
     _upCompositeRenderItem->GetShader()->UpdateValue(
-        "position",
+        _compositeUniforms.position,
         glm::vec4(
             ((_x / (float)windowWidth) * 2.f) - 1.f, // minX
             ((_y / (float)windowHeight) * 2.f) - 1.f, // minY
             (((_x + _width) / (float)windowWidth) * 2.f) - 1.f, // maxX
             (((_y + _height) / (float)windowHeight) * 2.f) - 1.f // maxY
             )); // normalized device coordinates
-    _upCompositeRenderItem->GetShader()->UpdateValue("textureCoordinate", glm::vec4(0.f, 0.f, 1.f, 1.f)); // everything is rendered correctly into framebuffer, just display it
-    _upCompositeRenderItem->GetShader()->UpdateValue("centerOffset", glm::vec2(parameters.centerOffset.x, -parameters.centerOffset.y)); // center offset y has to be taken negative because OpenGL coordinates
-    _upCompositeRenderItem->GetShader()->UpdateValue("zoomPosition", glm::vec2(parameters.zoomPosition.x, 1.f - parameters.zoomPosition.y)); // zoomPosition has origin in upper left but lower left is necessary
-    _upCompositeRenderItem->GetShader()->UpdateValue("zoom", parameters.zoom);
+    _upCompositeRenderItem->GetShader()->UpdateValue(_compositeUniforms.textureCoordinate, glm::vec4(0.f, 0.f, 1.f, 1.f)); // everything is rendered correctly into framebuffer, just display it
+    _upCompositeRenderItem->GetShader()->UpdateValue(_compositeUniforms.centerOffset, glm::vec2(parameters.centerOffset.x, -parameters.centerOffset.y)); // center offset y has to be taken negative because OpenGL coordinates
+    _upCompositeRenderItem->GetShader()->UpdateValue(_compositeUniforms.zoomPosition, glm::vec2(parameters.zoomPosition.x, 1.f - parameters.zoomPosition.y)); // zoomPosition has origin in upper left but lower left is necessary
+    _upCompositeRenderItem->GetShader()->UpdateValue(_compositeUniforms.zoom, parameters.zoom);
     _upCompositeRenderItem->Draw(GL_POINTS);
+	drawCalls++;
+
+	// Update statistics
+	if (setup::LOG_WEB_VIEW_DRAWING)
+	{
+		if (measure)
+		{
+			glEndQuery(GL_TIME_ELAPSED);
+			_timeQueryPending = true;
+		}
+		_drawStatistics.frames++;
+		_drawStatistics.drawCalls += drawCalls;
+		_drawStatistics.rects += (unsigned int)(_instances.size() / 8);
+		if (!fill) { _drawStatistics.cachedFrames++; }
+		if (_drawStatistics.frames >= setup::WEB_VIEW_DRAWING_LOG_FRAMES)
+		{
+			LogDrawStatistics();
+		}
+	}
 }
 
 std::weak_ptr<Texture> WebView::GetTexture()
@@ -264,6 +276,19 @@ std::weak_ptr<Texture> WebView::GetTexture()
     return _spTexture;
 }
 
+void WebView::ReleaseTexture()
+{
+    int width = _spTexture->GetWidth();
+    int height = _spTexture->GetHeight();
+    _spTexture = std::shared_ptr<Texture>(new Texture(width, height, GL_RGBA, Texture::Filter::LINEAR, Texture::Wrap::BORDER));
+	_framebufferValid = false;
+}
+
+size_t WebView::GetTextureMemoryUsage() const
+{
+    return _spTexture->GetMemoryUsage();
+}
+
 void WebView::SetHighlightRects(std::vector<Rect> rects)
 {
     _rects = rects;
@@ -298,3 +323,16 @@ int WebView::GetResolutionY() const
 {
 	return _spTexture->GetHeight();
 }
+
+void WebView::LogDrawStatistics() const
+{
+	if (_drawStatistics.frames > 0)
+	{
+		LogInfo("WebView: ",
+			(float)_drawStatistics.drawCalls / (float)_drawStatistics.frames, " draw calls and ",
+			(float)_drawStatistics.rects / (float)_drawStatistics.frames, " highlighted rects per frame, ",
+			(100.f * _drawStatistics.cachedFrames) / (float)_drawStatistics.frames, "% of frames composited from cache, ",
+			_drawStatistics.measuredFrames > 0 ? _drawStatistics.gpuTime / (double)_drawStatistics.measuredFrames : 0.0, "ms GPU time per frame");
+	}
+	_drawStatistics = DrawStatistics();
+}
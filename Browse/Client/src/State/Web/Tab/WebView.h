@@ -3,13 +3,16 @@
 // Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
 //============================================================================
 // View on web which has Texture and renders it onto OpenGL quad.
-// All input is assumed to have origin in upper left corner.
+// All input is assumed to have origin in upper left corner. Web page and
+// highlighted rects are rendered into a framebuffer, which is kept as long as
+// neither texture, dimming nor rects change. Zooming is applied at composition.
 
 #ifndef WEBVIEW_H_
 #define WEBVIEW_H_
 
 #include "src/State/Web/Tab/WebViewParameters.h"
 #include "src/Utils/RenderItem.h"
+#include "src/Utils/InstancedRenderItem.h"
 #include "src/CEF/Data/Rect.h"
 #include "src/Utils/glmWrapper.h"
 #include "src/Utils/Framebuffer.h"
@@ -53,6 +56,12 @@ public:
     // Getter for weak pointer of texture
     std::weak_ptr<Texture> GetTexture();
 
+    // Replace texture by an empty one of same size, so memory on GPU is freed. Filled again by next paint
+    void ReleaseTexture();
+
+    // Get memory used by texture in bytes
+    size_t GetTextureMemoryUsage() const;
+
     // Set rects which are not dimmed
     void SetHighlightRects(std::vector<Rect> rects);
 
@@ -68,14 +77,33 @@ public:
 
 private:
 
+	// Statistics about drawing
+	struct DrawStatistics
+	{
+		unsigned int frames = 0;
+		unsigned int cachedFrames = 0; // frames which only composited content of framebuffer
+		unsigned int drawCalls = 0;
+		unsigned int rects = 0;
+		unsigned int measuredFrames = 0; // frames with GPU time available
+		double gpuTime = 0.0; // in milliseconds
+	};
+
+	// Log statistics about drawing and reset them
+	void LogDrawStatistics() const;
+
     // Texture object which belongs here but filled by CEF and read maybe by other
     std::shared_ptr<Texture> _spTexture;
 
     // Render item
     std::unique_ptr<RenderItem> _upWebpageRenderItem;
-	std::unique_ptr<RenderItem> _upHighlightRenderItem;
+	std::unique_ptr<InstancedRenderItem> _upHighlightRenderItem; // draws all rects at once
     std::unique_ptr<RenderItem> _upCompositeRenderItem;
 
+	// Handles of uniforms
+	struct { Shader::Handle position, textureCoordinate, dim; } _webpageUniforms;
+	struct { Shader::Handle dim, aspectRatio; } _highlightUniforms;
+	struct { Shader::Handle position, textureCoordinate, centerOffset, zoomPosition, zoom; } _compositeUniforms;
+
     // Current values
     int _x = 0;
     int _y = 0;
@@ -87,6 +115,18 @@ private:
 
     // Framebuffer to render highlights etc on webpage and later zoom in
     std::unique_ptr<Framebuffer> _upFramebuffer;
+
+	// Values used at last filling of framebuffer, to decide whether it can be reused
+	mutable bool _framebufferValid = false;
+	mutable Texture const * _filledTexture = nullptr;
+	mutable unsigned int _filledTextureRevision = 0;
+	mutable float _filledDim = 0.f;
+	mutable std::vector<float> _instances; // position and texture coordinate of highlighted rects, as uploaded
+
+	// Statistics and query for GPU time, only used when logging
+	mutable DrawStatistics _drawStatistics;
+	GLuint _timeQuery = 0;
+	mutable bool _timeQueryPending = false;
 };
 
 #endif // WEBVIEW_H_
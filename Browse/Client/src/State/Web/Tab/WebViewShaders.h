@@ -0,0 +1,125 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Shader sources of WebView. Kept apart so the highlight benchmark renders
+// with the very same shaders.
+
+#ifndef WEBVIEWSHADERS_H_
+#define WEBVIEWSHADERS_H_
+
+#include <string>
+
+const std::string vertexShaderSource =
+"#version 330 core\n"
+"void main() {\n"
+"}\n";
+
+const std::string highlightVertexShaderSource =
+"#version 330 core\n"
+"layout(location = 0) in vec4 positionAttr;\n" // per instance
+"layout(location = 1) in vec4 textureCoordinateAttr;\n" // per instance
+"out vec4 rectPosition;\n"
+"out vec4 rectTextureCoordinate;\n"
+"void main() {\n"
+"    rectPosition = positionAttr;\n"
+"    rectTextureCoordinate = textureCoordinateAttr;\n"
+"}\n";
+
+const std::string geometryShaderHead =
+"#version 330 core\n"
+"layout(points) in;\n"
+"layout(triangle_strip, max_vertices = 4) out;\n"
+"out vec2 uv;\n"
+"out vec2 pos;\n" // relative position within quad in OpenGL space
+"out vec2 size;\n"; // size of quad (relative values)
+
+const std::string geometryShaderUniforms =
+"uniform vec4 position;\n" // minX, minY, maxX, maxY. OpenGL coordinate system!
+"uniform vec4 textureCoordinate;\n"; // minU, minV, maxU, maxV. OpenGL coordinate system!
+
+const std::string geometryShaderInstances =
+"in vec4 rectPosition[];\n" // same as uniforms above, but per instance
+"in vec4 rectTextureCoordinate[];\n"
+"#define position rectPosition[0]\n"
+"#define textureCoordinate rectTextureCoordinate[0]\n";
+
+const std::string geometryShaderBody =
+"void main() {\n"
+"    size = vec2(position.z - position.x, position.w - position.y);\n" // relative size of quad
+"    gl_Position = vec4(position.zw, 0.0, 1.0);\n" // upper right corner
+"    uv = vec2(textureCoordinate.zw);\n"
+"    pos = vec2(1,1);\n"
+"    EmitVertex();\n"
+"    gl_Position = vec4(position.xw, 0.0, 1.0);\n" // upper left corner
+"    uv = vec2(textureCoordinate.xw);\n"
+"    pos = vec2(0,1);\n"
+"    EmitVertex();\n"
+"    gl_Position = vec4(position.zy, 0.0, 1.0);\n" // lower right corner
+"    uv = vec2(textureCoordinate.zy);\n"
+"    pos = vec2(1,0);\n"
+"    EmitVertex();\n"
+"    gl_Position = vec4(position.xy, 0.0, 1.0);\n" // lower left corner
+"    uv = vec2(textureCoordinate.xy);\n"
+"    pos = vec2(0,0);\n"
+"    EmitVertex();\n"
+"    EndPrimitive();\n"
+"}\n";
+
+const std::string geometryShaderSource = geometryShaderHead + geometryShaderUniforms + geometryShaderBody;
+const std::string highlightGeometryShaderSource = geometryShaderHead + geometryShaderInstances + geometryShaderBody;
+
+const std::string webpageFragmentShaderSource =
+"#version 330 core\n"
+"in vec2 uv;\n"
+"out vec4 fragColor;\n"
+"uniform sampler2D tex;\n"
+"uniform float dim;\n"
+"void main() {\n"
+"	vec4 color = texture(tex, uv);\n"
+"   color.rgb = (color.a * color.rgb) + (1.0 - color.a);" // white background
+"   fragColor = vec4(color.rgb * (1.0 - dim), 1.0);\n"
+"}\n";
+
+const std::string highlightFragmentShaderSource =
+"#version 330 core\n"
+"in vec2 uv;\n"
+"in vec2 pos;\n"
+"in vec2 size;\n"
+"out vec4 fragColor;\n"
+"uniform sampler2D tex;\n"
+"uniform float dim;\n"
+"uniform float aspectRatio;\n"
+"void main() {\n"
+"	vec4 color = texture(tex, uv);\n"
+"   color.rgb = (color.a * color.rgb) + (1.0 - color.a);" // white background
+"	vec2 circle = vec2(0.015, 0.015);\n" // inner circle to display
+"	circle.y *= aspectRatio;\n" // aspect ratio correction
+"   circle /= size;\n" // realtive size of circle within mesh
+"	vec2 halfCircle = circle/2;\n" // half circle necessary
+"	float inside = min(length(abs(pos - 0.5) / halfCircle),1);\n" // calculate whether pos inside circle to display
+"   inside = inside * inside;\n" // make circle stronger
+"   inside = inside * inside;\n" // make circle stronger, again
+"   inside = inside * inside;\n" // make circle stronger, again
+"   vec3 mixture = mix(vec3(1, 0, 0), color.rgb * (1.0 - dim), min(inside + 0.4, 1));\n" // mix overlay circle and normal color
+"   fragColor = vec4(mixture, 1.0);\n"
+"}\n";
+
+const std::string compositionFragmentShaderSource =
+"#version 330 core\n"
+"in vec2 uv;\n"
+"out vec4 fragColor;\n"
+"uniform sampler2D tex;\n"
+"uniform vec2 centerOffset;\n"
+"uniform vec2 zoomPosition;\n"
+"uniform float zoom;\n"
+"void main() {\n"
+"   vec2 coords = uv;\n"
+"   coords += centerOffset;" // move towards center
+"   coords -= zoomPosition;" // move zoom position to origin
+"   coords *= zoom;" // scale coords
+"   coords += zoomPosition;" // move it back
+"   fragColor = texture(tex, coords);\n"
+"}\n";
+
+#endif // WEBVIEWSHADERS_H_
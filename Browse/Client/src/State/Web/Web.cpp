@@ -13,6 +13,7 @@
 #include "src/Arguments.h"
 #include "src/ContentPath.h"
 #include <algorithm>
+#include <functional>
 
 
 
@@ -30,6 +31,9 @@ Web::Web(Master* pMaster, Mediator* pCefMediator, bool dataTransfer) : State(pMa
 	// Create hisotry manager
 	_upHistoryManager = std::unique_ptr<HistoryManager>(new HistoryManager(pMaster->GetUserDirectory()));
 
+	// Create favicon manager
+	_upFaviconManager = std::unique_ptr<FaviconManager>(new FaviconManager(pMaster->GetUserDirectory()));
+
 	// Create History
 	_upHistory = std::unique_ptr<History>(new History(_pMaster, _upHistoryManager.get()));
 
@@ -276,6 +280,17 @@ bool Web::SwitchToTab(int id)
         // Set new tab as current
         _currentTabId = id;
 
+        // Recreate browser of discarded tab
+        if(_tabs.at(_currentTabId)->IsDiscarded())
+        {
+            _tabs.at(_currentTabId)->Restore();
+            _tabRestoreCount++;
+            if (setup::LOG_TAB_DISCARDING)
+            {
+                LogInfo("Web: Restored tab ", _currentTabId, " (", _tabRestoreCount, " restores, ", _tabDiscardCount, " discards so far).");
+            }
+        }
+
         // Activate tab
         if(_active)
         {
@@ -415,6 +430,7 @@ void Web::DemoModeReset()
 
 	// History
 	_upHistoryManager->ClearHistoryAndDeleteFile();
+	_upFaviconManager->ClearFaviconsAndDeleteFile();
 
 	// Bookmarks
 	_upBookmarkManager->ClearBookmarksAndDeleteFile();
@@ -669,6 +685,17 @@ StateType Web::Update(float tpf, const std::shared_ptr<const Input> spInput, std
         }
     }
 
+    // Keep background tabs within budget
+    if (setup::TAB_DISCARDING)
+    {
+        _tabBudgetCheckTime -= tpf;
+        if (_tabBudgetCheckTime <= 0.f)
+        {
+            _tabBudgetCheckTime = setup::TAB_DISCARD_CHECK_INTERVAL;
+            EnforceTabBudget();
+        }
+    }
+
     // Only do it if there is some tab to update
     if(_currentTabId >= 0 && _tabs.find(_currentTabId) != _tabs.end())
     {
@@ -705,7 +732,7 @@ void Web::Activate()
     State::Activate();
 
     // Layout
-    eyegui::setVisibilityOfLayout(_pWebLayout, true, true, false);
+    _pMaster->SetVisibilityOfLayout(_pWebLayout, true, true, false);
 
     // Reset stuff
     _goToSettings = false;
@@ -722,7 +749,7 @@ void Web::Deactivate()
     State::Deactivate();
 
     // Layout
-    eyegui::setVisibilityOfLayout(_pWebLayout, false, true, false);
+    _pMaster->SetVisibilityOfLayout(_pWebLayout, false, true, false);
 
 	// Deactivate all tabs
     if(_currentTabId >= 0)
@@ -766,6 +793,46 @@ std::shared_ptr<HistoryManager::Page> Web::AddPageToHistory(std::string URL, std
 	return _upHistoryManager->AddPage(URL, title);
 }
 
+void Web::EnforceTabBudget()
+{
+    // Collect memory and count of live tabs and background tabs which could be discarded
+    size_t memory = 0;
+    unsigned int liveCount = 0;
+    std::vector<std::pair<float, int> > candidates; // time since active and id
+    for (const auto& rPair : _tabs)
+    {
+        if (rPair.second->IsDiscarded()) { continue; }
+        memory += rPair.second->GetTextureMemoryUsage();
+        liveCount++;
+        if (rPair.first != _currentTabId && !rPair.second->IsVideoInWebView() && !rPair.second->IsAudible()) // keep tabs playing media
+        {
+            candidates.push_back(std::make_pair(rPair.second->GetTimeSinceActive(), rPair.first));
+        }
+    }
+
+    // Least recently used first
+    std::sort(candidates.begin(), candidates.end(), std::greater<std::pair<float, int> >());
+
+    // Discard while budget is exceeded or tab has been idle for too long
+    const size_t memoryBudget = (size_t)setup::TAB_TEXTURE_MEMORY_BUDGET * 1024 * 1024;
+    for (const auto& rCandidate : candidates)
+    {
+        bool idle = setup::TAB_DISCARD_IDLE_TIME > 0.f && rCandidate.first >= setup::TAB_DISCARD_IDLE_TIME;
+        if (!idle && memory <= memoryBudget && liveCount <= setup::TAB_MAX_LIVE_COUNT) { break; } // remaining ones are used more recently
+        const auto& rupTab = _tabs.at(rCandidate.second);
+        memory -= std::min(memory, rupTab->GetTextureMemoryUsage());
+        liveCount--;
+        rupTab->Discard();
+        _tabDiscardCount++;
+        if (setup::LOG_TAB_DISCARDING)
+        {
+            LogInfo("Web: Discarded tab ", rCandidate.second, " after ", rCandidate.first, " seconds of inactivity (",
+                liveCount, " live tabs using ", memory / (1024 * 1024), " MB, ",
+                _tabDiscardCount, " discards, ", _tabRestoreCount, " restores so far).");
+        }
+    }
+}
+
 int Web::GetIndexOfTabInOrderVector(int id) const
 {
     // Search tab in order
@@ -796,7 +863,7 @@ void Web::ShowTabOverview(bool show)
     if(show)
     {
         // Set visibility
-        eyegui::setVisibilityOfLayout(_pTabOverviewLayout, true, true, true);
+        _pMaster->SetVisibilityOfLayout(_pTabOverviewLayout, true, true, true);
 
         // Update tab overview before displaying
         UpdateTabOverview();
@@ -804,7 +871,7 @@ void Web::ShowTabOverview(bool show)
     else
     {
         // Set visibility
-        eyegui::setVisibilityOfLayout(_pTabOverviewLayout, false, false, true);
+        _pMaster->SetVisibilityOfLayout(_pTabOverviewLayout, false, false, true);
     }
 }
 
@@ -853,15 +920,13 @@ void Web::UpdateTabOverview()
         std::string shortURL = ShortenURL(_tabs.at(tabId)->GetURL());
         eyegui::setContentOfTextBlock(_pTabOverviewLayout, textblockId, shortURL);
 
-        // Set webpage rendering as icon of button
-        auto wpTexture = _tabs.at(tabId)->GetWebViewTexture();
-        if(auto spTexture = wpTexture.lock())
+        // Set webpage rendering as icon of button (discarded tabs provide recorded preview)
         {
             // Fetch pixel data of tab in higher mip map level
             std::vector<unsigned char> tabPreviewData;
             int tabPreviewWidth;
             int tabPreviewHeight;
-            if (spTexture->GetPixelsFromMipMap(
+            if (_tabs.at(tabId)->GetPreview(
                 WEB_TAB_OVERVIEW_MINI_PREVIEW_MIP_MAP_LEVEL,
                 tabPreviewWidth,
                 tabPreviewHeight,
@@ -11,6 +11,7 @@
 #include "src/State/Web/Tab/Tab.h"
 #include "src/State/Web/Managers/BookmarkManager.h"
 #include "src/State/Web/Managers/HistoryManager.h"
+#include "src/State/Web/Managers/FaviconManager.h"
 #include "src/State/Web/Screens/URLInput.h"
 #include "src/State/Web/Screens/History.h"
 #include "src/Input/VoiceInput.h"
@@ -117,6 +118,9 @@ public:
 	// Add history entry
 	virtual std::shared_ptr<HistoryManager::Page> AddPageToHistory(std::string URL, std::string title);
 
+	// Get favicon manager, which is shared by all tabs
+	virtual FaviconManager* GetFaviconManager() { return _upFaviconManager.get(); }
+
 private:
 
     // Jobs given by Tab over WebTabInterface
@@ -215,6 +219,9 @@ private:
 	// Update icon of tab overview
 	void UpdateTabOverviewIcon();
 
+	// Discard least recently used background tabs while budget of texture memory or live tabs is exceeded
+	void EnforceTabBudget();
+
 	// Validate URL. Returns true if recognized as URL
 	bool ValidateURL(const std::string& rURL) const;
 
@@ -252,12 +259,22 @@ private:
 	// History manager
 	std::unique_ptr<HistoryManager> _upHistoryManager;
 
+	// Favicon manager
+	std::unique_ptr<FaviconManager> _upFaviconManager;
+
 	// History object
 	std::unique_ptr<History> _upHistory;
 
 	// URL input object
 	std::unique_ptr<URLInput> _upURLInput;
 
+	// Time until tab budget is checked again
+	float _tabBudgetCheckTime = 0.f;
+
+	// Counters of discarded and restored tabs
+	unsigned int _tabDiscardCount = 0;
+	unsigned int _tabRestoreCount = 0;
+
 	// Data transfer
 	bool _dataTransfer = false;
 
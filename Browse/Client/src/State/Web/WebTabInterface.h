@@ -11,6 +11,7 @@
 #define WEBTABINTERFACE_H_
 
 #include "src/State/Web/Managers/HistoryManager.h"
+#include "src/State/Web/Managers/FaviconManager.h"
 #include "src/Award.h"
 #include <string>
 
@@ -32,6 +33,9 @@ public:
 
 	// Add history entry
 	virtual std::shared_ptr<HistoryManager::Page> AddPageToHistory(std::string URL, std::string title) = 0;
+
+	// Get favicon manager, which is shared by all tabs
+	virtual FaviconManager* GetFaviconManager() = 0;
 };
 
 #endif // WEBTABINTERFACE_H_
@@ -0,0 +1,30 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "FrameUniforms.h"
+
+// Layout must match block declaration
+static_assert(sizeof(FrameUniforms::Values) == 32, "FrameUniforms::Values does not match std140 layout of block");
+
+FrameUniforms::FrameUniforms()
+{
+	glGenBuffers(1, &_ubo);
+	glBindBuffer(GL_UNIFORM_BUFFER, _ubo);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(Values), NULL, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+FrameUniforms::~FrameUniforms()
+{
+	glDeleteBuffers(1, &_ubo);
+}
+
+void FrameUniforms::Update(const Values& rValues)
+{
+	glBindBuffer(GL_UNIFORM_BUFFER, _ubo);
+	glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(Values), &rValues);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	glBindBufferBase(GL_UNIFORM_BUFFER, FRAME_UNIFORM_BLOCK_BINDING, _ubo);
+}
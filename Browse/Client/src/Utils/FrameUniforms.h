@@ -0,0 +1,59 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// Uniform buffer with values that change per frame and not per draw call.
+// Filled and bound once per frame, shaders include the block declaration in
+// their source and are bound to it when linked. For now, only the periphery
+// blur of the screen filling quad in Master reads from it.
+
+#ifndef FRAMEUNIFORMS_H_
+#define FRAMEUNIFORMS_H_
+
+#include "externals/OGL/gl_core_3_3.h"
+#include "src/Utils/glmWrapper.h"
+#include <string>
+
+// Name and binding point of block
+static const char* const FRAME_UNIFORM_BLOCK_NAME = "Frame";
+static const GLuint FRAME_UNIFORM_BLOCK_BINDING = 0;
+
+// Declaration of block to include in shader source, must match layout of FrameUniforms::Values
+static const std::string FRAME_UNIFORM_BLOCK_SOURCE =
+"layout(std140) uniform Frame {\n"
+"    vec2 resolution;\n" // of window, in pixels
+"    vec2 gazePixelPosition;\n" // OpenGL coordinate system
+"    float focusPixelRadius;\n" // radius of sharp area around gaze, in pixels
+"    float peripheryMultiplier;\n" // brightness of periphery
+"};\n";
+
+class FrameUniforms
+{
+public:
+
+	// Values in std140 layout
+	struct Values
+	{
+		glm::vec2 resolution;
+		glm::vec2 gazePixelPosition;
+		float focusPixelRadius = 0.f;
+		float peripheryMultiplier = 1.f;
+		float padding[2] = { 0.f, 0.f };
+	};
+
+	// Constructor
+	FrameUniforms();
+
+	// Destructor
+	virtual ~FrameUniforms();
+
+	// Upload values and bind buffer to binding point of block
+	void Update(const Values& rValues);
+
+private:
+
+	// Buffer handle
+	GLuint _ubo = 0;
+};
+
+#endif // FRAMEUNIFORMS_H_
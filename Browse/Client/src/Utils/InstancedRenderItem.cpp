@@ -0,0 +1,73 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+
+#include "InstancedRenderItem.h"
+
+InstancedRenderItem::InstancedRenderItem(std::string vertSource, std::string fragSource, std::vector<GLint> attributeSizes)
+: RenderItem(vertSource, fragSource)
+{
+	InitInstances(attributeSizes);
+}
+
+InstancedRenderItem::InstancedRenderItem(std::string vertSource, std::string geomSource, std::string fragSource, std::vector<GLint> attributeSizes)
+: RenderItem(vertSource, geomSource, fragSource)
+{
+	InitInstances(attributeSizes);
+}
+
+InstancedRenderItem::~InstancedRenderItem()
+{
+	glDeleteBuffers(1, &_vbo);
+}
+
+void InstancedRenderItem::Fill(const std::vector<float>& rData)
+{
+	_instanceCount = _stride > 0 ? (int)(rData.size() / _stride) : 0;
+	if (rData.empty()) { return; }
+
+	glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+	if (rData.size() > _capacity)
+	{
+		// Reallocate with some headroom, so growing count of instances does not reallocate each frame
+		_capacity = rData.size() + rData.size() / 2;
+		glBufferData(GL_ARRAY_BUFFER, _capacity * sizeof(float), NULL, GL_DYNAMIC_DRAW);
+	}
+	glBufferSubData(GL_ARRAY_BUFFER, 0, rData.size() * sizeof(float), rData.data());
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void InstancedRenderItem::Draw(GLenum mode) const
+{
+	if (_instanceCount > 0)
+	{
+		glDrawArraysInstanced(mode, 0, 1, _instanceCount);
+	}
+}
+
+void InstancedRenderItem::InitInstances(std::vector<GLint> attributeSizes)
+{
+	// Count floats per instance
+	_stride = 0;
+	for (GLint size : attributeSizes) { _stride += size; }
+
+	// Create vertex buffer and bring it together with vertex array
+	glGenBuffers(1, &_vbo);
+	glBindVertexArray(_vao);
+	glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+
+	// Interleaved attributes which advance once per instance
+	int offset = 0;
+	for (GLuint location = 0; location < (GLuint)attributeSizes.size(); location++)
+	{
+		glEnableVertexAttribArray(location);
+		glVertexAttribPointer(location, attributeSizes[location], GL_FLOAT, GL_FALSE, _stride * sizeof(float), (void*)(offset * sizeof(float)));
+		glVertexAttribDivisor(location, 1);
+		offset += attributeSizes[location];
+	}
+
+	// Unbind everything
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
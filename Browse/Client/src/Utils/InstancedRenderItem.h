@@ -0,0 +1,54 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+// Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
+//============================================================================
+// RenderItem which draws one point per instance. Per-instance attributes are
+// interleaved floats in one vertex buffer, bound to consecutive attribute
+// locations starting at zero. Useful together with a geometry shader which
+// expands each point to a quad, so many quads need only one draw call.
+
+#ifndef INSTANCEDRENDERITEM_H_
+#define INSTANCEDRENDERITEM_H_
+
+#include "src/Utils/RenderItem.h"
+#include <vector>
+
+class InstancedRenderItem : public RenderItem
+{
+public:
+
+	// Constructors. Attribute sizes are component counts of per-instance attributes in order of their locations
+	InstancedRenderItem(std::string vertSource, std::string fragSource, std::vector<GLint> attributeSizes);
+	InstancedRenderItem(std::string vertSource, std::string geomSource, std::string fragSource, std::vector<GLint> attributeSizes);
+
+	// Destructor
+	virtual ~InstancedRenderItem();
+
+	// Upload per-instance attributes. Count of instances is derived from size of data
+	void Fill(const std::vector<float>& rData);
+
+	// Drawing of all instances with one call
+	virtual void Draw(GLenum mode = GL_POINTS) const;
+
+	// Getter for count of instances
+	int GetInstanceCount() const { return _instanceCount; }
+
+private:
+
+	// Initialization of vertex buffer
+	void InitInstances(std::vector<GLint> attributeSizes);
+
+	// Vertex buffer with per-instance attributes
+	GLuint _vbo = 0;
+
+	// Floats per instance
+	int _stride = 0;
+
+	// Count of instances
+	int _instanceCount = 0;
+
+	// Allocated size of vertex buffer in floats
+	size_t _capacity = 0;
+};
+
+#endif // INSTANCEDRENDERITEM_H_
@@ -4,7 +4,11 @@
 //============================================================================
 
 #include "Shader.h"
+#include "src/Utils/FrameUniforms.h"
 #include "submodules/glm/glm/gtc/type_ptr.hpp"
+#include <cstring>
+
+Shader::Statistics Shader::_statistics;
 
 Shader::Shader(std::string vertSource, std::string fragSource) : Shader(vertSource, "", fragSource)
 {
@@ -46,6 +50,9 @@ Shader::Shader(std::string vertSource, std::string geomSource, std::string fragS
     glDeleteShader(vertexShader);
     if(geometryShader >= 0) { glDeleteShader(geometryShader); }
     glDeleteShader(fragmentShader);
+
+	// Uniforms
+	ResolveUniforms();
 }
 
 Shader::~Shader()
@@ -58,32 +65,137 @@ void Shader::Bind() const
     glUseProgram(_program);
 }
 
+Shader::Handle Shader::GetHandle(std::string name) const
+{
+	auto iter = _handles.find(name);
+	return iter != _handles.end() ? iter->second : -1;
+}
+
+void Shader::UpdateValue(Handle handle, const int& rValue) const
+{
+	GLint location = Prepare(handle, &rValue, sizeof(int));
+	if (location >= 0) { glUniform1i(location, rValue); }
+}
+
+void Shader::UpdateValue(Handle handle, const float& rValue) const
+{
+	GLint location = Prepare(handle, &rValue, sizeof(float));
+	if (location >= 0) { glUniform1f(location, rValue); }
+}
+
+void Shader::UpdateValue(Handle handle, const glm::vec2& rValue) const
+{
+	GLint location = Prepare(handle, glm::value_ptr(rValue), sizeof(glm::vec2));
+	if (location >= 0) { glUniform2fv(location, 1, glm::value_ptr(rValue)); }
+}
+
+void Shader::UpdateValue(Handle handle, const glm::vec3& rValue) const
+{
+	GLint location = Prepare(handle, glm::value_ptr(rValue), sizeof(glm::vec3));
+	if (location >= 0) { glUniform3fv(location, 1, glm::value_ptr(rValue)); }
+}
+
+void Shader::UpdateValue(Handle handle, const glm::vec4& rValue) const
+{
+	GLint location = Prepare(handle, glm::value_ptr(rValue), sizeof(glm::vec4));
+	if (location >= 0) { glUniform4fv(location, 1, glm::value_ptr(rValue)); }
+}
+
+void Shader::UpdateValue(Handle handle, const glm::mat4& rValue) const
+{
+	GLint location = Prepare(handle, glm::value_ptr(rValue), sizeof(glm::mat4));
+	if (location >= 0) { glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(rValue)); }
+}
+
 void Shader::UpdateValue(std::string name, const int& rValue) const
 {
-    glUniform1i(glGetUniformLocation(_program, name.c_str()), rValue);
+	_statistics.lookups++;
+	UpdateValue(GetHandle(name), rValue);
 }
 
 void Shader::UpdateValue(std::string name, const float& rValue) const
 {
-    glUniform1f(glGetUniformLocation(_program, name.c_str()), rValue);
+	_statistics.lookups++;
+	UpdateValue(GetHandle(name), rValue);
 }
 
 void Shader::UpdateValue(std::string name, const glm::vec2& rValue) const
 {
-    glUniform2fv(glGetUniformLocation(_program, name.c_str()), 1, glm::value_ptr(rValue));
+	_statistics.lookups++;
+	UpdateValue(GetHandle(name), rValue);
 }
 
 void Shader::UpdateValue(std::string name, const glm::vec3& rValue) const
 {
-    glUniform3fv(glGetUniformLocation(_program, name.c_str()), 1, glm::value_ptr(rValue));
+	_statistics.lookups++;
+	UpdateValue(GetHandle(name), rValue);
 }
 
 void Shader::UpdateValue(std::string name, const glm::vec4& rValue) const
 {
-    glUniform4fv(glGetUniformLocation(_program, name.c_str()), 1, glm::value_ptr(rValue));
+	_statistics.lookups++;
+	UpdateValue(GetHandle(name), rValue);
 }
 
 void Shader::UpdateValue(std::string name, const glm::mat4& rValue) const
 {
-    glUniformMatrix4fv(glGetUniformLocation(_program, name.c_str()), 1, GL_FALSE, glm::value_ptr(rValue));
+	_statistics.lookups++;
+	UpdateValue(GetHandle(name), rValue);
+}
+
+void Shader::ResolveUniforms()
+{
+	// Go over active uniforms
+	GLint count = 0;
+	glGetProgramiv(_program, GL_ACTIVE_UNIFORMS, &count);
+	GLint maxLength = 0;
+	glGetProgramiv(_program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+	std::vector<GLchar> buffer(glm::max(maxLength, 1));
+	for (GLint i = 0; i < count; i++)
+	{
+		GLsizei length = 0;
+		GLint size = 0;
+		GLenum type = 0;
+		glGetActiveUniform(_program, (GLuint)i, (GLsizei)buffer.size(), &length, &size, &type, buffer.data());
+		std::string name(buffer.data(), length);
+
+		// Members of uniform blocks have no location and are filled via buffer
+		Uniform uniform;
+		uniform.location = glGetUniformLocation(_program, name.c_str());
+		if (uniform.location < 0) { continue; }
+
+		// Arrays are reported with index of first element, make them available by plain name
+		if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+		{
+			name.erase(name.size() - 3);
+		}
+
+		_handles[name] = (Handle)_uniforms.size();
+		_uniforms.push_back(uniform);
+	}
+
+	// Bind block with values shared by frame
+	GLuint blockIndex = glGetUniformBlockIndex(_program, FRAME_UNIFORM_BLOCK_NAME);
+	if (blockIndex != GL_INVALID_INDEX)
+	{
+		glUniformBlockBinding(_program, blockIndex, FRAME_UNIFORM_BLOCK_BINDING);
+	}
+}
+
+GLint Shader::Prepare(Handle handle, const void* pValue, size_t size) const
+{
+	// Uniforms which are not active are ignored by OpenGL, too
+	if (handle < 0 || handle >= (Handle)_uniforms.size()) { return -1; }
+
+	// Compare with last upload
+	Uniform& rUniform = _uniforms[handle];
+	if (rUniform.uploaded && std::memcmp(rUniform.values, pValue, size) == 0)
+	{
+		_statistics.skipped++;
+		return -1;
+	}
+	std::memcpy(rUniform.values, pValue, size);
+	rUniform.uploaded = true;
+	_statistics.uploads++;
+	return rUniform.location;
 }
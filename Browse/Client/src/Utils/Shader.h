@@ -2,7 +2,10 @@
 // Distributed under the Apache License, Version 2.0.
 // Author: Raphael Menges (raphaelmenges@uni-koblenz.de)
 //============================================================================
-// Quad to render with OpenGL.
+// Quad to render with OpenGL. Active uniforms are resolved once after
+// linking and values are only uploaded when they differ from the last one.
+// Programs declaring the frame uniform block are bound to the uniform buffer
+// with values that change per frame, see FrameUniforms.h.
 
 #ifndef SHADER_H_
 #define SHADER_H_
@@ -10,11 +13,24 @@
 #include "externals/OGL/gl_core_3_3.h"
 #include "src/Utils/glmWrapper.h"
 #include <string>
+#include <vector>
+#include <map>
 
 class Shader
 {
 public:
 
+	// Handle of uniform, negative if not active in program
+	typedef int Handle;
+
+	// Statistics about updates of values, summed over all shaders
+	struct Statistics
+	{
+		unsigned int lookups = 0; // updates by name, each resolved location with the driver before caching
+		unsigned int uploads = 0; // values handed to the driver
+		unsigned int skipped = 0; // values equal to last upload
+	};
+
     // Constructor
     Shader(std::string vertSource, std::string fragSource);
     Shader(std::string vertSource, std::string geomSource, std::string fragSource);
@@ -25,7 +41,18 @@ public:
     // Bind shader program
     void Bind() const;
 
+	// Get handle of uniform for updating its value. Negative if uniform is not active
+	Handle GetHandle(std::string name) const;
+
     // Update values in shader. Bind before updating!
+    void UpdateValue(Handle handle, const int& rValue) const;
+    void UpdateValue(Handle handle, const float& rValue) const;
+    void UpdateValue(Handle handle, const glm::vec2& rValue) const;
+    void UpdateValue(Handle handle, const glm::vec3& rValue) const;
+    void UpdateValue(Handle handle, const glm::vec4& rValue) const;
+    void UpdateValue(Handle handle, const glm::mat4& rValue) const;
+
+	// Update values in shader by name, looking up handle first. Bind before updating!
     void UpdateValue(std::string name, const int& rValue) const;
     void UpdateValue(std::string name, const float& rValue) const;
     void UpdateValue(std::string name, const glm::vec2& rValue) const;
@@ -36,10 +63,39 @@ public:
     // Get program handle
     GLuint GetProgram() const { return _program; }
 
+	// Get statistics of all shaders since last reset
+	static Statistics GetStatistics() { return _statistics; }
+
+	// Reset statistics of all shaders
+	static void ResetStatistics() { _statistics = Statistics(); }
+
 private:
 
+	// Active uniform with last uploaded value
+	struct Uniform
+	{
+		GLint location = -1;
+		bool uploaded = false;
+		float values[16]; // large enough for a mat4, integers are stored bitwise
+	};
+
+	// Resolve active uniforms and bind uniform blocks after linking
+	void ResolveUniforms();
+
+	// Check whether value differs from last upload and remember it. Returns location to upload to or -1
+	GLint Prepare(Handle handle, const void* pValue, size_t size) const;
+
     // Handle
     GLuint _program = 0;
+
+	// Active uniforms, indexed by handle
+	mutable std::vector<Uniform> _uniforms;
+
+	// Handles by name of uniform
+	std::map<std::string, Handle> _handles;
+
+	// Statistics of all shaders
+	static Statistics _statistics;
 };
 
 
@@ -116,6 +116,7 @@ void Texture::Fill(
         glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, _width, _height, inputFormat, GL_UNSIGNED_BYTE, pBuffer);
     }
     glPixelStorei(GL_UNPACK_ALIGNMENT, 4); // set back to standard
+    _revision++;
 
     // Unbind texture
     glBindTexture(GL_TEXTURE_2D, 0);
@@ -136,6 +137,20 @@ float Texture::GetAspectRatio() const
     return ((float)_width) / ((float)_height);
 }
 
+size_t Texture::GetMemoryUsage() const
+{
+    if (!_initialized) { return 0; }
+
+    // Base level and, once generated, every mip map level down to one pixel
+    size_t memoryUsage = 0;
+    int levels = _mipMapsGenerated ? MaximalMipMapLevel(_width, _height) + 1 : 1;
+    for (int i = 0; i < levels; i++)
+    {
+        memoryUsage += (size_t)glm::max(_width >> i, 1) * (size_t)glm::max(_height >> i, 1) * 4;
+    }
+    return memoryUsage;
+}
+
 glm::vec4 Texture::GetAverageColor() const
 {
 	// TODO: depending on internal format...
@@ -144,6 +159,7 @@ glm::vec4 Texture::GetAverageColor() const
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, _handle);
 	glGenerateMipmap(GL_TEXTURE_2D);
+	_mipMapsGenerated = _mipMapsGenerated || _initialized;
 
     // Calculate count of levels
 	GLint maxLevel = MaximalMipMapLevel(_width, _height);
@@ -194,6 +210,7 @@ bool Texture::GetPixelsFromMipMap(int layer, int& rWidth, int& rHeight, std::vec
 		glActiveTexture(GL_TEXTURE0);
 		glBindTexture(GL_TEXTURE_2D, _handle);
 		glGenerateMipmap(GL_TEXTURE_2D);
+		_mipMapsGenerated = true;
 
 		// Calculate resolution
 		layer = glm::clamp(layer, 0, MaximalMipMapLevel(_width, _height) - 1);
@@ -237,6 +254,7 @@ void Texture::drawRectangle(int width, int height, int x, int y)
 	glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, 3, height, GL_BGRA, GL_UNSIGNED_BYTE, &img[0]);
 	glTexSubImage2D(GL_TEXTURE_2D, 0, x+width, y, 3, height, GL_BGRA, GL_UNSIGNED_BYTE, &img[0]);
 	glTexSubImage2D(GL_TEXTURE_2D, 0, x, y+height, width, 3, GL_BGRA, GL_UNSIGNED_BYTE, &img[0]);
+	_revision++;
 
 
 	// Unbind texture
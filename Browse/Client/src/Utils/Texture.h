@@ -60,6 +60,13 @@ public:
     // Getter for aspect ratio
     float GetAspectRatio() const;
 
+    // Get memory allocated for texture in bytes, assuming four bytes per pixel. Includes mip map
+    // levels once they have been generated. Zero if not yet filled
+    size_t GetMemoryUsage() const;
+
+    // Get revision of content, increased whenever texture is filled or drawn into
+    unsigned int GetRevision() const { return _revision; }
+
     // Get average color in texture (mip map is calculated)
     glm::vec4 GetAverageColor() const;
 
@@ -78,6 +85,8 @@ private:
     int _width = 0;
     int _height = 0;
     GLenum _internalFormat;
+    unsigned int _revision = 0;
+    mutable bool _mipMapsGenerated = false; // mip map levels are allocated by first generation
 };
 
 #endif // TEXTURE_H_
@@ -13,6 +13,7 @@
 
 #include "src/Master/Master.h"
 #include "src/Utils/Logger.h"
+#include "src/Setup.h"
 
 
 // Execute function to have Master object on stack which might be faster than on heap
@@ -74,9 +75,18 @@ int CommonMain(const CefMainArgs& args, CefSettings settings, CefRefPtr<MainCefA
 	settings.windowless_rendering_enabled = true;
 	settings.remote_debugging_port = 8088;
 
+	// Decide how CEF's message loop is driven
+	settings.multi_threaded_message_loop = setup::CEF_MULTI_THREADED_MESSAGE_LOOP;
+	settings.external_message_pump = setup::CEF_EXTERNAL_MESSAGE_PUMP && !setup::CEF_MULTI_THREADED_MESSAGE_LOOP;
+
     // Initialize CEF
     LogInfo("Initializing CEF...");
     CefInitialize(args, settings, app.get(), windows_sandbox_info);
+	if (setup::CEF_MULTI_THREADED_MESSAGE_LOOP)
+	{
+		// Context is initialized asynchronously on CEF's UI thread
+		app->WaitForContextInitialization();
+	}
     LogInfo("..done.");
 
     // Execute our code
@@ -0,0 +1,293 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// Benchmark of eyeGUI as used by Tweet. Renders the benchmark layout for some
+// frames and prints CPU time of update and drawing, layout time of a text block
+// with 10k words, instantiation time of bricks, suggestion latency per
+// keystroke with 500k words and time per step of resizing window, floating
+// frame and adaptive scaling, then exits. The generated dictionary is written
+// to the temporary directory of the system, not into the content folder.
+
+#include "externals/eyeGUI-development/include/eyeGUI.h"
+#include "externals/OGL/gl_core_3_3.h"
+#include "externals/GLFW/include/GLFW/glfw3.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Frames to warm up (loading of layout and icons) and to measure
+const int WARMUP_FRAMES = 10;
+const int MEASURED_FRAMES = 500;
+
+// Callback to receive information from eyeGUI
+void printCallback(std::string message)
+{
+    std::cout << message << std::endl;
+}
+
+// Milliseconds since given time point
+double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Directory for temporary files of the system
+std::string temporaryDirectory()
+{
+#ifdef _WIN32
+    const char* pDirectory = std::getenv("TEMP");
+#else
+    const char* pDirectory = std::getenv("TMPDIR");
+#endif
+    return pDirectory != NULL ? std::string(pDirectory) : std::string("/tmp");
+}
+
+// Update and draw benchmark layout, further invisible copies stand in for layouts of background tabs
+void benchmarkFrames(GLFWwindow* window, eyegui::GUI* pGUI)
+{
+    eyegui::addLayout(pGUI, "layout_Benchmark.xeyegui");
+    const int tabs = 30;
+    for (int i = 1; i < tabs; i++) {
+        eyegui::addLayout(pGUI, "layout_Benchmark.xeyegui", 0, false);
+    }
+
+    double sum = 0, minimum = 0, maximum = 0, updateSum = 0;
+    eyegui::Input input;
+    for (int i = 0; i < WARMUP_FRAMES + MEASURED_FRAMES; i++) {
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        auto start = std::chrono::steady_clock::now();
+        eyegui::updateGUI(pGUI, 1.f / 60.f, input);
+        double updateMilliseconds = millisecondsSince(start);
+        eyegui::drawGUI(pGUI);
+        double milliseconds = millisecondsSince(start);
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+        if (i < WARMUP_FRAMES) {
+            continue;
+        }
+        sum += milliseconds;
+        updateSum += updateMilliseconds;
+        minimum = (i == WARMUP_FRAMES) ? milliseconds : std::min(minimum, milliseconds);
+        maximum = std::max(maximum, milliseconds);
+    }
+    cout << "Benchmark: " << MEASURED_FRAMES << " frames with " << tabs << " layouts, CPU frame time avg " << (sum / MEASURED_FRAMES)
+        << "ms, min " << minimum << "ms, max " << maximum << "ms, update avg " << (updateSum / MEASURED_FRAMES) << "ms" << endl;
+}
+
+// Layout of text block with 10k words in 100 paragraphs, first completely and then after small edits.
+// Afterwards, bricks are instantiated into the same layout, each with own ids
+void benchmarkTextAndBricks(eyegui::GUI* pGUI)
+{
+    eyegui::Input input;
+    eyegui::Layout* pTextLayout = eyegui::addLayout(pGUI, "layout_BenchmarkText.xeyegui");
+    eyegui::updateGUI(pGUI, 1.f / 60.f, input);
+    std::vector<std::string> paragraphs;
+    for (int i = 0; i < 100; i++) {
+        std::string paragraph;
+        for (int j = 0; j < 100; j++) {
+            paragraph += (j == 0 ? "word" : " word") + std::to_string((i * 100 + j) % 997);
+        }
+        paragraphs.push_back(paragraph);
+    }
+    auto joinParagraphs = [&]() {
+        std::string text;
+        for (size_t i = 0; i < paragraphs.size(); i++) {
+            text += (i == 0 ? "" : "\n") + paragraphs[i];
+        }
+        return text;
+    };
+    auto textStart = std::chrono::steady_clock::now();
+    eyegui::setContentOfTextBlock(pTextLayout, "text", joinParagraphs());
+    double completeLayout = millisecondsSince(textStart);
+    const int edits = 100;
+    double editSum = 0;
+    for (int i = 0; i < edits; i++) {
+        paragraphs[50] += " edit";
+        std::string text = joinParagraphs();
+        textStart = std::chrono::steady_clock::now();
+        eyegui::setContentOfTextBlock(pTextLayout, "text", text);
+        editSum += millisecondsSince(textStart);
+    }
+    cout << "Benchmark: text block with 10k words, complete layout " << completeLayout
+        << "ms, layout after edit avg " << (editSum / edits) << "ms" << endl;
+
+    const int bricks = 500;
+    auto brickStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < bricks; i++) {
+        std::map<std::string, std::string> idMapper;
+        idMapper["likeButton"] = "likeButton" + std::to_string(i);
+        eyegui::addFloatingFrameWithBrick(pTextLayout, "bricks/likeButton.beyegui", 0.1f * (i % 10), 0.1f * ((i / 10) % 10), 0.1f, 0.1f, idMapper);
+    }
+    cout << "Benchmark: " << bricks << " bricks instantiated in " << millisecondsSince(brickStart) << "ms" << endl;
+}
+
+// Suggestions per keystroke with dictionary of 500k generated words, ordered like by frequency
+void benchmarkSuggestions(eyegui::GUI* pGUI)
+{
+    const std::vector<std::string> syllables = { "ka", "ri", "to", "men", "sa", "lo", "ver", "in", "ta", "ne",
+        "ro", "di", "la", "mi", "son", "pa", "ge", "ti", "ber", "co", "an", "el", "us", "or", "qu", "fe", "ni", "ha", "st", "ple" };
+    std::mt19937 generator(42);
+    std::set<std::string> generatedWords;
+    std::vector<std::string> dictionaryWords;
+    while (dictionaryWords.size() < 500000) {
+        std::string word;
+        int count = 2 + generator() % 3;
+        for (int i = 0; i < count; i++) {
+            word += syllables[generator() % syllables.size()];
+        }
+        if (generatedWords.insert(word).second) {
+            dictionaryWords.push_back(word);
+        }
+    }
+
+    // Dictionary is loaded relative to root filepath, so point it to temporary directory while loading
+    const std::string dictionaryDirectory = temporaryDirectory();
+    const std::string dictionaryFilename = "eyeGUIBenchmarkDictionary.txt";
+    const std::string dictionaryFilepath = dictionaryDirectory + "/" + dictionaryFilename;
+    {
+        std::ofstream dictionaryFile(dictionaryFilepath);
+        for (const std::string& rWord : dictionaryWords) {
+            dictionaryFile << rWord << "\n";
+        }
+    }
+    eyegui::setRootFilepath(dictionaryDirectory);
+    auto dictionaryStart = std::chrono::steady_clock::now();
+    unsigned int dictionary = eyegui::addDictionary(pGUI, dictionaryFilename);
+    double dictionaryLoad = millisecondsSince(dictionaryStart);
+    eyegui::setRootFilepath(CONTENT_PATH);
+    std::remove(dictionaryFilepath.c_str());
+    eyegui::Layout* pSuggestLayout = eyegui::addLayout(pGUI, "layout_BenchmarkSuggest.xeyegui");
+
+    // Type words letter by letter, every third with a typo. Once waiting for the best suggestion and
+    // once with search in the background, which only costs the frame its request and collection
+    eyegui::Input input;
+    for (int background = 0; background < 2; background++) {
+        std::vector<double> keystrokes;
+        for (int i = 0; i < 30; i++) {
+            std::string word = dictionaryWords[(i * 16661) % dictionaryWords.size()];
+            if (i % 3 == 2) {
+                word[word.size() / 2] = 'x';
+            }
+            for (size_t j = 1; j <= word.size(); j++) {
+                std::string bestSuggestion;
+                auto keystrokeStart = std::chrono::steady_clock::now();
+                if (background) {
+                    eyegui::suggestWords(pSuggestLayout, "suggest", word.substr(0, j), dictionary);
+                } else {
+                    eyegui::suggestWords(pSuggestLayout, "suggest", word.substr(0, j), dictionary, bestSuggestion);
+                }
+                eyegui::updateGUI(pGUI, 1.f / 60.f, input);
+                keystrokes.push_back(millisecondsSince(keystrokeStart));
+            }
+        }
+        std::sort(keystrokes.begin(), keystrokes.end());
+        double keystrokeSum = 0;
+        for (double keystroke : keystrokes) {
+            keystrokeSum += keystroke;
+        }
+        cout << "Benchmark: " << dictionaryWords.size() << " words loaded in " << dictionaryLoad << "ms, "
+            << (background ? "suggestions in background" : "suggestions with best one") << " per keystroke avg " << (keystrokeSum / keystrokes.size())
+            << "ms, p95 " << keystrokes[keystrokes.size() * 95 / 100] << "ms, max " << keystrokes.back() << "ms" << endl;
+    }
+}
+
+// Resizing in own GUI, time per step includes update and drawing of the frame showing the result
+void benchmarkResizing(GLFWwindow* window, eyegui::GUI* pGUI)
+{
+    eyegui::Input input;
+    eyegui::Layout* pResizeLayout = eyegui::addLayout(pGUI, "layout_BenchmarkResize.xeyegui");
+    unsigned int resizeFrame = eyegui::addFloatingFrameWithBrick(pResizeLayout, "bricks/WallContentArea/wall_Content_Brick.beyegui", 0.5f, 0.2f, 0.4f, 0.4f);
+
+    // Images of brick are decoded in background, so warm up longer to not measure their upload
+    for (int i = 0; i < 10 * WARMUP_FRAMES; i++) {
+        eyegui::updateGUI(pGUI, 1.f / 60.f, input);
+        eyegui::drawGUI(pGUI);
+    }
+    const int resizeSteps = 60;
+    auto measureResizeSteps = [&](std::string name, float tpf, eyegui::Input stepInput, std::function<void(int)> step) {
+        double stepSum = 0, stepMaximum = 0;
+        for (int i = 0; i < resizeSteps; i++) {
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            auto stepStart = std::chrono::steady_clock::now();
+            step(i);
+            eyegui::updateGUI(pGUI, tpf, stepInput);
+            eyegui::drawGUI(pGUI);
+            double milliseconds = millisecondsSince(stepStart);
+            glfwSwapBuffers(window);
+            glfwPollEvents();
+            stepSum += milliseconds;
+            stepMaximum = std::max(stepMaximum, milliseconds);
+        }
+        cout << "Benchmark: " << resizeSteps << " steps of " << name << ", per step avg " << (stepSum / resizeSteps)
+            << "ms, max " << stepMaximum << "ms" << endl;
+    };
+
+    // Window dragged by mouse, time per frame is long enough to skip waiting for further resizing
+    measureResizeSteps("window resizing", 0.5f, input, [&](int i) {
+        eyegui::resizeGUI(pGUI, 1280 - 4 * (i % 20), 800 - 2 * (i % 20));
+    });
+
+    // Floating frame dragged by mouse, which reports several positions per frame
+    measureResizeSteps("floating frame resizing", 1.f / 60.f, input, [&](int i) {
+        for (int j = 1; j <= 3; j++) {
+            float size = 0.4f + 0.002f * (3 * (i % 20) + j);
+            eyegui::setSizeOfFloatingFrame(pResizeLayout, resizeFrame, size, size);
+        }
+    });
+
+    // Gaze upon first button of top row, whose adaptive scaling changes the stack every frame
+    eyegui::Input gazeInput;
+    gazeInput.gazeX = 40;
+    gazeInput.gazeY = 80;
+    measureResizeSteps("adaptive scaling", 1.f / 60.f, gazeInput, [](int) {});
+}
+
+int main() {
+    // GLFW
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+
+    // Window with resolution of Tweet, without vertical sync to not measure waiting for it
+    GLFWwindow* window = glfwCreateWindow(1280, 800, "GazeTheWeb - Tweet - eyeGUI Benchmark", NULL, NULL);
+    glfwMakeContextCurrent(window);
+    ogl_LoadFunctions();
+    glfwSwapInterval(0);
+
+    // Setup eyeGUI like Tweet
+    eyegui::setRootFilepath(CONTENT_PATH);
+    eyegui::setErrorCallback(&printCallback);
+    eyegui::setWarningCallback(&printCallback);
+    eyegui::GUIBuilder builder;
+    builder.width = 1280;
+    builder.height = 800;
+    builder.fontFilepath = "font/Oxygen-Sans.ttf";
+
+    // Benchmarks on shared GUI
+    eyegui::GUI* pGUI = builder.construct();
+    benchmarkFrames(window, pGUI);
+    benchmarkTextAndBricks(pGUI);
+    benchmarkSuggestions(pGUI);
+    eyegui::terminateGUI(pGUI);
+
+    // Resizing in own GUI
+    eyegui::GUI* pResizeGUI = builder.construct();
+    benchmarkResizing(window, pResizeGUI);
+    eyegui::terminateGUI(pResizeGUI);
+
+    glfwTerminate();
+    return 0;
+}
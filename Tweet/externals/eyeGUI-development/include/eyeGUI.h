@@ -213,8 +213,11 @@ namespace eyegui
         int height = 720; //!< Height of GUI as integer
         std::string fontFilepath = ""; //!< FontFilepath is path to a .ttf font file
         CharacterSet characterSet = CharacterSet::US_ENGLISH; //!< CharacterSet used to initialize font rendering
+        bool prewarmGlyphs = false; //!< Render glyphs of character set at startup instead of at first usage
         std::string localizationFilepath = ""; //!< LocalizationFilepath is path to a .leyegui file
         float vectorGraphicsDPI = 96.0f; //!< Dpi which are used to rasterize vector graphics
+        std::string vectorGraphicsCacheFilepath = ""; //!< Path to file which keeps rasterized vector graphics between runs, not relative to root. Empty disables caching
+        unsigned int vectorGraphicsCacheSize = 64; //!< Maximal size of vector graphics cache file in megabytes
         float fontTallSize = 0.1f; //!< Height of tall font in percentage of GUI height
         float fontMediumSize = 0.04f; //!< Height of medium font in percentage of GUI height
         float fontSmallSize = 0.0175f; //!< Height of small font in percentage of GUI height
@@ -301,13 +304,20 @@ namespace eyegui
     */
     void setDescriptionVisibility(GUI* pGUI, DescriptionVisibility visbility);
 
-    //! Prefetch image to avoid lags.
+    //! Prefetch image to avoid lags. Image is decoded in the background and uploaded while updating the GUI.
     /*!
       \param pGUI pointer to GUI.
       \param filepath is path to image which should be prefetched.
     */
     void prefetchImage(GUI* pGUI, std::string filepath);
 
+    //! Prefetch all images referenced by layout or brick file, so they are decoded before layout is added.
+    /*!
+      \param pGUI pointer to GUI.
+      \param filepath is path to layout or brick file whose images should be prefetched.
+    */
+    void prefetchImagesOfFile(GUI* pGUI, std::string filepath);
+
     //! Add dictionary which can be used for text suggestions.
     /*!
       \param pGUI pointer to GUI.
@@ -699,7 +709,7 @@ namespace eyegui
     */
     void setKeymapOfKeyboard(Layout* pLayout, std::string id, unsigned int keymapIndex);
 
-    //! Give input to word suggest element.
+    //! Give input to word suggest element. Suggestions are searched in the background and shown when available.
     /*!
     \param pLayout pointer to layout.
     \param id is the unique id of an element.
@@ -708,7 +718,7 @@ namespace eyegui
     */
     void suggestWords(Layout* pLayout, std::string id, std::u16string input, unsigned int dictionaryIndex);
 
-    //! Give input to word suggest element.
+    //! Give input to word suggest element. Suggestions are searched in the background and shown when available.
     /*!
     \param pLayout pointer to layout.
     \param id is the unique id of an element.
@@ -34,8 +34,8 @@ namespace eyegui
     static const std::string LOCALIZATION_EXTENSION = "leyegui";
     static const int NOTIFICATION_MAX_LOOP_COUNT = 10;
     static const float ACCUMULATED_TIME_PERIOD = 1800.0f;
-    static const float FONT_CHARACTER_PADDING = 0.07f; // percentage of height
-    static const int FONT_MINIMAL_CHARACTER_PADDING = 2;
+    static const int FONT_REFERENCE_PIXEL_HEIGHT = 64; // glyphs are rendered once at this height and scaled to font sizes
+    static const int FONT_DISTANCE_FIELD_SPREAD = 8; // distance in pixels at reference height encoded around glyphs
     static const float RESIZE_WAIT_DURATION = 0.3f;
     static const glm::vec4 RESIZE_BLEND_COLOR = glm::vec4(0.75f, 0.75f, 0.75f, 0.75f);
     static const std::u16string LOCALIZATION_NOT_FOUND = u"";
@@ -48,11 +48,15 @@ namespace eyegui
     static const float KEY_MIN_SCALE = 0.5f;
     static const char16_t FONT_FALLBACK_CHARACTER = u' ';
     static const float FONT_KEYBOARD_SIZE = 0.1f; // percentage of screen height
+    static const int FONT_ATLAS_SHELF_GLYPHS = 16; // width of font atlas in glyphs of full height
+    static const int FONT_ATLAS_PAGE_SHELVES = 4; // height of one page of font atlas in shelves of full height
+    static const uint FONT_ATLAS_MAX_PAGES = 8; // least recently used page is evicted when all are full
     static const uint DICTIONARY_MAX_FOLLOWING_WORDS = 2; // maximal count of words for each fully collected one serving as prefix
     static const uint DICTIONARY_INPUT_REPEAT_IGNORE_DEPTH = 1; // "Aaal" -> "Aal"
     static const uint DICTIONARY_INPUT_REPEAT_PAUSE_DEPTH = 3; // "Al" -> "Aal". Important for fast typing because no repeating letters in input
     static const uint DICTIONARY_INPUT_PAUSE_DEPTH = 0; // "Hus" -> "Haus"
     static const uint DICTIONARY_INPUT_IGNORE_DEPTH = 1; // "Huus" -> "Haus"
+    static const uint DICTIONARY_CANCEL_CHECK_INTERVAL = 256; // count of search states or found words between checks for cancellation
     static const uint WORD_SUGGEST_MAX_SUGGESTIONS = 10;
     static const float WORD_SUGGEST_SCROLL_SPEED = 1.5f;
     static const float WORD_SUGGEST_THRESHOLD_SPEED = 0.75f;
@@ -61,6 +65,17 @@ namespace eyegui
     static const float WORD_SUGGEST_SUGGESTION_DISTANCE = 4; // in size of letter which represents space
 	static const float TEXT_BACKGROUND_SIZE = 1.1f;
 	static const float GRID_FILL_EPSILON = 0.01f;  // since floating point precision does not sum everything to 100%
+    static const uint DRAW_BATCHER_MAX_LOOKBACK = 256; // count of enqueued batches searched for one to join
+    static const int ICON_ATLAS_PAGE_SIZE = 1024; // width and height of one page of icon atlas in pixels
+    static const uint ICON_ATLAS_MAX_PAGES = 4;
+    static const int ICON_ATLAS_MAX_ICON_SIZE = 256; // bigger icons are drawn from own texture
+    static const int ICON_ATLAS_PADDING = 8; // repeated border pixels around icon, covers mipmap levels up to three
+    static const uint TEXT_WORD_CACHE_MAX_WORDS = 65536; // cache of word geometry is cleared when full
+    static const uint IMAGE_LOADER_MAX_THREADS = 4; // workers decoding image files in the background
+    static const float IMAGE_UPLOAD_FRAME_BUDGET = 0.004f; // seconds per frame spent on uploading decoded images, at least one slice is uploaded
+    static const uint IMAGE_UPLOAD_SLICE_PIXELS = 65536; // pixels of decoded image uploaded at once
+    static const std::string VECTOR_GRAPHICS_CACHE_MAGIC = "EGVC"; // first bytes of cache file
+    static const uint VECTOR_GRAPHICS_CACHE_VERSION = 1; // increment when layout of cache file changes
 }
 
 #endif // DEFINES_H_
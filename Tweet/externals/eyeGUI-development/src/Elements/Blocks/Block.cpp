@@ -44,11 +44,6 @@ namespace eyegui
         mConsumeInput = consumeInput;
         mInnerBorder = innerBorder;
 
-        // Fetch render item
-        mpBackground = mpAssetManager->fetchRenderItem(
-            shaders::Type::COLOR,
-            meshes::Type::QUAD);
-
         // Fetch background image if one is wanted
         if(backgroundFilepath != EMPTY_STRING_ATTRIBUTE)
         {
@@ -72,11 +67,10 @@ namespace eyegui
         // Draw simple background color
         if (getStyle()->backgroundColor.a > 0)
         {
-            mpBackground->bind();
-            mpBackground->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpBackground->getShader()->fillValue("color", getStyle()->backgroundColor);
-            mpBackground->getShader()->fillValue("alpha", mAlpha);
-            mpBackground->draw();
+            DrawBatcher::Instance instance;
+            instance.color = getStyle()->backgroundColor;
+            instance.values.y = mAlpha;
+            mpAssetManager->getDrawBatcher()->enqueue(shaders::Type::COLOR, mFullDrawMatrix, 0, 0, instance);
         }
 
         // Draw background image if available
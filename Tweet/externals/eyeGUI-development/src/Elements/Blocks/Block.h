@@ -64,7 +64,6 @@ namespace eyegui
     private:
 
         // Members
-        RenderItem const * mpBackground;
         std::unique_ptr<Image> mupImage;
         float mInnerBorder; // [0..1]
         bool mConsumeInput;
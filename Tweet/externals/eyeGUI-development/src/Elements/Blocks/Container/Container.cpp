@@ -189,6 +189,18 @@ namespace eyegui
         }
     }
 
+    bool Container::specialSettled() const
+    {
+        for (const std::unique_ptr<Element>& rupElement : mChildren)
+        {
+            if (!rupElement->isSleeping())
+            {
+                return false;
+            }
+        }
+        return Block::specialSettled();
+    }
+
     void Container::drawChildren() const
     {
         // Draw children
@@ -67,6 +67,9 @@ namespace eyegui
         // Reset filled by subclasses
         virtual void specialReset();
 
+        // Settled when all children are sleeping
+        virtual bool specialSettled() const;
+
         // Draw on top of element (used for drawing children over effects like marking)
         virtual void drawChildren() const;
 
@@ -57,6 +57,13 @@ namespace eyegui
         mMarking = false;
         mMark.setValue(0);
         mRenderingMask = renderingMask;
+        mSleeping = false;
+        mResizeNecessary = true;
+        mAvailableX = 0;
+        mAvailableY = 0;
+        mAvailableWidth = 0;
+        mAvailableHeight = 0;
+        mResizeGeneration = 0;
 
         // Decide about dimming
         mDimming = dimming;
@@ -80,10 +87,16 @@ namespace eyegui
             mpStyle = mpLayout->getStyleFromStylesheet(DEFAULT_STYLE_NAME);
         }
 
-        // Render items
-        mpActivityItem = mpAssetManager->fetchRenderItem(shaders::Type::ACTIVITY, meshes::Type::QUAD);
-        mpDimItem = mpAssetManager->fetchRenderItem(shaders::Type::DIM, meshes::Type::QUAD);
-        mpMarkItem = mpAssetManager->fetchRenderItem(shaders::Type::MARK, meshes::Type::QUAD);
+        // Mask used by shaders of element
+        switch (mRenderingMask)
+        {
+        case RenderingMask::BOX:
+            mpMask = mpAssetManager->fetchTexture(graphics::Type::BOX);
+            break;
+        case RenderingMask::CIRCLE:
+            mpMask = mpAssetManager->fetchTexture(graphics::Type::CIRCLE);
+            break;
+        }
     }
 
     Element::~Element()
@@ -167,6 +180,7 @@ namespace eyegui
         if(pStyle != NULL)
         {
             mpStyle = pStyle;
+            wake();
         }
         else
         {
@@ -182,6 +196,7 @@ namespace eyegui
     void Element::setAlpha(float alpha)
     {
         mAlpha = alpha;
+        wake();
     }
 
     float Element::getAlpha() const
@@ -191,6 +206,7 @@ namespace eyegui
 
     void Element::setActivity(bool active, bool fade)
     {
+        wake();
         if (active)
         {
             if (mpParent->isActive())
@@ -219,6 +235,7 @@ namespace eyegui
     void Element::setDimming(bool dimming)
     {
         mDimming = dimming;
+        wake();
     }
 
     bool Element::isDimming() const
@@ -229,6 +246,7 @@ namespace eyegui
     void Element::setMarking(bool marking, int depth)
     {
         mMarking = marking;
+        wake();
     }
 
     bool Element::isMarking() const
@@ -289,6 +307,24 @@ namespace eyegui
 
     void Element::transformAndSize(int x, int y, int width, int height)
     {
+        // Keep transformation, meshes and those of children when given space is the same
+        uint generation = mpLayout->getResizeGeneration();
+        if (!mResizeNecessary
+            && mResizeGeneration == generation
+            && mAvailableX == x
+            && mAvailableY == y
+            && mAvailableWidth == width
+            && mAvailableHeight == height)
+        {
+            return;
+        }
+        mResizeNecessary = false;
+        mResizeGeneration = generation;
+        mAvailableX = x;
+        mAvailableY = y;
+        mAvailableWidth = width;
+        mAvailableHeight = height;
+
         // Use border
         int usedBorder;
         if (width > height)
@@ -339,6 +375,9 @@ namespace eyegui
         // Call method implemented by subclasses
         specialTransformAndSize();
 
+        // Subclasses may react on new size in update
+        wake();
+
         // After calculation transformation, recalculate the matrix for rendering
         mFullDrawMatrix = calculateDrawMatrix(
                             mpLayout->getLayoutWidth(),
@@ -349,6 +388,18 @@ namespace eyegui
                             mHeight);
     }
 
+    void Element::makeResizeNecessary()
+    {
+        // Parents have to pass transformation down to this element
+        Element* pElement = this;
+        while (pElement != NULL)
+        {
+            pElement->mResizeNecessary = true;
+            pElement = pElement->mpParent;
+        }
+        mpFrame->makeResizeNecessary();
+    }
+
     float Element::getDynamicScale() const
     {
         return mRelativeScale + (mAdaptiveScale.getValue() * mpLayout->getConfig()->maximalAdaptiveScaleIncrease);
@@ -367,21 +418,40 @@ namespace eyegui
     void Element::setHiding(bool hidden)
     {
         mHidden = hidden;
+        wake();
     }
 
     float Element::update(float tpf, float alpha, Input* pInput, float dim)
     {
+        // Check wether cursor is over element
+        bool penetrated = penetratedByInput(pInput);
+
+        // *** SLEEPING ***
+
+        // Skip update of settled element until gaze enters or alpha or dimming from parent changes
+        if (mSleeping)
+        {
+            if (penetrated || alpha != mAlpha || (!mForceUndim && !mDimming && dim != mDim.getValue()))
+            {
+                mSleeping = false;
+            }
+            else
+            {
+                return mAdaptiveScale.getValue();
+            }
+        }
+
         // *** OWN UPDATING ***
 
+        // Remember adaptive scale, parent has to distribute space again when it changes
+        float previousAdaptiveScale = mAdaptiveScale.getValue();
+
         // Activity animation
         mActivity.update(tpf / mpLayout->getConfig()->animationDuration, !mActive);
 
         // Save current alpha (already animated by layout or other element)
         mAlpha = alpha;
 
-        // Check wether cursor is over element
-        bool penetrated = penetratedByInput(pInput);
-
         // Dimming
         if (mForceUndim)
         {
@@ -474,6 +544,15 @@ namespace eyegui
         // Decide, which adaptive scale to save. Own adaptive scale decreases if adaptive scaling is deactivated!
         // If it would be not saved in member, nobody would know about it at rendering.
         mAdaptiveScale.setValue(std::max(mAdaptiveScale.getValue(), specialAdaptiveScale));
+        if (mpParent != NULL && previousAdaptiveScale != mAdaptiveScale.getValue())
+        {
+            mpParent->makeResizeNecessary();
+        }
+
+        // *** SLEEPING ***
+
+        // Fall asleep when settled. Penetrated element stays awake to notice when gaze leaves
+        mSleeping = !penetrated && settled();
 
         // Return adaptive scale
         return mAdaptiveScale.getValue();
@@ -484,54 +563,36 @@ namespace eyegui
         // Only draw if visible
         if (mAlpha > 0 && !mHidden)
         {
-            // Bind mask for that element in first slot
-            // DO NOT BIND ANYTHING ELSE WHILE DRAWING TO SLOT 0 !!!
-            switch (mRenderingMask)
-            {
-            case RenderingMask::BOX:
-                mpAssetManager->fetchTexture(graphics::Type::BOX)->bind(0);
-                break;
-            case RenderingMask::CIRCLE:
-                mpAssetManager->fetchTexture(graphics::Type::CIRCLE)->bind(0);
-                break;
-            }
-
             // Draw content of element
             specialDraw();
 
+            // Overlays are drawn in batches with overlays of other elements
+            DrawBatcher* pDrawBatcher = mpAssetManager->getDrawBatcher();
+
             // Draw marking
             if(mMark.getValue() > 0)
             {
-                mpMarkItem->bind();
-                mpMarkItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-                mpMarkItem->getShader()->fillValue("markColor", getStyle()->markColor);
-                mpMarkItem->getShader()->fillValue("mark", mMark.getValue());
-                mpMarkItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-                mpMarkItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-                mpMarkItem->draw();
+                DrawBatcher::Instance instance;
+                instance.color = getStyle()->markColor;
+                instance.values = glm::vec4(mMark.getValue(), getMultipliedDimmedAlpha(), 0, 0);
+                pDrawBatcher->enqueue(shaders::Type::MARK, mFullDrawMatrix, getMask(), 0, instance);
             }
 
             // Draw activity (or unactivity)
             if(mActivity.getValue() < 1)
             {
-                mpActivityItem->bind();
-                mpActivityItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-                mpActivityItem->getShader()->fillValue("activity", mActivity.getValue());
-                mpActivityItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-                mpMarkItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-                mpActivityItem->draw();
+                DrawBatcher::Instance instance;
+                instance.values = glm::vec4(mActivity.getValue(), getMultipliedDimmedAlpha(), 0, 0);
+                pDrawBatcher->enqueue(shaders::Type::ACTIVITY, mFullDrawMatrix, getMask(), 0, instance);
             }
 
             // Draw dimming
             if(mDim.getValue() > 0)
             {
-                mpDimItem->bind();
-                mpDimItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-                mpDimItem->getShader()->fillValue("dimColor", getStyle()->dimColor);
-                mpDimItem->getShader()->fillValue("dim", mDim.getValue());
-                mpDimItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-                mpMarkItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-                mpDimItem->draw();
+                DrawBatcher::Instance instance;
+                instance.color = getStyle()->dimColor;
+                instance.values = glm::vec4(mDim.getValue(), getMultipliedDimmedAlpha(), 0, 0);
+                pDrawBatcher->enqueue(shaders::Type::DIM, mFullDrawMatrix, getMask(), 0, instance);
             }
 
             drawChildren();
@@ -562,12 +623,19 @@ namespace eyegui
         }
         mForceUndim = false;
 
+        if (mpParent != NULL && mAdaptiveScale.getValue() != 0)
+        {
+            mpParent->makeResizeNecessary();
+        }
         mAdaptiveScale.setValue(0);
 
         // TODO: one could reset marking, too
 
         // Do reset implemented by subclass
         specialReset();
+
+        // Update with reset values
+        wake();
     }
 
     void Element::evaluateSize(
@@ -621,6 +689,7 @@ namespace eyegui
         {
             // Fading is wished, so remember the replaced element
             mupReplacedElement = std::move(upElement);
+            wake();
         }
         else
         {
@@ -645,6 +714,27 @@ namespace eyegui
 		return false;
 	}
 
+    void Element::wake()
+    {
+        mSleeping = false;
+
+        // Sleeping parent would not update this
+        if (mpParent != NULL)
+        {
+            mpParent->wake();
+        }
+    }
+
+    bool Element::isSleeping() const
+    {
+        return mSleeping;
+    }
+
+    bool Element::specialSettled() const
+    {
+        return true;
+    }
+
     bool Element::penetratedByInput(Input const * pInput) const
     {
         // Check whether gaze is upon element
@@ -671,8 +761,38 @@ namespace eyegui
         return mDim.getValue();
     }
 
+    GLuint Element::getMask() const
+    {
+        return mpMask->getHandle();
+    }
+
     float Element::getMultipliedDimmedAlpha() const
     {
         return mAlpha * glm::mix(1.0f , getStyle()->dimAlpha, mDim.getValue());
     }
+
+    bool Element::settled() const
+    {
+        // Replaced element is still fading
+        if (mupReplacedElement.get() != NULL)
+        {
+            return false;
+        }
+
+        // Animations have to be at their targets
+        if (mActivity.getValue() != (mActive ? 1.f : 0.f)
+            || mMark.getValue() != (mMarking ? 1.f : 0.f)
+            || mAdaptiveScale.getValue() > 0)
+        {
+            return false;
+        }
+
+        // Dimming is done when not penetrated
+        if ((mForceUndim && mDim.getValue() > 0) || (!mForceUndim && mDimming && mDim.getValue() < 1))
+        {
+            return false;
+        }
+
+        return specialSettled();
+    }
 }
@@ -13,7 +13,9 @@
 // one parent element which is set to null for the root element of the frame.
 // Transformation and size is calculated using a mechanism first asking the
 // children with "evaluateSize" how much of the available space they would use
-// and then telling all the children their size and transformation.
+// and then telling all the children their size and transformation. Elements
+// keep transformation and meshes when the space given to them did not change,
+// so only subtrees with changed constraints are transformed again.
 
 #ifndef ELEMENT_H_
 #define ELEMENT_H_
@@ -170,9 +172,12 @@ namespace eyegui
         // Get all ids, of children and this node
         std::set<std::string> getAllIds() const;
 
-        // Change transformation and size (pixel values)
+        // Change transformation and size (pixel values). Skipped when nothing changed since last call
         void transformAndSize(int x, int y, int width, int height);
 
+        // Transform element and its parents again at next resizing of frame, even if their space did not change
+        void makeResizeNecessary();
+
         // Get relative and adaptive scale combined to dynamic scale
         float getDynamicScale() const;
 
@@ -188,6 +193,12 @@ namespace eyegui
         // Updating, returns adaptive scale
         float update(float tpf, float alpha, Input* pInput, float dim);
 
+        // Wake up element and its parents, so they are updated again
+        void wake();
+
+        // Whether element has settled and is skipped by updating until woken
+        bool isSleeping() const;
+
         // Drawing
         void draw() const;
 
@@ -235,6 +246,9 @@ namespace eyegui
         // Implemented by subclasses
         virtual bool mayConsumeInput() = 0;
 
+        // Whether animations and interaction of subclass have settled. Only asked when not penetrated by input
+        virtual bool specialSettled() const;
+
         // Checks, whether element is penetrated by input
         virtual bool penetratedByInput(Input const * pInput) const;
 
@@ -245,6 +259,12 @@ namespace eyegui
         float getDim() const;
         float getMultipliedDimmedAlpha() const;
 
+        // Whether own animations and those of subclass have settled
+        bool settled() const;
+
+        // Get OpenGL handle of mask texture used by shaders of element
+        GLuint getMask() const;
+
         // Members
         int mX, mY, mWidth, mHeight; // ONLY PIXEL BASED VALUES HERE
         Type mType;
@@ -273,9 +293,7 @@ namespace eyegui
         std::unique_ptr<Element> mupReplacedElement;
         bool mHidden;
         RenderingMask mRenderingMask;
-        RenderItem const * mpActivityItem;
-        RenderItem const * mpDimItem;
-        RenderItem const * mpMarkItem;
+        Texture const * mpMask;
 
         bool mActive;
         LerpValue mActivity; // [0..1]
@@ -286,6 +304,12 @@ namespace eyegui
         bool mMarking;
         LerpValue mMark; // [0..1]
 
+        bool mSleeping;
+
+        bool mResizeNecessary;
+        int mAvailableX, mAvailableY, mAvailableWidth, mAvailableHeight; // space given at last transformation
+        uint mResizeGeneration; // generation of layout at last transformation
+
     };
 }
 
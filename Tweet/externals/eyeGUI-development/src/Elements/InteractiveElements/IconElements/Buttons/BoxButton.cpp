@@ -44,11 +44,6 @@ namespace eyegui
             isSwitch)
     {
         mType = Type::BOX_BUTTON;
-
-        // Render item
-        mpBoxButtonItem = mpAssetManager->fetchRenderItem(
-            shaders::Type::BOX_BUTTON,
-            meshes::Type::QUAD);
     }
 
     BoxButton::~BoxButton()
@@ -58,17 +53,12 @@ namespace eyegui
 
     void BoxButton::specialDraw() const
     {
-        mpIcon->bind(1);
-        mpBoxButtonItem->bind();
-        mpBoxButtonItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-        mpBoxButtonItem->getShader()->fillValue("color", getStyle()->color);
-        mpBoxButtonItem->getShader()->fillValue("iconColor", getStyle()->iconColor);
-        mpBoxButtonItem->getShader()->fillValue("pressing", getPressing());
-        mpBoxButtonItem->getShader()->fillValue("iconUVScale", iconAspectRatioCorrection());
-        mpBoxButtonItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-        mpBoxButtonItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-        mpBoxButtonItem->getShader()->fillValue("icon", 1);
-        mpBoxButtonItem->draw();
+        DrawBatcher::Instance instance;
+        instance.color = getStyle()->color;
+        instance.secondColor = getStyle()->iconColor;
+        instance.values = glm::vec4(getPressing(), getMultipliedDimmedAlpha(), 0, 0);
+        instance.extra = glm::vec4(iconAspectRatioCorrection(), 0, 0);
+        mpAssetManager->getDrawBatcher()->enqueueIcon(shaders::Type::BOX_BUTTON, mFullDrawMatrix, getMask(), mpIcon, instance);
 
         // Super call (draw highlight etc. on top)
         Button::specialDraw();
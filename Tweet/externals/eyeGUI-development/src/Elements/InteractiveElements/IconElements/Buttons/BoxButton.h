@@ -42,11 +42,6 @@ namespace eyegui
 
         // Drawing filled by subclasses
         virtual void specialDraw() const;
-
-    private:
-
-        // Members
-        RenderItem const * mpBoxButtonItem;
     };
 }
 
@@ -59,14 +59,14 @@ namespace eyegui
         mThreshold.setValue(0);
         mPressing.setValue(0);
 
-        // Render items
+        // Shader of threshold
         if(mUseCircleThreshold)
         {
-            mpThresholdItem = mpAssetManager->fetchRenderItem(shaders::Type::CIRCLE_THRESHOLD, meshes::Type::QUAD);
+            mThresholdShader = shaders::Type::CIRCLE_THRESHOLD;
         }
         else
         {
-            mpThresholdItem = mpAssetManager->fetchRenderItem(shaders::Type::BOX_THRESHOLD, meshes::Type::QUAD);
+            mThresholdShader = shaders::Type::BOX_THRESHOLD;
         }
     }
 
@@ -96,6 +96,9 @@ namespace eyegui
 
     void Button::down(bool immediately)
     {
+        // Pressing has to be animated
+        wake();
+
         if (!mIsDown && isActive())
         {
             // Remove highlight
@@ -117,6 +120,9 @@ namespace eyegui
 
     void Button::up(bool immediately)
     {
+        // Pressing has to be animated
+        wake();
+
         if (mIsDown && (isActive() || !mIsSwitch))
         {
             // Remove highlight
@@ -198,11 +204,9 @@ namespace eyegui
     {
         if(mThreshold.getValue() > 0)
         {
-            mpThresholdItem->bind();
-            mpThresholdItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpThresholdItem->getShader()->fillValue("thresholdColor", getStyle()->thresholdColor);
-            mpThresholdItem->getShader()->fillValue("threshold", mThreshold.getValue());
-            mpThresholdItem->getShader()->fillValue("alpha", mAlpha);
+            DrawBatcher::Instance instance;
+            instance.color = getStyle()->thresholdColor;
+            instance.values = glm::vec4(mThreshold.getValue(), mAlpha, 0, 0);
             if(!mUseCircleThreshold)
             {
                 float orientation = 0;
@@ -213,10 +217,9 @@ namespace eyegui
                         orientation = 1;
                     }
                 }
-                mpThresholdItem->getShader()->fillValue("orientation", orientation);
+                instance.values.z = orientation;
             }
-            mpThresholdItem->getShader()->fillValue("mask", 0); // mask is always in slot 0
-            mpThresholdItem->draw();
+            mpAssetManager->getDrawBatcher()->enqueue(mThresholdShader, mFullDrawMatrix, getMask(), 0, instance);
         }
 
 		// Super call
@@ -232,6 +235,18 @@ namespace eyegui
         mPressing.setValue(0);
     }
 
+    bool Button::specialSettled() const
+    {
+        // Button which is no switch goes up again after being pressed
+        if (mIsDown && !mIsSwitch)
+        {
+            return false;
+        }
+        return mThreshold.getValue() == 0
+            && mPressing.getValue() == (mIsDown ? 1.f : 0.f)
+            && IconElement::specialSettled();
+    }
+
     void Button::specialInteract()
     {
         // Hit button
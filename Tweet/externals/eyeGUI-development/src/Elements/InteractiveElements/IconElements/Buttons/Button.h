@@ -64,6 +64,9 @@ namespace eyegui
         // Reset filld by subclasses
         virtual void specialReset();
 
+        // Whether threshold and pressing have settled
+        virtual bool specialSettled() const;
+
         // Interaction fill by subclasses
         virtual void specialInteract();
 
@@ -81,7 +84,7 @@ namespace eyegui
         bool mIsSwitch;
         LerpValue mThreshold; // [0..1]
         LerpValue mPressing; // [0..1]
-        RenderItem const * mpThresholdItem;
+        shaders::Type mThresholdShader;
     };
 }
 
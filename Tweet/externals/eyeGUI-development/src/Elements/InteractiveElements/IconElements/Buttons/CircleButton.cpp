@@ -44,9 +44,6 @@ namespace eyegui
             isSwitch)
     {
         mType = Type::CIRCLE_BUTTON;
-
-        // Fetch stuff for rendering
-        mpCircleButtonItem = mpAssetManager->fetchRenderItem(shaders::Type::CIRCLE_BUTTON, meshes::Type::QUAD);
     }
 
     CircleButton::~CircleButton()
@@ -56,17 +53,11 @@ namespace eyegui
 
     void CircleButton::specialDraw() const
     {
-        mpIcon->bind(1);
-        mpCircleButtonItem->bind();
-        mpCircleButtonItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-        mpCircleButtonItem->getShader()->fillValue("color", getStyle()->color);
-        mpCircleButtonItem->getShader()->fillValue("iconColor", getStyle()->iconColor);
-        mpCircleButtonItem->getShader()->fillValue("pressing", getPressing());
-        mpCircleButtonItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-        mpCircleButtonItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-        mpCircleButtonItem->getShader()->fillValue("icon", 1);
-        mpCircleButtonItem->draw();
-
+        DrawBatcher::Instance instance;
+        instance.color = getStyle()->color;
+        instance.secondColor = getStyle()->iconColor;
+        instance.values = glm::vec4(getPressing(), getMultipliedDimmedAlpha(), 0, 0);
+        mpAssetManager->getDrawBatcher()->enqueueIcon(shaders::Type::CIRCLE_BUTTON, mFullDrawMatrix, getMask(), mpIcon, instance);
 
         // Super call
         Button::specialDraw();
@@ -52,11 +52,6 @@ namespace eyegui
 
         // Checks, whether circle button is penetrated by input
         virtual bool penetratedByInput(Input const * pInput) const;
-
-    private:
-
-        // Members
-        RenderItem const * mpCircleButtonItem;
     };
 }
 
@@ -240,4 +240,9 @@ namespace eyegui
         mInnerAlpha.setValue(0);
         mInnerElementVisible = false;
     }
+
+    bool DropButton::specialSettled() const
+    {
+        return mInnerAlpha.getValue() == (mInnerElementVisible ? 1.f : 0.f) && BoxButton::specialSettled();
+    }
 }
@@ -69,6 +69,9 @@ namespace eyegui
         // Reset filld by subclasses
         virtual void specialReset();
 
+        // Whether fading of inner element has settled
+        virtual bool specialSettled() const;
+
     private:
 
         // Member
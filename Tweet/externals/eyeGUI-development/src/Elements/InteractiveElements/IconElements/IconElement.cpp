@@ -172,6 +172,13 @@ namespace eyegui
         mDescriptionAlpha.setValue(0);
     }
 
+    bool IconElement::specialSettled() const
+    {
+        // Description is only visible on penetration or always
+        float target = (mpLayout->getDescriptionVisibility() == DescriptionVisibility::VISIBLE) ? 1.f : 0.f;
+        return mDescriptionAlpha.getValue() == target && InteractiveElement::specialSettled();
+    }
+
     glm::vec2 IconElement::iconAspectRatioCorrection() const
     {
         float aspectRatio = (float)mWidth / (float)mHeight;
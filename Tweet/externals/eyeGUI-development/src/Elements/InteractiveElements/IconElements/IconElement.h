@@ -63,6 +63,9 @@ namespace eyegui
         // Reset filled by subclasses
         virtual void specialReset();
 
+        // Whether description has faded
+        virtual bool specialSettled() const;
+
         // Calculate aspect ratio correction for icon on gizmo
         glm::vec2 iconAspectRatioCorrection() const;
 
@@ -50,12 +50,6 @@ namespace eyegui
 
         // Initialize members
         mPenetration.setValue(0);
-
-        // Render item
-        mpSensorItem = mpAssetManager->fetchRenderItem(
-            shaders::Type::SENSOR,
-            meshes::Type::QUAD);
-
     }
 
     Sensor::~Sensor()
@@ -104,17 +98,12 @@ namespace eyegui
 
     void Sensor::specialDraw() const
     {
-        mpIcon->bind(1);
-        mpSensorItem->bind();
-        mpSensorItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-        mpSensorItem->getShader()->fillValue("color", getStyle()->color);
-        mpSensorItem->getShader()->fillValue("iconColor", getStyle()->iconColor);
-        mpSensorItem->getShader()->fillValue("penetration", mPenetration.getValue());
-        mpSensorItem->getShader()->fillValue("iconUVScale", iconAspectRatioCorrection());
-        mpSensorItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-        mpSensorItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-        mpSensorItem->getShader()->fillValue("icon", 1);
-        mpSensorItem->draw();
+        DrawBatcher::Instance instance;
+        instance.color = getStyle()->color;
+        instance.secondColor = getStyle()->iconColor;
+        instance.values = glm::vec4(mPenetration.getValue(), getMultipliedDimmedAlpha(), 0, 0);
+        instance.extra = glm::vec4(iconAspectRatioCorrection(), 0, 0);
+        mpAssetManager->getDrawBatcher()->enqueueIcon(shaders::Type::SENSOR, mFullDrawMatrix, getMask(), mpIcon, instance);
 
         // Super call
         IconElement::specialDraw();
@@ -128,6 +117,11 @@ namespace eyegui
         mPenetration.setValue(0);
     }
 
+    bool Sensor::specialSettled() const
+    {
+        return mPenetration.getValue() == 0 && IconElement::specialSettled();
+    }
+
     void Sensor::specialInteract()
     {
         penetrate(mpLayout->getConfig()->sensorInteractionPenetrationAmount);
@@ -52,6 +52,9 @@ namespace eyegui
         // Reset filld by subclasses
         virtual void specialReset();
 
+        // Whether penetration has settled
+        virtual bool specialSettled() const;
+
         // Interaction fill by subclasses
         virtual void specialInteract();
 
@@ -62,7 +65,6 @@ namespace eyegui
 
         // Members
         LerpValue mPenetration; // [0..1]
-        RenderItem const * mpSensorItem;
     };
 }
 
@@ -45,10 +45,6 @@ namespace eyegui
         mIsHighlighted = false;
         mSelection.setValue(0);
         mIsSelected = false;
-
-        // Render items
-        mpHighlightItem = mpAssetManager->fetchRenderItem(shaders::Type::HIGHLIGHT, meshes::Type::QUAD);
-        mpSelectionItem = mpAssetManager->fetchRenderItem(shaders::Type::SELECTION, meshes::Type::QUAD);
     }
 
     InteractiveElement::~InteractiveElement()
@@ -66,17 +62,20 @@ namespace eyegui
         if (mAlpha >= 1 && isActive())
         {
             specialInteract();
+            wake();
         }
     }
 
     void InteractiveElement::highlight(bool doHighlight)
     {
         mIsHighlighted = doHighlight;
+        wake();
     }
 
     void InteractiveElement::select(bool doSelect)
     {
         mIsSelected = doSelect;
+        wake();
     }
 
     InteractiveElement* InteractiveElement::internalNextInteractiveElement(Element const * pCaller)
@@ -91,26 +90,19 @@ namespace eyegui
         // Draw highlight
         if(mHighlight.getValue() > 0)
         {
-            mpHighlightItem->bind();
-            mpHighlightItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpHighlightItem->getShader()->fillValue("highlightColor", getStyle()->highlightColor);
-            mpHighlightItem->getShader()->fillValue("highlight", mHighlight.getValue());
-            mpHighlightItem->getShader()->fillValue("time", mpLayout->getAccPeriodicTime());
-            mpHighlightItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-            mpHighlightItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-            mpHighlightItem->draw();
+            DrawBatcher::Instance instance;
+            instance.color = getStyle()->highlightColor;
+            instance.values = glm::vec4(mHighlight.getValue(), getMultipliedDimmedAlpha(), mpLayout->getAccPeriodicTime(), 0);
+            mpAssetManager->getDrawBatcher()->enqueue(shaders::Type::HIGHLIGHT, mFullDrawMatrix, getMask(), 0, instance);
         }
 
         // Draw selection
         if(mSelection.getValue() > 0)
         {
-            mpSelectionItem->bind();
-            mpSelectionItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpSelectionItem->getShader()->fillValue("selectionColor", getStyle()->selectionColor);
-            mpSelectionItem->getShader()->fillValue("selection", mSelection.getValue());
-            mpSelectionItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-            mpSelectionItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-            mpSelectionItem->draw();
+            DrawBatcher::Instance instance;
+            instance.color = getStyle()->selectionColor;
+            instance.values = glm::vec4(mSelection.getValue(), getMultipliedDimmedAlpha(), 0, 0);
+            mpAssetManager->getDrawBatcher()->enqueue(shaders::Type::SELECTION, mFullDrawMatrix, getMask(), 0, instance);
         }
     }
 
@@ -140,6 +132,12 @@ namespace eyegui
         mIsSelected = false;
     }
 
+    bool InteractiveElement::specialSettled() const
+    {
+        return mHighlight.getValue() == (mIsHighlighted ? 1.f : 0.f)
+            && mSelection.getValue() == (mIsSelected ? 1.f : 0.f);
+    }
+
     bool InteractiveElement::mayConsumeInput()
     {
         return true;
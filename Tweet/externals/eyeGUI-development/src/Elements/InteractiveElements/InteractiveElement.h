@@ -63,6 +63,9 @@ namespace eyegui
         // Reset filld by subclasses
         virtual void specialReset();
 
+        // Whether highlight and selection have settled
+        virtual bool specialSettled() const;
+
         // Implemented by subclasses
         virtual bool mayConsumeInput();
 
@@ -74,8 +77,6 @@ namespace eyegui
         bool mIsHighlighted;
         LerpValue mSelection;
         bool mIsSelected;
-        RenderItem const * mpHighlightItem;
-        RenderItem const * mpSelectionItem;
     };
 }
 
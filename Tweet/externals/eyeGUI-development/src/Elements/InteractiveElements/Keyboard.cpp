@@ -56,11 +56,6 @@ namespace eyegui
         mUseFastTyping = false;
         mFastBuffer = u"";
 
-        // Fetch render item for background
-        mpBackground = mpAssetManager->fetchRenderItem(
-            shaders::Type::COLOR,
-            meshes::Type::QUAD);
-
         // Create keymaps (mKeymaps)
         initKeymaps(mpLayout->getCharacterSet());
     }
@@ -375,12 +370,11 @@ namespace eyegui
         // *** BACKGROUND ***
         if (getStyle()->backgroundColor.a > 0)
         {
-            // Bind, fill and draw background
-            mpBackground->bind();
-            mpBackground->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpBackground->getShader()->fillValue("color", getStyle()->backgroundColor);
-            mpBackground->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-            mpBackground->draw();
+            // Fill and enqueue background
+            DrawBatcher::Instance instance;
+            instance.color = getStyle()->backgroundColor;
+            instance.values.y = getMultipliedDimmedAlpha();
+            mpAssetManager->getDrawBatcher()->enqueue(shaders::Type::COLOR, mFullDrawMatrix, 0, 0, instance);
         }
 
         // *** RENDER KEYS ***
@@ -514,6 +508,11 @@ namespace eyegui
         // mBigCharactersActive = false;
     }
 
+    bool Keyboard::specialSettled() const
+    {
+        return false;
+    }
+
     void Keyboard::specialInteract()
     {
         // Either currently focused or the one with highest combination of focus and threshold...first idea used here
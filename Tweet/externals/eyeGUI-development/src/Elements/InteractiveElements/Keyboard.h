@@ -71,6 +71,9 @@ namespace eyegui
         // Reset filled by subclasses
         virtual void specialReset();
 
+        // Keyboard never settles, because keys follow the filtered gaze even outside of keyboard
+        virtual bool specialSettled() const;
+
         // Interaction fill by subclasses
         virtual void specialInteract();
 
@@ -131,7 +134,6 @@ namespace eyegui
 		void pressKey(SubKeymap* pKeys, int i, int j);
 
         // Members
-        RenderItem const * mpBackground;
         LerpValue mThreshold;
         int mFocusedKeyRow;
         int mFocusedKeyColumn;
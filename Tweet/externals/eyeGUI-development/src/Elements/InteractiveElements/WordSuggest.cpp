@@ -46,14 +46,7 @@ namespace eyegui
         mOffset.setValue(0.f);
         mDelta = 0;
         mCompleteWidth = 0;
-
-        // Fetch render item for background
-        mpBackground = mpAssetManager->fetchRenderItem(
-            shaders::Type::COLOR,
-            meshes::Type::QUAD);
-
-        // Fetch single render item to draw all thresholds
-        mpThresholdItem = mpAssetManager->fetchRenderItem(shaders::Type::BOX_THRESHOLD, meshes::Type::QUAD);
+        measureReferenceTexts();
     }
 
     WordSuggest::~WordSuggest()
@@ -63,14 +56,17 @@ namespace eyegui
 
     void WordSuggest::suggest(std::u16string input, Dictionary const * pDictionary, std::u16string& rBestSuggestion)
     {
-        // Clear up
-        mSuggestions.clear();
-        mThresholds.clear();
+        // Suggestions in the background are outdated
+        if (mupSuggestionWorker)
+        {
+            mupSuggestionWorker->cancel();
+        }
 
         // Fallback for suggestion
         rBestSuggestion = u"";
 
-        // Only do something when there is input
+        // Only search when there is input
+        std::vector<std::u16string> suggestions;
         if (!input.empty())
         {
             // Decide whether word should start with big letter
@@ -82,18 +78,7 @@ namespace eyegui
             }
 
             // Ask for suggestions
-            std::vector<std::u16string> suggestions = pDictionary->similarWords(input, startsWithUpperCase);
-            uint i = 0;
-            for (const std::u16string& rSuggestion : suggestions)
-            {
-                mSuggestions.push_back(std::move(mpAssetManager->createTextSimple(mFontSize, 1, rSuggestion)));
-
-                // Only add maximal allowed number of suggestions
-                if (++i >= WORD_SUGGEST_MAX_SUGGESTIONS)
-                {
-                    break;
-                }
-            }
+            pDictionary->similarWords(input, startsWithUpperCase, WORD_SUGGEST_MAX_SUGGESTIONS, mSearch, NULL, suggestions);
 
             // Save best suggestion
             if (!suggestions.empty())
@@ -101,18 +86,51 @@ namespace eyegui
                 // First one is best
                 rBestSuggestion = suggestions[0];
             }
+        }
 
-            // Prepare thresholds
-            mThresholds.resize(mSuggestions.size(), LerpValue(0));
+        // Show them
+        showSuggestions(suggestions);
+    }
+
+    void WordSuggest::suggest(std::u16string input, Dictionary const * pDictionary)
+    {
+        // Without input, there is nothing to search for
+        if (input.empty())
+        {
+            if (mupSuggestionWorker)
+            {
+                mupSuggestionWorker->cancel();
+            }
+            showSuggestions(std::vector<std::u16string>());
+            return;
+        }
 
-            // Transform and position the suggestions initially
-            transformSuggestions();
-            positionSuggestions();
+        // Decide whether word should start with big letter
+        bool startsWithUpperCase = false;
+        char16_t lowerCaseLetter = input[0];
+        if (toLower(lowerCaseLetter))
+        {
+            startsWithUpperCase = lowerCaseLetter != input[0];
         }
+
+        // Ask worker for suggestions, which are collected in update
+        if (!mupSuggestionWorker)
+        {
+            mupSuggestionWorker = std::unique_ptr<SuggestionWorker>(new SuggestionWorker);
+        }
+        mupSuggestionWorker->request(input, pDictionary, startsWithUpperCase, WORD_SUGGEST_MAX_SUGGESTIONS);
+        wake();
     }
 
     void WordSuggest::clear()
     {
+        // Suggestions in the background are outdated
+        if (mupSuggestionWorker)
+        {
+            mupSuggestionWorker->cancel();
+        }
+
+        wake();
         mOffset.setValue(0.f);
         mCompleteWidth = 0;
         mSuggestions.clear();
@@ -123,6 +141,13 @@ namespace eyegui
         // Super call
         float adaptiveScale = InteractiveElement::specialUpdate(tpf, pInput);
 
+        // *** COLLECT SUGGESTIONS FROM BACKGROUND ***
+        std::vector<std::u16string> suggestions;
+        if (mupSuggestionWorker && mupSuggestionWorker->collect(suggestions))
+        {
+            showSuggestions(suggestions);
+        }
+
         // *** UPDATE SCROLLING AND FOCUS ***
 
         // Check for penetration
@@ -161,7 +186,7 @@ namespace eyegui
         }
 
         // *** UPDATE THRESHOLD ***
-        float standardWidth = (float)(mpAssetManager->createTextSimple(mFontSize, 1, u"hallo")->getWidth()); // just some width to compare to
+        float standardWidth = (float)mStandardWidth;
         int count = (int)mSuggestions.size();
         for (int i = 0; i < count; i++)
         {
@@ -220,12 +245,11 @@ namespace eyegui
         // *** BACKGROUND ***
         if (getStyle()->backgroundColor.a > 0)
         {
-            // Bind, fill and draw background
-            mpBackground->bind();
-            mpBackground->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpBackground->getShader()->fillValue("color", getStyle()->backgroundColor);
-            mpBackground->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-            mpBackground->draw();
+            // Fill and enqueue background
+            DrawBatcher::Instance instance;
+            instance.color = getStyle()->backgroundColor;
+            instance.values.y = getMultipliedDimmedAlpha();
+            mpAssetManager->getDrawBatcher()->enqueue(shaders::Type::COLOR, mFullDrawMatrix, 0, 0, instance);
         }
 
         // *** SUGGESTIONS ***
@@ -260,14 +284,10 @@ namespace eyegui
                         mHeight);
 
                     // Draw threshold
-                    mpThresholdItem->bind();
-                    mpThresholdItem->getShader()->fillValue("matrix", matrix);
-                    mpThresholdItem->getShader()->fillValue("thresholdColor", getStyle()->thresholdColor);
-                    mpThresholdItem->getShader()->fillValue("threshold", threshold);
-                    mpThresholdItem->getShader()->fillValue("alpha", mAlpha);
-                    mpThresholdItem->getShader()->fillValue("orientation", 1.f); // vertical threshold
-                    mpThresholdItem->getShader()->fillValue("mask", 0); // mask is always in slot 0
-                    mpThresholdItem->draw();
+                    DrawBatcher::Instance instance;
+                    instance.color = getStyle()->thresholdColor;
+                    instance.values = glm::vec4(threshold, mAlpha, 1.f, 0); // vertical threshold
+                    mpAssetManager->getDrawBatcher()->enqueue(shaders::Type::BOX_THRESHOLD, matrix, getMask(), 0, instance);
                 }
             }
 
@@ -286,6 +306,9 @@ namespace eyegui
 
     void WordSuggest::specialTransformAndSize()
     {
+        // Size of font may have changed
+        measureReferenceTexts();
+
         // First transform and then position the text simple assets
         transformSuggestions();
         positionSuggestions();
@@ -299,6 +322,26 @@ namespace eyegui
         mChosenSuggestions.clear();
     }
 
+    bool WordSuggest::specialSettled() const
+    {
+        if (mupSuggestionWorker && mupSuggestionWorker->pending())
+        {
+            return false;
+        }
+        if (!mChosenSuggestions.empty())
+        {
+            return false;
+        }
+        for (const LerpValue& rThreshold : mThresholds)
+        {
+            if (rThreshold.getValue() > 0)
+            {
+                return false;
+            }
+        }
+        return InteractiveElement::specialSettled();
+    }
+
     void WordSuggest::specialInteract()
     {
         // Find suggestion with value most close to threshold
@@ -347,22 +390,75 @@ namespace eyegui
         }
     }
 
-    void WordSuggest::transformSuggestions()
+    void WordSuggest::showSuggestions(const std::vector<std::u16string>& rSuggestions)
     {
-        if (!mSuggestions.empty())
+        // Keep text of suggestions which are still there
+        std::vector<std::unique_ptr<TextSimple> > previousSuggestions = std::move(mSuggestions);
+        mSuggestions.clear();
+        mSuggestions.resize(rSuggestions.size());
+        for (uint i = 0; i < (uint)rSuggestions.size(); i++)
+        {
+            for (std::unique_ptr<TextSimple>& rupPrevious : previousSuggestions)
+            {
+                if (rupPrevious && rupPrevious->getContent() == rSuggestions[i])
+                {
+                    mSuggestions[i] = std::move(rupPrevious);
+                    break;
+                }
+            }
+        }
+
+        // Fill other texts with new suggestions, create text only if no previous is left
+        auto previousIt = previousSuggestions.begin();
+        for (uint i = 0; i < (uint)rSuggestions.size(); i++)
         {
-            // Fetch size of space in font (somehow strange way, but who cares)
-            auto spaceText = mpAssetManager->createTextSimple(mFontSize, 1, u" ");
-            int space = spaceText->getWidth();
+            if (mSuggestions[i])
+            {
+                continue;
+            }
+            while (previousIt != previousSuggestions.end() && !(*previousIt))
+            {
+                previousIt++;
+            }
+            if (previousIt != previousSuggestions.end())
+            {
+                mSuggestions[i] = std::move(*previousIt);
+                mSuggestions[i]->setContent(rSuggestions[i]);
+            }
+            else
+            {
+                mSuggestions[i] = mpAssetManager->createTextSimple(mFontSize, 1, rSuggestions[i]);
+            }
+        }
+
+        // Prepare thresholds
+        mThresholds.clear();
+        mThresholds.resize(mSuggestions.size(), LerpValue(0));
+        wake();
+
+        // Measure and position the suggestions, mesh of text is up to date
+        measureSuggestions();
+        positionSuggestions();
+    }
+
+    void WordSuggest::measureReferenceTexts()
+    {
+        // Fetch size of space in font (somehow strange way, but who cares)
+        mSpaceWidth = mpAssetManager->createTextSimple(mFontSize, 1, u" ")->getWidth();
+
+        // Just some width to compare to
+        mStandardWidth = mpAssetManager->createTextSimple(mFontSize, 1, u"hallo")->getWidth();
+    }
 
-            // Go over suggestions and transform them
-            mDelta = (int) (WORD_SUGGEST_SUGGESTION_DISTANCE * (float)space);
+    void WordSuggest::measureSuggestions()
+    {
+        if (!mSuggestions.empty())
+        {
+            // Go over suggestions and remind their widths
+            mDelta = (int) (WORD_SUGGEST_SUGGESTION_DISTANCE * (float)mSpaceWidth);
             mCompleteWidth = mDelta / 2;
             for (int i = 0; i < (int)mSuggestions.size(); i++)
             {
-                // Transform suggestion to fit available space
-                mSuggestions.at(i)->transform();
-
                 // Get width after transformation
                 int width = mSuggestions.at(i)->getWidth();
 
@@ -379,6 +475,16 @@ namespace eyegui
         }
     }
 
+    void WordSuggest::transformSuggestions()
+    {
+        // Transform suggestions to fit available space
+        for (const std::unique_ptr<TextSimple>& rSuggestion : mSuggestions)
+        {
+            rSuggestion->transform();
+        }
+        measureSuggestions();
+    }
+
     void WordSuggest::positionSuggestions()
     {
         if (!mSuggestions.empty())
@@ -6,7 +6,8 @@
 // Author: Raphael Menges (https://github.com/raphaelmenges)
 // Element which takes one input word via interface and displays suggestions.
 // One can chose a suggestion by threshold and listen to it with a listener
-// structure. Works good in combination with keyboard element.
+// structure. Works good in combination with keyboard element. Suggestions
+// may be searched in the background and are shown when available.
 
 #ifndef WORD_SUGGEST_H_
 #define WORD_SUGGEST_H_
@@ -14,6 +15,7 @@
 #include "src/Elements/InteractiveElements/InteractiveElement.h"
 
 #include "src/Utilities/Dictionary.h"
+#include "src/Utilities/SuggestionWorker.h"
 
 namespace eyegui
 {
@@ -42,6 +44,9 @@ namespace eyegui
         // Suggest. Best suggestion may be empty.
         void suggest(std::u16string input, Dictionary const * pDictionary, std::u16string& rBestSuggestion);
 
+        // Suggest with search in the background. Current suggestions are shown until new ones are available
+        void suggest(std::u16string input, Dictionary const * pDictionary);
+
         // Clear
         void clear();
 
@@ -59,6 +64,9 @@ namespace eyegui
         // Reset filld by subclasses
         virtual void specialReset();
 
+        // Whether thresholds and animation of chosen suggestions have settled
+        virtual bool specialSettled() const;
+
         // Interaction fill by subclasses
         virtual void specialInteract();
 
@@ -82,7 +90,16 @@ namespace eyegui
             std::unique_ptr<TextSimple> upText;
         };
 
-        // Transform the suggestions, fills members needed in position below
+        // Show given suggestions. Text of previous suggestions is reused
+        void showSuggestions(const std::vector<std::u16string>& rSuggestions);
+
+        // Measure width of text used as reference for suggestions
+        void measureReferenceTexts();
+
+        // Measure the suggestions, fills members needed in position below
+        void measureSuggestions();
+
+        // Transform and measure the suggestions
         void transformSuggestions();
 
         // Position the suggestions
@@ -92,16 +109,18 @@ namespace eyegui
         void chooseSuggestion(int index);
 
         // Members
-        RenderItem const * mpBackground;
         FontSize mFontSize;
         std::vector<std::unique_ptr<TextSimple> > mSuggestions;
         LerpValue mOffset; // offset given in percent of all suggestions
         int mDelta;
         int mCompleteWidth;
         std::vector<LerpValue> mThresholds;
-        RenderItem const * mpThresholdItem;
         std::u16string mLastChosenSuggestion;
         std::vector<ChosenSuggestion> mChosenSuggestions;
+        int mSpaceWidth; // width of space in font
+        int mStandardWidth; // width of some word to compare suggestions to
+        Dictionary::Search mSearch; // search of suggestions with best one
+        std::unique_ptr<SuggestionWorker> mupSuggestionWorker; // created at first suggestions in the background
     };
 }
 
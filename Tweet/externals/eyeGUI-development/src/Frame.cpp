@@ -85,7 +85,7 @@ namespace eyegui
     void Frame::update(float tpf, float alpha, Input* pInput, bool force)
     {
         // *** RESIZING ***
-        internalResizing();
+        resizeIfNecessary();
 
         // *** OWN UPDATE ***
 
@@ -146,13 +146,9 @@ namespace eyegui
         }
     }
 
-    void Frame::makeResizeNecessary(bool instant)
+    void Frame::makeResizeNecessary()
     {
         mResizeNecessary = true;
-        if(instant)
-        {
-            internalResizing();
-        }
     }
 
     void Frame::attachRoot(std::unique_ptr<Element> upElement)
@@ -315,7 +311,7 @@ namespace eyegui
         mResizeNecessary = true;
     }
 
-    void Frame::internalResizing()
+    void Frame::resizeIfNecessary()
     {
         // Makes problems when resizing of invisible layouts is activated
         // if (mResizeNecessary && mCombinedAlpha > 0)
@@ -58,8 +58,11 @@ namespace eyegui
         // Drawing
         void draw() const;
 
-        // Make resize necessary
-        void makeResizeNecessary(bool instant = false);
+        // Make resize necessary. Requests are collected and done at once before next update or drawing
+        void makeResizeNecessary();
+
+        // Do pending resize
+        void resizeIfNecessary();
 
         // Attach root
         void attachRoot(std::unique_ptr<Element> upElement);
@@ -120,9 +123,6 @@ namespace eyegui
 
     private:
 
-        // Resize function
-        void internalResizing();
-
         // Clamp size
         void clampSize();
 
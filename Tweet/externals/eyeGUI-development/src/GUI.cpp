@@ -23,8 +23,11 @@ namespace eyegui
         int height,
         std::string fontFilepath,
         CharacterSet characterSet,
+        bool prewarmGlyphs,
         std::string localizationFilepath,
         float vectorGraphicsDPI,
+        std::string vectorGraphicsCacheFilepath,
+        uint vectorGraphicsCacheSize,
         float fontTallSize,
         float fontMediumSize,
         float fontSmallSize,
@@ -40,6 +43,9 @@ namespace eyegui
         mNewWidth = mWidth;
         mNewHeight = mHeight;
         mCharacterSet = characterSet;
+        mPrewarmGlyphs = prewarmGlyphs;
+        mVectorGraphicsCacheFilepath = vectorGraphicsCacheFilepath; // used by asset manager at construction
+        mVectorGraphicsCacheSize = vectorGraphicsCacheSize;
         mAccPeriodicTime = -(ACCUMULATED_TIME_PERIOD / 2);
         mupAssetManager = std::unique_ptr<AssetManager>(new AssetManager(this));
         mpDefaultFont = NULL;
@@ -77,7 +83,8 @@ namespace eyegui
 
     GUI::~GUI()
     {
-        // Nothing to do so far
+        // Word suggest elements of layouts may still search in dictionaries, which are destroyed before layouts
+        mLayers.clear();
     }
 
     Layout* GUI::addLayout(std::string filepath, int layer, bool visible)
@@ -92,7 +99,7 @@ namespace eyegui
         pLayout->setVisibility(visible, false);
 
         // Do some initial resize to be ok for first draw
-        pLayout->makeResizeNecessary(true, true);
+        pLayout->makeResizeNecessary(true);
 
         // Give unique pointer to job so it will be pushed back before next rendering but not during
         mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new AddLayoutJob(this, std::move(upLayout), layer))));
@@ -193,6 +200,18 @@ namespace eyegui
             mLayers[i]->second->update(tpf, &copyInput);
         }
 
+        // Glyphs used by texts may have been moved or evicted in font atlases and loaded images
+        // have other size than their placeholders, so lay out everything again
+        bool fontsChanged = mupAssetManager->updateFonts();
+        bool texturesChanged = mupAssetManager->updateTextures();
+        if (fontsChanged || texturesChanged)
+        {
+            for (auto& rLayer : mLayers)
+            {
+                rLayer->second->makeResizeNecessary(mResizeInvisibleLayouts);
+            }
+        }
+
         // Update gaze drawer
         mupGazeDrawer->update(input.gazeX, input.gazeY, tpf);
 
@@ -221,6 +240,9 @@ namespace eyegui
             mLayers[i]->second->draw();
         }
 
+        // Draw quads collected while drawing layers
+        mupAssetManager->getDrawBatcher()->flush();
+
         // Render resize blend
         if (mResizing)
         {
@@ -274,6 +296,12 @@ namespace eyegui
         mupAssetManager->fetchTexture(filepath);
     }
 
+    void GUI::prefetchImagesOfFile(std::string filepath)
+    {
+        // Do it immediately
+        mupAssetManager->prefetchImagesOfFile(filepath);
+    }
+
     void GUI::setValueOfConfigAttribute(std::string attribute, std::string value)
     {
         mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new SetValueOfConfigAttributeJob(this, attribute, value))));
@@ -291,6 +319,12 @@ namespace eyegui
     void GUI::setDescriptionVisibility(DescriptionVisibility visbility)
     {
 		mDescriptionVisibility = visbility;
+
+        // Sleeping icon elements have to update their description
+        for (auto& rLayer : mLayers)
+        {
+            rLayer->second->wakeElements();
+        }
     }
 
     int GUI::getWindowWidth() const
@@ -318,6 +352,11 @@ namespace eyegui
         return mCharacterSet;
     }
 
+    bool GUI::getPrewarmGlyphs() const
+    {
+        return mPrewarmGlyphs;
+    }
+
     Font const * GUI::getDefaultFont() const
     {
         return mpDefaultFont;
@@ -342,6 +381,16 @@ namespace eyegui
         return mVectorGraphicsDPI;
     }
 
+    std::string GUI::getVectorGraphicsCacheFilepath() const
+    {
+        return mVectorGraphicsCacheFilepath;
+    }
+
+    uint GUI::getVectorGraphicsCacheSize() const
+    {
+        return mVectorGraphicsCacheSize;
+    }
+
     float GUI::getSizeOfFont(FontSize fontSize) const
     {
         switch (fontSize)
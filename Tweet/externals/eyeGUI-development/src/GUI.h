@@ -41,8 +41,11 @@ namespace eyegui
             int height,
             std::string fontFilepath,
             CharacterSet characterSet,
+            bool prewarmGlyphs,
             std::string localizationFilepath,
             float vectorGraphicsDPI,
+            std::string vectorGraphicsCacheFilepath,
+            uint vectorGraphicsCacheSize,
             float fontTallSize,
             float fontMediumSize,
             float fontSmallSize,
@@ -86,6 +89,9 @@ namespace eyegui
         // Prefatch image to avoid lag
         void prefetchImage(std::string filepath);
 
+        // Prefetch all images referenced by layout or brick file
+        void prefetchImagesOfFile(std::string filepath);
+
         // Set value of config attribute
         void setValueOfConfigAttribute(std::string attribute, std::string value);
 
@@ -110,6 +116,9 @@ namespace eyegui
         // Get used character set
         CharacterSet getCharacterSet() const;
 
+        // Get whether glyphs of character set are rendered in advance
+        bool getPrewarmGlyphs() const;
+
         // Get set default font
         Font const * getDefaultFont() const;
 
@@ -119,6 +128,12 @@ namespace eyegui
         // Get dpi for rasterization of vector graphics
         float getVectorGraphicsDPI() const;
 
+        // Get path to cache of rasterized vector graphics, empty if none
+        std::string getVectorGraphicsCacheFilepath() const;
+
+        // Get maximal size of cache of rasterized vector graphics in megabytes
+        uint getVectorGraphicsCacheSize() const;
+
         // Get size for font
         float getSizeOfFont(FontSize fontSize) const;
 
@@ -232,6 +247,7 @@ namespace eyegui
         int mWidth, mHeight;
         int mNewWidth, mNewHeight;
         CharacterSet mCharacterSet;
+        bool mPrewarmGlyphs;
         std::unique_ptr<AssetManager> mupAssetManager;
         float mAccPeriodicTime;
         Config mConfig;
@@ -244,6 +260,8 @@ namespace eyegui
         std::unique_ptr<GazeDrawer> mupGazeDrawer;
         bool mDrawGazeVisualization;
         float mVectorGraphicsDPI;
+        std::string mVectorGraphicsCacheFilepath;
+        uint mVectorGraphicsCacheSize;
         float mFontTallSize;
         float mFontMediumSize;
         float mFontSmallSize;
@@ -47,6 +47,14 @@ namespace eyegui
         }
     }
 
+    void Layer::wakeElements()
+    {
+        for (std::unique_ptr<Layout>& upLayout : mLayouts)
+        {
+            upLayout->wakeElements();
+        }
+    }
+
     void Layer::addLayout(std::unique_ptr<Layout> upLayout)
     {
         mLayouts.push_back(std::move(upLayout));
@@ -32,6 +32,9 @@ namespace eyegui
 		// Resize
 		void makeResizeNecessary(bool force);
 
+		// Wake all elements, e.g. after change of settings which influence their update
+		void wakeElements();
+
 		// Add layout
 		void addLayout(std::unique_ptr<Layout> upLayout);
 
@@ -31,6 +31,7 @@ namespace eyegui
         mupMainFrame = std::unique_ptr<Frame>(new Frame(this, 0, 0, 1, 1));
         mupNotificationQueue = std::unique_ptr<NotificationQueue>(new NotificationQueue(this));
         mForceResize = false;
+        mResizeGeneration = 1;
 
         // Parse style file
         mupStyles = stylesheet_parser::parse(stylesheetFilepath);
@@ -120,6 +121,17 @@ namespace eyegui
         // Use alpha because while fading it should still draw
         if (mAlpha.getValue() > 0)
         {
+            // Resizing requested since update is done here, so all requests of a frame are handled at once
+            mupMainFrame->resizeIfNecessary();
+            for (uint i = 0; i < mFloatingFramesOrderingIndices.size(); i++)
+            {
+                Frame* pFrame = mFloatingFrames[mFloatingFramesOrderingIndices[i]].get();
+                if (pFrame != NULL)
+                {
+                    pFrame->resizeIfNecessary();
+                }
+            }
+
             // Draw main frame
             mupMainFrame->draw();
 
@@ -135,13 +147,22 @@ namespace eyegui
         }
     }
 
-    void Layout::makeResizeNecessary(bool force, bool instant)
+    void Layout::makeResizeNecessary(bool force)
     {
         mResizeNecessary = true;
         mForceResize = force;
-        if(instant)
+        mResizeGeneration++;
+        internalResizing(force);
+    }
+
+    void Layout::wakeElements()
+    {
+        if (mupIds.get() != NULL)
         {
-           internalResizing(force, instant);
+            for (auto& rPair : *(mupIds.get()))
+            {
+                rPair.second->wake();
+            }
         }
     }
 
@@ -186,6 +207,11 @@ namespace eyegui
         return mpGUI->getWindowHeight();
     }
 
+    uint Layout::getResizeGeneration() const
+    {
+        return mResizeGeneration;
+    }
+
     float Layout::getAccPeriodicTime() const
     {
         return mpGUI->getAccPeriodicTime();
@@ -663,6 +689,34 @@ namespace eyegui
         convertUTF16ToUTF8(bestSuggestion16, rBestSuggestion);
     }
 
+    void Layout::suggestWords(std::string id, std::u16string input, uint dictionaryIndex)
+    {
+        WordSuggest* pWordSuggest = toWordSuggest(fetchElement(id));
+        if (pWordSuggest != NULL)
+        {
+            Dictionary const * pDictionary = mpGUI->getDictionary(dictionaryIndex);
+            if(pDictionary != NULL)
+            {
+                pWordSuggest->suggest(input, pDictionary);
+            }
+            else
+            {
+                throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find dictionary with index: " + std::to_string(dictionaryIndex));
+            }
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find word suggest with id: " + id);
+        }
+    }
+
+    void Layout::suggestWords(std::string id, std::string input, uint dictionaryIndex)
+    {
+        std::u16string input16;
+        convertUTF8ToUTF16(input, input16);
+        suggestWords(id, input16, dictionaryIndex);
+    }
+
     void Layout::clearSuggestions(std::string id)
     {
         WordSuggest* pWordSuggest = toWordSuggest(fetchElement(id));
@@ -714,8 +768,8 @@ namespace eyegui
             // Insert ids
             insertIds(std::move(upPair->second));
 
-            // To transform and resize now
-            pStack->getFrame()->makeResizeNecessary(true);
+            // Transform stack and new brick before next drawing
+            pStack->makeResizeNecessary();
         }
         else
         {
@@ -1338,7 +1392,7 @@ namespace eyegui
         insertIds(std::move(upPair->second));
 
         // Do some initial resize to be ok for first draw
-        pFrame->makeResizeNecessary(true);
+        pFrame->makeResizeNecessary();
 
         // Return index
         return frameIndex;
@@ -1519,12 +1573,12 @@ namespace eyegui
         return mpGUI->getDescriptionFontSize();
     }
 
-    void Layout::internalResizing(bool force, bool instant)
+    void Layout::internalResizing(bool force)
     {
         if (force || (mResizeNecessary && mAlpha.getValue() > 0))
         {
             // Resize main frame
-            mupMainFrame->makeResizeNecessary(instant);
+            mupMainFrame->makeResizeNecessary();
 
             // Resize floating frames
             for (auto& upFrame : mFloatingFrames)
@@ -1532,7 +1586,7 @@ namespace eyegui
                 Frame* pFrame = upFrame.get();
                 if (pFrame != NULL)
                 {
-                    pFrame->makeResizeNecessary(instant);
+                    pFrame->makeResizeNecessary();
                 }
             }
             mResizeNecessary = false;
@@ -1632,8 +1686,8 @@ namespace eyegui
                 mupIds->erase(id);
             }
 
-            // Do direct resize to be ok for first draw
-            pTarget->getFrame()->makeResizeNecessary(true);
+            // Resize replacement to be ok for first draw
+            pElement->makeResizeNecessary();
 
             // Success
             return true;
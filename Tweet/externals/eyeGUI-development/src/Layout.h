@@ -48,11 +48,14 @@ namespace eyegui
         // Updating
         void update(float tpf, Input* pInput);
 
-        // Drawing
+        // Drawing. Pending resizing of frames is done before
         void draw() const;
 
-        // Make resize necessary
-        void makeResizeNecessary(bool force, bool instant = false);
+        // Make resize of all elements necessary, for example after change of window size or fonts
+        void makeResizeNecessary(bool force);
+
+        // Wake all elements, so settled ones are updated again
+        void wakeElements();
 
         // Attach element to main frame as root
         void attachElementToMainFrameAsRoot(
@@ -75,6 +78,9 @@ namespace eyegui
         uint getLayoutWidth() const;
         uint getLayoutHeight() const;
 
+        // Get generation of resizing, increased whenever all elements have to be transformed again
+        uint getResizeGeneration() const;
+
         // Get time from GUI
         float getAccPeriodicTime() const;
 
@@ -190,6 +196,10 @@ namespace eyegui
         void suggestWords(std::string id, std::u16string input, uint dictionaryIndex, std::u16string& rBestSuggestion);
         void suggestWords(std::string id, std::string input, uint dictionaryIndex, std::string& rBestSuggestion);
 
+        // Suggest words with search in the background
+        void suggestWords(std::string id, std::u16string input, uint dictionaryIndex);
+        void suggestWords(std::string id, std::string input, uint dictionaryIndex);
+
         // Clear suggestions
         void clearSuggestions(std::string id);
 
@@ -335,7 +345,7 @@ namespace eyegui
     private:
 
         // Resize function
-        void internalResizing(bool force, bool instant = false);
+        void internalResizing(bool force);
 
         // Fetch pointer to element by id
         Element* fetchElement(std::string id) const;
@@ -371,6 +381,7 @@ namespace eyegui
         InteractiveElement* mpSelectedInteractiveElement;
         std::unique_ptr<NotificationQueue> mupNotificationQueue;
         bool mForceResize;
+        uint mResizeGeneration;
     };
 }
 
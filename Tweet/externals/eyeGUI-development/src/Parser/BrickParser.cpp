@@ -23,16 +23,11 @@ namespace eyegui
                 throwError(OperationNotifier::Operation::PARSING, "Extension of file not as expected", filepath);
             }
 
-            // Read file
-            tinyxml2::XMLDocument doc;
-            doc.LoadFile(buildPath(filepath).c_str());
-            if (doc.Error())
-            {
-                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
-            }
+            // Get parsed file, which is only read again when it has changed
+            tinyxml2::XMLDocument const * pDocument = pAssetManager->fetchBrick(filepath);
 
             // Get first xml element
-            tinyxml2::XMLElement* xmlElement = doc.FirstChildElement();
+            tinyxml2::XMLElement const * xmlElement = pDocument != NULL ? pDocument->FirstChildElement() : NULL;
 
             // Collect values to return
             std::unique_ptr<elementsAndIds> upPair = std::unique_ptr<elementsAndIds>(new elementsAndIds);
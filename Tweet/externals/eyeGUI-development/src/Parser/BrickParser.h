@@ -4,7 +4,8 @@
 //============================================================================
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
-// Parser for bricks. Delegates element parser for actual work.
+// Parser for bricks. Delegates element parser for actual work. Files are
+// read once and kept by asset manager as template for all instances.
 
 #ifndef BRICK_PARSER_H_
 #define BRICK_PARSER_H_
@@ -21,6 +21,8 @@
 #include "src/Utilities/PathBuilder.h"
 
 #include <algorithm>
+#include <chrono>
+#include <thread>
 
 namespace eyegui
 {
@@ -28,6 +30,7 @@ namespace eyegui
     {
         // Save members
         mpGUI = pGUI;
+        mpFillingTexture = NULL;
 
         // Initialize FreeType Library
         if (FT_Init_FreeType(&mFreeTypeLibrary))
@@ -36,10 +39,32 @@ namespace eyegui
                 OperationNotifier::Operation::RUNTIME,
                 "Could not initialize FreeType Library");
         }
+
+        // Batching of quads, which packs icons into atlas
+        mupIconAtlas = std::unique_ptr<IconAtlas>(new IconAtlas());
+        mupDrawBatcher = std::unique_ptr<DrawBatcher>(new DrawBatcher(fetchMesh(meshes::Type::QUAD), mupIconAtlas.get()));
+
+        // Geometry of words shared by texts
+        mupWordCache = std::unique_ptr<WordCache>(new WordCache());
+
+        // Rasterized vector graphics of previous runs
+        if (mpGUI->getVectorGraphicsCacheFilepath() != EMPTY_STRING_ATTRIBUTE)
+        {
+            mupVectorGraphicsCache = std::unique_ptr<VectorGraphicsCache>(
+                new VectorGraphicsCache(mpGUI->getVectorGraphicsCacheFilepath(), mpGUI->getVectorGraphicsCacheSize() * 1024 * 1024));
+        }
+
+        // Workers for image files, one core is left for rendering
+        uint threadCount = std::thread::hardware_concurrency();
+        threadCount = threadCount > 1 ? std::min(threadCount - 1, IMAGE_LOADER_MAX_THREADS) : 1;
+        mupImageLoader = std::unique_ptr<ImageLoader>(new ImageLoader(threadCount, mupVectorGraphicsCache.get()));
     }
 
     AssetManager::~AssetManager()
     {
+        // Stop loading of images
+        mupImageLoader.reset();
+
         // Get rid of fonts first because they have to delete FreeType faces
         mFonts.clear();
 
@@ -115,9 +140,13 @@ namespace eyegui
                 std::transform(input.begin(), input.end(), input.begin(), ::tolower);
 
                 // Check token
+                ImageLoader::Job job;
+                job.filepath = filepath;
+                job.dpi = mpGUI->getVectorGraphicsDPI();
+                job.suspectedChannels = 0;
                 if (input.compare("svg") == 0)
                 {
-                    rupTexture = std::unique_ptr<Texture>(new VectorTexture(filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI()));
+                    job.vectorGraphics = true;
                 }
                 else if (input.compare("png") == 0 || input.compare("jpg") == 0 || input.compare("jpeg") == 0 || input.compare("tga") == 0 || input.compare("bmp") == 0)
                 {
@@ -128,13 +157,23 @@ namespace eyegui
                         suspectedChannelCount = 4;
                     }
 
-                    rupTexture = std::unique_ptr<Texture>(new PixelTexture(filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, suspectedChannelCount));
+                    job.vectorGraphics = false;
+                    job.suspectedChannels = suspectedChannelCount;
                 }
                 else
                 {
                     throwWarning(OperationNotifier::Operation::IMAGE_LOADING, "Image file not found or wrong format. Replaced with placeholder", filepath);
                     rupTexture = std::unique_ptr<Texture>(new VectorTexture(&graphics::notFoundGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI()));
                 }
+
+                // Decode image in background and use placeholder until then
+                if (rupTexture == nullptr)
+                {
+                    AsyncTexture* pAsyncTexture = new AsyncTexture(filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP);
+                    rupTexture = std::unique_ptr<Texture>(pAsyncTexture);
+                    mLoadingTextures[filepath] = pAsyncTexture;
+                    mupImageLoader->enqueue(job);
+                }
             }
             pTexture = rupTexture.get();
             mTextures[filepath] = std::move(rupTexture);
@@ -152,6 +191,16 @@ namespace eyegui
 		bool flipY)
     {
         // Just overwrite it if existing
+        auto it = mTextures.find(name);
+        if (it != mTextures.end())
+        {
+            mupIconAtlas->remove(it->second.get());
+            if (mpFillingTexture == it->second.get())
+            {
+                mpFillingTexture = NULL;
+            }
+            mLoadingTextures.erase(name);
+        }
         mTextures[name] = std::move(std::unique_ptr<Texture>(new PixelTexture(width, height, format, pData, flipY, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP)));
         return mTextures[name].get();
     }
@@ -196,56 +245,56 @@ namespace eyegui
             switch (shader)
             {
             case shaders::Type::COLOR:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pColorFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pColorFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::CIRCLE:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCircleFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCircleFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::DIM:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pDimFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pDimFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::ACTIVITY:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pActivityFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pActivityFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::MARK:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pMarkFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pMarkFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::CIRCLE_THRESHOLD:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCircleThresholdFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCircleThresholdFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::BOX_THRESHOLD:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pBoxThresholdFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pBoxThresholdFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::HIGHLIGHT:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pHighlightFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pHighlightFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::SELECTION:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pSelectionFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pSelectionFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::CIRCLE_BUTTON:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCircleButtonFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCircleButtonFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::BOX_BUTTON:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pBoxButtonFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pBoxButtonFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::SENSOR:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pSensorFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pSensorFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::TEXT:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pTextFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pTextFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::IMAGE:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pImageFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pImageFragmentShader, mupDrawBatcher.get()));
                 break;
 
             // TODO
 
 
             case shaders::Type::KEY:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pKeyFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pKeyFragmentShader, mupDrawBatcher.get()));
                 break;
             case shaders::Type::CHARACTER_KEY:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCharacterKeyFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCharacterKeyFragmentShader, mupDrawBatcher.get()));
                 break;
             default:
                 throwError(OperationNotifier::Operation::BUG, "Shader does not exist");
@@ -257,6 +306,11 @@ namespace eyegui
         return pShader;
     }
 
+    DrawBatcher* AssetManager::getDrawBatcher()
+    {
+        return mupDrawBatcher.get();
+    }
+
     Mesh const * AssetManager::fetchMesh(meshes::Type mesh)
     {
         // Search in map for mesh and create if needed
@@ -320,16 +374,20 @@ namespace eyegui
                 }
                 else
                 {
-                    // Decide character set
-                    std::set<char16_t> characters = charsets::BASIC;
-                    switch (mpGUI->getCharacterSet())
+                    // Decide character set, which is rendered in advance if desired. Other glyphs are rendered at first usage
+                    std::set<char16_t> characters;
+                    if (mpGUI->getPrewarmGlyphs())
                     {
-                    case CharacterSet::GERMANY_GERMAN:
-                        characters.insert(charsets::GERMANY_GERMAN.begin(), charsets::GERMANY_GERMAN.end());
-                        break;
-                    case CharacterSet::US_ENGLISH:
-                        // Are there any special characters in us english?
-                        break;
+                        characters = charsets::BASIC;
+                        switch (mpGUI->getCharacterSet())
+                        {
+                        case CharacterSet::GERMANY_GERMAN:
+                            characters.insert(charsets::GERMANY_GERMAN.begin(), charsets::GERMANY_GERMAN.end());
+                            break;
+                        case CharacterSet::US_ENGLISH:
+                            // Are there any special characters in us english?
+                            break;
+                        }
                     }
 
                     // Give face to a font object (it will delete it in the end)
@@ -352,12 +410,130 @@ namespace eyegui
         return pFont;
     }
 
+    tinyxml2::XMLDocument const * AssetManager::fetchBrick(std::string filepath)
+    {
+        // Search for brick and check whether file has changed since it was read
+        std::string fullpath = buildPath(filepath);
+        std::time_t modificationTime = getFileModificationTime(fullpath);
+        BrickTemplate& rBrick = mBricks[filepath];
+        if (rBrick.upDocument != nullptr && rBrick.modificationTime == modificationTime)
+        {
+            return rBrick.upDocument.get();
+        }
+
+        // Read file
+        std::unique_ptr<tinyxml2::XMLDocument> upDocument = std::unique_ptr<tinyxml2::XMLDocument>(new tinyxml2::XMLDocument);
+        upDocument->LoadFile(fullpath.c_str());
+        if (upDocument->Error())
+        {
+            throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + upDocument->ErrorName(), filepath);
+            mBricks.erase(filepath);
+            return NULL;
+        }
+
+        // Remember document as template
+        rBrick.upDocument = std::move(upDocument);
+        rBrick.modificationTime = modificationTime;
+        return rBrick.upDocument.get();
+    }
+
+    WordCache* AssetManager::getWordCache()
+    {
+        return mupWordCache.get();
+    }
+
     void AssetManager::resizeFontAtlases()
     {
         for (auto& rPair : mFonts)
         {
             rPair.second->resizeFontAtlases();
         }
+
+        // Cached words are scaled for old font sizes
+        mupWordCache->invalidate();
+    }
+
+    bool AssetManager::updateFonts()
+    {
+        bool changed = false;
+        for (auto& rPair : mFonts)
+        {
+            changed |= rPair.second->update();
+        }
+
+        // Words are cached per generation of font, so forget the outdated ones
+        if (changed)
+        {
+            mupWordCache->invalidate();
+        }
+        return changed;
+    }
+
+    bool AssetManager::updateTextures()
+    {
+        // Upload at least one slice per frame and continue while within budget
+        auto start = std::chrono::steady_clock::now();
+        bool changed = false;
+        while (true)
+        {
+            // Start filling next loaded image into its texture
+            if (mpFillingTexture == NULL)
+            {
+                ImageLoader::Result result;
+                if (!mupImageLoader->collect(result))
+                {
+                    break;
+                }
+
+                // Texture may have been replaced meanwhile
+                auto it = mLoadingTextures.find(result.job.filepath);
+                if (it == mLoadingTextures.end())
+                {
+                    continue;
+                }
+
+                // Show placeholder graphics if image could not be loaded
+                if (!result.success)
+                {
+                    throwError(OperationNotifier::Operation::IMAGE_LOADING, "Image file not found or error at parsing", result.job.filepath);
+                    VectorTexture::rasterize(&graphics::notFoundGraphics, result.job.dpi, result.image);
+                }
+                mpFillingTexture = it->second;
+                mpFillingTexture->beginFill(std::move(result.image));
+            }
+
+            // Fill next slice and forget region of placeholder in icon atlas when complete
+            if (mpFillingTexture->continueFill(IMAGE_UPLOAD_SLICE_PIXELS))
+            {
+                mupIconAtlas->remove(mpFillingTexture);
+                mLoadingTextures.erase(mpFillingTexture->getFilepath());
+                mpFillingTexture = NULL;
+                changed = true;
+            }
+
+            // Check budget
+            std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() >= IMAGE_UPLOAD_FRAME_BUDGET)
+            {
+                break;
+            }
+        }
+        return changed;
+    }
+
+    void AssetManager::prefetchImagesOfFile(std::string filepath)
+    {
+        // Read file
+        tinyxml2::XMLDocument doc;
+        doc.LoadFile(buildPath(filepath).c_str());
+        if (doc.Error())
+        {
+            throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
+            return;
+        }
+
+        // Go over all elements
+        prefetchImagesOfElement(doc.FirstChildElement());
     }
 
     std::unique_ptr<TextFlow> AssetManager::createTextFlow(
@@ -417,4 +593,24 @@ namespace eyegui
                     filepath,
                     alignment)));
     }
+
+    void AssetManager::prefetchImagesOfElement(tinyxml2::XMLElement const * pElement)
+    {
+        for (; pElement != NULL; pElement = pElement->NextSiblingElement())
+        {
+            // Attributes which reference images
+            const char* attributes[] = { "icon", "src", "backgroundsrc" };
+            for (const char* pAttribute : attributes)
+            {
+                const char* pValue = pElement->Attribute(pAttribute);
+                if (pValue != NULL && pValue[0] != '\0')
+                {
+                    fetchTexture(pValue);
+                }
+            }
+
+            // Children
+            prefetchImagesOfElement(pElement->FirstChildElement());
+        }
+    }
 }
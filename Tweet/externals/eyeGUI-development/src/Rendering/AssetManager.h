@@ -6,7 +6,8 @@
 // Author: Raphael Menges (https://github.com/raphaelmenges)
 // Managing all kind of assets like shaders, meshes and graphics. Ensures that
 // all assets are unique and loaded only one time into memory. Initializes and
-// terminates the FreeType library and manages fonts.
+// terminates the FreeType library and manages fonts. Image files are decoded
+// in the background and shown as transparent placeholders until uploaded.
 
 #ifndef ASSET_MANAGER_H_
 #define ASSET_MANAGER_H_
@@ -15,16 +16,23 @@
 #include "Mesh.h"
 #include "Textures/Texture.h"
 #include "RenderItem.h"
+#include "DrawBatcher.h"
+#include "Textures/IconAtlas.h"
+#include "Textures/AsyncTexture.h"
+#include "Textures/ImageLoader.h"
 #include "Font/Font.h"
 #include "Assets/Text/TextFlow.h"
 #include "Assets/Text/TextSimple.h"
+#include "Assets/Text/WordCache.h"
 #include "Assets/Key.h"
 #include "Assets/CharacterKey.h"
 #include "Assets/Image.h"
 
 #include "externals/FreeType2/include/ft2build.h"
+#include "externals/TinyXML2/tinyxml2.h"
 #include FT_FREETYPE_H
 
+#include <ctime>
 #include <memory>
 #include <map>
 
@@ -54,7 +62,7 @@ namespace eyegui
         // Fetch render item
         RenderItem const * fetchRenderItem(shaders::Type shader, meshes::Type mesh);
 
-        // Fetch texture
+        // Fetch texture, which is empty until image file is loaded in background
         Texture const * fetchTexture(std::string filepath);
         Texture const * fetchTexture(
 			std::string name,
@@ -73,12 +81,30 @@ namespace eyegui
         // Fetch mesh
         Mesh const * fetchMesh(meshes::Type mesh);
 
+        // Get draw batcher, which collects quads to draw them with few draw calls
+        DrawBatcher* getDrawBatcher();
+
         // Fetch font
         Font const * fetchFont(std::string filepath);
 
+        // Fetch parsed brick file, which is read again when file has changed. Returns NULL if parsing failed
+        tinyxml2::XMLDocument const * fetchBrick(std::string filepath);
+
+        // Get cache of word geometry shared by texts
+        WordCache* getWordCache();
+
         // Resize font atlases (should be called by GUI only)
         void resizeFontAtlases();
 
+        // Update fonts once per frame, returns whether glyphs used by texts became invalid (should be called by GUI only)
+        bool updateFonts();
+
+        // Upload images loaded in background within time budget of frame, returns whether textures have changed (should be called by GUI only)
+        bool updateTextures();
+
+        // Start loading all images referenced by layout or brick file
+        void prefetchImagesOfFile(std::string filepath);
+
         // Create text flow and return it as unique pointer
         std::unique_ptr<TextFlow> createTextFlow(
             FontSize fontSize,
@@ -101,6 +127,16 @@ namespace eyegui
 
     private:
 
+        // Parsed brick file, serves as template for all instances of brick
+        struct BrickTemplate
+        {
+            std::unique_ptr<tinyxml2::XMLDocument> upDocument;
+            std::time_t modificationTime;
+        };
+
+        // Collect referenced images of element and its children
+        void prefetchImagesOfElement(tinyxml2::XMLElement const * pElement);
+
         // Members
         GUI const * mpGUI;
         FT_Library mFreeTypeLibrary;
@@ -110,6 +146,14 @@ namespace eyegui
         std::map<std::string, std::unique_ptr<Texture> > mTextures;
         std::map<graphics::Type, std::unique_ptr<Texture> > mGraphics;
         std::map<std::string, std::unique_ptr<Font> > mFonts;
+        std::map<std::string, BrickTemplate> mBricks;
+        std::map<std::string, AsyncTexture*> mLoadingTextures;
+        AsyncTexture* mpFillingTexture;
+        std::unique_ptr<VectorGraphicsCache> mupVectorGraphicsCache;
+        std::unique_ptr<ImageLoader> mupImageLoader;
+        std::unique_ptr<IconAtlas> mupIconAtlas;
+        std::unique_ptr<DrawBatcher> mupDrawBatcher;
+        std::unique_ptr<WordCache> mupWordCache;
     };
 }
 
@@ -24,18 +24,13 @@ namespace eyegui
         mpFont = pFont;
         mCharacter = character;
 
-        // Fetch shader to render character
-        mpQuadShader = mpAssetManager->fetchShader(shaders::Type::CHARACTER_KEY);
-
         // Get glyph from font
         mpGlyph = mpFont->getGlyph(FontSize::KEYBOARD, mCharacter);
 
         // Calculate relative size of character
         float targetGlyphHeight = mpFont->getTargetGlyphHeight(FontSize::KEYBOARD);
-        mCharacterSize = std::max(KEY_MIN_SCALE, mpGlyph->size.y / targetGlyphHeight);
-
-        // Prepare quad for displaying the character
-        prepareQuad();
+        float glyphHeight = mpGlyph->size.y - (2 * mpGlyph->margin);
+        mCharacterSize = std::max(KEY_MIN_SCALE, glyphHeight / targetGlyphHeight);
     }
 
     CharacterKey::CharacterKey(const CharacterKey& rOtherKey) : Key(rOtherKey)
@@ -43,22 +38,14 @@ namespace eyegui
         // Copy members
         mpFont = rOtherKey.mpFont;
         mCharacter = rOtherKey.mCharacter;
-        mpQuadShader = rOtherKey.mpQuadShader;
         mpGlyph = rOtherKey.mpGlyph;
         mCharacterSize = rOtherKey.mCharacterSize;
-
-        // But create own quad!
-        prepareQuad();
+        mQuadMatrix = rOtherKey.mQuadMatrix;
     }
 
     CharacterKey::~CharacterKey()
     {
-        // Delete vertex array object
-        glDeleteVertexArrays(1, &mQuadVertexArrayObject);
-
-        // Delete buffers
-        glDeleteBuffers(1, &mQuadVertexBuffer);
-        glDeleteBuffers(1, &mQuadTextureCoordinateBuffer);
+        // Nothing to do
     }
 
     void CharacterKey::transformAndSize()
@@ -66,8 +53,12 @@ namespace eyegui
         // Super call
         Key::transformAndSize();
 
-        // Calculate ratio of glyph representing character
-        float ratio = (float)mpGlyph->size.x / (float)mpGlyph->size.y;
+        // Fetch glyph again, since it is rendered at first usage after resizing or eviction from atlas
+        mpGlyph = mpFont->getGlyph(FontSize::KEYBOARD, mCharacter);
+
+        // Calculate ratio of glyph representing character, without margin
+        glm::vec2 glyphSize = mpGlyph->size - (2 * mpGlyph->margin);
+        float ratio = glyphSize.x / glyphSize.y;
 
         // Calculate size multiplier
         glm::vec2 sizeMultiplier;
@@ -92,19 +83,15 @@ namespace eyegui
             (int)quadSize.x,
             (int)quadSize.y);
 
-        // Set texture coordinates of quad
-        GLint oldBuffer = -1;
-        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
-        glBindBuffer(GL_ARRAY_BUFFER, mQuadTextureCoordinateBuffer);
-        std::vector<glm::vec2> textureCoordinates;
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.x, mpGlyph->atlasPosition.y));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.z, mpGlyph->atlasPosition.y));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.z, mpGlyph->atlasPosition.w));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.z, mpGlyph->atlasPosition.w));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.x, mpGlyph->atlasPosition.w));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.x, mpGlyph->atlasPosition.y));
-        glBufferData(GL_ARRAY_BUFFER, textureCoordinates.size() * 2 * sizeof(float), textureCoordinates.data(), GL_DYNAMIC_DRAW);
-        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+        // Character covers only center of quad
+        float border = (1.0f - mCharacterSize) / 2.0f;
+        mQuadMatrix = glm::translate(mQuadMatrix, glm::vec3(border, border, 0));
+        mQuadMatrix = glm::scale(mQuadMatrix, glm::vec3(mCharacterSize, mCharacterSize, 1));
+
+        // Extend quad by margin of glyph
+        glm::vec2 margin = mpGlyph->margin > 0 ? mpGlyph->margin / glyphSize : glm::vec2(0);
+        mQuadMatrix = glm::translate(mQuadMatrix, glm::vec3(-margin, 0));
+        mQuadMatrix = glm::scale(mQuadMatrix, glm::vec3(1.f + (2.f * margin), 1));
     }
 
     void CharacterKey::draw(
@@ -121,24 +108,25 @@ namespace eyegui
             pickColor,
             alpha);
 
-        // Render character
-        mpQuadShader->bind();
-        glBindVertexArray(mQuadVertexArrayObject);
-
-        // Bind atlas texture
-        mpFont->bindAtlasTexture(FontSize::KEYBOARD, 1, true);
-
         // Fill color
-        glm::vec4 characterColor = iconColor;
-        characterColor.a *= alpha;
-        mpQuadShader->fillValue("color", characterColor);
-
-        // Fill other uniforms
-        mpQuadShader->fillValue("matrix", mQuadMatrix); // Matrix is updated in transform and size
-        mpQuadShader->fillValue("atlas", 1);
-
-        // Draw character quad (vertex count must be 6)
-        glDrawArrays(GL_TRIANGLES, 0, 6);
+        DrawBatcher::Instance instance;
+        instance.color = iconColor;
+        instance.color.a *= alpha;
+
+        // Fill position of glyph in atlas
+        instance.textureRect = glm::vec4(
+            mpGlyph->atlasPosition.x,
+            mpGlyph->atlasPosition.y,
+            mpGlyph->atlasPosition.z - mpGlyph->atlasPosition.x,
+            mpGlyph->atlasPosition.w - mpGlyph->atlasPosition.y);
+
+        // Render character, characters of all keys are drawn at once
+        mpAssetManager->getDrawBatcher()->enqueue(
+            shaders::Type::CHARACTER_KEY,
+            mQuadMatrix, // Matrix is updated in transform and size
+            0,
+            mpFont->getAtlasTexture(),
+            instance);
 
 		// Draw threshold
 		drawThreshold(
@@ -151,55 +139,4 @@ namespace eyegui
     {
         return std::u16string(&mCharacter, 1);
     }
-
-    void CharacterKey::prepareQuad()
-    {
-        // Save currently set buffer and vertex array object
-        GLint oldBuffer = -1;
-        GLint oldVAO = -1;
-        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
-        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVAO);
-
-        // Initialize mesh buffers and vertex array object
-        glGenBuffers(1, &mQuadVertexBuffer);
-        glGenBuffers(1, &mQuadTextureCoordinateBuffer);
-        glGenVertexArrays(1, &mQuadVertexArrayObject);
-
-        // Coordinates of quad
-        float border = (1.0f - mCharacterSize) / 2.0f;
-        float a = border;
-        float b = 1.0f - border;
-
-        // Fill vertex buffer (in OpenGL space)
-        glBindBuffer(GL_ARRAY_BUFFER, mQuadVertexBuffer);
-        std::vector<glm::vec3> vertices;
-        vertices.push_back(glm::vec3(a, a, 0));
-        vertices.push_back(glm::vec3(b, a, 0));
-        vertices.push_back(glm::vec3(b, b, 0));
-        vertices.push_back(glm::vec3(b, b, 0));
-        vertices.push_back(glm::vec3(a, b, 0));
-        vertices.push_back(glm::vec3(a, a, 0));
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * 3 * sizeof(float), vertices.data(), GL_STATIC_DRAW);
-
-        // Texture coordinates are dynamic and filled in transformAndSize method
-
-        // Bind stuff to vertex array object
-        glBindVertexArray(mQuadVertexArrayObject);
-
-        // Vertices
-        GLuint vertexAttrib = glGetAttribLocation(mpQuadShader->getShaderProgram(), "posAttribute");
-        glEnableVertexAttribArray(vertexAttrib);
-        glBindBuffer(GL_ARRAY_BUFFER, mQuadVertexBuffer);
-        glVertexAttribPointer(vertexAttrib, 3, GL_FLOAT, GL_FALSE, 0, NULL);
-
-        // Texture coordinates
-        GLuint uvAttrib = glGetAttribLocation(mpQuadShader->getShaderProgram(), "uvAttribute");
-        glEnableVertexAttribArray(uvAttrib);
-        glBindBuffer(GL_ARRAY_BUFFER, mQuadTextureCoordinateBuffer);
-        glVertexAttribPointer(uvAttrib, 2, GL_FLOAT, GL_FALSE, 0, NULL);
-
-        // Restore old settings
-        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
-        glBindVertexArray(oldVAO);
-    }
 }
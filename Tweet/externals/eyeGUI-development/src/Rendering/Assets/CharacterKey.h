@@ -48,18 +48,11 @@ namespace eyegui
 
     private:
 
-        // Prepare quad for displaying the character
-        void prepareQuad();
-
         // Members
         Font const * mpFont;
         char16_t mCharacter;
         Glyph const * mpGlyph;
         float mCharacterSize;
-        Shader const * mpQuadShader;
-        GLuint mQuadVertexBuffer;
-        GLuint mQuadTextureCoordinateBuffer;
-        GLuint mQuadVertexArrayObject;
         glm::mat4 mQuadMatrix;
     };
 
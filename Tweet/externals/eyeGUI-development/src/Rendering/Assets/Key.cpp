@@ -29,15 +29,8 @@ namespace eyegui
         mPicked = false;
         mPick.setValue(0);
 
-        // Fetch render item for key circle
-        mpCircleRenderItem = mpAssetManager->fetchRenderItem(
-            shaders::Type::KEY,
-            meshes::Type::QUAD);
-
-		// Fetch render item for threshold visualization
-		mpThresholdItem = mpAssetManager->fetchRenderItem(
-			shaders::Type::CIRCLE_THRESHOLD,
-			meshes::Type::QUAD);
+		// Mask of keyboard for threshold visualization
+		mMask = mpAssetManager->fetchTexture(graphics::Type::BOX)->getHandle();
     }
 
     Key::Key(const Key& rOtherKey)
@@ -52,8 +45,7 @@ namespace eyegui
         mFocus.setValue(rOtherKey.mFocus.getValue());
         mPicked = rOtherKey.mPicked;
         mPick.setValue(rOtherKey.mPick.getValue());
-        mpCircleRenderItem = rOtherKey.mpCircleRenderItem;
-		mpThresholdItem = rOtherKey.mpThresholdItem;
+		mMask = rOtherKey.mMask;
     }
 
     Key::~Key()
@@ -136,21 +128,17 @@ namespace eyegui
             glm::vec4 pickColor,
             float alpha) const
     {
-        // Bind and fill render item
-        mpCircleRenderItem->bind();
-
         // Fill color
-        glm::vec4 circleColor = color;
-        circleColor.a *= alpha;
-        mpCircleRenderItem->getShader()->fillValue("color", circleColor);
+        DrawBatcher::Instance instance;
+        instance.color = color;
+        instance.color.a *= alpha;
 
-        // Fill other uniforms
-        mpCircleRenderItem->getShader()->fillValue("matrix", mCircleMatrix); // Matrix is updated in transform and size
-        mpCircleRenderItem->getShader()->fillValue("pickColor", pickColor);
-        mpCircleRenderItem->getShader()->fillValue("pick", mPick.getValue());
+        // Fill other values
+        instance.secondColor = pickColor;
+        instance.values.x = mPick.getValue();
 
-        // Drawing
-        mpCircleRenderItem->draw();
+        // Drawing, circles of all keys are drawn at once
+        mpAssetManager->getDrawBatcher()->enqueue(shaders::Type::KEY, mCircleMatrix, 0, 0, instance); // Matrix is updated in transform and size
     }
 
 	void Key::drawThreshold(
@@ -160,13 +148,10 @@ namespace eyegui
 	{
 		if (threshold > 0)
 		{
-			mpThresholdItem->bind();
-			mpThresholdItem->getShader()->fillValue("matrix", mCircleMatrix);
-			mpThresholdItem->getShader()->fillValue("thresholdColor", thresholdColor);
-			mpThresholdItem->getShader()->fillValue("threshold", threshold);
-			mpThresholdItem->getShader()->fillValue("alpha", alpha);
-			mpThresholdItem->getShader()->fillValue("mask", 0); // mask is always in slot 0
-			mpThresholdItem->draw();
+			DrawBatcher::Instance instance;
+			instance.color = thresholdColor;
+			instance.values = glm::vec4(threshold, alpha, 0, 0);
+			mpAssetManager->getDrawBatcher()->enqueue(shaders::Type::CIRCLE_THRESHOLD, mCircleMatrix, mMask, 0, instance);
 		}
 	}
 }
@@ -100,8 +100,7 @@ namespace eyegui
         int mSize;
         Layout const * mpLayout;
         AssetManager* mpAssetManager;
-        RenderItem const * mpCircleRenderItem;
-		RenderItem const * mpThresholdItem;
+		GLuint mMask;
         bool mFocused;
         LerpValue mFocus;
         bool mPicked;
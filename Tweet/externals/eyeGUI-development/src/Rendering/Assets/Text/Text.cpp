@@ -11,6 +11,8 @@
 #include "src/Rendering/AssetManager.h"
 #include "src/Utilities/OperationNotifier.h"
 
+#include <cstddef>
+
 namespace eyegui
 {
 
@@ -37,6 +39,8 @@ namespace eyegui
         mX = 0;
         mY = 0;
         mVertexCount = 0;
+        mMeshBounds = glm::vec4(0);
+        mVertexBufferCapacity = 0;
 
 		// Background
 		mpBackground = mpAssetManager->fetchRenderItem(shaders::Type::COLOR, meshes::Type::QUAD);
@@ -57,6 +61,8 @@ namespace eyegui
 		this->mContent = rOtherText.mContent;
 		this->mpShader = rOtherText.mpShader;
 		this->mVertexCount = 0;
+		this->mMeshBounds = glm::vec4(0);
+		this->mVertexBufferCapacity = 0;
 
 		// Create own text for the copy
 		prepareText();
@@ -67,9 +73,8 @@ namespace eyegui
         // Delete vertex array object
         glDeleteVertexArrays(1, &mVertexArrayObject);
 
-        // Delete buffers
+        // Delete buffer
         glDeleteBuffers(1, &mVertexBuffer);
-        glDeleteBuffers(1, &mTextureCoordinateBuffer);
     }
 
     void Text::setContent(std::u16string content)
@@ -82,7 +87,7 @@ namespace eyegui
     {
         // Save currently set buffer
         GLint oldBuffer = -1;
-        glGetIntegerv(GL_ARRAY_BUFFER, &oldBuffer);
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
 
         // Get height of line
         float lineHeight = mScale * mpFont->getLineHeight(mFontSize);
@@ -93,22 +98,43 @@ namespace eyegui
         // Streamline line ending
         streamlineLineEnding(copyContent);
 
-        // Structures for OpenGL
-        std::vector<glm::vec3> vertices;
-        std::vector<glm::vec2> textureCoordinates;
-
         // Let the subclasses to the work
-        specialCalculateMesh(copyContent, lineHeight, vertices, textureCoordinates);
+        GLuint firstChangedVertex = (GLuint)specialCalculateMesh(copyContent, lineHeight, mVertices);
 
         // Vertex count
-        mVertexCount = (GLuint)vertices.size();
+        mVertexCount = (GLuint)mVertices.size();
 
-        // Fill into buffer
-        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
-        glBufferData(GL_ARRAY_BUFFER, mVertexCount * 3 * sizeof(float), vertices.data(), GL_DYNAMIC_DRAW);
+        // Bounds of mesh
+        mMeshBounds = glm::vec4(0);
+        if (!mVertices.empty())
+        {
+            const glm::vec3& rFirst = mVertices[0].position;
+            mMeshBounds = glm::vec4(rFirst.x, rFirst.y, rFirst.x, rFirst.y);
+            for (const TextVertex& rVertex : mVertices)
+            {
+                mMeshBounds = glm::vec4(
+                    glm::min(mMeshBounds.x, rVertex.position.x),
+                    glm::min(mMeshBounds.y, rVertex.position.y),
+                    glm::max(mMeshBounds.z, rVertex.position.x),
+                    glm::max(mMeshBounds.w, rVertex.position.y));
+            }
+        }
 
-        glBindBuffer(GL_ARRAY_BUFFER, mTextureCoordinateBuffer);
-        glBufferData(GL_ARRAY_BUFFER, mVertexCount * 2 * sizeof(float), textureCoordinates.data(), GL_DYNAMIC_DRAW);
+        // Fill into buffer. Only changed part is uploaded if buffer is big enough
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        if (mVertexCount > mVertexBufferCapacity || firstChangedVertex == 0)
+        {
+            glBufferData(GL_ARRAY_BUFFER, mVertexCount * sizeof(TextVertex), mVertices.data(), GL_DYNAMIC_DRAW);
+            mVertexBufferCapacity = mVertexCount;
+        }
+        else if (firstChangedVertex < mVertexCount)
+        {
+            glBufferSubData(
+                GL_ARRAY_BUFFER,
+                firstChangedVertex * sizeof(TextVertex),
+                (mVertexCount - firstChangedVertex) * sizeof(TextVertex),
+                mVertices.data() + firstChangedVertex);
+        }
 
         // Restore old setting
         glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
@@ -116,10 +142,18 @@ namespace eyegui
 
     Text::Word Text::calculateWord(std::u16string content, float scale) const
     {
+        // Look up cache first
+        WordCache* pWordCache = mpAssetManager->getWordCache();
+        uint generation = mpFont->getGeneration();
+        Word const * pCachedWord = pWordCache->find(mpFont, generation, mFontSize, scale, content);
+        if (pCachedWord != NULL)
+        {
+            return *pCachedWord;
+        }
+
         // Empty word
-        Word word;
-        word.spVertices = std::shared_ptr<std::vector<glm::vec3> >(new std::vector<glm::vec3>);
-        word.spTextureCoordinates = std::shared_ptr<std::vector<glm::vec2> >(new std::vector<glm::vec2>);
+        std::shared_ptr<std::vector<TextVertex> > spVertices(new std::vector<TextVertex>);
+        spVertices->reserve(content.size() * 6);
 
         // Fill word with data
         float xPixelPen = 0;
@@ -134,13 +168,14 @@ namespace eyegui
                 continue;
             }
 
-            float yPixelPen = 0 - (scale * (float)(pGlyph->size.y - pGlyph->bearing.y));
+            float xPixelQuad = xPixelPen + (scale * pGlyph->bearing.x);
+            float yPixelQuad = 0 - (scale * (pGlyph->size.y - pGlyph->bearing.y));
 
             // Vertices for this quad
-            glm::vec3 vertexA = glm::vec3(xPixelPen, yPixelPen, 0);
-            glm::vec3 vertexB = glm::vec3(xPixelPen + (scale * pGlyph->size.x), yPixelPen, 0);
-            glm::vec3 vertexC = glm::vec3(xPixelPen + (scale * pGlyph->size.x), yPixelPen + (scale * pGlyph->size.y), 0);
-            glm::vec3 vertexD = glm::vec3(xPixelPen, yPixelPen + (scale * pGlyph->size.y), 0);
+            glm::vec3 vertexA = glm::vec3(xPixelQuad, yPixelQuad, 0);
+            glm::vec3 vertexB = glm::vec3(xPixelQuad + (scale * pGlyph->size.x), yPixelQuad, 0);
+            glm::vec3 vertexC = glm::vec3(xPixelQuad + (scale * pGlyph->size.x), yPixelQuad + (scale * pGlyph->size.y), 0);
+            glm::vec3 vertexD = glm::vec3(xPixelQuad, yPixelQuad + (scale * pGlyph->size.y), 0);
 
             // Texture coordinates for this quad
             glm::vec2 textureCoordinateA = glm::vec2(pGlyph->atlasPosition.x, pGlyph->atlasPosition.y);
@@ -150,25 +185,23 @@ namespace eyegui
 
             xPixelPen += scale * pGlyph->advance.x;
 
-            // Fill into data blocks
-            word.spVertices->push_back(vertexA);
-            word.spVertices->push_back(vertexB);
-            word.spVertices->push_back(vertexC);
-            word.spVertices->push_back(vertexC);
-            word.spVertices->push_back(vertexD);
-            word.spVertices->push_back(vertexA);
-
-            word.spTextureCoordinates->push_back(textureCoordinateA);
-            word.spTextureCoordinates->push_back(textureCoordinateB);
-            word.spTextureCoordinates->push_back(textureCoordinateC);
-            word.spTextureCoordinates->push_back(textureCoordinateC);
-            word.spTextureCoordinates->push_back(textureCoordinateD);
-            word.spTextureCoordinates->push_back(textureCoordinateA);
+            // Fill into data block
+            spVertices->push_back({ vertexA, textureCoordinateA });
+            spVertices->push_back({ vertexB, textureCoordinateB });
+            spVertices->push_back({ vertexC, textureCoordinateC });
+            spVertices->push_back({ vertexC, textureCoordinateC });
+            spVertices->push_back({ vertexD, textureCoordinateD });
+            spVertices->push_back({ vertexA, textureCoordinateA });
         }
 
-        // Set width of whole word
+        // Set geometry and width of whole word
+        Word word;
+        word.spVertices = spVertices;
         word.pixelWidth = xPixelPen;
 
+        // Remember word for other texts
+        pWordCache->insert(mpFont, generation, mFontSize, scale, content, word);
+
         return word;
     }
 
@@ -180,25 +213,23 @@ namespace eyegui
 		glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
 		glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVAO);
 
-		// Initialize mesh buffers and vertex array object
+		// Initialize mesh buffer and vertex array object
 		glGenBuffers(1, &mVertexBuffer);
-		glGenBuffers(1, &mTextureCoordinateBuffer);
 		glGenVertexArrays(1, &mVertexArrayObject);
 
 		// Bind stuff to vertex array object
 		glBindVertexArray(mVertexArrayObject);
+		glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
 
 		// Vertices
 		GLuint vertexAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "posAttribute");
 		glEnableVertexAttribArray(vertexAttrib);
-		glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
-		glVertexAttribPointer(vertexAttrib, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+		glVertexAttribPointer(vertexAttrib, 3, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (GLvoid*)offsetof(TextVertex, position));
 
-		// Texture coordinates
+		// Texture coordinates (interleaved with vertices)
 		GLuint uvAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "uvAttribute");
 		glEnableVertexAttribArray(uvAttrib);
-		glBindBuffer(GL_ARRAY_BUFFER, mTextureCoordinateBuffer);
-		glVertexAttribPointer(uvAttrib, 2, GL_FLOAT, GL_FALSE, 0, NULL);
+		glVertexAttribPointer(uvAttrib, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (GLvoid*)offsetof(TextVertex, textureCoordinate));
 
 		// Restore old settings
 		glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
@@ -10,6 +10,7 @@
 #define TEXT_H_
 
 #include "src/Rendering/Font/Font.h"
+#include "src/Rendering/Assets/Text/WordCache.h"
 #include "src/Rendering/Shader.h"
 #include "externals/OpenGLLoader/gl_core_3_3.h"
 
@@ -50,23 +51,19 @@ namespace eyegui
     protected:
 
         // Struct for word
-        struct Word
-        {
-            std::shared_ptr<std::vector<glm::vec3> > spVertices;
-            std::shared_ptr<std::vector<glm::vec2> > spTextureCoordinates;
-            float pixelWidth;
-        };
+        typedef TextWord Word;
 
         // Calculate mesh (in pixel coordinates). Calls specialized method of subclasses
         void calculateMesh();
 
-        // Special calculate mesh implemented by specialized classes
-        virtual void specialCalculateMesh(
+        // Special calculate mesh implemented by specialized classes. Vertices contain mesh
+        // of last calculation. Returns index of first vertex which has been changed
+        virtual uint specialCalculateMesh(
             std::u16string streamlinedContent,
-            float lineHeight, std::vector<glm::vec3>& rVertices,
-            std::vector<glm::vec2>& rTextureCoordinates) = 0;
+            float lineHeight,
+            std::vector<TextVertex>& rVertices) = 0;
 
-        // Calculate single word and returns it
+        // Calculate single word and returns it. Words are taken from cache if possible
         Word calculateWord(std::u16string content, float scale) const;
 
 		// Prepare text
@@ -84,9 +81,11 @@ namespace eyegui
 		RenderItem const * mpBackground;
 
         Shader const * mpShader;
+        std::vector<TextVertex> mVertices;
         GLuint mVertexCount;
+        glm::vec4 mMeshBounds; // minimum (xy) and maximum (zw) of vertices
         GLuint mVertexBuffer;
-        GLuint mTextureCoordinateBuffer;
+        GLuint mVertexBufferCapacity; // count of vertices buffer has space for
         GLuint mVertexArrayObject;
     };
 }
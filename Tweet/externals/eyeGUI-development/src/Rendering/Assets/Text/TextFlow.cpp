@@ -14,6 +14,7 @@
 #include "externals/GLM/glm/gtc/matrix_transform.hpp"
 
 #include <cmath>
+#include <map>
 
 namespace eyegui
 {
@@ -42,6 +43,21 @@ namespace eyegui
         // TransformAndSize has to be called before usage (no calculate mesh is called here)
         mWidth = 0;
         mHeight = 0;
+
+        // No layout yet
+        mLayoutEnd.vertexCount = 0;
+        mLayoutEnd.yPixelPen = 0;
+        mLayoutEnd.flowWidth = 0;
+        mLayoutEnd.failure = false;
+        mLayoutValid = false;
+        mLayoutWidth = 0;
+        mLayoutHeight = 0;
+        mLayoutLineHeight = 0;
+        mLayoutGeneration = 0;
+        mPixelOfSpace = 0;
+        mOverflowLine.pixelWidth = 0;
+        mOverflowLine.hasNext = false;
+        mOverflowLineFits = false;
     }
 
     TextFlow::~TextFlow()
@@ -56,11 +72,16 @@ namespace eyegui
         int width,
         int height)
     {
+        // Mesh is in local coordinates, so only new size or resized font atlases require new layout
+        bool resized = (width != mWidth) || (height != mHeight);
         mX = x;
         mY = y;
         mWidth = width;
         mHeight = height;
-        calculateMesh();
+        if (resized || !mLayoutValid || mLayoutGeneration != mpFont->getGeneration())
+        {
+            calculateMesh();
+        }
     }
 
     void TextFlow::draw(
@@ -83,6 +104,38 @@ namespace eyegui
             break;
         }
 
+        // Area covered by glyphs (mesh has origin at upper left of flow and y axis pointing up)
+        int left = mX + (int)std::floor(mMeshBounds.x) - 1;
+        int top = mY + yOffset - (int)std::ceil(mMeshBounds.w) - 1;
+        int right = mX + (int)std::ceil(mMeshBounds.z) + 1;
+        int bottom = mY + yOffset - (int)std::floor(mMeshBounds.y) + 1;
+
+        // Background is drawn around flow
+        if (renderBackground)
+        {
+            int value = mWidth < mHeight ? mWidth : mHeight;
+            int extraPixels = (int)(((float)value) * TEXT_BACKGROUND_SIZE) - value;
+            left = std::min(left, mX + ((mWidth - (extraPixels + mFlowWidth)) / 2));
+            top = std::min(top, mY + yOffset - (extraPixels / 2));
+            right = std::max(right, mX + ((mWidth + extraPixels + mFlowWidth) / 2) + 1);
+            bottom = std::max(bottom, mY + yOffset + mFlowHeight + extraPixels);
+        }
+        glm::mat4 boundsMatrix = calculateDrawMatrix(
+            mpGUI->getWindowWidth(),
+            mpGUI->getWindowHeight(),
+            left,
+            top,
+            right - left,
+            bottom - top);
+
+        // Let draw batcher decide when to draw, so quads of surrounding elements are not split into many batches
+        mpAssetManager->getDrawBatcher()->enqueue(
+            boundsMatrix,
+            [this, color, alpha, renderBackground, yOffset]() { drawFlow(color, alpha, renderBackground, yOffset); });
+    }
+
+    void TextFlow::drawFlow(glm::vec4 color, float alpha, bool renderBackground, int yOffset) const
+    {
 		// Calculate transformation matrix for text flow
 		glm::mat4 matrix = glm::mat4(1.0f);
 		matrix = glm::translate(matrix, glm::vec3(mX, mpGUI->getWindowHeight() - (mY + yOffset), 0)); // Change coordinate system and translate to position
@@ -109,14 +162,7 @@ namespace eyegui
 		}
 
         // Bind atlas texture
-        if (mScale == 1.0f)
-        {
-            mpFont->bindAtlasTexture(mFontSize, 1, false);
-        }
-        else
-        {
-            mpFont->bindAtlasTexture(mFontSize, 1, true);
-        }
+        mpFont->bindAtlasTexture(1);
 
 		// Bind shader
 		mpShader->bind();
@@ -132,178 +178,301 @@ namespace eyegui
         glDrawArrays(GL_TRIANGLES, 0, mVertexCount);
     }
 
-    void TextFlow::specialCalculateMesh(
+    uint TextFlow::specialCalculateMesh(
             std::u16string streamlinedContent,
-            float lineHeight, std::vector<glm::vec3>& rVertices,
-            std::vector<glm::vec2>& rTextureCoordinates)
+            float lineHeight,
+            std::vector<TextVertex>& rVertices)
     {
-		// Reset flow width to get longest line's width of this computation
-		mFlowWidth = 0;
-
         // OpenGL setup done in calling method
 
-        // Get size of space character
-        float pixelOfSpace = 0;
-
-        Glyph const * pGlyph = mpFont->getGlyph(mFontSize, u' ');
-        if (pGlyph == NULL)
+        // Seperate into paragraphs
+        std::vector<std::u16string> paragraphs;
+        size_t begin = 0;
+        size_t pos = 0;
+        while ((pos = streamlinedContent.find(u'\n', begin)) != std::u16string::npos)
         {
-            throwWarning(
-                OperationNotifier::Operation::RUNTIME,
-                "TextFlow creation does not find space sign in font");
+            paragraphs.push_back(streamlinedContent.substr(begin, pos - begin));
+            begin = pos + 1;
         }
-        else
+        paragraphs.push_back(streamlinedContent.substr(begin)); // Last paragraph (paragraphs never empty)
+
+        // Layout of previous calculation can be continued when nothing but content changed
+        uint generation = mpFont->getGeneration();
+        bool reuse = mLayoutValid
+            && !mLayoutEnd.failure
+            && mLayoutWidth == mWidth
+            && mLayoutHeight == mHeight
+            && mLayoutLineHeight == lineHeight
+            && mLayoutGeneration == generation;
+
+        if (!reuse)
         {
-            pixelOfSpace = mScale * pGlyph->advance.x;
-        }
+            mParagraphs.clear();
+            rVertices.clear();
 
-        // Create mark for overflow
-        Word overflowMark = calculateWord(TEXT_FLOW_OVERFLOW_MARK, mScale);
+            // Get size of space character
+            mPixelOfSpace = 0;
+            Glyph const * pGlyph = mpFont->getGlyph(mFontSize, u' ');
+            if (pGlyph == NULL)
+            {
+                throwWarning(
+                    OperationNotifier::Operation::RUNTIME,
+                    "TextFlow creation does not find space sign in font");
+            }
+            else
+            {
+                mPixelOfSpace = mScale * pGlyph->advance.x;
+            }
 
-        // Get pararaphs separated by \n
-        std::vector<std::u16string> paragraphs;
-        std::u16string paragraphDelimiter = u"\n";
+            // Create mark for overflow, aligned like single word in line
+            Word overflowMark = calculateWord(TEXT_FLOW_OVERFLOW_MARK, mScale);
+            float xOffset = 0;
+            if (mAlignment == TextFlowAlignment::RIGHT || mAlignment == TextFlowAlignment::CENTER)
+            {
+                xOffset = (float)mWidth - overflowMark.pixelWidth;
+                if (mAlignment == TextFlowAlignment::CENTER)
+                {
+                    xOffset = xOffset / 2.0f;
+                }
+            }
+            mOverflowLine.vertices.clear();
+            for (const TextVertex& rVertex : *(overflowMark.spVertices))
+            {
+                mOverflowLine.vertices.push_back({
+                    glm::vec3(rVertex.position.x + xOffset, rVertex.position.y, rVertex.position.z),
+                    rVertex.textureCoordinate });
+            }
+            mOverflowLine.pixelWidth = overflowMark.pixelWidth;
+            mOverflowLine.hasNext = false;
+            mOverflowLineFits = overflowMark.pixelWidth <= mWidth;
+        }
 
-        // Seperate into paragraphs
-        size_t pos = 0;
-        std::u16string token;
-        while ((pos = streamlinedContent.find(paragraphDelimiter)) != std::u16string::npos)
+        // Paragraphs in front of first changed one stay as they are
+        uint firstChanged = 0;
+        while (firstChanged < mParagraphs.size()
+            && firstChanged < paragraphs.size()
+            && mParagraphs[firstChanged].content == paragraphs[firstChanged])
         {
-            token = streamlinedContent.substr(0, pos);
-            paragraphs.push_back(token);
-            streamlinedContent.erase(0, pos + paragraphDelimiter.length());
+            firstChanged++;
         }
-        paragraphs.push_back(streamlinedContent); // Last paragraph (paragraphs never empty)
 
-        // Do not generate text flow mesh when there is a failure
-        bool failure = false;
-
-        // Go over paragraphs (pens are in local pixel coordinate system with origin in lower left corner of element)
-        float yPixelPen = -lineHeight; // First line should be also inside flow
-        for (std::u16string& rPargraph : paragraphs)
+        // Remember layouts of following paragraphs, as they may only have been moved
+        std::map<std::u16string, std::shared_ptr<const ParagraphLayout> > knownLayouts;
+        for (uint i = firstChanged; i < mParagraphs.size(); i++)
         {
-            // Get words out of paragraph
-            std::vector<Word> words;
-            std::u16string wordDelimiter = u" ";
-            while ((pos = rPargraph.find(wordDelimiter)) != std::u16string::npos)
+            if (mParagraphs[i].spLayout)
             {
-                token = rPargraph.substr(0, pos);
-                rPargraph.erase(0, pos + wordDelimiter.length());
-                failure |= !insertFitWord(words, token, mWidth, mScale);
+                knownLayouts[mParagraphs[i].content] = mParagraphs[i].spLayout;
             }
+        }
 
-            // Add last token from paragraph as well
-            failure |= !insertFitWord(words, rPargraph, mWidth, mScale);
+        // Continue at state in front of first changed paragraph (pens are in local pixel
+        // coordinate system with origin in lower left corner of element)
+        LayoutState state;
+        if (firstChanged < mParagraphs.size())
+        {
+            state = mParagraphs[firstChanged].state;
+        }
+        else if (reuse)
+        {
+            state = mLayoutEnd;
+        }
+        else
+        {
+            state.vertexCount = 0;
+            state.yPixelPen = -lineHeight; // First line should be also inside flow
+            state.flowWidth = 0;
+            state.failure = false;
+        }
+        uint firstChangedVertex = state.vertexCount;
+        rVertices.resize(state.vertexCount);
+        mParagraphs.resize(firstChanged);
 
-            // Failure appeared, forget it
-            if (!failure)
-            {
-                // Prepare some values
-                uint wordIndex = 0;
-                bool hasNext = !words.empty();
+        // Go over changed and following paragraphs
+        for (uint i = firstChanged; i < paragraphs.size(); i++)
+        {
+            Paragraph paragraph;
+            paragraph.state = state;
 
-                // Go over lines to write paragraph
-                while (hasNext && abs(yPixelPen) <= mHeight)
+            // Do not generate text flow mesh when there is a failure, so no layout of following paragraphs is required
+            if (!state.failure)
+            {
+                auto it = knownLayouts.find(paragraphs[i]);
+                paragraph.spLayout = (it != knownLayouts.end()) ? it->second : layoutParagraph(paragraphs[i]);
+                state.failure = paragraph.spLayout->failure;
+            }
+            paragraph.content = std::move(paragraphs[i]);
+            if (!state.failure)
+            {
+                for (const Line& rLine : paragraph.spLayout->lines)
                 {
-                    // Collect words in one line
-                    std::vector<Word const *> line;
-                    float wordsPixelWidth = 0;
-                    float newWordsWithSpacesPixelWidth = 0;
-
-                    // Still words in the paragraph and enough space? Fill into line!
-                    while (hasNext && newWordsWithSpacesPixelWidth <= mWidth)
+                    // Stop when flow is full
+                    if (abs(state.yPixelPen) > mHeight)
                     {
-                        // First word should always fit into width because of previous checks
-                        wordsPixelWidth += words[wordIndex].pixelWidth;
-                        line.push_back(&words[wordIndex]);
-                        wordIndex++;
-
-                        if (wordIndex >= words.size())
-                        {
-                            // No words in paragraph left
-                            hasNext = false;
-                        }
-                        else
-                        {
-                            // Calculate next width of line
-                            newWordsWithSpacesPixelWidth = std::ceil(
-                                (wordsPixelWidth + (float)words[wordIndex].pixelWidth) // Words size (old ones and new one)
-                                + (((float)line.size()) - 1.0f) * pixelOfSpace); // Spaces between words
-                        }
+                        break;
                     }
 
                     // If this is last line and after it still words left, replace it by some mark for overflow
-                    if (hasNext && abs(yPixelPen - lineHeight) > mHeight && overflowMark.pixelWidth <= mWidth)
-                    {
-                        line.clear();
-                        wordsPixelWidth = overflowMark.pixelWidth;
-                        line.push_back(&overflowMark);
-                    }
-
-					// Remember longest line's width
-					mFlowWidth = mFlowWidth < ((int) wordsPixelWidth + 1) ? ((int)wordsPixelWidth + 1) : mFlowWidth;
-
-                    // Decide dynamic space for line
-                    float dynamicSpace = pixelOfSpace;
-                    if (line.size() > 1)
+                    Line const * pLine = &rLine;
+                    if (rLine.hasNext && abs(state.yPixelPen - lineHeight) > mHeight && mOverflowLineFits)
                     {
-                        if (mAlignment == TextFlowAlignment::JUSTIFY && hasNext && line.size() > 1) // Do not use dynamic space for last line
-                        {
-                            // For justify, do something dynamic
-                            dynamicSpace = ((float)mWidth - wordsPixelWidth) / ((float)line.size() - 1.0f);
-                        }
-                        else
-                        {
-                            // Adjust space to compensate precision errors in other alignments
-                            float calculatedDynamicSpace = (float)mWidth - (wordsPixelWidth / (float)(line.size() - 1));
-                            dynamicSpace = std::min(dynamicSpace, calculatedDynamicSpace);
-                        }
+                        pLine = &mOverflowLine;
                     }
 
-                    // Now decide xOffset for line
-                    float xOffset = 0;
-                    if (mAlignment == TextFlowAlignment::RIGHT || mAlignment == TextFlowAlignment::CENTER)
-                    {
-                        xOffset = (float)mWidth - ((wordsPixelWidth + ((float)line.size() - 1.0f) * dynamicSpace));
-                        if (mAlignment == TextFlowAlignment::CENTER)
-                        {
-                            xOffset = xOffset / 2.0f;
-                        }
-                    }
+                    // Remember longest line's width
+                    state.flowWidth = state.flowWidth < ((int)pLine->pixelWidth + 1) ? ((int)pLine->pixelWidth + 1) : state.flowWidth;
 
-                    // Combine word geometry to one line
-                    float xPixelPen = xOffset;
-                    for (uint i = 0; i < line.size(); i++)
+                    // Move line to pen
+                    for (const TextVertex& rVertex : pLine->vertices)
                     {
-                        // Assuming, that the count of vertices and texture coordinates is equal
-                        for (uint j = 0; j < line[i]->spVertices->size(); j++)
-                        {
-                            const glm::vec3& rVertex = line[i]->spVertices->at(j);
-                            rVertices.push_back(glm::vec3(rVertex.x + xPixelPen, rVertex.y + yPixelPen, rVertex.z));
-                            const glm::vec2& rTextureCoordinate = line[i]->spTextureCoordinates->at(j);
-                            rTextureCoordinates.push_back(glm::vec2(rTextureCoordinate.s, rTextureCoordinate.t));
-                        }
-
-                        // Advance xPen
-                        xPixelPen += dynamicSpace + line[i]->pixelWidth;
+                        rVertices.push_back({
+                            glm::vec3(rVertex.position.x, rVertex.position.y + state.yPixelPen, rVertex.position.z),
+                            rVertex.textureCoordinate });
                     }
 
                     // Advance yPen
-                    yPixelPen -= lineHeight;
+                    state.yPixelPen -= lineHeight;
                 }
             }
+            state.vertexCount = (uint)rVertices.size();
+
+            mParagraphs.push_back(std::move(paragraph));
         }
 
         // If failure appeared, clean up
-        if (failure)
+        if (state.failure)
         {
             // Vertex count will become zero
             rVertices.clear();
-            rTextureCoordinates.clear();
+            firstChangedVertex = 0;
+        }
+
+        // Remember layout for next calculation
+        mLayoutEnd = state;
+        mLayoutValid = true;
+        mLayoutWidth = mWidth;
+        mLayoutHeight = mHeight;
+        mLayoutLineHeight = lineHeight;
+        mLayoutGeneration = generation;
+
+        // Width of longest line and height of all lines (yPixelPen is one line to low now)
+        mFlowWidth = state.flowWidth;
+        mFlowHeight = (int)std::max(std::ceil(abs(state.yPixelPen) - lineHeight), 0.0f);
+
+        return firstChangedVertex;
+    }
+
+    std::shared_ptr<const TextFlow::ParagraphLayout> TextFlow::layoutParagraph(const std::u16string& rContent) const
+    {
+        std::shared_ptr<ParagraphLayout> spLayout(new ParagraphLayout);
+
+        // Get words out of paragraph
+        std::vector<Word> words;
+        bool failure = false;
+        size_t begin = 0;
+        size_t pos = 0;
+        while (!failure && (pos = rContent.find(u' ', begin)) != std::u16string::npos)
+        {
+            failure = !insertFitWord(words, rContent.substr(begin, pos - begin), mWidth, mScale);
+            begin = pos + 1;
+        }
+
+        // Add last token from paragraph as well
+        if (!failure)
+        {
+            failure = !insertFitWord(words, rContent.substr(begin), mWidth, mScale);
+        }
+
+        // Failure appeared, forget it
+        spLayout->failure = failure;
+        if (failure)
+        {
+            return spLayout;
+        }
+
+        // Prepare some values
+        uint wordIndex = 0;
+        bool hasNext = !words.empty();
+
+        // Go over lines to write paragraph
+        while (hasNext)
+        {
+            // Collect words in one line
+            std::vector<Word const *> line;
+            float wordsPixelWidth = 0;
+            float newWordsWithSpacesPixelWidth = 0;
+
+            // Still words in the paragraph and enough space? Fill into line!
+            while (hasNext && newWordsWithSpacesPixelWidth <= mWidth)
+            {
+                // First word should always fit into width because of previous checks
+                wordsPixelWidth += words[wordIndex].pixelWidth;
+                line.push_back(&words[wordIndex]);
+                wordIndex++;
+
+                if (wordIndex >= words.size())
+                {
+                    // No words in paragraph left
+                    hasNext = false;
+                }
+                else
+                {
+                    // Calculate next width of line
+                    newWordsWithSpacesPixelWidth = std::ceil(
+                        (wordsPixelWidth + (float)words[wordIndex].pixelWidth) // Words size (old ones and new one)
+                        + (((float)line.size()) - 1.0f) * mPixelOfSpace); // Spaces between words
+                }
+            }
+
+            // Decide dynamic space for line
+            float dynamicSpace = mPixelOfSpace;
+            if (line.size() > 1)
+            {
+                if (mAlignment == TextFlowAlignment::JUSTIFY && hasNext && line.size() > 1) // Do not use dynamic space for last line
+                {
+                    // For justify, do something dynamic
+                    dynamicSpace = ((float)mWidth - wordsPixelWidth) / ((float)line.size() - 1.0f);
+                }
+                else
+                {
+                    // Adjust space to compensate precision errors in other alignments
+                    float calculatedDynamicSpace = (float)mWidth - (wordsPixelWidth / (float)(line.size() - 1));
+                    dynamicSpace = std::min(dynamicSpace, calculatedDynamicSpace);
+                }
+            }
+
+            // Now decide xOffset for line
+            float xOffset = 0;
+            if (mAlignment == TextFlowAlignment::RIGHT || mAlignment == TextFlowAlignment::CENTER)
+            {
+                xOffset = (float)mWidth - ((wordsPixelWidth + ((float)line.size() - 1.0f) * dynamicSpace));
+                if (mAlignment == TextFlowAlignment::CENTER)
+                {
+                    xOffset = xOffset / 2.0f;
+                }
+            }
+
+            // Combine word geometry to one line
+            Line combined;
+            combined.pixelWidth = wordsPixelWidth;
+            combined.hasNext = hasNext;
+            float xPixelPen = xOffset;
+            for (uint i = 0; i < line.size(); i++)
+            {
+                for (const TextVertex& rVertex : *(line[i]->spVertices))
+                {
+                    combined.vertices.push_back({
+                        glm::vec3(rVertex.position.x + xPixelPen, rVertex.position.y, rVertex.position.z),
+                        rVertex.textureCoordinate });
+                }
+
+                // Advance xPen
+                xPixelPen += dynamicSpace + line[i]->pixelWidth;
+            }
+            spLayout->lines.push_back(std::move(combined));
         }
 
-        // Get height of all lines (yPixelPen is one line to low now)
-        mFlowHeight = (int)std::max(std::ceil(abs(yPixelPen) - lineHeight), 0.0f);
+        return spLayout;
     }
 
     std::vector<TextFlow::Word> TextFlow::calculateFitWord(std::u16string content, int maxPixelWidth, float scale) const
@@ -14,6 +14,8 @@
 
 #include "src/Rendering/Assets/Text/Text.h"
 
+#include <memory>
+
 namespace eyegui
 {
     class TextFlow : public Text
@@ -46,11 +48,50 @@ namespace eyegui
 
     protected:
 
-        // Calculate mesh (in pixel coordinates)
-        virtual void specialCalculateMesh(
+        // Draw text flow immediately, called by draw batcher at the right time
+        void drawFlow(glm::vec4 color, float alpha, bool renderBackground, int yOffset) const;
+
+        // Line of paragraph with geometry relative to start of line on baseline
+        struct Line
+        {
+            std::vector<TextVertex> vertices;
+            float pixelWidth; // width of words without spaces
+            bool hasNext; // whether further words of paragraph follow
+        };
+
+        // Lines of paragraph, only depending on content and width of flow
+        struct ParagraphLayout
+        {
+            std::vector<Line> lines;
+            bool failure; // some word does not fit into width
+        };
+
+        // State of layout at begin of paragraph
+        struct LayoutState
+        {
+            uint vertexCount;
+            float yPixelPen;
+            int flowWidth;
+            bool failure;
+        };
+
+        // Paragraph as placed into mesh
+        struct Paragraph
+        {
+            std::u16string content;
+            std::shared_ptr<const ParagraphLayout> spLayout;
+            LayoutState state;
+        };
+
+        // Calculate mesh (in pixel coordinates). Only paragraphs starting
+        // with first changed one are placed again
+        virtual uint specialCalculateMesh(
             std::u16string streamlinedContent,
-            float lineHeight, std::vector<glm::vec3>& rVertices,
-            std::vector<glm::vec2>& rTextureCoordinates);
+            float lineHeight,
+            std::vector<TextVertex>& rVertices);
+
+        // Break paragraph into lines
+        std::shared_ptr<const ParagraphLayout> layoutParagraph(const std::u16string& rContent) const;
 
         // Calculate word with maximal width (in doubt split it). If result is empty, not enough space available
         std::vector<Word> calculateFitWord(std::u16string content, int maxPixelWidth, float scale) const;
@@ -65,6 +106,18 @@ namespace eyegui
         int mHeight;
 		int mFlowWidth;
         int mFlowHeight;
+
+        // Layout of current mesh, reused as long as size and glyphs of font do not change
+        std::vector<Paragraph> mParagraphs;
+        LayoutState mLayoutEnd;
+        bool mLayoutValid;
+        int mLayoutWidth;
+        int mLayoutHeight;
+        float mLayoutLineHeight;
+        uint mLayoutGeneration;
+        float mPixelOfSpace;
+        Line mOverflowLine;
+        bool mOverflowLineFits;
     };
 }
 
@@ -74,14 +74,7 @@ namespace eyegui
         matrix = glm::ortho(0.0f, (float)(mpGUI->getWindowWidth() - 1), 0.0f, (float)(mpGUI->getWindowHeight() - 1)) * matrix; // Pixel to world space
 
         // Bind atlas texture
-        if (mScale == 1.0f)
-        {
-            mpFont->bindAtlasTexture(mFontSize, 1, false);
-        }
-        else
-        {
-            mpFont->bindAtlasTexture(mFontSize, 1, true);
-        }
+        mpFont->bindAtlasTexture(1);
 
         mpShader->fillValue("matrix", matrix);
         mpShader->fillValue("color", color);
@@ -117,13 +110,16 @@ namespace eyegui
 		return mContent;
 	}
 
-    void TextSimple::specialCalculateMesh(
+    uint TextSimple::specialCalculateMesh(
             std::u16string streamlinedContent,
-            float lineHeight, std::vector<glm::vec3>& rVertices,
-            std::vector<glm::vec2>& rTextureCoordinates)
+            float lineHeight,
+            std::vector<TextVertex>& rVertices)
     {
         // OpenGL setup done in calling method
 
+        // Simple text is always calculated completely
+        rVertices.clear();
+
         // Go over lines and collect them
         std::u16string delimiter = u"\n";
         size_t pos = 0;
@@ -144,13 +140,12 @@ namespace eyegui
             // Just do whole line as one big word
             Word word = calculateWord(line, mScale);
 
-            // Assuming, that the count of vertices and texture coordinates is equal
-            for (uint i = 0; i < word.spVertices->size(); i++)
+            // Move word to line
+            for (const TextVertex& rVertex : *(word.spVertices))
             {
-                const glm::vec3& rVertex = word.spVertices->at(i);
-                rVertices.push_back(glm::vec3(rVertex.x, rVertex.y + yPixelPen, rVertex.z));
-                const glm::vec2& rTextureCoordinate = word.spTextureCoordinates->at(i);
-                rTextureCoordinates.push_back(glm::vec2(rTextureCoordinate.s, rTextureCoordinate.t));
+                rVertices.push_back({
+                    glm::vec3(rVertex.position.x, rVertex.position.y + yPixelPen, rVertex.position.z),
+                    rVertex.textureCoordinate });
             }
 
             // Advance yPen
@@ -164,5 +159,7 @@ namespace eyegui
         // Save used width and height
         mWidth = (int)maxPixelWidth;
         mHeight = (int)pixelHeight;
+
+        return 0;
     }
 }
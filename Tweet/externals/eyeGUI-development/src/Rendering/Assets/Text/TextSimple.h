@@ -50,10 +50,10 @@ namespace eyegui
     protected:
 
         // Calculate mesh (in pixel coordinates)
-        virtual void specialCalculateMesh(
+        virtual uint specialCalculateMesh(
             std::u16string streamlinedContent,
-            float lineHeight, std::vector<glm::vec3>& rVertices,
-            std::vector<glm::vec2>& rTextureCoordinates);
+            float lineHeight,
+            std::vector<TextVertex>& rVertices);
 
         // Members
         int mWidth;
@@ -0,0 +1,81 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "WordCache.h"
+
+#include <functional>
+
+namespace eyegui
+{
+    WordCache::WordCache()
+    {
+        // Nothing to do
+    }
+
+    WordCache::~WordCache()
+    {
+        // Nothing to do
+    }
+
+    TextWord const * WordCache::find(Font const * pFont, uint generation, FontSize fontSize, float scale, const std::u16string& rContent) const
+    {
+        Key key;
+        key.pFont = pFont;
+        key.generation = generation;
+        key.fontSize = fontSize;
+        key.scale = scale;
+        key.content = rContent;
+
+        auto it = mWords.find(key);
+        if (it != mWords.end())
+        {
+            return &(it->second);
+        }
+        return NULL;
+    }
+
+    void WordCache::insert(Font const * pFont, uint generation, FontSize fontSize, float scale, const std::u16string& rContent, const TextWord& rWord)
+    {
+        // Start over when cache is full. Texts keep their words alive on their own
+        if (mWords.size() >= TEXT_WORD_CACHE_MAX_WORDS)
+        {
+            mWords.clear();
+        }
+
+        Key key;
+        key.pFont = pFont;
+        key.generation = generation;
+        key.fontSize = fontSize;
+        key.scale = scale;
+        key.content = rContent;
+        mWords[key] = rWord;
+    }
+
+    void WordCache::invalidate()
+    {
+        mWords.clear();
+    }
+
+    bool WordCache::Key::operator==(const Key& rOther) const
+    {
+        return pFont == rOther.pFont
+            && generation == rOther.generation
+            && fontSize == rOther.fontSize
+            && scale == rOther.scale
+            && content == rOther.content;
+    }
+
+    size_t WordCache::KeyHash::operator()(const Key& rKey) const
+    {
+        size_t hash = std::hash<std::u16string>()(rKey.content);
+        hash ^= std::hash<Font const *>()(rKey.pFont) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<uint>()(rKey.generation) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<int>()((int)rKey.fontSize) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<float>()(rKey.scale) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+}
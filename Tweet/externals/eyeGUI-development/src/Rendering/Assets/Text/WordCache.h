@@ -0,0 +1,81 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Cache of word geometry shared by all texts of one GUI. Words are keyed by
+// font, generation of font, font size, scale and content. Geometry references
+// glyphs in font atlases, so words of older generations are never returned.
+
+#ifndef WORD_CACHE_H_
+#define WORD_CACHE_H_
+
+#include "src/Rendering/Font/Font.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace eyegui
+{
+    // Vertex of text mesh, position and texture coordinate are interleaved in one buffer
+    struct TextVertex
+    {
+        glm::vec3 position;
+        glm::vec2 textureCoordinate;
+    };
+
+    // Geometry of word with origin at pen position on baseline
+    struct TextWord
+    {
+        std::shared_ptr<const std::vector<TextVertex> > spVertices;
+        float pixelWidth;
+    };
+
+    class WordCache
+    {
+    public:
+
+        // Constructor
+        WordCache();
+
+        // Destructor
+        virtual ~WordCache();
+
+        // Get cached word, returns NULL if not cached
+        TextWord const * find(Font const * pFont, uint generation, FontSize fontSize, float scale, const std::u16string& rContent) const;
+
+        // Add word to cache. Generation has to be fetched before word is calculated
+        void insert(Font const * pFont, uint generation, FontSize fontSize, float scale, const std::u16string& rContent, const TextWord& rWord);
+
+        // Forget all words (call when font atlases change)
+        void invalidate();
+
+    private:
+
+        // Key of word
+        struct Key
+        {
+            bool operator==(const Key& rOther) const;
+
+            Font const * pFont;
+            uint generation;
+            FontSize fontSize;
+            float scale;
+            std::u16string content;
+        };
+
+        // Hash of key
+        struct KeyHash
+        {
+            size_t operator()(const Key& rKey) const;
+        };
+
+        // Members
+        std::unordered_map<Key, TextWord, KeyHash> mWords;
+    };
+}
+
+#endif // WORD_CACHE_H_
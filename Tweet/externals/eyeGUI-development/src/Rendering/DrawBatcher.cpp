@@ -0,0 +1,418 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "DrawBatcher.h"
+
+#include "AssetManager.h"
+#include "InstancedShaders.h"
+#include "ScissorStack.h"
+#include "src/Defines.h"
+#include "src/Utilities/OperationNotifier.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace eyegui
+{
+    DrawBatcher::Instance::Instance()
+    {
+        rect = glm::vec4(0);
+        color = glm::vec4(0);
+        secondColor = glm::vec4(0);
+        values = glm::vec4(0);
+        textureRect = glm::vec4(0, 0, 1, 1);
+        extra = glm::vec4(1, 1, 0, 0);
+    }
+
+    bool DrawBatcher::Key::operator==(const Key& rOther) const
+    {
+        return shader == rOther.shader
+            && mask == rOther.mask
+            && texture == rOther.texture
+            && scissor == rOther.scissor;
+    }
+
+    DrawBatcher::DrawBatcher(Mesh const * pQuadMesh, IconAtlas* pIconAtlas)
+    {
+        // Fill members
+        mpQuadMesh = pQuadMesh;
+        mpIconAtlas = pIconAtlas;
+        mInstanceBufferCapacity = 0;
+        mFlushing = false;
+
+        // Save currently set buffer and vertex array object
+        GLint oldBuffer = -1;
+        GLint oldVAO = -1;
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
+        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVAO);
+
+        // Vertex array object
+        glGenVertexArrays(1, &mVertexArrayObject);
+        glBindVertexArray(mVertexArrayObject);
+
+        // Vertices and texture coordinates of quad (locations are fixed in instanced vertex shader)
+        glEnableVertexAttribArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, mpQuadMesh->getVertexBuffer());
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+        glEnableVertexAttribArray(1);
+        glBindBuffer(GL_ARRAY_BUFFER, mpQuadMesh->getTextureCoordinateBuffer());
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, NULL);
+
+        // Instance values, advanced once per instance
+        glGenBuffers(1, &mInstanceBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+        for (GLuint i = 2; i < 8; i++)
+        {
+            glEnableVertexAttribArray(i);
+            glVertexAttribDivisor(i, 1);
+        }
+        setInstanceAttributes(0);
+
+        // Restore old settings
+        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+        glBindVertexArray(oldVAO);
+    }
+
+    DrawBatcher::~DrawBatcher()
+    {
+        glDeleteVertexArrays(1, &mVertexArrayObject);
+        glDeleteBuffers(1, &mInstanceBuffer);
+    }
+
+    void DrawBatcher::enqueue(shaders::Type shader, const glm::mat4& rDrawMatrix, GLuint mask, GLuint texture, Instance instance)
+    {
+        Key key;
+        key.shader = shader;
+        key.mask = mask;
+        key.texture = texture;
+        key.scissor = ScissorStack::current();
+
+        instance.rect = calculateRect(rDrawMatrix);
+        mInstances.push_back(instance);
+        join(key, instance.rect, (uint)(mInstances.size() - 1));
+    }
+
+    void DrawBatcher::enqueueIcon(shaders::Type shader, const glm::mat4& rDrawMatrix, GLuint mask, Texture const * pIcon, Instance instance)
+    {
+        IconAtlas::Region region = mpIconAtlas->getRegion(pIcon);
+        instance.textureRect = region.rect;
+        enqueue(shader, rDrawMatrix, mask, region.texture, instance);
+    }
+
+    void DrawBatcher::enqueue(const glm::mat4& rDrawMatrix, std::function<void()> drawing)
+    {
+        // Such batch is never joined by others
+        Batch batch;
+        batch.key.shader = shaders::Type::COLOR;
+        batch.key.mask = 0;
+        batch.key.texture = 0;
+        batch.key.scissor = ScissorStack::current();
+        glm::vec4 rect = calculateRect(rDrawMatrix);
+        batch.bounds = glm::vec4(rect.x, rect.y, rect.x + rect.z, rect.y + rect.w);
+        batch.drawing = drawing;
+        mBatches.push_back(batch);
+    }
+
+    void DrawBatcher::flush()
+    {
+        // Called again by drawings which cannot be batched
+        if (mFlushing || mBatches.empty())
+        {
+            return;
+        }
+        mFlushing = true;
+
+        // Make sure mipmaps of icon atlas are up to date
+        mpIconAtlas->prepare();
+
+        // Save state direct drawing relies upon
+        GLint oldActiveTexture = 0;
+        GLint oldMask = 0;
+        GLint oldTexture = 0;
+        GLint oldBuffer = 0;
+        GLint oldVAO = 0;
+        glGetIntegerv(GL_ACTIVE_TEXTURE, &oldActiveTexture);
+        glActiveTexture(GL_TEXTURE0);
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldMask);
+        glActiveTexture(GL_TEXTURE1);
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldTexture);
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
+        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVAO);
+
+        // Order instances by batch so each batch is a continuous range
+        mOrderedInstances.clear();
+        for (const Batch& rBatch : mBatches)
+        {
+            for (uint index : rBatch.instances)
+            {
+                mOrderedInstances.push_back(mInstances[index]);
+            }
+        }
+
+        // Upload instances, buffer is orphaned to avoid waiting for previous frame
+        if (!mOrderedInstances.empty())
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+            uint count = (uint)mOrderedInstances.size();
+            if (count > mInstanceBufferCapacity)
+            {
+                mInstanceBufferCapacity = std::max(count, (3 * mInstanceBufferCapacity) / 2);
+            }
+            glBufferData(GL_ARRAY_BUFFER, mInstanceBufferCapacity * sizeof(Instance), NULL, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(Instance), mOrderedInstances.data());
+        }
+
+        // Draw batches in order, only changing state where necessary
+        Shader const * pBoundShader = NULL;
+        bool stateBound = false;
+        GLuint boundMask = 0;
+        GLuint boundTexture = 0;
+        glm::ivec4 boundScissor(-1);
+        uint firstInstance = 0;
+        for (const Batch& rBatch : mBatches)
+        {
+            // Scissor
+            if (rBatch.key.scissor != boundScissor)
+            {
+                glScissor(rBatch.key.scissor.x, rBatch.key.scissor.y, rBatch.key.scissor.z, rBatch.key.scissor.w);
+                boundScissor = rBatch.key.scissor;
+            }
+
+            // Drawing which cannot be batched changes about everything
+            if (rBatch.drawing)
+            {
+                rBatch.drawing();
+                pBoundShader = NULL;
+                stateBound = false;
+                continue;
+            }
+
+            // Vertex array object and textures
+            if (!stateBound)
+            {
+                glBindVertexArray(mVertexArrayObject);
+                glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+                glActiveTexture(GL_TEXTURE0);
+                glBindTexture(GL_TEXTURE_2D, rBatch.key.mask);
+                glActiveTexture(GL_TEXTURE1);
+                glBindTexture(GL_TEXTURE_2D, rBatch.key.texture);
+                boundMask = rBatch.key.mask;
+                boundTexture = rBatch.key.texture;
+                stateBound = true;
+            }
+            if (rBatch.key.mask != boundMask)
+            {
+                glActiveTexture(GL_TEXTURE0);
+                glBindTexture(GL_TEXTURE_2D, rBatch.key.mask);
+                boundMask = rBatch.key.mask;
+            }
+            if (rBatch.key.texture != boundTexture)
+            {
+                glActiveTexture(GL_TEXTURE1);
+                glBindTexture(GL_TEXTURE_2D, rBatch.key.texture);
+                boundTexture = rBatch.key.texture;
+            }
+
+            // Shader
+            Shader const * pShader = fetchShader(rBatch.key.shader);
+            if (pShader != pBoundShader)
+            {
+                pShader->bind();
+                pBoundShader = pShader;
+            }
+
+            // Draw all quads of batch at once
+            setInstanceAttributes(firstInstance);
+            glDrawArraysInstanced(GL_TRIANGLES, 0, mpQuadMesh->getVertexCount(), (GLsizei)rBatch.instances.size());
+            firstInstance += (uint)rBatch.instances.size();
+        }
+
+        // Restore state
+        ScissorStack::apply();
+        glBindVertexArray(oldVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, oldMask);
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, oldTexture);
+        glActiveTexture(oldActiveTexture);
+
+        // Clear for next frame
+        mInstances.clear();
+        mBatches.clear();
+        mFlushing = false;
+    }
+
+    void DrawBatcher::join(const Key& rKey, const glm::vec4& rRect, uint instance)
+    {
+        // Search backwards until some batch overlaps the new quad
+        int last = (int)mBatches.size() - 1;
+        int first = std::max(0, last - (int)DRAW_BATCHER_MAX_LOOKBACK);
+        for (int i = last; i >= first; i--)
+        {
+            Batch& rBatch = mBatches[i];
+            if (!rBatch.drawing && rBatch.key == rKey)
+            {
+                rBatch.instances.push_back(instance);
+                rBatch.bounds = glm::vec4(
+                    std::min(rBatch.bounds.x, rRect.x),
+                    std::min(rBatch.bounds.y, rRect.y),
+                    std::max(rBatch.bounds.z, rRect.x + rRect.z),
+                    std::max(rBatch.bounds.w, rRect.y + rRect.w));
+                return;
+            }
+            if (overlaps(rBatch, rRect))
+            {
+                break;
+            }
+        }
+
+        // Start new batch
+        Batch batch;
+        batch.key = rKey;
+        batch.bounds = glm::vec4(rRect.x, rRect.y, rRect.x + rRect.z, rRect.y + rRect.w);
+        batch.instances.push_back(instance);
+        mBatches.push_back(batch);
+    }
+
+    bool DrawBatcher::overlaps(const Batch& rBatch, const glm::vec4& rRect) const
+    {
+        // Test bounds first
+        if (rRect.x >= rBatch.bounds.z
+            || rRect.x + rRect.z <= rBatch.bounds.x
+            || rRect.y >= rBatch.bounds.w
+            || rRect.y + rRect.w <= rBatch.bounds.y)
+        {
+            return false;
+        }
+
+        // Drawing which cannot be batched only has bounds
+        if (rBatch.drawing)
+        {
+            return true;
+        }
+
+        // Test single quads
+        for (uint index : rBatch.instances)
+        {
+            const glm::vec4& rOther = mInstances[index].rect;
+            if (rRect.x < rOther.x + rOther.z
+                && rOther.x < rRect.x + rRect.z
+                && rRect.y < rOther.y + rOther.w
+                && rOther.y < rRect.y + rRect.w)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Shader const * DrawBatcher::fetchShader(shaders::Type shader)
+    {
+        // Try to find shader
+        std::unique_ptr<Shader>& rupShader = mShaders[shader];
+        Shader* pShader = rupShader.get();
+
+        // Create shader if necessary
+        if (pShader == NULL)
+        {
+            char const * pFragmentShader = NULL;
+            bool mask = true;
+            bool texture = false;
+            switch (shader)
+            {
+            case shaders::Type::COLOR:
+                pFragmentShader = shaders::pInstancedColorFragmentShader;
+                mask = false;
+                break;
+            case shaders::Type::DIM:
+                pFragmentShader = shaders::pInstancedDimFragmentShader;
+                break;
+            case shaders::Type::ACTIVITY:
+                pFragmentShader = shaders::pInstancedActivityFragmentShader;
+                break;
+            case shaders::Type::MARK:
+                pFragmentShader = shaders::pInstancedMarkFragmentShader;
+                break;
+            case shaders::Type::CIRCLE_THRESHOLD:
+                pFragmentShader = shaders::pInstancedCircleThresholdFragmentShader;
+                break;
+            case shaders::Type::BOX_THRESHOLD:
+                pFragmentShader = shaders::pInstancedBoxThresholdFragmentShader;
+                break;
+            case shaders::Type::HIGHLIGHT:
+                pFragmentShader = shaders::pInstancedHighlightFragmentShader;
+                break;
+            case shaders::Type::SELECTION:
+                pFragmentShader = shaders::pInstancedSelectionFragmentShader;
+                break;
+            case shaders::Type::CIRCLE_BUTTON:
+                pFragmentShader = shaders::pInstancedCircleButtonFragmentShader;
+                texture = true;
+                break;
+            case shaders::Type::BOX_BUTTON:
+                pFragmentShader = shaders::pInstancedBoxButtonFragmentShader;
+                texture = true;
+                break;
+            case shaders::Type::SENSOR:
+                pFragmentShader = shaders::pInstancedSensorFragmentShader;
+                texture = true;
+                break;
+            case shaders::Type::KEY:
+                pFragmentShader = shaders::pInstancedKeyFragmentShader;
+                mask = false;
+                break;
+            case shaders::Type::CHARACTER_KEY:
+                pFragmentShader = shaders::pInstancedCharacterKeyFragmentShader;
+                mask = false;
+                break;
+            default:
+                throwError(OperationNotifier::Operation::BUG, "Shader has no instanced variant for batched drawing");
+                pFragmentShader = shaders::pInstancedColorFragmentShader;
+                mask = false;
+                break;
+            }
+            rupShader = std::unique_ptr<Shader>(new Shader(shaders::pInstancedVertexShader, pFragmentShader));
+            pShader = rupShader.get();
+
+            // Samplers are fixed to slots
+            pShader->bind();
+            if (mask)
+            {
+                pShader->fillValue("mask", 0);
+            }
+            if (texture)
+            {
+                pShader->fillValue("icon", 1);
+            }
+            if (shader == shaders::Type::CHARACTER_KEY)
+            {
+                pShader->fillValue("atlas", 1);
+            }
+        }
+
+        return pShader;
+    }
+
+    void DrawBatcher::setInstanceAttributes(uint firstInstance) const
+    {
+        // Expects instance buffer to be bound
+        std::size_t offset = firstInstance * sizeof(Instance);
+        glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (GLvoid*)(offset + offsetof(Instance, rect)));
+        glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (GLvoid*)(offset + offsetof(Instance, color)));
+        glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (GLvoid*)(offset + offsetof(Instance, secondColor)));
+        glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (GLvoid*)(offset + offsetof(Instance, values)));
+        glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (GLvoid*)(offset + offsetof(Instance, textureRect)));
+        glVertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (GLvoid*)(offset + offsetof(Instance, extra)));
+    }
+
+    glm::vec4 DrawBatcher::calculateRect(const glm::mat4& rDrawMatrix)
+    {
+        // Draw matrices only scale and translate the unit quad
+        return glm::vec4(rDrawMatrix[3][0], rDrawMatrix[3][1], rDrawMatrix[0][0], rDrawMatrix[1][1]);
+    }
+}
@@ -0,0 +1,118 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Collects quads of elements while drawing and draws quads with same shader
+// and textures in one instanced draw call. Quads may only be drawn earlier than
+// enqueued if nothing enqueued in between covers them, so result is the same
+// as drawing everything in order. Binding a shader for direct drawing flushes
+// the collected quads first.
+
+#ifndef DRAW_BATCHER_H_
+#define DRAW_BATCHER_H_
+
+#include "Shader.h"
+#include "Mesh.h"
+#include "Textures/IconAtlas.h"
+#include "externals/OpenGLLoader/gl_core_3_3.h"
+#include "externals/GLM/glm/glm.hpp"
+
+#include <functional>
+#include <memory>
+#include <map>
+#include <vector>
+
+namespace eyegui
+{
+    // Forward declaration
+    namespace shaders { enum class Type; }
+
+    class DrawBatcher
+    {
+    public:
+
+        // Values of one quad, meaning of values depends on shader
+        struct Instance
+        {
+            Instance();
+
+            glm::vec4 rect; // position and size in normalized device coordinates, filled by batcher
+            glm::vec4 color;
+            glm::vec4 secondColor; // color of icon or pick
+            glm::vec4 values; // x = value of shader, y = alpha, z = time or orientation
+            glm::vec4 textureRect; // offset and scale of icon or character in texture, filled by batcher for icons
+            glm::vec4 extra; // xy = uv scale of icon
+        };
+
+        // Constructor
+        DrawBatcher(Mesh const * pQuadMesh, IconAtlas* pIconAtlas);
+
+        // Destructor
+        virtual ~DrawBatcher();
+
+        // Enqueue quad with draw matrix as used by render items. Mask is bound to slot 0, texture to slot 1
+        void enqueue(shaders::Type shader, const glm::mat4& rDrawMatrix, GLuint mask, GLuint texture, Instance instance);
+
+        // Enqueue quad with icon in slot 1, which is drawn from icon atlas if possible
+        void enqueueIcon(shaders::Type shader, const glm::mat4& rDrawMatrix, GLuint mask, Texture const * pIcon, Instance instance);
+
+        // Enqueue drawing which cannot be batched. Draw matrix has to cover everything it draws
+        void enqueue(const glm::mat4& rDrawMatrix, std::function<void()> drawing);
+
+        // Draw everything enqueued
+        void flush();
+
+    private:
+
+        // State that has to be equal for quads drawn together
+        struct Key
+        {
+            bool operator==(const Key& rOther) const;
+
+            shaders::Type shader;
+            GLuint mask;
+            GLuint texture;
+            glm::ivec4 scissor;
+        };
+
+        // Quads drawn with one call or single drawing which cannot be batched
+        struct Batch
+        {
+            Key key;
+            glm::vec4 bounds; // minimum and maximum of all rects
+            std::vector<uint> instances; // indices of instances
+            std::function<void()> drawing;
+        };
+
+        // Add to last batch with same key that nothing enqueued afterwards overlaps, else create new batch
+        void join(const Key& rKey, const glm::vec4& rRect, uint instance);
+
+        // Whether rect overlaps anything in batch
+        bool overlaps(const Batch& rBatch, const glm::vec4& rRect) const;
+
+        // Get instanced variant of shader
+        Shader const * fetchShader(shaders::Type shader);
+
+        // Set instance attributes to start at given instance
+        void setInstanceAttributes(uint firstInstance) const;
+
+        // Convert draw matrix to rect in normalized device coordinates
+        static glm::vec4 calculateRect(const glm::mat4& rDrawMatrix);
+
+        // Members
+        Mesh const * mpQuadMesh;
+        IconAtlas* mpIconAtlas;
+        std::map<shaders::Type, std::unique_ptr<Shader> > mShaders;
+        std::vector<Instance> mInstances;
+        std::vector<Instance> mOrderedInstances;
+        std::vector<Batch> mBatches;
+        GLuint mVertexArrayObject;
+        GLuint mInstanceBuffer;
+        uint mInstanceBufferCapacity;
+        bool mFlushing;
+    };
+}
+
+#endif // DRAW_BATCHER_H_
@@ -11,6 +11,7 @@
 #include "src/Utilities/OperationNotifier.h"
 #include "Defines.h"
 #include <algorithm>
+#include <cmath>
 
 namespace eyegui
 {
@@ -18,34 +19,57 @@ namespace eyegui
         GUI const * pGUI,
         std::string filepath,
         std::unique_ptr<FT_Face> upFace,
-        std::set<char16_t> characterSet) : Font()
+        std::set<char16_t> prewarmCharacters) : Font()
     {
         // Fill members
         mpGUI = pGUI;
         mFilepath = filepath;
         mupFace = std::move(upFace);
-        mCharacterSet = characterSet;
+        mFrame = 0;
+        mGeneration = 0;
+        mUpdatedGeneration = 0;
 
-        // Initilialize textures
-        glGenTextures(1, &mTallTexture);
-        glGenTextures(1, &mMediumTexture);
-        glGenTextures(1, &mSmallTexture);
-        glGenTextures(1, &mKeyboardTexture);
+        // Glyphs are always rendered at reference height
+        FT_Set_Pixel_Sizes(*(mupFace.get()), 0, FONT_REFERENCE_PIXEL_HEIGHT);
 
         // Update pixel heights
         fillPixelHeights();
 
-        // Fill atlases the first time
-        fillAtlases();
+        // Size of pages depends on reference height
+        int cellSize = FONT_REFERENCE_PIXEL_HEIGHT + 2 * FONT_DISTANCE_FIELD_SPREAD;
+        mAtlasWidth = FONT_ATLAS_SHELF_GLYPHS * cellSize;
+        mPageHeight = FONT_ATLAS_PAGE_SHELVES * cellSize;
+
+        // Initilialize texture, distance field is always sampled linearly
+        glGenTextures(1, &mTexture);
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        // Start with single page
+        if (!addPage())
+        {
+            throwError(
+                OperationNotifier::Operation::RUNTIME,
+                "Too big glyphs for texture atlas. GPU supported texture size is insufficient",
+                mFilepath);
+        }
+
+        // Render characters which are expected to be used anyway
+        for (char16_t c : prewarmCharacters)
+        {
+            fetchGlyph(c);
+        }
+        mUpdatedGeneration = mGeneration;
     }
 
     AtlasFont::~AtlasFont()
     {
-        // Delete textures
-        glDeleteTextures(1, &mTallTexture);
-        glDeleteTextures(1, &mMediumTexture);
-        glDeleteTextures(1, &mSmallTexture);
-        glDeleteTextures(1, &mKeyboardTexture);
+        // Delete texture
+        glDeleteTextures(1, &mTexture);
 
         // Delete used face
         FT_Done_Face(*(mupFace.get()));
@@ -53,34 +77,35 @@ namespace eyegui
 
     void AtlasFont::resizeFontAtlases()
     {
-        // Update pixel heights
+        // Update pixel heights, glyphs are scaled at next usage
         fillPixelHeights();
 
-        // Update all atlases
-        fillAtlases();
+        // Everything is laid out again after resizing anyway
+        mGeneration++;
+        mUpdatedGeneration = mGeneration;
     }
 
-    Glyph const * AtlasFont::getGlyph(FontSize fontSize, char16_t character) const
+    bool AtlasFont::update()
     {
-        Glyph const * pGlyph = NULL;
+        // Pages used in new frame may not be evicted before next one
+        mFrame++;
 
-        switch (fontSize)
-        {
-        case FontSize::TALL:
-            pGlyph = getGlyph(mTallGlyphs, character);
-            break;
-        case FontSize::MEDIUM:
-            pGlyph = getGlyph(mMediumGlyphs, character);
-            break;
-        case FontSize::SMALL:
-            pGlyph = getGlyph(mSmallGlyphs, character);
-            break;
-        case FontSize::KEYBOARD:
-            pGlyph = getGlyph(mKeyboardGlyphs, character);
-            break;
-        }
+        // Tell about glyphs moved or evicted since last update
+        bool changed = mUpdatedGeneration != mGeneration;
+        mUpdatedGeneration = mGeneration;
+        return changed;
+    }
+
+    uint AtlasFont::getGeneration() const
+    {
+        return mGeneration;
+    }
+
+    Glyph const * AtlasFont::getGlyph(FontSize fontSize, char16_t character) const
+    {
+        Glyph const * pGlyph = fetchGlyph(character);
 
-        // Check whether key was found
+        // Check whether glyph was found
         if (pGlyph == NULL)
         {
             throwWarning(
@@ -89,21 +114,7 @@ namespace eyegui
                 mFilepath);
 
             // Try to load fallback
-            switch (fontSize)
-            {
-            case FontSize::TALL:
-                pGlyph = getGlyph(mTallGlyphs, FONT_FALLBACK_CHARACTER);
-                break;
-            case FontSize::MEDIUM:
-                pGlyph = getGlyph(mMediumGlyphs, FONT_FALLBACK_CHARACTER);
-                break;
-            case FontSize::SMALL:
-                pGlyph = getGlyph(mSmallGlyphs, FONT_FALLBACK_CHARACTER);
-                break;
-            case FontSize::KEYBOARD:
-                pGlyph = getGlyph(mKeyboardGlyphs, FONT_FALLBACK_CHARACTER);
-                break;
-            }
+            pGlyph = fetchGlyph(FONT_FALLBACK_CHARACTER);
 
             // Check fallback
             if (pGlyph == NULL)
@@ -112,10 +123,20 @@ namespace eyegui
                     OperationNotifier::Operation::RUNTIME,
                     "Fallback character not found, check font file and character set",
                     mFilepath);
+                return NULL;
             }
         }
 
-        return pGlyph;
+        // Scale glyph from reference height to font size
+        ScaledGlyphs& rScaledGlyphs = getScaledGlyphs(fontSize);
+        float scale = (float)rScaledGlyphs.pixelHeight / (float)FONT_REFERENCE_PIXEL_HEIGHT;
+        Glyph& rScaledGlyph = rScaledGlyphs.glyphs[character];
+        rScaledGlyph.atlasPosition = pGlyph->atlasPosition;
+        rScaledGlyph.size = scale * pGlyph->size;
+        rScaledGlyph.bearing = scale * pGlyph->bearing;
+        rScaledGlyph.advance = scale * pGlyph->advance;
+        rScaledGlyph.margin = scale * pGlyph->margin;
+        return &rScaledGlyph;
     }
 
     float AtlasFont::getLineHeight(FontSize fontSize) const
@@ -126,338 +147,474 @@ namespace eyegui
 
     float AtlasFont::getTargetGlyphHeight(FontSize fontSize) const
     {
-        // Values seems to be not correct (not depending on bitmap size)
-        /*switch(fontSize)
-        {
-        case FontSize::TALL:
-        return mTallLineHeight;
-        break;
-        case FontSize::MEDIUM:
-        return mMediumLineHeight;
-        break;
-        case FontSize::SMALL:
-        return mSmallLineHeight;
-        break;
-        }*/
-
-        switch (fontSize)
-        {
-        case FontSize::TALL:
-            return (float)mTallPixelHeight;
-            break;
-        case FontSize::MEDIUM:
-            return (float)mMediumPixelHeight;
-            break;
-        case FontSize::SMALL:
-            return (float)mSmallPixelHeight;
-            break;
-        case FontSize::KEYBOARD:
-            return (float)mKeyboardPixelHeight;
-            break;
-        default:
-            return 0;
-        }
+        // Line height given by face seems to be not correct (not depending on bitmap size)
+        return (float)getScaledGlyphs(fontSize).pixelHeight;
     }
 
-    void AtlasFont::bindAtlasTexture(FontSize fontSize, uint slot, bool linearFiltering) const
+    void AtlasFont::bindAtlasTexture(uint slot) const
     {
         // Choose slot
         glActiveTexture(GL_TEXTURE0 + slot);
 
-        // Bind atlas texture
+        // Bind atlas texture, which is shared by all font sizes
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+    }
+
+    uint AtlasFont::getAtlasTexture() const
+    {
+        return mTexture;
+    }
+
+    AtlasFont::ScaledGlyphs& AtlasFont::getScaledGlyphs(FontSize fontSize) const
+    {
         switch (fontSize)
         {
         case FontSize::TALL:
-            glBindTexture(GL_TEXTURE_2D, mTallTexture);
-            break;
+            return mTallGlyphs;
         case FontSize::MEDIUM:
-            glBindTexture(GL_TEXTURE_2D, mMediumTexture);
-            break;
+            return mMediumGlyphs;
         case FontSize::SMALL:
-            glBindTexture(GL_TEXTURE_2D, mSmallTexture);
-            break;
-        case FontSize::KEYBOARD:
-            glBindTexture(GL_TEXTURE_2D, mKeyboardTexture);
-            break;
-        }
-
-        // Set sampling
-        if (linearFiltering)
-        {
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        }
-        else
-        {
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            return mSmallGlyphs;
+        default:
+            return mKeyboardGlyphs;
         }
     }
 
-    Glyph const * AtlasFont::getGlyph(const std::map<char16_t, Glyph>& rGlyphMap, char16_t character) const
+    Glyph const * AtlasFont::fetchGlyph(char16_t character) const
     {
-        auto it = rGlyphMap.find(character);
-
-        if (it != rGlyphMap.end())
+        auto it = mGlyphs.find(character);
+        if (it == mGlyphs.end())
         {
-            return &(it->second);
+            CachedGlyph cachedGlyph;
+            cachedGlyph.resident = false;
+            cachedGlyph.missing = false;
+            cachedGlyph.page = -1;
+            it = mGlyphs.insert(std::make_pair(character, cachedGlyph)).first;
         }
-        else
+        CachedGlyph& rCachedGlyph = it->second;
+
+        // Check coverage of font only once
+        if (rCachedGlyph.missing)
         {
             return NULL;
         }
-    }
 
-    int AtlasFont::calculatePadding(int pixelHeight)
-    {
-        return std::max(
-            FONT_MINIMAL_CHARACTER_PADDING,
-            (int)(pixelHeight * FONT_CHARACTER_PADDING));
-    }
+        // Render glyph at first usage
+        if (!rCachedGlyph.resident && !renderGlyph(character, rCachedGlyph))
+        {
+            return NULL;
+        }
 
-    void AtlasFont::fillPixelHeights()
-    {
-        float windowHeight =(float) mpGUI->getWindowHeight();
-        mTallPixelHeight = (int)(windowHeight * mpGUI->getSizeOfFont(FontSize::TALL));
-        mMediumPixelHeight = (int)(windowHeight * mpGUI->getSizeOfFont(FontSize::MEDIUM));
-        mSmallPixelHeight = (int)(windowHeight * mpGUI->getSizeOfFont(FontSize::SMALL));
-        mKeyboardPixelHeight = (int)(windowHeight * mpGUI->getSizeOfFont(FontSize::KEYBOARD));
-    }
+        // Remember usage of page
+        if (rCachedGlyph.page >= 0)
+        {
+            mPages[rCachedGlyph.page].lastUsage = mFrame;
+        }
 
-    void AtlasFont::fillAtlases()
-    {
-        fillAtlas(
-            mTallPixelHeight,
-            mTallGlyphs,
-            mTallLinePixelHeight,
-            mTallTexture,
-            calculatePadding(mTallPixelHeight));
-        fillAtlas(
-            mMediumPixelHeight,
-            mMediumGlyphs,
-            mMediumLinePixelHeight,
-            mMediumTexture,
-            calculatePadding(mMediumPixelHeight));
-        fillAtlas(
-            mSmallPixelHeight,
-            mSmallGlyphs,
-            mSmallLinePixelHeight,
-            mSmallTexture,
-            calculatePadding(mSmallPixelHeight));
-        fillAtlas(
-            mKeyboardPixelHeight,
-            mKeyboardGlyphs,
-            mKeyboardLinePixelHeight,
-            mKeyboardTexture,
-            calculatePadding(mKeyboardPixelHeight));
+        return &(rCachedGlyph.glyph);
     }
 
-    void AtlasFont::fillAtlas(
-        int pixelHeight,
-        std::map<char16_t, Glyph>& rGlyphMap,
-        float& rLineHeight,
-        GLuint textureHandle,
-        int padding)
+    bool AtlasFont::renderGlyph(char16_t character, CachedGlyph& rCachedGlyph) const
     {
-        // Some typedef, keeps track of combination of each glyph and its bitmap
-        typedef std::pair<Glyph*, std::vector<unsigned char> > glyphBitmapPair;
-
-        // Store bitmaps temporarily
-        std::vector<glyphBitmapPair> bitmaps;
-
         // Reference to face
         FT_Face& rFace = *(mupFace.get());
 
-        // Set the height for generation of glyphs
-        FT_Set_Pixel_Sizes(rFace, 0, pixelHeight);
+        // Check whether character is covered by font
+        if (FT_Get_Char_Index(rFace, character) == 0)
+        {
+            throwWarning(
+                OperationNotifier::Operation::RUNTIME,
+                "Failed to find character in font file, check coverage of font",
+                mFilepath);
+            rCachedGlyph.missing = true;
+            return false;
+        }
 
-        // Set line height
-        rLineHeight = (float)(rFace->height) / 64; // Given in 1/64 pixel
+        // Load glyph in face. Hinting is only valid for reference height
+        if (FT_Load_Char(rFace, character, FT_LOAD_RENDER | FT_LOAD_NO_HINTING))
+        {
+            throwWarning(
+                OperationNotifier::Operation::RUNTIME,
+                "Failed to find character in font file, check coverage of font",
+                mFilepath);
+            rCachedGlyph.missing = true;
+            return false;
+        }
 
-        // Go over character set and collect glyphs and bitmaps
-        for (char16_t c : mCharacterSet)
+        // Determine width and height of bitmap and its distance field
+        const FT_Bitmap& rBitmap = rFace->glyph->bitmap;
+        int bitmapWidth = rBitmap.width;
+        int bitmapHeight = rBitmap.rows;
+        int spread = FONT_DISTANCE_FIELD_SPREAD;
+        int fieldWidth = bitmapWidth + 2 * spread;
+        int fieldHeight = bitmapHeight + 2 * spread;
+
+        // Find space in atlas, if bitmap is not empty
+        int page = -1;
+        int x = 0;
+        int y = 0;
+        bool empty = bitmapWidth <= 0 || bitmapHeight <= 0;
+        if (!empty)
         {
-            // Load current glyph in face
-            if (FT_Load_Char(rFace, c, FT_LOAD_RENDER))
+            page = allocate(fieldWidth, fieldHeight, x, y);
+            if (page < 0)
             {
-                throwWarning(
-                    OperationNotifier::Operation::RUNTIME,
-                    "Failed to find character in font file, check coverage of font",
-                    mFilepath);
-                continue;
+                return false;
             }
+        }
+
+        // Save some values of the glyph at reference height. Quad covers only
+        // part of the spread, which is enough for smooth outline at small sizes
+        int margin = empty ? 0 : spread / 2;
+        rCachedGlyph.glyph.advance = glm::vec2(
+            (float)(rFace->glyph->advance.x) / 64,   // Given in 1/64 pixel
+            (float)(rFace->glyph->advance.y) / 64);  // Given in 1/64 pixel
+        rCachedGlyph.glyph.size = glm::vec2(bitmapWidth + 2 * margin, bitmapHeight + 2 * margin);
+        rCachedGlyph.glyph.bearing = glm::vec2(
+            rFace->glyph->bitmap_left - margin,
+            rFace->glyph->bitmap_top + margin);
+        rCachedGlyph.glyph.margin = (float)margin;
+        rCachedGlyph.glyph.atlasPosition = glm::vec4(0, 0, 0, 0);
+        rCachedGlyph.page = page;
+        rCachedGlyph.resident = true;
+
+        // Nothing to draw for empty bitmap
+        if (page < 0)
+        {
+            return true;
+        }
+        mPages[page].characters.push_back(character);
 
-            // Determine width and height
-            int bitmapWidth = rFace->glyph->bitmap.width;
-            int bitmapHeight = rFace->glyph->bitmap.rows;
-
-            // Save some values of the glyph
-            rGlyphMap[c].advance = glm::vec2(
-                (float)(rFace->glyph->advance.x) / 64,   // Given in 1/64 pixel
-                (float)(rFace->glyph->advance.y) / 64);  // Given in 1/64 pixel
-            rGlyphMap[c].size = glm::ivec2(bitmapWidth, bitmapHeight);
-            rGlyphMap[c].bearing = glm::ivec2(
-                rFace->glyph->bitmap_left,
-                rFace->glyph->bitmap_top);
-
-            // Go over rows and write it mirrored into own buffer
-            std::vector<unsigned char> mirrorBuffer;
-            for (int i = bitmapHeight - 1; i >= 0; i--)
+        // Coverage of bitmap surrounded by spread, with rows mirrored
+        std::vector<float> coverage(fieldWidth * fieldHeight, 0);
+        for (int i = 0; i < bitmapHeight; i++)
+        {
+            int row = fieldHeight - 1 - (spread + i);
+            for (int j = 0; j < bitmapWidth; j++)
             {
-                for (int j = 0; j < bitmapWidth; j++)
-                {
-                    mirrorBuffer.push_back(rFace->glyph->bitmap.buffer[i*bitmapWidth + j]);
-                }
+                coverage[row * fieldWidth + spread + j] = (float)rBitmap.buffer[i * rBitmap.pitch + j] / 255.f;
             }
-
-            // Fetch current glyph and bitmap and store it in vector as pair
-            bitmaps.push_back(
-                glyphBitmapPair(
-                    &rGlyphMap[c],
-                    mirrorBuffer));
         }
 
-        // Decide, which resolution is minimum when texture would be quadratic
-        int sumPixelWidth = 0;
-        for (const glyphBitmapPair& rGlyphBitmapPair : bitmaps)
+        // Distances of pixels outside to inside and other way round
+        const float infinity = 1e20f;
+        std::vector<float> outsideDistances(coverage.size());
+        std::vector<float> insideDistances(coverage.size());
+        for (int i = 0; i < (int)coverage.size(); i++)
         {
-            sumPixelWidth += rGlyphBitmapPair.first->size.x + 2 * padding;
+            bool inside = coverage[i] >= 0.5f;
+            outsideDistances[i] = inside ? 0 : infinity;
+            insideDistances[i] = inside ? infinity : 0;
         }
-        int pixelCount = (pixelHeight + 2 * padding) * sumPixelWidth;
-        float sqrtPixelCount = sqrt((float)pixelCount);
+        calculateSquaredDistances(outsideDistances, fieldWidth, fieldHeight);
+        calculateSquaredDistances(insideDistances, fieldWidth, fieldHeight);
 
-        int i = 5;
-        while (pow(2, i) < sqrtPixelCount)
+        // Signed distance to outline (positive inside) mapped to byte, spread is mapped to half of range
+        std::vector<unsigned char> field(coverage.size());
+        for (int i = 0; i < (int)field.size(); i++)
         {
-            i++;
+            float distance;
+            if (coverage[i] > 0.f && coverage[i] < 1.f)
+            {
+                // Outline crosses pixel, coverage tells distance more precisely than pixel centers
+                distance = coverage[i] - 0.5f;
+            }
+            else if (coverage[i] >= 0.5f)
+            {
+                distance = std::sqrt(insideDistances[i]) - 0.5f;
+            }
+            else
+            {
+                distance = 0.5f - std::sqrt(outsideDistances[i]);
+            }
+            float value = glm::clamp(0.5f + (distance / (2.f * spread)), 0.f, 1.f);
+            field[i] = (unsigned char)(value * 255.f + 0.5f);
         }
-        int xResolution = (int)pow(2, i);
 
-        // Get the maximum resolution of textures on this GPU
-        int maxTextureResolution;
-        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureResolution);
+        // Save current binding as this may be called while drawing
+        GLint oldTexture = 0;
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldTexture);
+
+        // Enable writing of non power of two
+        GLint oldUnpackAlignment = 4;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        // Write into texture
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+        glTexSubImage2D(
+            GL_TEXTURE_2D,
+            0,
+            x,
+            y,
+            fieldWidth,
+            fieldHeight,
+            GL_RED,
+            GL_UNSIGNED_BYTE,
+            field.data());
+
+        // Restore settings
+        glBindTexture(GL_TEXTURE_2D, oldTexture);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment);
+
+        // Save position in atlas
+        float atlasHeight = (float)(mPages.size() * mPageHeight);
+        int offset = spread - margin;
+        rCachedGlyph.glyph.atlasPosition = glm::vec4(
+            (float)(x + offset) / mAtlasWidth,
+            (float)(y + offset) / atlasHeight,
+            (float)(x + fieldWidth - offset) / mAtlasWidth,
+            (float)(y + fieldHeight - offset) / atlasHeight);
+
+        return true;
+    }
 
-        if (xResolution > maxTextureResolution)
+    int AtlasFont::allocate(int width, int height, int& rX, int& rY) const
+    {
+        // Bitmap has to fit into one page
+        if (width > mAtlasWidth || height > mPageHeight)
         {
-            throwError(
-                OperationNotifier::Operation::RUNTIME,
-                "Too many and too big glyphs for texture atlas. GPU supported texture size is insufficient",
-                mFilepath);
+            return -1;
         }
 
-        // Build up rows with vectors of words
-        std::vector<int> rows;
-        std::vector<std::vector<glyphBitmapPair const *> > bitmapOrder;
-        for (const glyphBitmapPair& rGlyphBitmapPair : bitmaps)
+        // Try to put bitmap into current shelf of a page or to start new shelf below it
+        int page = -1;
+        for (int i = 0; i < (int)mPages.size() && page < 0; i++)
         {
-            // Try different rows
-            int width = rGlyphBitmapPair.first->size.x + 2 * padding;
-            bool check = false;
-
-            for (uint j = 0; j < rows.size(); j++)
+            Page& rPage = mPages[i];
+            if (rPage.shelfX + width <= mAtlasWidth && rPage.shelfY + height <= mPageHeight)
             {
-                // Does this word fit in this row?
-                if ((rows[j] + width) < xResolution)
-                {
-                    rows[j] += width;
-                    bitmapOrder[j].push_back(&rGlyphBitmapPair);
-                    check = true;
-                    break;
-                }
+                page = i;
             }
-            if (!check)
+            else if (rPage.shelfY + rPage.shelfHeight + height <= mPageHeight)
             {
-                // No more room in existing rows, add more
-                rows.push_back(width);
-                std::vector<glyphBitmapPair const *> rowBitmapOrder;
-                rowBitmapOrder.push_back(&rGlyphBitmapPair);
-                bitmapOrder.push_back(rowBitmapOrder);
+                rPage.shelfX = 0;
+                rPage.shelfY += rPage.shelfHeight;
+                rPage.shelfHeight = 0;
+                page = i;
             }
         }
 
-        // Calculate necessary rows
-        i = 5;
-        int yResolution = (int)rows.size() * (pixelHeight + 2 * padding);
-        while (pow(2, i) < yResolution)
+        // Add page or evict least recently used one, which has not been used in this frame
+        if (page < 0)
         {
-            i++;
+            if (mPages.size() < FONT_ATLAS_MAX_PAGES && addPage())
+            {
+                page = (int)mPages.size() - 1;
+            }
+            else
+            {
+                int leastRecentlyUsed = 0;
+                for (int i = 1; i < (int)mPages.size(); i++)
+                {
+                    if (mPages[i].lastUsage < mPages[leastRecentlyUsed].lastUsage)
+                    {
+                        leastRecentlyUsed = i;
+                    }
+                }
+                if (mPages[leastRecentlyUsed].lastUsage == mFrame)
+                {
+                    throwWarning(
+                        OperationNotifier::Operation::RUNTIME,
+                        "Font atlas is too small for characters used at once",
+                        mFilepath);
+                    return -1;
+                }
+                evictPage(leastRecentlyUsed);
+                page = leastRecentlyUsed;
+            }
         }
 
-        // Let's make y resolution also power of two
-        yResolution = (int)pow(2, i);
+        // Put bitmap into shelf
+        Page& rPage = mPages[page];
+        rX = rPage.shelfX;
+        rY = page * mPageHeight + rPage.shelfY;
+        rPage.shelfX += width;
+        rPage.shelfHeight = std::max(rPage.shelfHeight, height);
+        return page;
+    }
 
-        // Do check for vertical resolution as well
-        if (yResolution > maxTextureResolution)
+    bool AtlasFont::addPage() const
+    {
+        // Get the maximum resolution of textures on this GPU
+        int maxTextureResolution;
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureResolution);
+        int oldHeight = (int)mPages.size() * mPageHeight;
+        int newHeight = oldHeight + mPageHeight;
+        if (newHeight > maxTextureResolution)
         {
-            throwError(
-                OperationNotifier::Operation::RUNTIME,
-                "Too many and too big glyphs for texture atlas. GPU supported texture size is insufficient",
-                mFilepath);
+            return false;
         }
 
-        // Enable writing of non power of two
+        // Save current settings as this may be called while drawing
+        GLint oldTexture = 0;
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldTexture);
+        GLint oldPackAlignment = 4;
+        glGetIntegerv(GL_PACK_ALIGNMENT, &oldPackAlignment);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
         GLint oldUnpackAlignment = 4;
         glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment);
         glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-        // Initialize texture for atlas (filtering set at texture binding)
-        glBindTexture(GL_TEXTURE_2D, textureHandle);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-        std::vector<GLubyte> emptyData(xResolution * yResolution, 0);
+        // Keep rendered glyphs while texture is enlarged
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+        std::vector<GLubyte> data(mAtlasWidth * newHeight, 0);
+        if (oldHeight > 0)
+        {
+            glGetTexImage(GL_TEXTURE_2D, 0, GL_RED, GL_UNSIGNED_BYTE, data.data());
+        }
         glTexImage2D(
             GL_TEXTURE_2D,
             0,
             GL_R8,
-            xResolution,
-            yResolution,
+            mAtlasWidth,
+            newHeight,
             0,
             GL_RED,
             GL_UNSIGNED_BYTE,
-            emptyData.data());
+            data.data());
 
-        // Write bitmaps into texture and save further values to the glyph
-        int yPen = yResolution - pixelHeight - 2 * padding;
-        for (uint i = 0; i < bitmapOrder.size(); i++)
+        // Restore settings
+        glBindTexture(GL_TEXTURE_2D, oldTexture);
+        glPixelStorei(GL_PACK_ALIGNMENT, oldPackAlignment);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment);
+
+        // Positions of rendered glyphs are relative to height of texture
+        if (oldHeight > 0)
         {
-            int xPen = 0;
-            for (uint j = 0; j < bitmapOrder[i].size(); j++)
+            float factor = (float)oldHeight / (float)newHeight;
+            for (auto& rPair : mGlyphs)
             {
-                int bitmapWidth = bitmapOrder[i][j]->first->size.x;
-                int bitmapHeight = bitmapOrder[i][j]->first->size.y;
-
-                // Write into texture
-                glTexSubImage2D(
-                    GL_TEXTURE_2D,
-                    0,
-                    xPen + padding,
-                    yPen + padding,
-                    bitmapWidth,
-                    bitmapHeight,
-                    GL_RED,
-                    GL_UNSIGNED_BYTE,
-                    bitmapOrder[i][j]->second.data());
-
-                // Save further values to glyph structure
-                bitmapOrder[i][j]->first->atlasPosition = glm::vec4(
-                    (float)(xPen + padding) / xResolution,
-                    (float)(yPen + padding) / yResolution,
-                    (float)(xPen + padding + bitmapWidth) / xResolution,
-                    (float)(yPen + padding + bitmapHeight) / yResolution);
-
-                // Advance pen
-                xPen += bitmapWidth + 2 * padding;
+                rPair.second.glyph.atlasPosition.y *= factor;
+                rPair.second.glyph.atlasPosition.w *= factor;
             }
-
-            // Advance pen
-            yPen -= pixelHeight + 2 * padding;
+            mGeneration++;
         }
 
-        // Unbind texture
-        glBindTexture(GL_TEXTURE_2D, 0);
+        // Add page
+        Page page;
+        page.shelfX = 0;
+        page.shelfY = 0;
+        page.shelfHeight = 0;
+        page.lastUsage = mFrame;
+        mPages.push_back(page);
+        return true;
+    }
 
-        // Reset unpack alignment
+    void AtlasFont::evictPage(int page) const
+    {
+        // Glyphs are rendered again at next usage
+        Page& rPage = mPages[page];
+        for (char16_t c : rPage.characters)
+        {
+            mGlyphs[c].resident = false;
+        }
+        rPage.characters.clear();
+        rPage.shelfX = 0;
+        rPage.shelfY = 0;
+        rPage.shelfHeight = 0;
+
+        // Clear page, so padding around new glyphs is empty
+        GLint oldTexture = 0;
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldTexture);
+        GLint oldUnpackAlignment = 4;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        std::vector<GLubyte> emptyData(mAtlasWidth * mPageHeight, 0);
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+        glTexSubImage2D(
+            GL_TEXTURE_2D,
+            0,
+            0,
+            page * mPageHeight,
+            mAtlasWidth,
+            mPageHeight,
+            GL_RED,
+            GL_UNSIGNED_BYTE,
+            emptyData.data());
+        glBindTexture(GL_TEXTURE_2D, oldTexture);
         glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment);
+
+        // Meshes using evicted glyphs have to be calculated again
+        mGeneration++;
+    }
+
+    void AtlasFont::calculateSquaredDistances(std::vector<float>& rValues, int width, int height) const
+    {
+        // Buffers for one dimensional transform of rows and columns
+        const float infinity = 1e20f;
+        int length = std::max(width, height);
+        std::vector<float> input(length);
+        std::vector<float> output(length);
+        std::vector<int> parabolas(length); // positions of parabolas in lower envelope
+        std::vector<float> boundaries(length + 1); // boundaries between parabolas
+
+        // Transform of one row or column, given by first index and step between values
+        auto transform = [&](int first, int step, int count)
+        {
+            for (int q = 0; q < count; q++)
+            {
+                input[q] = rValues[first + q * step];
+            }
+
+            // Compute lower envelope of parabolas rooted at each value
+            auto intersection = [&](int q, int p)
+            {
+                return ((input[q] + (float)(q * q)) - (input[p] + (float)(p * p))) / (float)(2 * q - 2 * p);
+            };
+            int k = 0;
+            parabolas[0] = 0;
+            boundaries[0] = -infinity;
+            boundaries[1] = infinity;
+            for (int q = 1; q < count; q++)
+            {
+                float s = intersection(q, parabolas[k]);
+                while (s <= boundaries[k])
+                {
+                    k--;
+                    s = intersection(q, parabolas[k]);
+                }
+                k++;
+                parabolas[k] = q;
+                boundaries[k] = s;
+                boundaries[k + 1] = infinity;
+            }
+
+            // Fill in values of lower envelope
+            k = 0;
+            for (int q = 0; q < count; q++)
+            {
+                while (boundaries[k + 1] < (float)q)
+                {
+                    k++;
+                }
+                float distance = (float)(q - parabolas[k]);
+                output[q] = (distance * distance) + input[parabolas[k]];
+            }
+
+            for (int q = 0; q < count; q++)
+            {
+                rValues[first + q * step] = output[q];
+            }
+        };
+
+        // Columns first, then rows
+        for (int x = 0; x < width; x++)
+        {
+            transform(x, width, height);
+        }
+        for (int y = 0; y < height; y++)
+        {
+            transform(y * width, 1, width);
+        }
+    }
+
+    void AtlasFont::fillPixelHeights()
+    {
+        float windowHeight = (float)mpGUI->getWindowHeight();
+        mTallGlyphs.pixelHeight = (int)(windowHeight * mpGUI->getSizeOfFont(FontSize::TALL));
+        mMediumGlyphs.pixelHeight = (int)(windowHeight * mpGUI->getSizeOfFont(FontSize::MEDIUM));
+        mSmallGlyphs.pixelHeight = (int)(windowHeight * mpGUI->getSizeOfFont(FontSize::SMALL));
+        mKeyboardGlyphs.pixelHeight = (int)(windowHeight * mpGUI->getSizeOfFont(FontSize::KEYBOARD));
     }
 }
@@ -4,8 +4,13 @@
 //============================================================================
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
-// Font implementation using FreeType library to render glyphs as bitmaps
-// onto a texture atlas.
+// Font implementation using FreeType library to render glyphs as signed
+// distance fields onto a texture atlas. Glyphs are rendered once at reference
+// size and shared by all font sizes, which only scale them. Glyphs are rendered
+// at first usage and packed shelf by shelf into pages of the atlas. The atlas
+// grows page by page and evicts the least recently used page when it is full.
+// Both invalidate glyphs returned earlier, which is told by the generation of
+// the font.
 
 #ifndef ATLAS_FONT_H_
 #define ATLAS_FONT_H_
@@ -28,19 +33,26 @@ namespace eyegui
     {
     public:
 
-        // Constructor (takes responsibility for face)
+        // Constructor (takes responsibility for face). Characters for prewarming
+        // are rendered at construction instead of first usage
         AtlasFont(
             GUI const * pGUI,
             std::string filepath,
             std::unique_ptr<FT_Face> upFace,
-            std::set<char16_t> characterSet);
+            std::set<char16_t> prewarmCharacters);
 
         // Destructor
         virtual ~AtlasFont();
 
-        // Resize font atlases
+        // Resize font atlases, which only scales glyphs
         virtual void resizeFontAtlases();
 
+        // Update once per frame
+        virtual bool update();
+
+        // Generation of glyphs
+        virtual uint getGeneration() const;
+
         // Get glyph (may return NULL if not found)
         virtual Glyph const * getGlyph(FontSize fontSize, char16_t character) const;
 
@@ -51,55 +63,79 @@ namespace eyegui
         virtual float getTargetGlyphHeight(FontSize fontSize) const;
 
         // Bind atlas texture of font
-        virtual void bindAtlasTexture(FontSize fontSize, uint slot = 0, bool linearFiltering = false) const;
+        virtual void bindAtlasTexture(uint slot = 0) const;
 
-    private:
+        // Get OpenGL handle of atlas texture of font
+        virtual uint getAtlasTexture() const;
 
-        // Get glyph (may return NULL if not found)
-        Glyph const * getGlyph(const std::map<char16_t, Glyph>& rGlyphMap, char16_t character) const;
+    private:
 
-        // Calculate padding
-        int calculatePadding(int pixelHeight);
+        // Glyph at reference size and its place in atlas. Entries are never removed
+        struct CachedGlyph
+        {
+            Glyph glyph;
+            bool resident; // rendered into atlas
+            bool missing; // not covered by font
+            int page; // page in atlas, -1 if bitmap is empty
+        };
+
+        // Page of atlas, filled shelf by shelf
+        struct Page
+        {
+            int shelfX;
+            int shelfY;
+            int shelfHeight;
+            uint lastUsage; // frame of last usage
+            std::vector<char16_t> characters;
+        };
+
+        // Glyphs scaled to one font size. Entries are never removed, so pointers to glyphs stay valid
+        struct ScaledGlyphs
+        {
+            int pixelHeight;
+            std::map<char16_t, Glyph> glyphs;
+        };
+
+        // Get scaled glyphs of font size
+        ScaledGlyphs& getScaledGlyphs(FontSize fontSize) const;
+
+        // Get glyph at reference size and render it if necessary (returns NULL if not covered by font or no space left)
+        Glyph const * fetchGlyph(char16_t character) const;
+
+        // Render distance field of glyph into atlas, returns false if no space left
+        bool renderGlyph(char16_t character, CachedGlyph& rCachedGlyph) const;
+
+        // Find space for bitmap in pages, adds or evicts page if necessary. Returns index of page or -1
+        int allocate(int width, int height, int& rX, int& rY) const;
+
+        // Add empty page to atlas, returns false if maximal texture size would be exceeded
+        bool addPage() const;
+
+        // Remove all glyphs of page from atlas
+        void evictPage(int page) const;
+
+        // Replace values by squared distance to nearest zero value, using
+        // separable transform of Felzenszwalb and Huttenlocher
+        void calculateSquaredDistances(std::vector<float>& rValues, int width, int height) const;
 
         // Fill pixel heights
         void fillPixelHeights();
 
-        // Fill all atlases
-        void fillAtlases();
-
-        // Fill atlas
-        void fillAtlas(
-            int pixelHeight,
-            std::map<char16_t, Glyph>& rGlyphMap,
-            float& rLineHeight,
-            GLuint textureHandle,
-            int padding);
-
         // Members
         GUI const * mpGUI;
         std::unique_ptr<FT_Face> mupFace;
-        std::set<char16_t> mCharacterSet;
-
-        std::map<char16_t, Glyph> mTallGlyphs;
-        std::map<char16_t, Glyph> mMediumGlyphs;
-        std::map<char16_t, Glyph> mSmallGlyphs;
-        std::map<char16_t, Glyph> mKeyboardGlyphs;
-
-        float mTallLinePixelHeight;
-        float mMediumLinePixelHeight;
-        float mSmallLinePixelHeight;
-        float mKeyboardLinePixelHeight;
-
-        GLuint mTallTexture;
-        GLuint mMediumTexture;
-        GLuint mSmallTexture;
-        GLuint mKeyboardTexture;
-
-        int mTallPixelHeight;
-        int mMediumPixelHeight;
-        int mSmallPixelHeight;
-        int mKeyboardPixelHeight;
-
+        GLuint mTexture;
+        int mAtlasWidth;
+        int mPageHeight;
+        mutable std::vector<Page> mPages;
+        mutable std::map<char16_t, CachedGlyph> mGlyphs;
+        mutable ScaledGlyphs mTallGlyphs;
+        mutable ScaledGlyphs mMediumGlyphs;
+        mutable ScaledGlyphs mSmallGlyphs;
+        mutable ScaledGlyphs mKeyboardGlyphs;
+        mutable uint mFrame;
+        mutable uint mGeneration;
+        uint mUpdatedGeneration; // generation at last update
         std::string mFilepath;
     };
 }
@@ -46,6 +46,16 @@ namespace eyegui
         // Nothing to do
     }
 
+    bool EmptyFont::update()
+    {
+        return false;
+    }
+
+    uint EmptyFont::getGeneration() const
+    {
+        return 0;
+    }
+
     Glyph const * EmptyFont::getGlyph(FontSize fontSize, char16_t character) const
     {
         return NULL;
@@ -61,9 +71,14 @@ namespace eyegui
         return 0;
     }
 
-    void EmptyFont::bindAtlasTexture(FontSize fontSize, uint slot, bool linearFiltering ) const
+    void EmptyFont::bindAtlasTexture(uint slot) const
     {
         // Nothing to do
     }
 
+    uint EmptyFont::getAtlasTexture() const
+    {
+        return mTexture;
+    }
+
 }
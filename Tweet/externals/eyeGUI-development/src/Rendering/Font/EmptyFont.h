@@ -30,6 +30,12 @@ namespace eyegui
         // Resize font atlases
         virtual void resizeFontAtlases();
 
+        // Update once per frame
+        virtual bool update();
+
+        // Generation of glyphs
+        virtual uint getGeneration() const;
+
         // Get glyph (may return NULL if not found)
         virtual Glyph const * getGlyph(FontSize fontSize, char16_t character) const;
 
@@ -40,7 +46,10 @@ namespace eyegui
         virtual float getTargetGlyphHeight(FontSize fontSize) const;
 
         // Bind atlas texture of font
-        virtual void bindAtlasTexture(FontSize fontSize, uint slot = 0, bool linearFiltering = false) const;
+        virtual void bindAtlasTexture(uint slot = 0) const;
+
+        // Get OpenGL handle of atlas texture of font
+        virtual uint getAtlasTexture() const;
 
     private:
 
@@ -19,9 +19,10 @@ namespace eyegui
     struct Glyph
     {
         glm::vec4	atlasPosition;	// Position in atlas (minU, minV, maxU, maxV)
-        glm::ivec2  size;			// Size in pixel
-        glm::ivec2	bearing;		// Offset from baseline to left / top of glyph in pixel
+        glm::vec2   size;			// Size in pixel
+        glm::vec2	bearing;		// Offset from baseline to left / top of glyph in pixel
         glm::vec2	advance;        // Offset to advance to next glyph in pixel
+        float       margin;         // Border around glyph included in size and bearing in pixel
     };
 
     class Font
@@ -37,6 +38,13 @@ namespace eyegui
         // Resize font atlases
         virtual void resizeFontAtlases() = 0;
 
+        // Called once per frame. Returns whether glyphs returned earlier
+        // became invalid since last call, not counting resizing of atlases
+        virtual bool update() = 0;
+
+        // Generation of glyphs, increased whenever glyphs returned earlier became invalid
+        virtual uint getGeneration() const = 0;
+
         // Get glyph (may return NULL if not found)
         virtual Glyph const * getGlyph(FontSize fontSize, char16_t character) const = 0;
 
@@ -46,8 +54,11 @@ namespace eyegui
         // Get target glyph height
         virtual float getTargetGlyphHeight(FontSize fontSize) const = 0;
 
-        // Bind atlas texture of font
-        virtual void bindAtlasTexture(FontSize fontSize, uint slot = 0, bool linearFiltering = false) const = 0;
+        // Bind atlas texture of font, which is shared by all font sizes
+        virtual void bindAtlasTexture(uint slot = 0) const = 0;
+
+        // Get OpenGL handle of atlas texture of font, which is shared by all font sizes
+        virtual uint getAtlasTexture() const = 0;
     };
 }
 
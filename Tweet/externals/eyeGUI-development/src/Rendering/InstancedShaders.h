@@ -0,0 +1,286 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Instanced variants of internal shaders, used by the draw batcher only.
+
+#ifndef INSTANCED_SHADERS_H_
+#define INSTANCED_SHADERS_H_
+
+namespace eyegui
+{
+    namespace shaders
+    {
+        // Quad is placed by rectangle in normalized device coordinates, everything else a shader needs
+        // per element comes from instance attributes: color, second color (icon or pick color), values
+        // (x = shader value, y = alpha, z = time or orientation), texture rectangle (icon in atlas or
+        // character in font atlas) and extra (xy = icon uv scale)
+
+        static const char* pInstancedVertexShader =
+            "#version 330 core\n"
+            "layout(location = 0) in vec3 posAttribute;\n"
+            "layout(location = 1) in vec2 uvAttribute;\n"
+            "layout(location = 2) in vec4 rectAttribute;\n"
+            "layout(location = 3) in vec4 colorAttribute;\n"
+            "layout(location = 4) in vec4 secondColorAttribute;\n"
+            "layout(location = 5) in vec4 valuesAttribute;\n"
+            "layout(location = 6) in vec4 textureRectAttribute;\n"
+            "layout(location = 7) in vec4 extraAttribute;\n"
+            "out vec2 uv;\n"
+            "flat out vec4 instanceColor;\n"
+            "flat out vec4 instanceSecondColor;\n"
+            "flat out vec4 instanceValues;\n"
+            "flat out vec4 instanceTextureRect;\n"
+            "flat out vec4 instanceExtra;\n"
+            "void main() {\n"
+            "   uv = uvAttribute;\n"
+            "   instanceColor = colorAttribute;\n"
+            "   instanceSecondColor = secondColorAttribute;\n"
+            "   instanceValues = valuesAttribute;\n"
+            "   instanceTextureRect = textureRectAttribute;\n"
+            "   instanceExtra = extraAttribute;\n"
+            "   gl_Position = vec4(rectAttribute.xy + (posAttribute.xy * rectAttribute.zw), 0, 1);\n"
+            "}\n";
+
+        static const char* pInstancedColorFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "flat in vec4 instanceColor;\n"
+            "flat in vec4 instanceValues;\n"
+            "void main() {\n"
+            "   vec4 color = instanceColor;\n"
+            "   float alpha = instanceValues.y;\n"
+            "   fragColor = vec4(color.rgb, color.a * alpha);\n"
+            "}\n";
+
+        static const char* pInstancedDimFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "flat in vec4 instanceColor;\n"
+            "flat in vec4 instanceValues;\n"
+            "uniform sampler2D mask;\n"
+            "void main() {\n"
+            "   vec4 dimColor = instanceColor;\n"
+            "   float dim = instanceValues.x;\n"
+            "   float alpha = instanceValues.y;\n"
+            "   fragColor = vec4(1.0, 1.0, 1.0, texture(mask, uv).r * alpha) * dimColor * dim;\n"
+            "}\n";
+
+        static const char* pInstancedActivityFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "flat in vec4 instanceValues;\n"
+            "uniform sampler2D mask;\n"
+            "void main() {\n"
+            "   float activity = instanceValues.x;\n"
+            "   float alpha = instanceValues.y;\n"
+            "   fragColor = vec4(0.3, 0.3, 0.3, texture(mask, uv).r * 0.5 * alpha) * (1.0 - activity);\n"
+            "}\n";
+
+        static const char* pInstancedMarkFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "flat in vec4 instanceColor;\n"
+            "flat in vec4 instanceValues;\n"
+            "uniform sampler2D mask;\n"
+            "void main() {\n"
+            "   vec4 markColor = instanceColor;\n"
+            "   float mark = instanceValues.x;\n"
+            "   float alpha = instanceValues.y;\n"
+            "   fragColor = vec4(1.0, 1.0, 1.0, texture(mask, uv).r * alpha) * markColor * mark;\n"
+            "}\n";
+
+        static const char* pInstancedCircleThresholdFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "flat in vec4 instanceColor;\n"
+            "flat in vec4 instanceValues;\n"
+            "uniform sampler2D mask;\n"
+            "void main() {\n"
+            "   vec4 thresholdColor = instanceColor;\n"
+            "   float threshold = instanceValues.x;\n"
+            "   float alpha = instanceValues.y;\n"
+            "   float thresholdMask = clamp(100 * clamp((length(2*uv-1)) - (1.025 * threshold - 0.025), 0, 1), 0 ,1);\n" // inverted threshold
+            "   fragColor = vec4(1.0, 1.0, 1.0, texture(mask, uv).r * sqrt(threshold) * (1.0 - thresholdMask) * alpha) * thresholdColor;\n"
+            "}\n";
+
+        static const char* pInstancedBoxThresholdFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "flat in vec4 instanceColor;\n"
+            "flat in vec4 instanceValues;\n"
+            "uniform sampler2D mask;\n"
+            "void main() {\n"
+            "   vec4 thresholdColor = instanceColor;\n"
+            "   float threshold = instanceValues.x;\n"
+            "   float alpha = instanceValues.y;\n"
+            "   float orientation = instanceValues.z;\n"
+            "   float thresholdMask = mix(uv.r, uv.g, orientation);\n"
+            "   thresholdMask =  clamp(100 * clamp(1.9 * abs(thresholdMask - 0.5)  - (0.975 * threshold - 0.025), 0, 1), 0, 1);\n" // inverted threshold
+            "   fragColor = vec4(1.0, 1.0, 1.0, texture(mask, uv).r * sqrt(threshold) * (1.0 - thresholdMask) * alpha) * thresholdColor;\n"
+            "}\n";
+
+        static const char* pInstancedHighlightFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "flat in vec4 instanceColor;\n"
+            "flat in vec4 instanceValues;\n"
+            "uniform sampler2D mask;\n"
+            "void main() {\n"
+            "   vec4 highlightColor = instanceColor;\n"
+            "   float highlight = instanceValues.x;\n"
+            "   float alpha = instanceValues.y;\n"
+            "   float time = instanceValues.z;\n"
+            "   fragColor = vec4(1.0, 1.0, 1.0, texture(mask, uv).r * alpha * 0.5 * (1 + sin(3 * time))) * highlightColor * highlight;\n"
+            "}\n";
+
+        static const char* pInstancedSelectionFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "flat in vec4 instanceColor;\n"
+            "flat in vec4 instanceValues;\n"
+            "uniform sampler2D mask;\n"
+            "void main() {\n"
+            "   vec4 selectionColor = instanceColor;\n"
+            "   float selection = instanceValues.x;\n"
+            "   float alpha = instanceValues.y;\n"
+            "   float gradient = length(2*uv-1);\n" // simple gradient as base
+            "   fragColor = vec4(1.0, 1.0, 1.0, texture(mask, uv).r * alpha * pow(gradient,2) * selection) * selectionColor;\n"
+            "}\n";
+
+        static const char* pInstancedCircleButtonFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "flat in vec4 instanceColor;\n"
+            "flat in vec4 instanceSecondColor;\n"
+            "flat in vec4 instanceValues;\n"
+            "flat in vec4 instanceTextureRect;\n"
+            "uniform sampler2D mask;\n"
+            "uniform sampler2D icon;\n"
+            "vec4 iconTexture(vec2 iconUV) {\n" // emulates clamping to edge of icon in atlas
+            "   return texture(icon, instanceTextureRect.xy + (clamp(iconUV, 0, 1) * instanceTextureRect.zw));\n"
+            "}\n"
+            "void main() {\n"
+            "   vec4 color = instanceColor;\n"
+            "   vec4 iconColor = instanceSecondColor;\n"
+            "   float pressing = instanceValues.x;\n"
+            "   float alpha = instanceValues.y;\n"
+            "   float powPressing = pressing * pressing;\n"
+            "   vec2 pressUV = ((0.975 + (0.5 * powPressing)) * (uv - 0.5)) + 0.5;\n"
+            "   float pressMask = (texture(mask, pressUV)).r;\n"
+            "   vec3 col = mix(color.rgb / 3, color.rgb, pressMask);\n"
+            "   vec4 iconValue = iconColor * iconTexture(pressUV).rgba;\n"
+            "   vec4 final = mix(vec4(col, color.a), vec4(iconValue.rgb, 1), iconValue.a * pressMask);\n"
+            "   fragColor = vec4(final.rgb, final.a * texture(mask, uv).r * alpha);\n"
+            "}\n";
+
+        static const char* pInstancedBoxButtonFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "flat in vec4 instanceColor;\n"
+            "flat in vec4 instanceSecondColor;\n"
+            "flat in vec4 instanceValues;\n"
+            "flat in vec4 instanceTextureRect;\n"
+            "flat in vec4 instanceExtra;\n"
+            "uniform sampler2D mask;\n"
+            "uniform sampler2D icon;\n"
+            "vec4 iconTexture(vec2 iconUV) {\n" // emulates clamping to edge of icon in atlas
+            "   return texture(icon, instanceTextureRect.xy + (clamp(iconUV, 0, 1) * instanceTextureRect.zw));\n"
+            "}\n"
+            "void main() {\n"
+            "   vec4 color = instanceColor;\n"
+            "   vec4 iconColor = instanceSecondColor;\n"
+            "   float pressing = instanceValues.x;\n"
+            "   float alpha = instanceValues.y;\n"
+            "   vec2 iconUVScale = instanceExtra.xy;\n"
+            "   float powPressing = pressing * pressing;\n"
+            "   vec2 pressUV = ((1 + (0.5 * powPressing)) * (uv - 0.5)) + 0.5;\n"
+            "   float pressMask = float(all(equal(ivec2(1,1), ivec2(pressUV+1))));\n"
+            "   vec3 col = mix(color.rgb / 3, color.rgb, pressMask);\n"
+            "   vec2 iconUV = ((1 + (0.5 * powPressing)) * iconUVScale * (uv - 0.5)) + 0.5;\n"
+            "   vec4 iconValue = iconColor * iconTexture(iconUV).rgba;\n"
+            "   vec4 final = mix(vec4(col, color.a), vec4(iconValue.rgb, 1), iconValue.a * pressMask);\n"
+            "   fragColor = vec4(final.rgb, final.a * texture(mask, uv).r * alpha);\n"
+            "}\n";
+
+        static const char* pInstancedSensorFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "flat in vec4 instanceColor;\n"
+            "flat in vec4 instanceSecondColor;\n"
+            "flat in vec4 instanceValues;\n"
+            "flat in vec4 instanceTextureRect;\n"
+            "flat in vec4 instanceExtra;\n"
+            "uniform sampler2D mask;\n"
+            "uniform sampler2D icon;\n"
+            "vec4 iconTexture(vec2 iconUV) {\n" // emulates clamping to edge of icon in atlas
+            "   return texture(icon, instanceTextureRect.xy + (clamp(iconUV, 0, 1) * instanceTextureRect.zw));\n"
+            "}\n"
+            "void main() {\n"
+            "   vec4 color = instanceColor;\n"
+            "   vec4 iconColor = instanceSecondColor;\n"
+            "   float penetration = instanceValues.x;\n"
+            "   float alpha = instanceValues.y;\n"
+            "   vec2 iconUVScale = instanceExtra.xy;\n"
+            "   vec2 penetrationUV = ((1 + (0.5 * penetration)) * (uv - 0.5)) + 0.5;\n"
+            "   float penetratioMask = float(all(equal(ivec2(1,1), ivec2(penetrationUV+1))));\n"
+            "   vec3 col = mix(color.rgb / 3, color.rgb, penetratioMask);\n"
+            "   vec2 iconUV = ((1 + (0.5 * penetration)) * iconUVScale * (uv - 0.5)) + 0.5;\n"
+            "   vec4 iconValue = iconColor * iconTexture(iconUV).rgba;\n"
+            "   vec4 final = mix(vec4(col, color.a), vec4(iconValue.rgb, 1), iconValue.a * penetratioMask);\n"
+            "   fragColor = vec4(final.rgb, final.a * texture(mask, uv).r * alpha);\n"
+            "}\n";
+
+        static const char* pInstancedKeyFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "flat in vec4 instanceColor;\n"
+            "flat in vec4 instanceSecondColor;\n"
+            "flat in vec4 instanceValues;\n"
+            "const int innerBorder = 10;\n"
+            "void main() {\n"
+            "   vec4 color = instanceColor;\n"
+            "   vec4 pickColor = instanceSecondColor;\n"
+            "   float pick = instanceValues.x;\n"
+            "   float gradient = length(2*uv-1);\n" // simple gradient as base
+            "   float circle = (1.0-gradient) * 75;\n" // extend gradient to unclamped circle
+            "   float inner = clamp(circle - (pick * innerBorder), 0, 1);\n" // inner circle for character
+            "   float outer = clamp(circle, 0, 1);\n" // outer circle for pick
+            "   vec4 col = color;\n" // color
+            "   vec4 customPickColor = pickColor;\n"
+            "   customPickColor.a *= 0.5;\n" // perpare pick color
+            "   col += pick * customPickColor * (1.0-inner);\n" // add custom pick color
+            "   fragColor = vec4(col.rgb , col.a * outer);\n" // composing pixel
+            "}\n";
+
+        static const char* pInstancedCharacterKeyFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "flat in vec4 instanceColor;\n"
+            "flat in vec4 instanceTextureRect;\n"
+            "uniform sampler2D atlas;\n"
+            "void main() {\n"
+            "   vec4 color = instanceColor;\n"
+            "   float distance = texture(atlas, instanceTextureRect.xy + (uv * instanceTextureRect.zw)).r;\n"
+            "   float smoothing = max(fwidth(distance), 0.0001);\n"
+            "   float value = clamp(((distance - 0.5) / smoothing) + 0.5, 0, 1);\n"
+            "   fragColor = vec4(color.rgb, color.a * value);\n"
+            "}\n";
+    }
+}
+
+#endif // INSTANCED_SHADERS_H_
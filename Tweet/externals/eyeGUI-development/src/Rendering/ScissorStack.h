@@ -46,6 +46,18 @@ namespace eyegui
 			getInstance()->internalInitForDrawing(width, height);
 		}
 
+		// Current scissor box in OpenGL coordinates (x, y, width, height)
+		static glm::ivec4 current()
+		{
+			return getInstance()->mCurrent;
+		}
+
+		// Set current scissor box again, e.g. after drawing with other boxes
+		static void apply()
+		{
+			getInstance()->scissor();
+		}
+
 	private:
 
 		// Struct for rect (origin in upper left corner)
@@ -70,6 +82,7 @@ namespace eyegui
 		{
 			mWindowWidth = 0;
 			mWindowHeight = 0;
+			mCurrent = glm::ivec4(0);
 		}
 
 		// Destructor
@@ -113,7 +126,7 @@ namespace eyegui
 		}
 
 		// Do scissoring
-		void scissor() const
+		void scissor()
 		{
 			// Go over stack and intersect in space with origin in upper left corner
 			int x1 = 0;
@@ -139,7 +152,8 @@ namespace eyegui
 			}
 
 			// Transform to OpenGL space
-			glScissor(x1, mWindowHeight - y2, x2 - x1, y2 - y1);
+			mCurrent = glm::ivec4(x1, mWindowHeight - y2, x2 - x1, y2 - y1);
+			glScissor(mCurrent.x, mCurrent.y, mCurrent.z, mCurrent.w);
 		}
 
 		// Check for instance existence
@@ -160,6 +174,7 @@ namespace eyegui
 		std::vector<Rect> mRects; // stack implemented using vector
 		int mWindowWidth;
 		int mWindowHeight;
+		glm::ivec4 mCurrent; // last set scissor box
 	};
 }
 
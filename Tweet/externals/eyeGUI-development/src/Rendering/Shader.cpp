@@ -7,6 +7,7 @@
 
 #include "Shader.h"
 
+#include "DrawBatcher.h"
 #include "externals/GLM/glm/gtc/type_ptr.hpp"
 #include "src/Utilities/OperationNotifier.h"
 
@@ -14,8 +15,11 @@
 
 namespace eyegui
 {
-    Shader::Shader(char const * const pVertexShaderSource, char const * const pFragmentShaderSource)
+    Shader::Shader(char const * const pVertexShaderSource, char const * const pFragmentShaderSource, DrawBatcher* pDrawBatcher)
     {
+        // Save draw batcher
+        mpDrawBatcher = pDrawBatcher;
+
         // Vertex shader
         GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
         glShaderSource(vertexShader, 1, &pVertexShaderSource, NULL);
@@ -69,6 +73,12 @@ namespace eyegui
 
     void Shader::bind() const
     {
+        // Quads collected so far have to be drawn before anything else
+        if (mpDrawBatcher != NULL)
+        {
+            mpDrawBatcher->flush();
+        }
+
         glUseProgram(mShaderProgram);
     }
 
@@ -17,12 +17,15 @@
 
 namespace eyegui
 {
+    // Forward declaration
+    class DrawBatcher;
+
     class Shader
     {
     public:
 
-        // Constructor
-        Shader(char const * const pVertexShader, char const * const pFragmentShader);
+        // Constructor. Draw batcher is flushed before shader is bound for drawing
+        Shader(char const * const pVertexShader, char const * const pFragmentShader, DrawBatcher* pDrawBatcher = NULL);
 
         // Destructor
         virtual ~Shader();
@@ -48,6 +51,7 @@ namespace eyegui
 
         // Member
         GLuint mShaderProgram;
+        DrawBatcher* mpDrawBatcher;
         std::map<std::string, int> mUniformLocationCache;
     };
 }
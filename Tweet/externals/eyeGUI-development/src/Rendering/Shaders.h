@@ -207,7 +207,9 @@ namespace eyegui
             "uniform float alpha;\n"
             "uniform sampler2D atlas;\n"
             "void main() {\n"
-            "   float character = texture(atlas, uv).r;\n"
+            "   float distance = texture(atlas, uv).r;\n" // signed distance to outline of glyph, 0.5 at outline
+            "   float smoothing = max(fwidth(distance), 0.0001);\n" // change of distance from one pixel to the next
+            "   float character = clamp(((distance - 0.5) / smoothing) + 0.5, 0, 1);\n"
             "   vec4 col = color;\n"
             "   fragColor = vec4(col.rgb, col.a * alpha * character);\n"
             "}\n";
@@ -252,7 +254,9 @@ namespace eyegui
             "uniform vec4 color = vec4(1,0,0,1);\n"
             "uniform sampler2D atlas;\n"
             "void main() {\n"
-            "   float value = texture(atlas, uv).r;\n"
+            "   float distance = texture(atlas, uv).r;\n" // signed distance to outline of glyph, 0.5 at outline
+            "   float smoothing = max(fwidth(distance), 0.0001);\n" // change of distance from one pixel to the next
+            "   float value = clamp(((distance - 0.5) / smoothing) + 0.5, 0, 1);\n"
             "   fragColor = vec4(color.rgb, color.a * value);\n"
             "}\n";
     }
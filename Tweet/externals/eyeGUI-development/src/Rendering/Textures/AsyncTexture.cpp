@@ -0,0 +1,105 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "AsyncTexture.h"
+
+#include "PixelTexture.h"
+
+#include <algorithm>
+
+namespace eyegui
+{
+    AsyncTexture::AsyncTexture(std::string filepath, Filtering filtering, Wrap wrap) : Texture()
+    {
+        // Save members
+        mFilepath = filepath;
+        mFiltering = filtering;
+        mWrap = wrap;
+        mLoaded = false;
+        mFormat = GL_RGBA;
+        mFillTexture = 0;
+        mFilledRows = 0;
+
+        // Transparent placeholder
+        const uchar placeholder[4] = { 0, 0, 0, 0 };
+        createOpenGLTexture(placeholder, Filtering::NEAREST, mWrap, 1, 1, 4, GL_RGBA, GL_RGBA8, false, mFilepath);
+    }
+
+    AsyncTexture::~AsyncTexture()
+    {
+        // Delete unfinished texture
+        glDeleteTextures(1, &mFillTexture);
+    }
+
+    void AsyncTexture::beginFill(DecodedImage image)
+    {
+        // Decide format
+        GLenum glInternalFormat;
+        PixelTexture::chooseFormat(image.channelCount, mFormat, glInternalFormat, mFilepath);
+        mImage = std::move(image);
+        mFilledRows = 0;
+
+        // Allocate texture which is filled row by row
+        glDeleteTextures(1, &mFillTexture);
+        glActiveTexture(GL_TEXTURE0);
+        glGenTextures(1, &mFillTexture);
+        glBindTexture(GL_TEXTURE_2D, mFillTexture);
+        setWrap(mWrap);
+        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, mImage.width, mImage.height, 0, mFormat, GL_UNSIGNED_BYTE, NULL);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    bool AsyncTexture::continueFill(uint pixelCount)
+    {
+        if (mFillTexture == 0)
+        {
+            return mLoaded;
+        }
+
+        // Upload at least one row
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, mFillTexture);
+        uint rowCount = std::max(1u, pixelCount / std::max(1u, mImage.width));
+        rowCount = std::min(rowCount, mImage.height - mFilledRows);
+        if (rowCount > 0)
+        {
+            glTexSubImage2D(
+                GL_TEXTURE_2D,
+                0,
+                0,
+                mFilledRows,
+                mImage.width,
+                rowCount,
+                mFormat,
+                GL_UNSIGNED_BYTE,
+                mImage.pixels.data() + (mFilledRows * mImage.width * mImage.channelCount));
+            mFilledRows += rowCount;
+        }
+
+        // Replace placeholder when all rows are filled
+        if (mFilledRows >= mImage.height)
+        {
+            setFiltering(mFiltering);
+            replaceOpenGLTexture(mFillTexture, mImage.width, mImage.height);
+            mFillTexture = 0;
+            mImage = DecodedImage();
+            mLoaded = true;
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+        return mLoaded;
+    }
+
+    bool AsyncTexture::isLoaded() const
+    {
+        return mLoaded;
+    }
+
+    std::string AsyncTexture::getFilepath() const
+    {
+        return mFilepath;
+    }
+}
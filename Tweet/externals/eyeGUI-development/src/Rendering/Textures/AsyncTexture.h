@@ -0,0 +1,54 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Texture of image file which is decoded by image loader in the background.
+// Until the decoded image is filled in, texture is a transparent placeholder.
+// Filling is split into slices of rows, so big images do not stall a frame.
+
+#ifndef ASYNC_TEXTURE_H_
+#define ASYNC_TEXTURE_H_
+
+#include "Texture.h"
+
+namespace eyegui
+{
+    class AsyncTexture : public Texture
+    {
+    public:
+
+        // Constructor
+        AsyncTexture(std::string filepath, Filtering filtering, Wrap wrap);
+
+        // Destructor
+        virtual ~AsyncTexture();
+
+        // Start to fill decoded image into texture (has to be called on thread with OpenGL context)
+        void beginFill(DecodedImage image);
+
+        // Fill next rows of decoded image up to given count of pixels. Returns whether texture is complete
+        bool continueFill(uint pixelCount);
+
+        // Whether decoded image has been filled in
+        virtual bool isLoaded() const;
+
+        // Getter for path of image file
+        std::string getFilepath() const;
+
+    private:
+
+        // Members
+        std::string mFilepath;
+        Filtering mFiltering;
+        Wrap mWrap;
+        bool mLoaded;
+        DecodedImage mImage;
+        GLenum mFormat;
+        GLuint mFillTexture; // replaces placeholder when complete
+        uint mFilledRows;
+    };
+}
+
+#endif // ASYNC_TEXTURE_H_
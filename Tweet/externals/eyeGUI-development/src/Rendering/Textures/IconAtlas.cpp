@@ -0,0 +1,193 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "IconAtlas.h"
+
+#include "src/Defines.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace eyegui
+{
+    IconAtlas::IconAtlas()
+    {
+        // Pages are added on demand
+    }
+
+    IconAtlas::~IconAtlas()
+    {
+        for (const Page& rPage : mPages)
+        {
+            glDeleteTextures(1, &rPage.texture);
+        }
+    }
+
+    IconAtlas::Region IconAtlas::getRegion(Texture const * pTexture)
+    {
+        // Look up known textures
+        auto it = mRegions.find(pTexture);
+        if (it != mRegions.end())
+        {
+            return it->second;
+        }
+
+        // Try to copy texture into atlas, use own texture otherwise. Placeholders are not remembered
+        Region region;
+        if (!pTexture->isLoaded() || !insert(pTexture, region))
+        {
+            region.texture = pTexture->getHandle();
+            region.rect = glm::vec4(0, 0, 1, 1);
+        }
+        if (pTexture->isLoaded())
+        {
+            mRegions[pTexture] = region;
+        }
+        return region;
+    }
+
+    void IconAtlas::remove(Texture const * pTexture)
+    {
+        // Space in page is not reused
+        mRegions.erase(pTexture);
+    }
+
+    void IconAtlas::prepare()
+    {
+        GLint oldTexture = 0;
+        bool saved = false;
+        for (Page& rPage : mPages)
+        {
+            if (rPage.changed)
+            {
+                if (!saved)
+                {
+                    glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldTexture);
+                    saved = true;
+                }
+                glBindTexture(GL_TEXTURE_2D, rPage.texture);
+                glGenerateMipmap(GL_TEXTURE_2D);
+                rPage.changed = false;
+            }
+        }
+
+        // Restore binding
+        if (saved)
+        {
+            glBindTexture(GL_TEXTURE_2D, oldTexture);
+        }
+    }
+
+    bool IconAtlas::insert(Texture const * pTexture, Region& rRegion)
+    {
+        // Only icons up to maximal size are put into atlas
+        int width = (int)pTexture->getWidth();
+        int height = (int)pTexture->getHeight();
+        if (width <= 0 || height <= 0 || width > ICON_ATLAS_MAX_ICON_SIZE || height > ICON_ATLAS_MAX_ICON_SIZE)
+        {
+            return false;
+        }
+        int paddedWidth = width + 2 * ICON_ATLAS_PADDING;
+        int paddedHeight = height + 2 * ICON_ATLAS_PADDING;
+
+        // Find space in last page, start new shelf or new page if necessary
+        if (mPages.empty())
+        {
+            addPage();
+        }
+        Page* pPage = &(mPages.back());
+        if (pPage->shelfX + paddedWidth > ICON_ATLAS_PAGE_SIZE)
+        {
+            pPage->shelfX = 0;
+            pPage->shelfY += pPage->shelfHeight;
+            pPage->shelfHeight = 0;
+        }
+        if (pPage->shelfY + paddedHeight > ICON_ATLAS_PAGE_SIZE)
+        {
+            if (mPages.size() >= ICON_ATLAS_MAX_PAGES)
+            {
+                return false;
+            }
+            addPage();
+            pPage = &(mPages.back());
+        }
+        int x = pPage->shelfX;
+        int y = pPage->shelfY;
+        pPage->shelfX += paddedWidth;
+        pPage->shelfHeight = std::max(pPage->shelfHeight, paddedHeight);
+
+        // Save current binding as this may be called while drawing
+        GLint oldTexture = 0;
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldTexture);
+
+        // Read pixels of icon
+        std::vector<uchar> pixels(width * height * 4);
+        glBindTexture(GL_TEXTURE_2D, pTexture->getHandle());
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+        // Surround icon by its repeated border pixels
+        std::vector<uchar> paddedPixels(paddedWidth * paddedHeight * 4);
+        for (int i = 0; i < paddedHeight; i++)
+        {
+            int sourceRow = glm::clamp(i - ICON_ATLAS_PADDING, 0, height - 1);
+            for (int j = 0; j < paddedWidth; j++)
+            {
+                int sourceColumn = glm::clamp(j - ICON_ATLAS_PADDING, 0, width - 1);
+                std::memcpy(
+                    &paddedPixels[(i * paddedWidth + j) * 4],
+                    &pixels[(sourceRow * width + sourceColumn) * 4],
+                    4);
+            }
+        }
+
+        // Copy into page
+        glBindTexture(GL_TEXTURE_2D, pPage->texture);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, paddedWidth, paddedHeight, GL_RGBA, GL_UNSIGNED_BYTE, paddedPixels.data());
+        pPage->changed = true;
+
+        // Restore binding
+        glBindTexture(GL_TEXTURE_2D, oldTexture);
+
+        // Fill region
+        float pageSize = (float)ICON_ATLAS_PAGE_SIZE;
+        rRegion.texture = pPage->texture;
+        rRegion.rect = glm::vec4(
+            (x + ICON_ATLAS_PADDING) / pageSize,
+            (y + ICON_ATLAS_PADDING) / pageSize,
+            width / pageSize,
+            height / pageSize);
+        return true;
+    }
+
+    void IconAtlas::addPage()
+    {
+        Page page;
+        page.shelfX = 0;
+        page.shelfY = 0;
+        page.shelfHeight = 0;
+        page.changed = true;
+
+        // Save current binding as this may be called while drawing
+        GLint oldTexture = 0;
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldTexture);
+
+        // Create empty texture
+        std::vector<uchar> emptyPixels(ICON_ATLAS_PAGE_SIZE * ICON_ATLAS_PAGE_SIZE * 4, 0);
+        glGenTextures(1, &page.texture);
+        glBindTexture(GL_TEXTURE_2D, page.texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, ICON_ATLAS_PAGE_SIZE, ICON_ATLAS_PAGE_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, emptyPixels.data());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+
+        // Restore binding
+        glBindTexture(GL_TEXTURE_2D, oldTexture);
+
+        mPages.push_back(page);
+    }
+}
@@ -0,0 +1,72 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Atlas which packs icons into shared textures, so icon elements with different
+// icons can be drawn in one batch. Icons are copied from their own textures at
+// first request and surrounded by repeated border pixels to mimic clamping.
+
+#ifndef ICON_ATLAS_H_
+#define ICON_ATLAS_H_
+
+#include "Texture.h"
+#include "externals/GLM/glm/glm.hpp"
+
+#include <map>
+#include <vector>
+
+namespace eyegui
+{
+    class IconAtlas
+    {
+    public:
+
+        // Region of icon, either in page of atlas or in own texture of icon
+        struct Region
+        {
+            GLuint texture;
+            glm::vec4 rect; // offset (xy) and scale (zw) in texture coordinates
+        };
+
+        // Constructor
+        IconAtlas();
+
+        // Destructor
+        virtual ~IconAtlas();
+
+        // Get region of icon. Icon is copied into atlas at first request if it fits
+        Region getRegion(Texture const * pTexture);
+
+        // Forget texture (has to be called before texture is deleted)
+        void remove(Texture const * pTexture);
+
+        // Create mipmaps of changed pages (call before drawing from atlas)
+        void prepare();
+
+    private:
+
+        // Page of atlas, filled shelf by shelf
+        struct Page
+        {
+            GLuint texture;
+            int shelfX;
+            int shelfY;
+            int shelfHeight;
+            bool changed;
+        };
+
+        // Copy texture into atlas, returns false if no space left
+        bool insert(Texture const * pTexture, Region& rRegion);
+
+        // Add empty page
+        void addPage();
+
+        // Members
+        std::vector<Page> mPages;
+        std::map<Texture const *, Region> mRegions;
+    };
+}
+
+#endif // ICON_ATLAS_H_
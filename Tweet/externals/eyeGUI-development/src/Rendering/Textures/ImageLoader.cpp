@@ -0,0 +1,126 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "ImageLoader.h"
+
+#include "PixelTexture.h"
+#include "VectorTexture.h"
+#include "src/Utilities/PathBuilder.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace eyegui
+{
+    ImageLoader::ImageLoader(uint threadCount, VectorGraphicsCache* pVectorGraphicsCache)
+    {
+        mpVectorGraphicsCache = pVectorGraphicsCache;
+        mStop = false;
+
+        // Start workers
+        for (uint i = 0; i < threadCount; i++)
+        {
+            mThreads.push_back(std::thread(&ImageLoader::work, this));
+        }
+    }
+
+    ImageLoader::~ImageLoader()
+    {
+        // Tell workers to stop and wait for them. Jobs not started are dropped
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mCondition.notify_all();
+        for (std::thread& rThread : mThreads)
+        {
+            rThread.join();
+        }
+    }
+
+    void ImageLoader::enqueue(Job job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mJobs.push_back(job);
+        }
+        mCondition.notify_one();
+    }
+
+    bool ImageLoader::collect(Result& rResult)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mResults.empty())
+        {
+            return false;
+        }
+        rResult = std::move(mResults.front());
+        mResults.pop_front();
+        return true;
+    }
+
+    void ImageLoader::load(const Job& rJob, Result& rResult)
+    {
+        rResult.job = rJob;
+        if (rJob.vectorGraphics)
+        {
+            // Read file
+            std::ifstream in(buildPath(rJob.filepath).c_str(), std::ios::in | std::ios::binary);
+            if (!in)
+            {
+                rResult.success = false;
+                return;
+            }
+            std::stringstream strStream;
+            strStream << in.rdbuf();
+            std::string content = strStream.str();
+            rResult.success = true;
+
+            // Take rasterized graphics from cache or rasterize and cache it
+            uint64_t contentHash = VectorGraphicsCache::hash(content);
+            if (mpVectorGraphicsCache == NULL || !mpVectorGraphicsCache->read(contentHash, rJob.dpi, rResult.image))
+            {
+                VectorTexture::rasterize(&content, rJob.dpi, rResult.image);
+                if (mpVectorGraphicsCache != NULL)
+                {
+                    mpVectorGraphicsCache->write(contentHash, rJob.dpi, rResult.image);
+                }
+            }
+        }
+        else
+        {
+            rResult.success = PixelTexture::decode(rJob.filepath, rJob.suspectedChannels, rResult.image);
+        }
+    }
+
+    void ImageLoader::work()
+    {
+        while (true)
+        {
+            // Wait for job
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mCondition.wait(lock, [this] { return mStop || !mJobs.empty(); });
+                if (mStop)
+                {
+                    return;
+                }
+                job = mJobs.front();
+                mJobs.pop_front();
+            }
+
+            // Load image without holding lock
+            Result result;
+            load(job, result);
+
+            // Hand over result
+            std::lock_guard<std::mutex> lock(mMutex);
+            mResults.push_back(std::move(result));
+        }
+    }
+}
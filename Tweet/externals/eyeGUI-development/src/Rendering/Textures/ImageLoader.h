@@ -0,0 +1,77 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Pool of worker threads which decode image files and rasterize vector
+// graphics. Decoded images are collected on the thread with the OpenGL
+// context, which uploads them into textures. Rasterized vector graphics are
+// taken from cache if available.
+
+#ifndef IMAGE_LOADER_H_
+#define IMAGE_LOADER_H_
+
+#include "Texture.h"
+#include "VectorGraphicsCache.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace eyegui
+{
+    class ImageLoader
+    {
+    public:
+
+        // Image file to load
+        struct Job
+        {
+            std::string filepath;
+            bool vectorGraphics;
+            float dpi; // only used for vector graphics
+            int suspectedChannels; // only used for pixel graphics
+        };
+
+        // Loaded image file
+        struct Result
+        {
+            Job job;
+            bool success;
+            DecodedImage image;
+        };
+
+        // Constructor, cache may be NULL
+        ImageLoader(uint threadCount, VectorGraphicsCache* pVectorGraphicsCache);
+
+        // Destructor, waits for workers
+        virtual ~ImageLoader();
+
+        // Load image file in the background
+        void enqueue(Job job);
+
+        // Take one loaded image if available. Returns whether result was filled
+        bool collect(Result& rResult);
+
+    private:
+
+        // Load image file on calling thread
+        void load(const Job& rJob, Result& rResult);
+
+        // Main loop of workers
+        void work();
+
+        // Members
+        VectorGraphicsCache* mpVectorGraphicsCache;
+        std::vector<std::thread> mThreads;
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        std::deque<Job> mJobs;
+        std::deque<Result> mResults;
+        bool mStop;
+    };
+}
+
+#endif // IMAGE_LOADER_H_
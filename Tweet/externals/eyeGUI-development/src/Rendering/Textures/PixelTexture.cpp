@@ -16,6 +16,8 @@
 
 #include "externals/stb/stb_image.h"
 
+#include <cstring>
+
 namespace eyegui
 {
     PixelTexture::PixelTexture(
@@ -24,15 +26,9 @@ namespace eyegui
 		Wrap wrap,
 		int suspectedChannels) : Texture()
     {
-        // Setup stb_image
-        stbi_set_flip_vertically_on_load(true);
-
         // Try to load image
-        int width, height, channelCount;
-        unsigned char* data = stbi_load(buildPath(filepath).c_str(), &width, &height, &channelCount, suspectedChannels);
-
-        // Check whether file was found and parsed
-        if (data == NULL)
+        DecodedImage image;
+        if (!decode(filepath, suspectedChannels, image))
         {
             throwError(OperationNotifier::Operation::IMAGE_LOADING, "Image file not found or error at parsing", filepath);
         }
@@ -40,32 +36,10 @@ namespace eyegui
 		// Decide format
 		GLenum glFormat;
 		GLenum glInternalFormat;
-		switch (suspectedChannels)
-		{
-		case 1:
-			glFormat = GL_RED;
-			glInternalFormat = GL_R8;
-			break;
-		case 3:
-			glFormat = GL_RGB;
-			glInternalFormat = GL_RGB8;
-			break;
-		case 4:
-			glFormat = GL_RGBA;
-			glInternalFormat = GL_RGBA8;
-			break;
-		default:
-			glFormat= GL_RGB; 
-			glInternalFormat = GL_R8;
-			throwWarning(OperationNotifier::Operation::IMAGE_LOADING, "Unknown number of color channels", filepath);
-			break;
-		}
+		chooseFormat(suspectedChannels, glFormat, glInternalFormat, filepath);
 
         // Create OpenGL texture
-        createOpenGLTexture(data, filtering, wrap, width, height, channelCount, glFormat, glInternalFormat, false, filepath);
-
-        // Delete raw image data
-        stbi_image_free(data);
+        createOpenGLTexture(image.pixels.data(), filtering, wrap, image.width, image.height, image.channelCount, glFormat, glInternalFormat, false, filepath);
     }
 
     PixelTexture::PixelTexture(
@@ -102,4 +76,56 @@ namespace eyegui
     {
         // Nothing to do
     }
+
+    bool PixelTexture::decode(std::string filepath, int suspectedChannels, DecodedImage& rImage)
+    {
+        // Try to load image. Flipping of stb_image is global state, so rows are flipped here
+        int width, height, channelCount;
+        unsigned char* data = stbi_load(buildPath(filepath).c_str(), &width, &height, &channelCount, suspectedChannels);
+
+        // Check whether file was found and parsed
+        if (data == NULL)
+        {
+            return false;
+        }
+
+        // Copy rows from bottom to top
+        rImage.width = (uint)width;
+        rImage.height = (uint)height;
+        rImage.channelCount = suspectedChannels > 0 ? (uint)suspectedChannels : (uint)channelCount;
+        uint rowSize = rImage.width * rImage.channelCount;
+        rImage.pixels.resize(rowSize * rImage.height);
+        for (uint i = 0; i < rImage.height; i++)
+        {
+            std::memcpy(&rImage.pixels[i * rowSize], &data[(rImage.height - 1 - i) * rowSize], rowSize);
+        }
+
+        // Delete raw image data
+        stbi_image_free(data);
+        return true;
+    }
+
+    void PixelTexture::chooseFormat(int channelCount, GLenum& rFormat, GLenum& rInternalFormat, std::string filepath)
+    {
+		switch (channelCount)
+		{
+		case 1:
+			rFormat = GL_RED;
+			rInternalFormat = GL_R8;
+			break;
+		case 3:
+			rFormat = GL_RGB;
+			rInternalFormat = GL_RGB8;
+			break;
+		case 4:
+			rFormat = GL_RGBA;
+			rInternalFormat = GL_RGBA8;
+			break;
+		default:
+			rFormat = GL_RGB;
+			rInternalFormat = GL_R8;
+			throwWarning(OperationNotifier::Operation::IMAGE_LOADING, "Unknown number of color channels", filepath);
+			break;
+		}
+    }
 }
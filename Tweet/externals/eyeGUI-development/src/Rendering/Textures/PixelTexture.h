@@ -35,6 +35,12 @@ namespace eyegui
 
         // Destructor
         virtual ~PixelTexture();
+
+        // Decode image file, may be called from any thread. Returns whether successful
+        static bool decode(std::string filepath, int suspectedChannels, DecodedImage& rImage);
+
+        // Choose OpenGL format for count of channels
+        static void chooseFormat(int channelCount, GLenum& rFormat, GLenum& rInternalFormat, std::string filepath);
     };
 }
 
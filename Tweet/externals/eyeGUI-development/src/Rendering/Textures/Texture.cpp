@@ -51,6 +51,16 @@ namespace eyegui
         return ((float)mWidth) / ((float)mHeight);
     }
 
+    GLuint Texture::getHandle() const
+    {
+        return mTexture;
+    }
+
+    bool Texture::isLoaded() const
+    {
+        return true;
+    }
+
     void Texture::createOpenGLTexture(unsigned char const * pData, Filtering filtering, Wrap wrap, uint width, uint height, uint channelCount, GLenum format, GLenum internalFormat, bool flipY, std::string filepath)
     {
         // Save members
@@ -71,6 +81,35 @@ namespace eyegui
         glBindTexture(GL_TEXTURE_2D, mTexture);
 
         // Wrapping
+        setWrap(wrap);
+
+        // Load it to GPU
+		if (flipY)
+		{
+			glTexImage2D(GL_TEXTURE_2D, 0, internalFormat , mWidth, mHeight, 0, format, GL_UNSIGNED_BYTE, flippedData.data());
+		}
+		else
+		{
+			glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, mWidth, mHeight, 0, format, GL_UNSIGNED_BYTE, pData);
+		}
+
+        // Filtering
+        setFiltering(filtering);
+
+        // Unbind texture
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    void Texture::replaceOpenGLTexture(GLuint texture, uint width, uint height)
+    {
+        glDeleteTextures(1, &mTexture);
+        mTexture = texture;
+        mWidth = width;
+        mHeight = height;
+    }
+
+    void Texture::setWrap(Wrap wrap)
+    {
         switch (wrap)
         {
         case Wrap::CLAMP:
@@ -90,18 +129,10 @@ namespace eyegui
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
             break;
         }
+    }
 
-        // Load it to GPU
-		if (flipY)
-		{
-			glTexImage2D(GL_TEXTURE_2D, 0, internalFormat , mWidth, mHeight, 0, format, GL_UNSIGNED_BYTE, flippedData.data());
-		}
-		else
-		{
-			glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, mWidth, mHeight, 0, format, GL_UNSIGNED_BYTE, pData);
-		}
-
-        // Filtering
+    void Texture::setFiltering(Filtering filtering)
+    {
         switch (filtering)
         {
         case Filtering::LINEAR:
@@ -114,9 +145,6 @@ namespace eyegui
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
             break;
         }
-
-        // Unbind texture
-        glBindTexture(GL_TEXTURE_2D, 0);
     }
 
 	void Texture::flipPixelsY(unsigned char const * pData, unsigned char* pFlippedData, uint width, uint height, uint channelCount) const
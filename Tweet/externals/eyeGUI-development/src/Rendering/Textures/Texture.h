@@ -19,6 +19,15 @@
 
 namespace eyegui
 {
+    // Pixels of decoded image with rows from bottom to top
+    struct DecodedImage
+    {
+        uint width = 0;
+        uint height = 0;
+        uint channelCount = 0;
+        std::vector<uchar> pixels;
+    };
+
     class Texture
     {
     public:
@@ -49,11 +58,26 @@ namespace eyegui
         // Getter for aspect ratio
         float getAspectRatio() const;
 
+        // Getter for OpenGL handle
+        GLuint getHandle() const;
+
+        // Whether content is final, placeholders are replaced later
+        virtual bool isLoaded() const;
+
     protected:
 
         // Create OpenGL texture (something like initialization)
 		void createOpenGLTexture(unsigned char const * pData, Filtering filtering, Wrap wrap, uint width, uint height, uint channelCount, GLenum format, GLenum internalFormat, bool flipY, std::string filepath);
 
+        // Take over other OpenGL texture and delete current one
+        void replaceOpenGLTexture(GLuint texture, uint width, uint height);
+
+        // Set wrapping of bound texture
+        static void setWrap(Wrap wrap);
+
+        // Set filtering of bound texture, generates mipmaps for linear filtering
+        static void setFiltering(Filtering filtering);
+
 		// Flip pixels vertically
 		void flipPixelsY(unsigned char const * pData, unsigned char* pFlippedData, uint width, uint height, uint channelCount) const;
 
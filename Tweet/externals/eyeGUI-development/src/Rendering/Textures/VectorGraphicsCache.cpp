@@ -0,0 +1,266 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "VectorGraphicsCache.h"
+
+#include "src/Utilities/OperationNotifier.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace eyegui
+{
+    VectorGraphicsCache::VectorGraphicsCache(std::string filepath, uint maxBytes)
+    {
+        // Save members
+        mFilepath = filepath;
+        mMaxBytes = maxBytes;
+        mGeneration = 0;
+        mEnd = sizeof(FileHeader);
+        mBytes = 0;
+        mCompact = false;
+
+        // Start new file if existing one cannot be used
+        if (!readEntries())
+        {
+            mEntries.clear();
+            mGeneration = 0;
+            mEnd = sizeof(FileHeader);
+            mBytes = 0;
+            mCompact = false;
+            std::ofstream out(mFilepath.c_str(), std::ios::binary | std::ios::trunc);
+            FileHeader header;
+            std::memcpy(header.magic, VECTOR_GRAPHICS_CACHE_MAGIC.data(), sizeof(header.magic));
+            header.version = VECTOR_GRAPHICS_CACHE_VERSION;
+            header.generation = mGeneration;
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            if (!out.good())
+            {
+                throwWarning(OperationNotifier::Operation::IMAGE_LOADING, "Cache of vector graphics could not be created", mFilepath);
+                return;
+            }
+        }
+
+        // Keep file open for reading and appending entries
+        mFile.open(mFilepath.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+
+        // Save generation
+        mFile.seekp(offsetof(FileHeader, generation));
+        mFile.write(reinterpret_cast<const char*>(&mGeneration), sizeof(mGeneration));
+        mFile.flush();
+    }
+
+    VectorGraphicsCache::~VectorGraphicsCache()
+    {
+        // Evict least recently used entries
+        if (mFile.is_open() && (mCompact || mBytes > (std::streamoff)mMaxBytes))
+        {
+            compact();
+        }
+    }
+
+    bool VectorGraphicsCache::read(uint64_t contentHash, float dpi, DecodedImage& rImage)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        // Look for entry
+        uint32_t dpiBits;
+        std::memcpy(&dpiBits, &dpi, sizeof(dpiBits));
+        auto it = mEntries.find(std::make_pair(contentHash, dpiBits));
+        if (it == mEntries.end() || !mFile.is_open())
+        {
+            return false;
+        }
+        Entry& rEntry = it->second;
+
+        // Read pixels directly into image
+        rImage.width = rEntry.header.width;
+        rImage.height = rEntry.header.height;
+        rImage.channelCount = 4;
+        rImage.pixels.resize(rImage.width * rImage.height * rImage.channelCount);
+        mFile.seekg(rEntry.offset + (std::streamoff)sizeof(EntryHeader));
+        mFile.read(reinterpret_cast<char*>(rImage.pixels.data()), rImage.pixels.size());
+        if (!mFile.good())
+        {
+            // Forget broken entry
+            mFile.clear();
+            mEntries.erase(it);
+            mCompact = true;
+            return false;
+        }
+
+        // Remember usage
+        if (rEntry.header.lastUse != mGeneration)
+        {
+            rEntry.header.lastUse = mGeneration;
+            mFile.seekp(rEntry.offset + (std::streamoff)offsetof(EntryHeader, lastUse));
+            mFile.write(reinterpret_cast<const char*>(&mGeneration), sizeof(mGeneration));
+            mFile.flush();
+        }
+        return true;
+    }
+
+    void VectorGraphicsCache::write(uint64_t contentHash, float dpi, const DecodedImage& rImage)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        // Only images as rasterized are cached
+        if (!mFile.is_open() || rImage.channelCount != 4 || rImage.pixels.size() != rImage.width * rImage.height * 4)
+        {
+            return;
+        }
+
+        // Check whether already cached
+        Entry entry;
+        entry.header.contentHash = contentHash;
+        std::memcpy(&entry.header.dpi, &dpi, sizeof(entry.header.dpi));
+        auto key = std::make_pair(entry.header.contentHash, entry.header.dpi);
+        if (mEntries.find(key) != mEntries.end())
+        {
+            return;
+        }
+
+        // Append entry to file
+        entry.header.width = rImage.width;
+        entry.header.height = rImage.height;
+        entry.header.lastUse = mGeneration;
+        entry.offset = mEnd;
+        mFile.seekp(mEnd);
+        mFile.write(reinterpret_cast<const char*>(&entry.header), sizeof(entry.header));
+        mFile.write(reinterpret_cast<const char*>(rImage.pixels.data()), rImage.pixels.size());
+        mFile.flush();
+        if (!mFile.good())
+        {
+            mFile.clear();
+            mCompact = true;
+            return;
+        }
+
+        // Remember entry
+        mEntries[key] = entry;
+        mEnd += getEntrySize(entry.header);
+        mBytes += getEntrySize(entry.header);
+    }
+
+    uint64_t VectorGraphicsCache::hash(const std::string& rContent)
+    {
+        // FNV-1a
+        uint64_t value = 14695981039346656037ull;
+        for (char c : rContent)
+        {
+            value ^= (uint64_t)(unsigned char)c;
+            value *= 1099511628211ull;
+        }
+        return value;
+    }
+
+    bool VectorGraphicsCache::readEntries()
+    {
+        std::ifstream in(mFilepath.c_str(), std::ios::binary | std::ios::ate);
+        if (!in.is_open())
+        {
+            return false;
+        }
+        std::streamoff fileSize = in.tellg();
+        in.seekg(0);
+
+        // Check header
+        FileHeader fileHeader;
+        in.read(reinterpret_cast<char*>(&fileHeader), sizeof(fileHeader));
+        if (!in.good()
+            || std::memcmp(fileHeader.magic, VECTOR_GRAPHICS_CACHE_MAGIC.data(), sizeof(fileHeader.magic)) != 0
+            || fileHeader.version != VECTOR_GRAPHICS_CACHE_VERSION)
+        {
+            return false;
+        }
+        mGeneration = fileHeader.generation + 1;
+
+        // Go over entries and skip their pixels
+        std::streamoff offset = sizeof(FileHeader);
+        while (offset + (std::streamoff)sizeof(EntryHeader) <= fileSize)
+        {
+            Entry entry;
+            entry.offset = offset;
+            in.seekg(offset);
+            in.read(reinterpret_cast<char*>(&entry.header), sizeof(entry.header));
+            std::streamoff size = getEntrySize(entry.header);
+            if (!in.good() || offset + size > fileSize)
+            {
+                break;
+            }
+            mEntries[std::make_pair(entry.header.contentHash, entry.header.dpi)] = entry;
+            mBytes += size;
+            offset += size;
+        }
+
+        // Incomplete entry at end is overwritten by next one and removed at closing
+        mEnd = offset;
+        mCompact = offset != fileSize;
+        return true;
+    }
+
+    void VectorGraphicsCache::compact()
+    {
+        // Sort entries from most to least recently used
+        std::vector<Entry const *> entries;
+        for (const auto& rPair : mEntries)
+        {
+            entries.push_back(&rPair.second);
+        }
+        std::stable_sort(entries.begin(), entries.end(), [](Entry const * a, Entry const * b) { return a->header.lastUse > b->header.lastUse; });
+
+        // Write new file next to current one
+        std::string temporaryFilepath = mFilepath + ".tmp";
+        std::ofstream out(temporaryFilepath.c_str(), std::ios::binary | std::ios::trunc);
+        FileHeader fileHeader;
+        std::memcpy(fileHeader.magic, VECTOR_GRAPHICS_CACHE_MAGIC.data(), sizeof(fileHeader.magic));
+        fileHeader.version = VECTOR_GRAPHICS_CACHE_VERSION;
+        fileHeader.generation = mGeneration;
+        out.write(reinterpret_cast<const char*>(&fileHeader), sizeof(fileHeader));
+
+        // Copy entries as long as they fit
+        std::streamoff bytes = 0;
+        std::vector<char> buffer;
+        for (Entry const * pEntry : entries)
+        {
+            std::streamoff size = getEntrySize(pEntry->header);
+            if (bytes + size > (std::streamoff)mMaxBytes)
+            {
+                continue;
+            }
+            buffer.resize((size_t)size);
+            mFile.seekg(pEntry->offset);
+            mFile.read(buffer.data(), size);
+            if (!mFile.good())
+            {
+                mFile.clear();
+                continue;
+            }
+            out.write(buffer.data(), size);
+            bytes += size;
+        }
+
+        // Replace current file
+        out.close();
+        mFile.close();
+        if (out.fail())
+        {
+            std::remove(temporaryFilepath.c_str());
+            return;
+        }
+        std::remove(mFilepath.c_str());
+        std::rename(temporaryFilepath.c_str(), mFilepath.c_str());
+    }
+
+    std::streamoff VectorGraphicsCache::getEntrySize(const EntryHeader& rHeader)
+    {
+        return (std::streamoff)sizeof(EntryHeader) + ((std::streamoff)rHeader.width * (std::streamoff)rHeader.height * 4);
+    }
+}
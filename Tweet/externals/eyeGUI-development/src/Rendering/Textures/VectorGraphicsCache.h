@@ -0,0 +1,93 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Persistent cache of rasterized vector graphics, so icons are not rasterized
+// again at every start. Entries are identified by hash of file content and
+// dpi. All entries are stored in one file, each as small header followed by
+// pixels as they are uploaded to OpenGL. Least recently used entries are
+// evicted when file is closed and bigger than allowed.
+
+#ifndef VECTOR_GRAPHICS_CACHE_H_
+#define VECTOR_GRAPHICS_CACHE_H_
+
+#include "Texture.h"
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+
+namespace eyegui
+{
+    class VectorGraphicsCache
+    {
+    public:
+
+        // Constructor, opens or creates cache file
+        VectorGraphicsCache(std::string filepath, uint maxBytes);
+
+        // Destructor, evicts entries and closes cache file
+        virtual ~VectorGraphicsCache();
+
+        // Read rasterized graphics, may be called from any thread. Returns whether found
+        bool read(uint64_t contentHash, float dpi, DecodedImage& rImage);
+
+        // Store rasterized graphics, may be called from any thread
+        void write(uint64_t contentHash, float dpi, const DecodedImage& rImage);
+
+        // Hash of file content
+        static uint64_t hash(const std::string& rContent);
+
+    private:
+
+        // Header of cache file
+        struct FileHeader
+        {
+            char magic[4];
+            uint32_t version;
+            uint32_t generation; // incremented at each opening of file
+        };
+
+        // Header of entry in cache file, followed by pixels
+        struct EntryHeader
+        {
+            uint64_t contentHash;
+            uint32_t dpi; // bits of float
+            uint32_t width;
+            uint32_t height;
+            uint32_t lastUse; // generation of last usage
+        };
+
+        // Entry in memory
+        struct Entry
+        {
+            std::streamoff offset;
+            EntryHeader header;
+        };
+
+        // Read entries of existing file. Returns whether file is valid
+        bool readEntries();
+
+        // Write new file with most recently used entries within maximal size
+        void compact();
+
+        // Size of entry in file including its header
+        static std::streamoff getEntrySize(const EntryHeader& rHeader);
+
+        // Members
+        std::string mFilepath;
+        uint mMaxBytes;
+        std::mutex mMutex;
+        std::fstream mFile;
+        uint32_t mGeneration;
+        std::map<std::pair<uint64_t, uint32_t>, Entry> mEntries;
+        std::streamoff mEnd; // where next entry is written
+        std::streamoff mBytes; // size of all entries
+        bool mCompact; // whether file contains garbage
+    };
+}
+
+#endif // VECTOR_GRAPHICS_CACHE_H_
@@ -21,6 +21,34 @@
 namespace eyegui
 {
     VectorTexture::VectorTexture(std::string filepath, Filtering filtering, Wrap wrap, float dpi) : Texture()
+    {
+        // Parse and rasterize file
+        DecodedImage image;
+        if (!rasterize(filepath, dpi, image))
+        {
+            throwError(OperationNotifier::Operation::IMAGE_LOADING, "Graphics file not found or error while parsing", filepath);
+        }
+
+        // Create OpenGL texture
+        createOpenGLTexture(image.pixels.data(), filtering, wrap, image.width, image.height, image.channelCount, GL_RGBA, GL_RGBA, false, filepath);
+    }
+
+    VectorTexture::VectorTexture(std::string const * pGraphic, Filtering filtering, Wrap wrap, float dpi)
+    {
+        // Parse and rasterize graphics
+        DecodedImage image;
+        rasterize(pGraphic, dpi, image);
+
+        // Create OpenGL texture
+        createOpenGLTexture(image.pixels.data(), filtering, wrap, image.width, image.height, image.channelCount, GL_RGBA, GL_RGBA, false, "");
+    }
+
+    VectorTexture::~VectorTexture()
+    {
+        // Nothing to do
+    }
+
+    bool VectorTexture::rasterize(std::string filepath, float dpi, DecodedImage& rImage)
     {
         // Parse file
         NSVGimage* svg = nsvgParseFromFile(buildPath(filepath).c_str(), "px", dpi);
@@ -28,37 +56,38 @@ namespace eyegui
         // Check whether file found and parsed
         if (svg == NULL)
         {
-            throwError(OperationNotifier::Operation::IMAGE_LOADING, "Graphics file not found or error while parsing", filepath);
+            return false;
         }
 
-        // Rasterize it and create OpenGL texture
-        rasterizeGraphics(svg, filtering, wrap, filepath);
+        // Rasterize it
+        rasterize(svg, rImage);
 
         // Delete graphics
         nsvgDelete(svg);
+        return true;
     }
 
-    VectorTexture::VectorTexture(std::string const * pGraphic, Filtering filtering, Wrap wrap, float dpi)
+    void VectorTexture::rasterize(std::string const * pGraphic, float dpi, DecodedImage& rImage)
     {
-        // Parse graphics
+        // Parse graphics, NanoSVG modifies the string while parsing
         char* str = static_cast<char*>(malloc(sizeof(char) * pGraphic->size() + 1));
         strcpy(str, pGraphic->data());
         NSVGimage* svg = nsvgParse(str, "px", dpi);
         free(str);
+        if (svg == NULL)
+        {
+            rImage = DecodedImage();
+            return;
+        }
 
-        // Rasterize it and create OpenGL texture
-        rasterizeGraphics(svg, filtering, wrap, "");
+        // Rasterize it
+        rasterize(svg, rImage);
 
         // Delete graphics
         nsvgDelete(svg);
     }
 
-    VectorTexture::~VectorTexture()
-    {
-        // Nothing to do
-    }
-
-    void VectorTexture::rasterizeGraphics(NSVGimage* svg, Filtering filtering, Wrap wrap, std::string filepath)
+    void VectorTexture::rasterize(NSVGimage* svg, DecodedImage& rImage)
     {
         uint width = (uint)(svg->width);
         uint height = (uint)(svg->height);
@@ -67,15 +96,15 @@ namespace eyegui
         // Create rasterizer
         NSVGrasterizer* rast = nsvgCreateRasterizer();
 
-        // Prepare memory for image
-        std::vector<uchar> image;
-        image.resize(width * height * channelCount);
-
-        // Rasterize
-        nsvgRasterize(rast, svg, 0, 0, 1, image.data(), width, height, width * channelCount);
-
-        // Create OpenGL from image
-		createOpenGLTexture(image.data(), filtering, wrap, width, height, channelCount, GL_RGBA, GL_RGBA, true, filepath);
+        // Rasterize with negative stride, so rows are stored from bottom to top as OpenGL expects
+        rImage.width = width;
+        rImage.height = height;
+        rImage.channelCount = channelCount;
+        rImage.pixels.resize(width * height * channelCount);
+        if (height > 0)
+        {
+            nsvgRasterize(rast, svg, 0, 0, 1, rImage.pixels.data() + ((height - 1) * width * channelCount), width, height, -(int)(width * channelCount));
+        }
 
         // Delete NanoSVG stuff
         nsvgDeleteRasterizer(rast);
@@ -28,10 +28,16 @@ namespace eyegui
         // Destructor
         virtual ~VectorTexture();
 
+        // Parse and rasterize graphics file, may be called from any thread. Returns whether successful
+        static bool rasterize(std::string filepath, float dpi, DecodedImage& rImage);
+
+        // Parse and rasterize internal graphics
+        static void rasterize(std::string const * pGraphic, float dpi, DecodedImage& rImage);
+
     private:
 
-        // Rasterize
-        void rasterizeGraphics(NSVGimage* svg, Filtering filtering, Wrap wrap, std::string filepath);
+        // Rasterize parsed graphics into image with rows from bottom to top
+        static void rasterize(NSVGimage* svg, DecodedImage& rImage);
 
     };
 }
@@ -15,9 +15,44 @@
 #include <fstream>
 #include <algorithm>
 #include <sstream>
+#include <queue>
+#include <tuple>
 
 namespace eyegui
 {
+    Dictionary::Search::Search()
+    {
+        mpDictionary = NULL;
+    }
+
+    Dictionary::Search::State::State(
+        Node const * pNode,
+        int remainingInputRepeatIgnores,
+        int remainingInputRepeatPauses,
+        int remainingInputPauses,
+        int remainingInputIgnores,
+        bool mayAddLongerWords)
+    {
+        this->pNode = pNode;
+        this->remainingInputRepeatIgnores = remainingInputRepeatIgnores;
+        this->remainingInputRepeatPauses = remainingInputRepeatPauses;
+        this->remainingInputPauses = remainingInputPauses;
+        this->remainingInputIgnores = remainingInputIgnores;
+        this->mayAddLongerWords = mayAddLongerWords;
+    }
+
+    bool Dictionary::Search::State::operator<(const State& rOther) const
+    {
+        return std::tie(pNode, remainingInputRepeatIgnores, remainingInputRepeatPauses, remainingInputPauses, remainingInputIgnores, mayAddLongerWords)
+            < std::tie(rOther.pNode, rOther.remainingInputRepeatIgnores, rOther.remainingInputRepeatPauses, rOther.remainingInputPauses, rOther.remainingInputIgnores, rOther.mayAddLongerWords);
+    }
+
+    bool Dictionary::Search::State::operator==(const State& rOther) const
+    {
+        return std::tie(pNode, remainingInputRepeatIgnores, remainingInputRepeatPauses, remainingInputPauses, remainingInputIgnores, mayAddLongerWords)
+            == std::tie(rOther.pNode, rOther.remainingInputRepeatIgnores, rOther.remainingInputRepeatPauses, rOther.remainingInputPauses, rOther.remainingInputIgnores, rOther.mayAddLongerWords);
+    }
+
     Dictionary::Dictionary(std::string filepath)
     {
         // Read file with instream
@@ -37,15 +72,17 @@ namespace eyegui
             // Streamline line endings
             streamlineLineEnding(content, true);
 
-            // Add words to dictionary
+            // Add words to dictionary, line of word is its rank
             std::string delimiter = "\n";
+            size_t start = 0;
             size_t pos = 0;
+            uint rank = 0;
             std::string line;
-            while ((pos = content.find(delimiter)) != std::string::npos)
+            while ((pos = content.find(delimiter, start)) != std::string::npos)
             {
                 // Extract line
-                line = content.substr(0, pos);
-                content.erase(0, pos + delimiter.length());
+                line = content.substr(start, pos - start);
+                start = pos + delimiter.length();
 
                 // Convert line to utf-16 string
                 if (!(line.empty()))
@@ -54,7 +91,7 @@ namespace eyegui
                     if(convertUTF8ToUTF16(line, line16))
                     {
                         // Add word to dictionary
-                        addWord(line16);
+                        addWord(line16, rank++);
                     }
                     else
                     {
@@ -118,119 +155,188 @@ namespace eyegui
         }
     }
 
-    std::vector<std::u16string> Dictionary::similarWords(const std::u16string& rWord, bool makeFirstLetterUpperCase) const
+    bool Dictionary::similarWords(
+        const std::u16string& rWord,
+        bool makeFirstLetterUpperCase,
+        uint maxCount,
+        Search& rSearch,
+        std::atomic<bool> const * pCancel,
+        std::vector<std::u16string>& rSimilarWords) const
     {
+        rSimilarWords.clear();
+
         // Convert to lower case
         std::u16string lowerWord = rWord;
         convertToLower(lowerWord); // state is not necessary to remember
         uint wordLength = (uint)rWord.size();
 
-        // Create set to collect results
-        std::set<std::u16string> resultSet;
-
-        // Search for given word, ignore identical letters in one row
-        fuzzyWordSearch(
-            lowerWord,
-            DICTIONARY_INPUT_REPEAT_IGNORE_DEPTH,
-            DICTIONARY_INPUT_REPEAT_PAUSE_DEPTH,
-            DICTIONARY_INPUT_PAUSE_DEPTH,
-            DICTIONARY_INPUT_IGNORE_DEPTH,
-            resultSet);
+        // Start over when search was used with other dictionary
+        if (rSearch.mpDictionary != this)
+        {
+            rSearch = Search();
+            rSearch.mpDictionary = this;
+        }
 
-        // Save size of result set
-        int sizeOfResultSet = (int)resultSet.size();
+        // Search starts at root, ignore identical letters in one row
+        if (rSearch.mFrontiers.empty())
+        {
+            rSearch.mFrontiers.push_back(
+                std::vector<Search::State>(
+                    1,
+                    Search::State(
+                        NULL,
+                        (int)DICTIONARY_INPUT_REPEAT_IGNORE_DEPTH,
+                        (int)DICTIONARY_INPUT_REPEAT_PAUSE_DEPTH,
+                        (int)DICTIONARY_INPUT_PAUSE_DEPTH,
+                        (int)DICTIONARY_INPUT_IGNORE_DEPTH,
+                        true)));
+        }
 
-        // Only continue when necessary
-        std::vector<std::u16string> resultVector;
-        if(sizeOfResultSet > 0)
+        // Keep states of prefix which input has in common with previous one
+        uint prefixLength = 0;
+        while (prefixLength < (uint)rSearch.mInput.size()
+            && prefixLength < wordLength
+            && rSearch.mInput[prefixLength] == lowerWord[prefixLength])
         {
-            // Rate results by word distance
-            int distance;
-            std::vector<std::pair<std::u16string, int> > sortedResults;
-            sortedResults.reserve(sizeOfResultSet);
-            std::u16string comparsionWord = lowerWord;
-            firstCharacterToUpper(comparsionWord);
-            for(const std::u16string& rFoundWord : resultSet)
+            prefixLength++;
+        }
+        rSearch.mInput.resize(prefixLength);
+        rSearch.mFrontiers.resize(prefixLength + 1);
+        rSearch.mDeadStates.erase(
+            std::remove_if(
+                rSearch.mDeadStates.begin(),
+                rSearch.mDeadStates.end(),
+                [&](const Search::DeadState& rDeadState) { return rDeadState.inputIndex >= prefixLength; }),
+            rSearch.mDeadStates.end());
+
+        // Consume remaining letters of input
+        for (uint i = prefixLength; i < wordLength; i++)
+        {
+            if (!continueSearch(lowerWord[i], rSearch, pCancel))
             {
-                // Determine common size of both words to not discriminate appended letters
-                uint commonLength = std::min(wordLength, (uint)rFoundWord.size());
-
-                // Use input with possible first upper letter as comparsion
-                // Since in the structure is only the case of the first letter saved
-                distance = (int)levenshteinSSE::levenshtein(
-                    comparsionWord.begin(), comparsionWord.begin() + commonLength,
-                    rFoundWord.begin(), rFoundWord.begin() + commonLength);
-
-                // Build up structure with found word and distance to searched one
-                sortedResults.push_back(std::make_pair(rFoundWord, distance));
+                return false;
             }
+        }
 
-            // Sort the built structure
-            std::sort(
-                sortedResults.begin(),
-                sortedResults.end(),
-                [&comparsionWord](const std::pair<std::u16string, int>& left, const std::pair<std::u16string, int>& right)
+        // Collect nodes of found words. Decision whether here is a word is done below
+        std::vector<Node const *> foundNodes;
+        for (const Search::State& rState : rSearch.mFrontiers.back())
+        {
+            // Only continue, if some node from map was chosen
+            if (rState.pNode != NULL)
+            {
+                // Add current word since no letters in input are left. This constraint means, that no words
+                // shorter than input can be added (but words like "Aaal" because of DICTIONARY_INPUT_REPEAT_IGNORE_DEPTH)
+                foundNodes.push_back(rState.pNode);
+
+                // Add words which have the collected word as prefix, if wished
+                if (rState.mayAddLongerWords)
                 {
-                    // Collect information
-                    int distanceLeft = left.second;
-                    int distanceRight = right.second;
-                    bool leftFirstIdentical = false;
-                    bool leftLastIdentical = false;
-                    bool rightFirstIdentical = false;
-                    bool rightLastIdentical = false;
-
-                    if (!comparsionWord.empty())
-                    {
-                        if (!left.first.empty())
-                        {
-                            leftFirstIdentical = left.first.front() == comparsionWord.front();
-                            leftLastIdentical = left.first.back() == comparsionWord.back();
-                        }
-                        if (!right.first.empty())
-                        {
-                            rightFirstIdentical = right.first.front() == comparsionWord.front();
-                            rightLastIdentical = right.first.back() == comparsionWord.back();
-                        }
-                    }
+                    addLongerWords(*rState.pNode, DICTIONARY_MAX_FOLLOWING_WORDS, foundNodes);
+                }
+            }
+        }
+        for (const Search::DeadState& rDeadState : rSearch.mDeadStates)
+        {
+            // Only add if remaining input pauses are enough to compensate extra letters
+            if ((int)wordLength - (int)(rDeadState.inputIndex + 1) < rDeadState.remainingInputPauses)
+            {
+                foundNodes.push_back(rDeadState.pNode);
+            }
+        }
+        std::sort(foundNodes.begin(), foundNodes.end());
+        foundNodes.erase(std::unique(foundNodes.begin(), foundNodes.end()), foundNodes.end());
 
-                    // Decide which word is the better suggestion (just some random stuff which looks good)
-                    if (leftFirstIdentical && leftLastIdentical)
-                    {
-                        // Integer division
-                        distanceLeft /= 2;
-                    }
-                    if (rightFirstIdentical && rightLastIdentical)
-                    {
-                        // Integer division
-                        distanceRight /= 2;
-                    }
+        // Rate results by word distance
+        struct RatedWord
+        {
+            std::u16string word;
+            int distance;
+            uint rank;
+        };
+        std::vector<RatedWord> ratedWords;
+        std::u16string comparsionWord = lowerWord;
+        firstCharacterToUpper(comparsionWord);
+        auto rateWord = [&](const std::u16string& rFoundWord, uint rank)
+        {
+            // Determine common size of both words to not discriminate appended letters
+            uint commonLength = std::min(wordLength, (uint)rFoundWord.size());
+
+            // Use input with possible first upper letter as comparsion
+            // Since in the structure is only the case of the first letter saved
+            int distance = (int)levenshteinSSE::levenshtein(
+                comparsionWord.begin(), comparsionWord.begin() + commonLength,
+                rFoundWord.begin(), rFoundWord.begin() + commonLength);
+
+            // Prefer words with identical first and last letter (just some random stuff which looks good)
+            if (!comparsionWord.empty() && !rFoundWord.empty()
+                && rFoundWord.front() == comparsionWord.front()
+                && rFoundWord.back() == comparsionWord.back())
+            {
+                // Integer division
+                distance /= 2;
+            }
 
-                    return distanceLeft < distanceRight;
-                });
+            // Build up structure with found word, its distance to searched one and its frequency
+            RatedWord ratedWord;
+            ratedWord.word = rFoundWord;
+            ratedWord.distance = distance;
+            ratedWord.rank = rank;
+            ratedWords.push_back(ratedWord);
+        };
+        uint checkCount = 0;
+        for (Node const * pNode : foundNodes)
+        {
+            // Check for cancellation now and then
+            if (pCancel != NULL && (++checkCount % DICTIONARY_CANCEL_CHECK_INTERVAL) == 0 && pCancel->load())
+            {
+                return false;
+            }
 
-            // Copy results to final vector
-            resultVector.reserve(sizeOfResultSet);
-            std::transform(
-                sortedResults.begin(),
-                sortedResults.end(),
-                std::back_inserter(resultVector),
-                [](const std::pair<std::u16string, int>& item)
+            // Add word in cases it has been added to dictionary
+            if (pNode->wordState != WordState::NONE)
+            {
+                std::u16string foundWord = collectWord(pNode);
+                if (pNode->wordState == WordState::LOWER_START || pNode->wordState == WordState::BOTH_STARTS)
                 {
-                    return item.first;
-                });
+                    rateWord(foundWord, pNode->rank);
+                }
+                if (pNode->wordState == WordState::UPPER_START || pNode->wordState == WordState::BOTH_STARTS)
+                {
+                    firstCharacterToUpper(foundWord);
+                    rateWord(foundWord, pNode->rank);
+                }
+            }
+        }
 
-            // Make first letter upper case if wished
-            if(makeFirstLetterUpperCase)
+        // Sort best words by distance and then by frequency
+        uint count = std::min(maxCount, (uint)ratedWords.size());
+        std::partial_sort(
+            ratedWords.begin(),
+            ratedWords.begin() + count,
+            ratedWords.end(),
+            [](const RatedWord& rLeft, const RatedWord& rRight)
             {
-                std::for_each(resultVector.begin(), resultVector.end(), firstCharacterToUpper);
-            }
+                return std::tie(rLeft.distance, rLeft.rank, rLeft.word) < std::tie(rRight.distance, rRight.rank, rRight.word);
+            });
+
+        // Copy results to final vector
+        rSimilarWords.reserve(count);
+        for (uint i = 0; i < count; i++)
+        {
+            rSimilarWords.push_back(ratedWords[i].word);
         }
 
-        // Return what you have
-        return resultVector;
+        // Make first letter upper case if wished
+        if (makeFirstLetterUpperCase)
+        {
+            std::for_each(rSimilarWords.begin(), rSimilarWords.end(), firstCharacterToUpper);
+        }
+
+        return true;
     }
 
-    void Dictionary::addWord(const std::u16string& rWord)
+    void Dictionary::addWord(const std::u16string& rWord, uint rank)
     {
         // Convert to lower case and remember it
         std::u16string lowerWord = rWord;
@@ -253,18 +359,26 @@ namespace eyegui
             if (it == pMap->end())
             {
                 // Add it to map and go on
-                pMap->insert(std::make_pair(c, Node()));
+                it = pMap->insert(std::make_pair(c, Node())).first;
+                it->second.pParent = pNode;
+                it->second.letter = c;
             }
 
             // Remember current node and new map
-            pNode = &(pMap->at(c));
+            pNode = &(it->second);
             pMap = &(pNode->children);
+
+            // Word is in subtree of each node on its way
+            pNode->bestRank = std::min(pNode->bestRank, rank);
         }
 
         // Set word state in last letter of word, seen from root
         // NONE is initial value
         if (pNode != NULL)
         {
+            // Most frequent occurence counts
+            pNode->rank = std::min(pNode->rank, rank);
+
             if (pNode->wordState == WordState::NONE)
             {
                 // First occurence, use given case
@@ -292,247 +406,166 @@ namespace eyegui
         return wordState;
     }
 
-    void Dictionary::fuzzyWordSearch(
-        const std::u16string& rInput,
-        uint inputRepeatIgnoreDepth,
-        uint inputRepeatPauseDepth,
-        uint inputPauseDepth,
-        uint inputIgnoreDepth,
-        std::set<std::u16string>& rFoundWords) const
+    bool Dictionary::continueSearch(char16_t letter, Search& rSearch, std::atomic<bool> const * pCancel) const
     {
-        // Just pipe it (start the recursion)
-        fuzzyWordSearch(
-            rInput,
-            0,
-            u"",
-            NULL,
-            (int)inputRepeatIgnoreDepth,
-            (int)inputRepeatPauseDepth,
-            (int)inputPauseDepth,
-            (int)inputIgnoreDepth,
-            true,
-            rFoundWords);
-    }
+        // Index of letter in input
+        uint i = (uint)rSearch.mInput.size();
+
+        // States before letter, which grow by states not consuming the letter
+        std::vector<Search::State> states = rSearch.mFrontiers.back();
+        std::vector<Search::State> nextStates;
+        std::vector<Search::DeadState> deadStates;
+        for (uint j = 0; j < (uint)states.size(); j++)
+        {
+            // Check for cancellation now and then
+            if (pCancel != NULL && (j % DICTIONARY_CANCEL_CHECK_INTERVAL) == 0 && pCancel->load())
+            {
+                return false;
+            }
 
-    void Dictionary::fuzzyWordSearch(
-        const std::u16string& rInput,
-        uint inputStartIndex,
-        std::u16string collectedWord,
-        Node const * pNode,
-        int remainingInputRepeatIgnores,
-        int remainingInputRepeatPauses,
-        int remainingInputPauses,
-        int reaminingInputIgnores,
-        bool mayAddLongerWords,
-        std::set<std::u16string>& rFoundWords) const
-    {
-        // Pointer to root map as fallback
-        NodeMap const * pMap = &mRootMap;
+            // Copy state since vector may grow
+            const Search::State state = states[j];
 
-        // Get pointer to map provided by node
-        if (pNode != NULL)
-        {
-            // Use the the map given in node
-            pMap = &(pNode->children);
-        }
+            // Use map of node or root map as fallback
+            NodeMap const * pMap = state.pNode != NULL ? &(state.pNode->children) : &mRootMap;
 
-        // Consume letters from start index of input word
-        uint count = (uint)rInput.size();
-        uint i = inputStartIndex; // Must be visible outside of loop
-        for (; i < count; i++)
-        {
             // Suspect input to be incomplete ("Hus" -> "Haus")
-            if(remainingInputPauses > 0)
+            if (state.remainingInputPauses > 0)
             {
-                for(const auto& rCharNode : *pMap)
+                for (const auto& rCharNode : *pMap)
                 {
-                    fuzzyWordSearch(
-                        rInput,
-                        i,
-                        collectedWord + rCharNode.first,
-                        &(rCharNode.second),
-                        0,
-                        0,
-                        remainingInputPauses - 1,
-                        reaminingInputIgnores,
-                        false,
-                        rFoundWords);
+                    states.push_back(
+                        Search::State(
+                            &(rCharNode.second),
+                            0,
+                            0,
+                            state.remainingInputPauses - 1,
+                            state.remainingInputIgnores,
+                            false));
                 }
             }
 
             // Ignore some input ("Huus" -> "Haus")
-            if(reaminingInputIgnores > 0)
+            if (state.remainingInputIgnores > 0)
             {
                 // Just ignore given letter from input, add letter from map and go on
-                for(const auto& rCharNode : *pMap)
+                for (const auto& rCharNode : *pMap)
                 {
-                    fuzzyWordSearch(
-                        rInput,
-                        i + 1,
-                        collectedWord + rCharNode.first,
-                        &(rCharNode.second),
-                        0,
-                        0,
-                        remainingInputPauses,
-                        reaminingInputIgnores - 1,
-                        false,
-                        rFoundWords);
+                    nextStates.push_back(
+                        Search::State(
+                            &(rCharNode.second),
+                            0,
+                            0,
+                            state.remainingInputPauses,
+                            state.remainingInputIgnores - 1,
+                            false));
                 }
             }
 
-            // Current letter
-            const char16_t& c = rInput[i];
-
             // "Aaal" -> "Aal" should be found (too many letters)
-            if (i > 0 && remainingInputRepeatIgnores > 0 && c == rInput[i-1])
+            if (i > 0 && state.remainingInputRepeatIgnores > 0 && letter == rSearch.mInput[i - 1])
             {
-                fuzzyWordSearch(
-                    rInput,
-                    i + 1,
-                    collectedWord,
-                    pNode,
-                    remainingInputRepeatIgnores -1,
-                    remainingInputRepeatPauses,
-                    remainingInputPauses,
-                    reaminingInputIgnores,
-                    mayAddLongerWords,
-                    rFoundWords);
+                Search::State nextState = state;
+                nextState.remainingInputRepeatIgnores--;
+                nextStates.push_back(nextState);
             }
 
             // Try to find letter in current map
-            NodeMap::const_iterator it = pMap->find(c);
+            NodeMap::const_iterator it = pMap->find(letter);
             if (it == pMap->end())
             {
-                // Next character was not found. Only add to found words if
+                // Next character was not found. Word of node may be added at the end, if
                 // remaining input pauses are enough to compensate extra letters
-                if(pNode != NULL && (int)count - (int)(i+1) < remainingInputPauses)
+                if (state.pNode != NULL && state.remainingInputPauses > 0)
                 {
-                    // Decision whether here is a node is done in add method
-                    addFuzzyWord(collectedWord, pNode->wordState, rFoundWords);
+                    Search::DeadState deadState;
+                    deadState.pNode = state.pNode;
+                    deadState.inputIndex = i;
+                    deadState.remainingInputPauses = state.remainingInputPauses;
+                    deadStates.push_back(deadState);
                 }
-
-				// Return from this recursion
-                return;
             }
             else
             {
-                // Some node was found since iterator not at end of map, so remember that
-                pNode = &(it->second);
-
-                // Add letter to collected word
-                collectedWord += c;
+                // Some node was found since iterator not at end of map, so go on with it
+                Search::State nextState = state;
+                nextState.pNode = &(it->second);
+                nextStates.push_back(nextState);
 
-                // "Al" -> "Aal" should be found  (not enough letters, repeating ones missing)
-                if(remainingInputRepeatPauses > 0)
+                // "Al" -> "Aal" should be found (not enough letters, repeating ones missing)
+                if (state.remainingInputRepeatPauses > 0)
                 {
-                    fuzzyWordSearch(
-                        rInput,
-                        i,
-                        collectedWord,
-                        pNode,
-                        remainingInputRepeatIgnores,
-                        remainingInputRepeatPauses - 1,
-                        remainingInputPauses,
-                        reaminingInputIgnores,
-                        mayAddLongerWords,
-                        rFoundWords);
+                    nextState.remainingInputRepeatPauses--;
+                    states.push_back(nextState);
                 }
-
-				// Prepare next iteration
-				pMap = &(pNode->children);
             }
         }
 
-		// Only continue, if some node from map was chosen
-		if (pNode != NULL)
-		{
-			// Add current word when no letters in input are left
-			if (i >= count)
-			{
-				// Adds word to found words
-				addFuzzyWord(collectedWord, pNode->wordState, rFoundWords);
-
-				// This constraint means, that no words shorter than input can be added
-				// (but words like "Aaal" because of DICTIONARY_INPUT_REPEAT_IGNORE_DEPTH)
-			}
-
-			// Add words which have the collected word as prefix, if wished
-			if (mayAddLongerWords)
-			{
-				addLongerWords(collectedWord, *pNode, DICTIONARY_MAX_FOLLOWING_WORDS, rFoundWords);
-			}
-		}
+        // Same states may be reached in different ways
+        std::sort(nextStates.begin(), nextStates.end());
+        nextStates.erase(std::unique(nextStates.begin(), nextStates.end()), nextStates.end());
+
+        // Remember states after letter
+        rSearch.mInput += letter;
+        rSearch.mFrontiers.push_back(std::move(nextStates));
+        rSearch.mDeadStates.insert(rSearch.mDeadStates.end(), deadStates.begin(), deadStates.end());
+        return true;
     }
 
-    int Dictionary::addLongerWords(
-        const std::u16string& rCollectedWord,
-        const Node& rNode,
-        int remainingWords,
-        std::set<std::u16string>& rFoundWords) const
+    void Dictionary::addLongerWords(const Node& rNode, uint count, std::vector<Node const *>& rFoundNodes) const
     {
-        if(remainingWords > 0) // should be not necessary
+        // Entry is either word of node or subtree of node, ordered by rank
+        struct Entry
         {
-            // Go over children of node and add all words until "remainingWords" counter is too low
-            for(const auto& rNodeMapEntry : rNode.children)
+            uint rank;
+            Node const * pNode;
+            bool word;
+            bool operator>(const Entry& rOther) const { return rank > rOther.rank; }
+        };
+
+        // Best first search through subtrees of children, which have at least one word
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> > entries;
+        auto addSubtrees = [&](const Node& rParent)
+        {
+            for (const auto& rNodeMapEntry : rParent.children)
             {
-                // Collected word
-                std::u16string collectedWord = rCollectedWord + rNodeMapEntry.first;
-
-                // Word is only added if here is one (checked by addFuzzyWord method)
-                if(addFuzzyWord(collectedWord, rNodeMapEntry.second.wordState, rFoundWords))
+                Entry entry = { rNodeMapEntry.second.bestRank, &(rNodeMapEntry.second), false };
+                entries.push(entry);
+            }
+        };
+        addSubtrees(rNode);
+        while (count > 0 && !entries.empty())
+        {
+            Entry entry = entries.top();
+            entries.pop();
+            if (entry.word)
+            {
+                // No other word in remaining subtrees is more frequent
+                rFoundNodes.push_back(entry.pNode);
+                count--;
+            }
+            else
+            {
+                // Split subtree into word of node and subtrees of children
+                if (entry.pNode->wordState != WordState::NONE)
                 {
-                    remainingWords--;
+                    Entry wordEntry = { entry.pNode->rank, entry.pNode, true };
+                    entries.push(wordEntry);
                 }
-
-                // Break out of for loop when no more words should be added
-                if(remainingWords <= 0) { break; }
-
-                // Do some recursion
-                remainingWords = addLongerWords(collectedWord, rNodeMapEntry.second, remainingWords, rFoundWords);
-
-                // Break out of for loop when no more words should be added
-                if(remainingWords <= 0) { break; }
+                addSubtrees(*(entry.pNode));
             }
         }
-
-        // Return how many words may be added further
-        return remainingWords;
     }
 
-    bool Dictionary::addFuzzyWord(const std::u16string& rCollectedWord, WordState collectedState, std::set<std::u16string>& rFoundWords) const
+    std::u16string Dictionary::collectWord(Node const * pNode) const
     {
-        switch (collectedState)
-        {
-        case WordState::BOTH_STARTS:
-        {
-            // Make version with upper case
-            std::u16string collectedWordUpper = rCollectedWord;
-            firstCharacterToUpper(collectedWordUpper);
-
-            // Add both cases
-            rFoundWords.insert(collectedWordUpper);
-            rFoundWords.insert(rCollectedWord);
-            return true;
-        }
-        case WordState::UPPER_START:
-        {
-            // Add upper case word
-            std::u16string collectedWordUpper = rCollectedWord;
-            firstCharacterToUpper(collectedWordUpper);
-            rFoundWords.insert(collectedWordUpper);
-            return true;
-        }
-        case WordState::LOWER_START:
+        // Go up to root and reverse collected letters
+        std::u16string word;
+        for (; pNode != NULL; pNode = pNode->pParent)
         {
-            // Add lower case word
-            rFoundWords.insert(rCollectedWord);
-            return true;
-        }
-        default:
-        {
-            // No word added
-            return false;
-        }
+            word += pNode->letter;
         }
+        std::reverse(word.begin(), word.end());
+        return word;
     }
 }
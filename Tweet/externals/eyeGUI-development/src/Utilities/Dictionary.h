@@ -5,9 +5,11 @@
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
 // Dictionary class storing given words of an arbitrary language in a prefix
-// tree structure. Some fuzzy word search with recursion is used to find
-// similar words to input. Found words are ordered by levenshtein distance
-// to original input word.
+// tree structure. Fuzzy word search finds similar words to input. It runs
+// letter by letter over the input and remembers the states reached before
+// each letter, so a search can be continued when letters are appended.
+// Found words are ordered by levenshtein distance to original input word
+// and by frequency, which is given by the order of words in the file.
 
 #ifndef DICTIONARY_H_
 #define DICTIONARY_H_
@@ -16,14 +18,70 @@
 
 #include <string>
 #include <vector>
-#include <set>
+#include <map>
+#include <atomic>
+#include <limits>
 
 namespace eyegui
 {
     class Dictionary
     {
+    private:
+
+        // Inner struct for node, defined below
+        struct Node;
+
     public:
 
+        // State of fuzzy search, which is continued by similar words for input sharing a prefix with previous one
+        class Search
+        {
+        public:
+
+            // Constructor
+            Search();
+
+        private:
+
+            friend class Dictionary;
+
+            // State of search before a letter of input is consumed
+            struct State
+            {
+                State(
+                    Node const * pNode,
+                    int remainingInputRepeatIgnores,
+                    int remainingInputRepeatPauses,
+                    int remainingInputPauses,
+                    int remainingInputIgnores,
+                    bool mayAddLongerWords);
+
+                bool operator<(const State& rOther) const;
+                bool operator==(const State& rOther) const;
+
+                Node const * pNode; // NULL for root
+                int remainingInputRepeatIgnores; // How many repeating letters of input can be ("Aaal" -> "Aal")
+                int remainingInputRepeatPauses; // How many repeating letters can be added by algorithm ("Al" -> "Aal")
+                int remainingInputPauses; // How many letters in a word could be missing ("Hus" -> "Haus")
+                int remainingInputIgnores; // How many letters in a word are possible wrong ("Huus" -> "Haus")
+                bool mayAddLongerWords; // Whether longer words, using collected as prefix, should be included
+            };
+
+            // State which found no node for letter of input. Its word is added when remaining pauses compensate rest of input
+            struct DeadState
+            {
+                Node const * pNode;
+                uint inputIndex;
+                int remainingInputPauses;
+            };
+
+            // Members
+            Dictionary const * mpDictionary; // dictionary of nodes in states
+            std::u16string mInput; // lower case input consumed so far
+            std::vector<std::vector<State> > mFrontiers; // states before each letter of input and after last one
+            std::vector<DeadState> mDeadStates;
+        };
+
         // Constructor
         Dictionary(std::string filepath);
 
@@ -33,56 +91,49 @@ namespace eyegui
         // Check for exact word
         bool checkForWord(const std::u16string& rWord) const;
 
-        // Give similar words sorted by probability.
-        // First letter can be made upper case for example for beginning of sentences
-        std::vector<std::u16string> similarWords(const std::u16string& rWord, bool makeFirstLetterUpperCase) const;
+        // Give at most max count similar words sorted by probability. First letter can be made upper case
+        // for example for beginning of sentences. Search is continued from common prefix with its previous
+        // input. Returns false without suggestions when cancelled, search stays usable then
+        bool similarWords(
+            const std::u16string& rWord,
+            bool makeFirstLetterUpperCase,
+            uint maxCount,
+            Search& rSearch,
+            std::atomic<bool> const * pCancel,
+            std::vector<std::u16string>& rSimilarWords) const;
 
     private:
 
         // Some typedef for the map
-        struct Node;
         typedef std::map<char16_t, Node> NodeMap;
 
         // Possible states for word, using 1 byte char as structure. None is used for "here is no word"
         enum class WordState : char { NONE, LOWER_START, UPPER_START, BOTH_STARTS };
 
-        // Add single word to dictionary
-        void addWord(const std::u16string& rWord);
+        // Add single word to dictionary. Rank is position of word in file
+        void addWord(const std::u16string& rWord, uint rank);
 
         // Convert to lower case. Returns word state
         WordState convertToLower(std::u16string& rWord) const;
 
-        // Fuzzy search for words. Takes lower case word as input
-        void fuzzyWordSearch(
-            const std::u16string& rInput,
-            uint inputRepeatIgnoreDepth,
-            uint inputRepeatPauseDepth,
-            uint inputPauseDepth,
-            uint inputIgnoreDepth,
-            std::set<std::u16string>& rFoundWords) const;
-        void fuzzyWordSearch(
-            const std::u16string& rInputWord,
-            uint inputStartIndex,
-            std::u16string collectedWord,
-            Node const * pNode,
-            int remainingInputRepeatIgnores, // How many repeating letters of input can be ("Aaal" -> "Aal")
-            int remainingInputRepeatPauses, // How many repeating letters can be added by algorithm ("Al" -> "Aal")
-            int remainingInputPauses, // How many letters in a word could be missing ("Hus" -> "Haus")
-            int reaminingInputIgnores, // How many letters in a word are possible wrong ("Huus" -> "Haus")
-            bool mayAddLongerWords, // Whether longer words, using collected as prefix, should be included
-            std::set<std::u16string>& rFoundWords) const;
-
-        // Add longer words which use collected word as prefix. One word can be lower and upper case, counted as one. Returns how many further words may be added
-        int addLongerWords(const std::u16string& rCollectedWord, const Node& rNode, int remainingWords, std::set<std::u16string>& rFoundWords) const;
-
-        // Add fuzzy word to found words in fuzzy search. Returns whether successful
-        bool addFuzzyWord(const std::u16string& rCollectedWord, WordState collectedState, std::set<std::u16string>& rFoundWords) const;
+        // Consume next letter of input by last states of search. Returns false when cancelled
+        bool continueSearch(char16_t letter, Search& rSearch, std::atomic<bool> const * pCancel) const;
+
+        // Add nodes of most frequent longer words which use word of node as prefix
+        void addLongerWords(const Node& rNode, uint count, std::vector<Node const *>& rFoundNodes) const;
+
+        // Collect word of node from root to node
+        std::u16string collectWord(Node const * pNode) const;
 
         // Inner struct for node. Represented letter is implicit coded in map entry which stores node. Buildung up a tree by reusing existing nodes
         struct Node
         {
             NodeMap children; // Further possible letters to form other words
             WordState wordState = WordState::NONE; // State of word formed by letters from root to here
+            Node const * pParent = NULL; // Node of previous letter, NULL for first letter
+            char16_t letter = 0; // Letter represented by node
+            uint rank = std::numeric_limits<uint>::max(); // Rank of word formed by letters from root to here, lower is more frequent
+            uint bestRank = std::numeric_limits<uint>::max(); // Best rank of all words in subtree including this node
         };
 
         // Members
@@ -9,6 +9,8 @@
 
 #include "externals/utf8rewind/include/utf8rewind/utf8rewind.h"
 
+#include <sys/stat.h>
+
 namespace eyegui
 {
     // ### HELPER HELPERS ###
@@ -379,4 +381,14 @@ namespace eyegui
             rInput += u"\n";
         }
     }
+
+    std::time_t getFileModificationTime(std::string filepath)
+    {
+        struct stat fileStatus;
+        if (stat(filepath.c_str(), &fileStatus) != 0)
+        {
+            return 0;
+        }
+        return fileStatus.st_mtime;
+    }
 }
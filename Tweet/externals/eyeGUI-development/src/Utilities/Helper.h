@@ -14,6 +14,7 @@
 
 #include <string>
 #include <algorithm>
+#include <ctime>
 
 namespace eyegui
 {
@@ -44,6 +45,9 @@ namespace eyegui
     // Streamline LF, CR and CR+LF endings to LF
     void streamlineLineEnding(std::string& rInput, bool addNewLineAtEnd = false);
     void streamlineLineEnding(std::u16string& rInput, bool addNewLineAtEnd = false);
+
+    // Returns time of last modification of file or zero if it cannot be accessed
+    std::time_t getFileModificationTime(std::string filepath);
 }
 
 #endif // HELPER_H_
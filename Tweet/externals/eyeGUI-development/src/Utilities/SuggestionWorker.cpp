@@ -0,0 +1,123 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "SuggestionWorker.h"
+
+namespace eyegui
+{
+    SuggestionWorker::SuggestionWorker() : mCancel(false)
+    {
+        mRequestId = 0;
+        mRequested = false;
+        mPending = false;
+        mFinished = false;
+        mStop = false;
+
+        // Start worker
+        mThread = std::thread(&SuggestionWorker::work, this);
+    }
+
+    SuggestionWorker::~SuggestionWorker()
+    {
+        // Tell worker to stop and wait for it
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+            mCancel = true;
+        }
+        mCondition.notify_one();
+        mThread.join();
+    }
+
+    void SuggestionWorker::request(std::u16string input, Dictionary const * pDictionary, bool makeFirstLetterUpperCase, uint maxCount)
+    {
+        {
+            // Replace waiting request and cancel running one
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRequest.input = input;
+            mRequest.pDictionary = pDictionary;
+            mRequest.makeFirstLetterUpperCase = makeFirstLetterUpperCase;
+            mRequest.maxCount = maxCount;
+            mRequestId++;
+            mRequested = true;
+            mPending = true;
+            mFinished = false;
+            mCancel = true;
+        }
+        mCondition.notify_one();
+    }
+
+    void SuggestionWorker::cancel()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mRequestId++;
+        mRequested = false;
+        mPending = false;
+        mFinished = false;
+        mCancel = true;
+    }
+
+    bool SuggestionWorker::pending() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mPending;
+    }
+
+    bool SuggestionWorker::collect(std::vector<std::u16string>& rSuggestions)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mFinished)
+        {
+            return false;
+        }
+        rSuggestions = std::move(mSuggestions);
+        mSuggestions.clear();
+        mPending = false;
+        mFinished = false;
+        return true;
+    }
+
+    void SuggestionWorker::work()
+    {
+        while (true)
+        {
+            // Wait for request
+            Request request;
+            uint requestId = 0;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mCondition.wait(lock, [this] { return mStop || mRequested; });
+                if (mStop)
+                {
+                    return;
+                }
+                request = mRequest;
+                requestId = mRequestId;
+                mRequested = false;
+                mCancel = false;
+            }
+
+            // Search without lock, may be cancelled by newer request
+            std::vector<std::u16string> suggestions;
+            bool completed = request.pDictionary->similarWords(
+                request.input,
+                request.makeFirstLetterUpperCase,
+                request.maxCount,
+                mSearch,
+                &mCancel,
+                suggestions);
+
+            // Drop suggestions of outdated request
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (completed && requestId == mRequestId)
+            {
+                mSuggestions = std::move(suggestions);
+                mFinished = true;
+            }
+        }
+    }
+}
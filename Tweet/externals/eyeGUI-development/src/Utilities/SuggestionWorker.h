@@ -0,0 +1,75 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Worker thread which searches dictionaries for similar words. Only the
+// latest request matters, so a new request cancels the running search and
+// results of older requests are dropped. The search is kept between requests
+// and continued when input shares a prefix with the previous one.
+
+#ifndef SUGGESTION_WORKER_H_
+#define SUGGESTION_WORKER_H_
+
+#include "src/Utilities/Dictionary.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace eyegui
+{
+    class SuggestionWorker
+    {
+    public:
+
+        // Constructor
+        SuggestionWorker();
+
+        // Destructor, cancels search and waits for worker
+        virtual ~SuggestionWorker();
+
+        // Search similar words in the background. Dictionary must live until search is done
+        void request(std::u16string input, Dictionary const * pDictionary, bool makeFirstLetterUpperCase, uint maxCount);
+
+        // Cancel latest request
+        void cancel();
+
+        // Whether suggestions of latest request are not yet collected
+        bool pending() const;
+
+        // Take suggestions of latest request if available. Returns whether suggestions were filled
+        bool collect(std::vector<std::u16string>& rSuggestions);
+
+    private:
+
+        // Search to do
+        struct Request
+        {
+            std::u16string input;
+            Dictionary const * pDictionary;
+            bool makeFirstLetterUpperCase;
+            uint maxCount;
+        };
+
+        // Main loop of worker
+        void work();
+
+        // Members
+        std::thread mThread;
+        mutable std::mutex mMutex;
+        std::condition_variable mCondition;
+        Request mRequest;
+        uint mRequestId; // id of latest request
+        bool mRequested; // whether latest request is waiting for worker
+        bool mPending; // whether suggestions of latest request are not collected
+        bool mFinished; // whether suggestions of latest request are available
+        std::vector<std::u16string> mSuggestions;
+        std::atomic<bool> mCancel;
+        bool mStop;
+        Dictionary::Search mSearch; // only used by worker
+    };
+}
+
+#endif // SUGGESTION_WORKER_H_
@@ -24,8 +24,11 @@ namespace eyegui
             height,
             fontFilepath,
             characterSet,
+            prewarmGlyphs,
             localizationFilepath,
             vectorGraphicsDPI,
+            vectorGraphicsCacheFilepath,
+            vectorGraphicsCacheSize,
             fontTallSize,
             fontMediumSize,
             fontSmallSize,
@@ -101,6 +104,11 @@ namespace eyegui
         pGUI->prefetchImage(filepath);
     }
 
+    void prefetchImagesOfFile(GUI* pGUI, std::string filepath)
+    {
+        pGUI->prefetchImagesOfFile(filepath);
+    }
+
     unsigned int addDictionary(GUI* pGUI, std::string filepath)
     {
         return pGUI->addDictionary(filepath);
@@ -356,14 +364,12 @@ namespace eyegui
 
     void suggestWords(Layout* pLayout, std::string id, std::u16string input, unsigned int dictionaryIndex)
     {
-        std::u16string bestSuggestion;
-        pLayout->suggestWords(id, input, dictionaryIndex, bestSuggestion);
+        pLayout->suggestWords(id, input, dictionaryIndex);
     }
 
     void suggestWords(Layout* pLayout, std::string id, std::string input, unsigned int dictionaryIndex)
     {
-        std::string bestSuggestion;
-        pLayout->suggestWords(id, input, dictionaryIndex, bestSuggestion);
+        pLayout->suggestWords(id, input, dictionaryIndex);
     }
 
     void suggestWords(Layout* pLayout, std::string id, std::u16string input, unsigned int dictionaryIndex, std::u16string& rBestSuggestion)